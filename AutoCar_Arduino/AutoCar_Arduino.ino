@@ -1,9 +1,23 @@
 // This is code for Arduino UNO R4 Wifi
 #include <Servo.h>       // Library for controlling servo motors. This is a standard library.
-#include <NewPing.h>     // Library for ultrasonic sensor support. You need to install this library.
+#include <FspTimer.h>    // Hardware timers of the UNO R4 (part of the board package)
 #include <Arduino.h>     // Basic Arduino library
+#include "car_protocol.h" // Binary command frames from the ESP32 CAM
+#include "drive_mix.h"    // Joystick mixing and ramping for CAR_CMD_DRIVE
+#include "auto_drive.h"   // Obstacle avoidance state machine of the automatic mode
 bool isAutoMode = false;  // Set to true when testing automatic mode (Auto Mode)
 
+car_parser_t commandParser;  // Receive state machine for command frames from Serial1
+uint8_t commandSpeed = 0;    // Speed requested by the last manual drive command, 0 = default speed
+int readCommand();           // Read the next command from Serial1 without blocking
+
+//===========Camera obstacle cue===========
+// In automatic mode the ESP32 CAM sends CAR_CMD_VISION frames about 10 times per second,
+// the thresholds for using them are in auto_drive.h
+int8_t visionSteer = 0;          // Last steering hint, -100 (left) .. 100 (right)
+uint8_t visionClear = 255;       // Last free space straight ahead
+unsigned long visionTime = 0;    // millis() of the last cue
+
 //==========LED Matrix for Arduino UNO R4 WIFI==========
 #include "Arduino_LED_Matrix.h"
 ArduinoLEDMatrix matrix;  // LED matrix control object
@@ -23,41 +37,121 @@ void MoveBack();     // Function to move backward
 void SpinLeft();     // Function to turn left
 void SpinRight();    // Function to turn right
 void Stop();         // Function to stop the car
+int ManualSpeed(int defaultSpeed);  // Speed requested by the last command, or the default speed
+
+//===========Proportional drive===========
+// While the joystick of the web page is held, the ESP32 CAM sends CAR_CMD_DRIVE frames (throttle and
+// steering) every 50 ms. They are mixed into a speed for each side that ramps by at most DRIVE_ACCEL per
+// step, and the motors stop if no frame came for CAR_DRIVE_LEASE_MS (page closed, WiFi lost).
+// Both motors share EN (every PWM pin is taken), so EN runs at the faster side's speed and the
+// slower side is switched on for only part of every DRIVE_SLOTS ms.
+// The mixing itself is in drive_mix.h (DRIVE_SLOTS of 1 ms = 100 Hz, DRIVE_ACCEL per step = 0 to full in about 0.2 s).
+#define DRIVE_STEP_MS 10          // Period of the job ramping the speeds and checking the lease
+#define DRIVE_SLOT_MS 1           // Period of the job switching the slower side on and off
+int8_t driveThrottle = 0;         // Axes of the last CAR_CMD_DRIVE frame, -127..127
+int8_t driveSteer = 0;
+bool driveActive = false;         // The motors follow the joystick
+unsigned long driveTime = 0;      // millis() of the last CAR_CMD_DRIVE frame
+int driveTarget[2] = { 0, 0 };    // Mixed speed of each side, -127..127
+int driveSpeed[2] = { 0, 0 };     // Ramped speed of each side
+int drivePwm[2] = { 0, 0 };       // PWM of each side, negative = backwards
+int driveSlowSide = DRIVE_LEFT;   // Side switched on for driveSlowSlots slots only
+int driveSlowSlots = DRIVE_SLOTS;
+int driveSlot = 0;
+void DriveTo(int throttle, int steer);  // Set the target speeds from a joystick position
+void DriveRelease();                    // Hand the motors back to the other commands
 
 //===========Ultrasonic sensor HC-SR04 (Front sensor)===========
 #define trig_pin_1 8                                           // Front sensor trigger pin
 #define echo_pin_1 7                                           // Front sensor echo pin
 #define maximum_distance 200                                   // Maximum measurable distance (cm)
-#define stop_car_distance 30                                   // Car stop distance (cm)
-#define stop_car_distance_side 30                              // Car stop distance when side sensor detects an object
 int F_distance = 100;                                          // Variable to store the distance measured by the front sensor
-NewPing sonarFront(trig_pin_1, echo_pin_1, maximum_distance);  // Front sensor control object
+unsigned long F_time = 0;                                      // millis() of the last front reading
 
 //===========Ultrasonic sensor HC-SR04 (Right sensor)===========
 #define trig_pin_2 4                                           // Right sensor trigger pin
 #define echo_pin_2 5                                           // Right sensor echo pin
 int R_distance = 100;                                          // Variable to store the distance measured by the right sensor
-NewPing sonarRight(trig_pin_2, echo_pin_2, maximum_distance);  // Right sensor control object
+unsigned long R_time = 0;                                      // millis() of the last right reading
 
 //===========Ultrasonic sensor HY-SRF05 (Left sensor)===========
 #define trig_pin_3 2                                          // Left sensor trigger pin
 #define echo_pin_3 3                                          // Left sensor echo pin
 int L_distance = 100;                                         // Variable to store the distance measured by the left sensor
-NewPing sonarLeft(trig_pin_3, echo_pin_3, maximum_distance);  // Left sensor control object
+unsigned long L_time = 0;                                     // millis() of the last left reading
+
+//===========Background sonar sampling===========
+// loop() triggers the sensors in turn and a timer interrupt times the echo in the background,
+// the same way NewPing's ping_timer() does (NewPing's timer methods do not support the UNO R4).
+// Like NewPing, the timer is started with each ping and stopped when the echo ends or times out,
+// so the 24 us interrupt does not run while no ping is in flight
+#define SONAR_COUNT 3
+#define SONAR_FRONT 0
+#define SONAR_RIGHT 1
+#define SONAR_LEFT 2
+#define US_ROUNDTRIP_CM 57                                      // Echo time for 1 cm (same as NewPing)
+#define SONAR_TIMER_US 24                                       // Echo pin check period, same resolution as NewPing
+#define SONAR_TIMEOUT_US (maximum_distance * US_ROUNDTRIP_CM + 6000)  // Give up on echoes from beyond maximum_distance
+#define SONAR_PING_SPACING_MS 12                                // Minimum time between two pings, lets the previous echo die out
+const uint8_t sonarTrigPins[SONAR_COUNT] = { trig_pin_1, trig_pin_2, trig_pin_3 };
+const uint8_t sonarEchoPins[SONAR_COUNT] = { echo_pin_1, echo_pin_2, echo_pin_3 };
+FspTimer sonarTimer;                    // Timer running the echo check interrupt, only while a ping is in flight
+volatile bool sonarBusy = false;        // A ping is in flight, the interrupt is timing it
+volatile bool sonarEchoHigh = false;    // The echo pulse of the ping in flight has started
+volatile uint8_t sonarEchoPin = 0;      // Echo pin of the ping in flight
+volatile unsigned long sonarStartUs;    // micros() of the trigger, then of the start of the echo
+volatile unsigned long sonarEchoUs;     // Length of the echo pulse, 0 = nothing in range
+int sonarIndex = SONAR_FRONT;           // Sensor of the last ping
+bool sonarPending = false;              // The result of the last ping has not been stored yet
+unsigned long sonarPingAt = 0;          // millis() of the last ping
+bool startSonar();                                // Configure the sensors and the echo timer
+void sonarTimerISR(timer_callback_args_t *args);  // Echo check interrupt
 
 //===========Servo SG90===========
 #define servo_pin 6  // Servo motor control pin
 Servo myServo;       // Servo motor control object
 
-int frontReadPing();   // Read distance from front sensor
-int leftReadPing();    // Read distance from left sensor
-int rightReadPing();   // Read distance from right sensor
-int lookRight();       // Look right
-int lookLeft();        // Look left
-void AutoTurnRight();  // Automatic right turn
-void AutoTurnLeft();   // Automatic left turn
+#define SERVO_SETTLE_MS 300  // Time for the servo to reach a new angle before the front sensor is read
+int servoAngle = 90;              // Angle the servo was last sent to
+unsigned long servoMovedAt = 0;   // millis() when the servo was last moved
+
+void LookAt(int angle);  // Turn the servo (and the front sensor) to an angle
+
+//===========Scheduler===========
+// Every job runs from loop() at its own period and returns quickly, so none of them blocks the others
+#define SONAR_POLL_MS 1  // Period of the job collecting sonar results and starting the next ping
+#define AUTO_STEP_MS 10  // Period of the automatic mode state machine
+
+struct SchedulerTask {
+  void (*run)();          // Job to run
+  unsigned long period;   // Milliseconds between runs, 0 = every loop
+  unsigned long lastRun;  // millis() of the last run
+};
+
+void pollCommands();  // Receive and execute commands from the ESP32 CAM
+void sampleSonar();   // Store the last sonar result and ping the next sensor
+void autoStep();      // Advance the automatic mode state machine
+void driveStep();     // Ramp the joystick speeds and stop when the lease runs out
+void driveSlotStep(); // Switch the slower side on and off
+
+SchedulerTask tasks[] = {
+  { pollCommands, 0, 0 },
+  { sampleSonar, SONAR_POLL_MS, 0 },
+  { autoStep, AUTO_STEP_MS, 0 },
+  { driveStep, DRIVE_STEP_MS, 0 },
+  { driveSlotStep, DRIVE_SLOT_MS, 0 },
+};
+
+//===========Automatic mode state machine===========
+// The states and their timing are in auto_drive.h, autoStep() feeds it the sensors and carries out its actions
+auto_drive_t autoDrive = { AUTO_START, 0, 0, 0 };
 
 void setup() {
+  // Initialize Serial connection first, so the messages below are not lost
+  Serial.begin(115200);   // Serial connection (for communication with the computer via USB)
+  Serial1.begin(115200);  // Serial 1 connection (for communication with ESP32 CAM)
+  car_parser_init(&commandParser);
+
   // Configure L298N pins
   pinMode(EN, OUTPUT);
   pinMode(IN1, OUTPUT);
@@ -71,15 +165,10 @@ void setup() {
   myServo.write(90);  // Set servo to center position
   delay(100);
 
-  // Read distance from front sensor
-  F_distance = frontReadPing();
-  delay(100);
-  F_distance = frontReadPing();
-  delay(100);
-
-  // Initialize Serial connection
-  Serial.begin(115200);   // Serial connection (for communication with the computer via USB)
-  Serial1.begin(115200);  // Serial 1 connection (for communication with ESP32 CAM)
+  // Start measuring distances in the background
+  if (!startSonar()) {
+    Serial.println("No free timer for the sonar");
+  }
 
   // Initialize LED Matrix
   matrix.loadSequence(LEDMATRIX_ANIMATION_OPENSOURCE);  // Load LED effect
@@ -88,106 +177,86 @@ void setup() {
 }
 
 void loop() {
-  String command = "";                               // Variable to store the command received from Serial1
-  if (Serial1.available() > 0) {                     // Check if there is data from Serial1
-    command = Serial1.readStringUntil('\n');         // Read the command until a newline character is encountered
-    Serial.println("Command received: " + command);  // Print the received command
+  // Run every job whose period has elapsed
+  unsigned long now = millis();
+  for (unsigned int i = 0; i < sizeof(tasks) / sizeof(tasks[0]); i++) {
+    if (now - tasks[i].lastRun >= tasks[i].period) {
+      tasks[i].lastRun = now;
+      tasks[i].run();
+    }
+  }
+}
+
+void pollCommands() {
+  int command = readCommand();  // Command received from Serial1, 0 if none
+  if (command != 0 && command != CAR_CMD_DRIVE) {
+    DriveRelease();  // Any other command takes the motors back from the joystick
   }
 
-  // Check if the command is "/AUTO\r" to enable automatic mode
-  if (command == "/AUTO\r") {
+  // Check if the command is CAR_CMD_AUTO to enable automatic mode
+  if (command == CAR_CMD_AUTO) {
     isAutoMode = true;  // Enable automatic mode
     Stop();             // Stop the car before switching mode
-    delay(500);
+    LookAt(90);
+    auto_enter(&autoDrive, AUTO_START, millis());
     Serial.println("Enabled auto mode");  // Notify that automatic mode is enabled
   }
-  // Check if the command is "/MANUAL\r" to enable manual mode
-  if (command == "/MANUAL\r") {
+  // Check if the command is CAR_CMD_MANUAL to enable manual mode
+  else if (command == CAR_CMD_MANUAL) {
     isAutoMode = false;                     // Enable manual mode
     Stop();                                 // Stop the car before switching mode
+    LookAt(90);                             // Set servo to center position
     Serial.println("Enabled manual mode");  // Notify that manual mode is enabled
   }
-
-  // Check if manual mode is enabled
-  if (isAutoMode == false) {
+  // Drive commands are only used in manual mode
+  else if (isAutoMode == false) {
     //==========MANUAL MODE==========
-    myServo.write(90);        // Set servo to center position
-    if (command == "/F\r") {  // Forward command
+    if (command == CAR_CMD_FORWARD) {  // Forward command
       MoveForward();
-      Serial.println("Moving Forward");  // Notify that the car is moving forward
-    } else if (command == "/B\r") {      // Backward command
+      Serial.println("Moving Forward");    // Notify that the car is moving forward
+    } else if (command == CAR_CMD_BACK) {  // Backward command
       MoveBack();
-      Serial.println("Moving Backward");  // Notify that the car is moving backward
-    } else if (command == "/L\r") {       // Left turn command
+      Serial.println("Moving Backward");   // Notify that the car is moving backward
+    } else if (command == CAR_CMD_LEFT) {  // Left turn command
       SpinLeft();
-      Serial.println("Turning Left");  // Notify that the car is turning left
-    } else if (command == "/R\r") {    // Right turn command
+      Serial.println("Turning Left");       // Notify that the car is turning left
+    } else if (command == CAR_CMD_RIGHT) {  // Right turn command
       SpinRight();
-      Serial.println("Turning Right");  // Notify that the car is turning right
-    } else if (command == "/S\r") {     // Stop command
+      Serial.println("Turning Right");     // Notify that the car is turning right
+    } else if (command == CAR_CMD_STOP) {  // Stop command
       Stop();
       Serial.println("Stopping");  // Notify that the car is stopping
+    } else if (command == CAR_CMD_DRIVE) {  // Joystick position
+      DriveTo(driveThrottle, driveSteer);
     }
-  } else {
-    //==========AUTOMATIC MODE==========
-    int distanceRight = 0;  // Store the distance measured by the right sensor
-    int distanceLeft = 0;   // Store the distance measured by the left sensor
-    delay(50);
-
-    // Check for commands in automatic mode
-    if (Serial1.available() > 0) {
-      command = Serial1.readStringUntil('\n');
-      Serial.println("Command received: " + command);
-
-      if (command == "/MANUAL\r") {
-        isAutoMode = false;
-        Stop();
-        Serial.println("Enabled manual mode");
-        return;  // Exit automatic mode
-      }
-    }
+  }
+}
 
-    // Check if any sensor detects an obstacle too close
-    if (F_distance <= stop_car_distance || R_distance <= stop_car_distance_side || L_distance <= stop_car_distance_side) {
-      Stop();  // Stop the car
-      delay(300);
-      MoveBack();  // Move the car backward
-      delay(300);
-      Stop();  // Stop the car
-      delay(300);
-      distanceRight = lookRight();  // Measure the distance on the right
-      delay(300);
-      distanceLeft = lookLeft();  // Measure the distance on the left
-      delay(300);
-
-      // Check for commands in automatic mode
-      if (Serial1.available() > 0) {
-        command = Serial1.readStringUntil('\n');
-        Serial.println("Command received: " + command);
-
-        if (command == "/MANUAL\r") {
-          isAutoMode = false;
-          Stop();
-          Serial.println("Enabled manual mode");
-          return;  // Exit automatic mode
-        }
+int readCommand() {
+  // Feed the bytes already received to the frame parser, return the first complete command
+  car_frame_t frame;
+  while (Serial1.available() > 0) {
+    if (car_parser_feed(&commandParser, Serial1.read(), &frame)) {
+      if (frame.cmd == CAR_CMD_VISION) {
+        // Not a command, just remember it for the automatic mode
+        visionSteer = (int8_t)frame.arg0;
+        visionClear = frame.arg1;
+        visionTime = millis();
+        continue;
       }
-
-      if (distanceRight > distanceLeft) {  // Right side is clearer
-        AutoTurnRight();                   // Turn right
-        Stop();
-      } else if (distanceRight < distanceLeft) {  // Left side is clearer
-        AutoTurnLeft();                           // Turn left
-        Stop();
+      if (frame.cmd == CAR_CMD_DRIVE) {
+        // Sent 20 times per second, too often to print
+        driveThrottle = (int8_t)frame.arg0;
+        driveSteer = (int8_t)frame.arg1;
+        return frame.cmd;
       }
-    } else {
-      MoveForward();  // If no obstacle, continue moving forward
+      Serial.print("Command received: ");  // Print the received command
+      Serial.println((char)frame.cmd);
+      commandSpeed = frame.arg0;
+      return frame.cmd;
     }
-    // Update the distance from the sensors
-    F_distance = frontReadPing();
-    L_distance = leftReadPing();
-    R_distance = rightReadPing();
   }
+  return 0;
 }
 
 //====L298N FUNCTIONS====
@@ -197,7 +266,7 @@ void MoveForward() {
   if (isAutoMode) {
     analogWrite(EN, AUTO_STRAIGHT_SPEED);  // Speed in automatic mode
   } else
-    analogWrite(EN, MANUAL_STRAIGHT_SPEED);  // Speed in manual mode
+    analogWrite(EN, ManualSpeed(MANUAL_STRAIGHT_SPEED));  // Speed in manual mode
   digitalWrite(IN1, HIGH);
   digitalWrite(IN2, LOW);
   digitalWrite(IN3, HIGH);
@@ -209,7 +278,7 @@ void MoveBack() {
   if (isAutoMode) {
     analogWrite(EN, AUTO_STRAIGHT_SPEED);  // Speed in automatic mode
   } else
-    analogWrite(EN, MANUAL_STRAIGHT_SPEED);  // Speed in manual mode
+    analogWrite(EN, ManualSpeed(MANUAL_STRAIGHT_SPEED));  // Speed in manual mode
   digitalWrite(IN1, LOW);
   digitalWrite(IN2, HIGH);
   digitalWrite(IN3, LOW);
@@ -221,7 +290,7 @@ void SpinLeft() {
   if (isAutoMode) {
     analogWrite(EN, AUTO_TURN_SPEED);  // Turn speed in automatic mode
   } else
-    analogWrite(EN, MANUAL_TURN_SPEED);  // Turn speed in manual mode
+    analogWrite(EN, ManualSpeed(MANUAL_TURN_SPEED));  // Turn speed in manual mode
   digitalWrite(IN1, HIGH);
   digitalWrite(IN2, LOW);
   digitalWrite(IN3, LOW);
@@ -233,7 +302,7 @@ void SpinRight() {
   if (isAutoMode) {
     analogWrite(EN, AUTO_TURN_SPEED);  // Turn speed in automatic mode
   } else
-    analogWrite(EN, MANUAL_TURN_SPEED);  // Turn speed in manual mode
+    analogWrite(EN, ManualSpeed(MANUAL_TURN_SPEED));  // Turn speed in manual mode
   digitalWrite(IN1, LOW);
   digitalWrite(IN2, HIGH);
   digitalWrite(IN3, HIGH);
@@ -248,65 +317,202 @@ void Stop() {
   digitalWrite(IN4, LOW);
 }
 
-//======= AUTOMATIC MODE ========
+int ManualSpeed(int defaultSpeed) {
+  // Use the speed sent with the command when there is one
+  return commandSpeed ? commandSpeed : defaultSpeed;
+}
+
+//======= PROPORTIONAL DRIVE ========
+
+void DriveTo(int throttle, int steer) {
+  // Mix throttle and steering into a speed per side
+  drive_mix(throttle, steer, driveTarget);
+  driveTime = millis();
+  if (!driveActive) {
+    driveActive = true;
+    driveSpeed[DRIVE_LEFT] = 0;  // Ramp up from standstill, whatever the last discrete command did
+    driveSpeed[DRIVE_RIGHT] = 0;
+  }
+}
+
+void DriveRelease() {
+  // Leave the motors to the discrete commands, which set all pins themselves
+  driveActive = false;
+}
+
+void SetSide(int side, int pwm) {
+  // Direction pins of one side: IN1/IN2 drive the right motor, IN3/IN4 the left one. 0 = coast
+  uint8_t forwardPin = side == DRIVE_RIGHT ? IN1 : IN3;
+  uint8_t backPin = side == DRIVE_RIGHT ? IN2 : IN4;
+  digitalWrite(forwardPin, pwm > 0 ? HIGH : LOW);
+  digitalWrite(backPin, pwm < 0 ? HIGH : LOW);
+}
 
-int frontReadPing() {
-  // Read distance from front sensor
-  delay(30);
-  int cm = sonarFront.ping_cm();
-  if (cm == 0) {
-    cm = 250;  // If no reading, set default distance
+void driveStep() {
+  // Move each side towards its target by at most DRIVE_ACCEL, stop at once when the lease runs out
+  if (!driveActive) {
+    return;
   }
-  return cm;
+  if (drive_lease_expired(millis(), driveTime)) {
+    DriveRelease();
+    Stop();
+    Serial.println("Joystick lease expired, stopping");
+    return;
+  }
+  for (int side = 0; side < 2; side++) {
+    driveSpeed[side] = drive_ramp(driveSpeed[side], driveTarget[side]);
+    drivePwm[side] = drive_speed_to_pwm(driveSpeed[side]);
+  }
+  // The shared EN runs at the faster side's PWM, the slower side gets the matching share of the slots
+  int fast;
+  driveSlowSlots = drive_slow_slots(drivePwm, &driveSlowSide, &fast);
+  analogWrite(EN, fast);
 }
 
-int leftReadPing() {
-  // Read distance from left sensor
-  delay(30);
-  int cm = sonarLeft.ping_cm();
-  if (cm == 0) {
-    cm = 250;  // If no reading, set default distance
+void driveSlotStep() {
+  // Set the direction pins, the slower side only during the first driveSlowSlots slots of each cycle
+  if (!driveActive) {
+    return;
+  }
+  for (int side = 0; side < 2; side++) {
+    bool on = side != driveSlowSide || driveSlot < driveSlowSlots;
+    SetSide(side, on ? drivePwm[side] : 0);
   }
-  return cm;
+  driveSlot = (driveSlot + 1) % DRIVE_SLOTS;
 }
 
-int rightReadPing() {
-  // Read distance from right sensor
-  delay(30);
-  int cm = sonarRight.ping_cm();
-  if (cm == 0) {
-    cm = 250;  // If no reading, set default distance
+//======= AUTOMATIC MODE ========
+
+void LookAt(int angle) {
+  // Turn the servo, the front sensor is not read until it has settled
+  if (angle != servoAngle) {
+    myServo.write(angle);
+    servoAngle = angle;
+    servoMovedAt = millis();
   }
-  return cm;
 }
 
-int lookRight() {
-  // Look right and measure distance
-  myServo.write(10);  // Turn servo to the right
-  delay(300);
-  int distance = frontReadPing();  // Read distance
-  myServo.write(90);               // Return servo to center
-  return distance;
+bool startSonar() {
+  // Configure the sensor pins and a periodic timer for the echo check interrupt, left stopped until the first ping
+  for (int i = 0; i < SONAR_COUNT; i++) {
+    pinMode(sonarTrigPins[i], OUTPUT);
+    pinMode(sonarEchoPins[i], INPUT);
+    digitalWrite(sonarTrigPins[i], LOW);
+  }
+  uint8_t timerType;
+  int8_t timerChannel = FspTimer::get_available_timer(timerType);
+  if (timerChannel < 0) {
+    return false;
+  }
+  if (!sonarTimer.begin(TIMER_MODE_PERIODIC, timerType, timerChannel, 1000000.0f / SONAR_TIMER_US, 0.0f, sonarTimerISR)) {
+    return false;
+  }
+  return sonarTimer.setup_overflow_irq() && sonarTimer.open() && sonarTimer.stop();
 }
 
-int lookLeft() {
-  // Look left and measure distance
-  myServo.write(170);  // Turn servo to the left
-  delay(300);
-  int distance = frontReadPing();  // Read distance
-  myServo.write(90);               // Return servo to center
-  return distance;
+void sonarTimerISR(timer_callback_args_t *args) {
+  // Time the echo pulse of the ping in flight, then stop the timer until the next ping
+  if (sonarBusy) {
+    unsigned long now = micros();
+    if (digitalRead(sonarEchoPin) == HIGH) {
+      if (!sonarEchoHigh) {  // Echo pulse started
+        sonarEchoHigh = true;
+        sonarStartUs = now;
+      }
+    } else if (sonarEchoHigh) {  // Echo pulse ended
+      sonarEchoUs = now - sonarStartUs;
+      sonarBusy = false;
+    }
+    if (sonarBusy && now - sonarStartUs > SONAR_TIMEOUT_US) {  // Nothing within maximum_distance
+      sonarBusy = false;
+    }
+  }
+  if (!sonarBusy) {
+    sonarTimer.stop();
+  }
 }
 
-void AutoTurnLeft() {
-  // Automatic left turn
-  SpinLeft();
-  delay(250);
-  MoveForward();
+void sampleSonar() {
+  // Store the result of the last ping, then ping the next sensor: front, right, left
+  if (sonarBusy) {
+    return;  // The interrupt is still timing the echo
+  }
+  if (sonarPending) {
+    int cm = sonarEchoUs / US_ROUNDTRIP_CM;
+    if (cm == 0) {
+      cm = 250;  // If no reading, set default distance
+    }
+    if (sonarIndex == SONAR_FRONT) {
+      F_distance = cm;
+      F_time = sonarPingAt;
+    } else if (sonarIndex == SONAR_RIGHT) {
+      R_distance = cm;
+      R_time = sonarPingAt;
+    } else {
+      L_distance = cm;
+      L_time = sonarPingAt;
+    }
+    sonarPending = false;
+  }
+
+  unsigned long now = millis();
+  if (now - sonarPingAt < SONAR_PING_SPACING_MS) {
+    return;
+  }
+  sonarIndex = (sonarIndex + 1) % SONAR_COUNT;
+  if (sonarIndex == SONAR_FRONT && now - servoMovedAt < SERVO_SETTLE_MS) {
+    sonarIndex = SONAR_RIGHT;  // Skip the front sensor while the servo is moving
+  }
+
+  // 10 us trigger pulse, then let the interrupt time the echo
+  uint8_t trigPin = sonarTrigPins[sonarIndex];
+  digitalWrite(trigPin, LOW);
+  delayMicroseconds(4);
+  digitalWrite(trigPin, HIGH);
+  delayMicroseconds(10);
+  digitalWrite(trigPin, LOW);
+  noInterrupts();
+  sonarEchoPin = sonarEchoPins[sonarIndex];
+  sonarEchoHigh = false;
+  sonarEchoUs = 0;
+  sonarStartUs = micros();
+  sonarBusy = true;
+  interrupts();
+  sonarTimer.start();  // Stopped again by the interrupt once this echo is timed
+  sonarPingAt = now;
+  sonarPending = true;
 }
-void AutoTurnRight() {
-  // Automatic right turn
-  SpinRight();
-  delay(250);
-  MoveForward();
+
+void autoStep() {
+  // Advance the obstacle avoidance sequence without blocking, then carry out what it asks for
+  if (isAutoMode == false) {
+    return;
+  }
+  auto_inputs_t in = { F_distance, R_distance, L_distance, F_time, R_time, L_time, servoMovedAt, visionSteer, visionClear, visionTime };
+  auto_action_t action = auto_step(&autoDrive, &in, millis());
+  if (action.camera_obstacle) {
+    Serial.println("Camera obstacle");
+  }
+  if (action.look != AUTO_LOOK_KEEP) {
+    LookAt(action.look);
+  }
+  switch (action.motor) {
+    case AUTO_MOTOR_KEEP:
+      break;
+    case AUTO_MOTOR_STOP:
+      Stop();
+      break;
+    case AUTO_MOTOR_FORWARD:
+      MoveForward();
+      break;
+    case AUTO_MOTOR_BACK:
+      MoveBack();
+      break;
+    case AUTO_MOTOR_SPIN_LEFT:
+      SpinLeft();
+      break;
+    case AUTO_MOTOR_SPIN_RIGHT:
+      SpinRight();
+      break;
+  }
 }
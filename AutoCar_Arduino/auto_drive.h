@@ -0,0 +1,216 @@
+/* Obstacle avoidance state machine of the automatic mode
+ *
+ * auto_step() runs every AUTO_STEP_MS with the latest sonar readings and
+ * camera cue and returns what the motors and the servo should do. Every
+ * pause of the sequence is a state with its entry time, so a step never
+ * blocks and commands keep being read between steps.
+ * Plain integer math without Arduino calls, so it also builds on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define stop_car_distance 30       // Car stop distance (cm)
+#define stop_car_distance_side 30  // Car stop distance when side sensor detects an object
+#define VISION_MAX_AGE_MS 300      // Older camera cues are ignored, e.g. when the camera stopped
+#define VISION_STOP_CLEAR 40       // Free space ahead (0-255) at which the car stops even if the sonar sees nothing
+#define VISION_STEER_MIN 30        // Steering hint (0-100) strong enough to turn without looking around
+#define AUTO_START_MS 500          // Wait after switching to automatic mode
+#define AUTO_PAUSE_MS 300          // Length of each stop and of backing away
+#define AUTO_TURN_MS 250           // Spin towards the clearer side
+#define AUTO_LOOK_KEEP -1          // auto_action_t.look when the servo stays where it is
+
+// States of the automatic mode
+typedef enum
+{
+	AUTO_START,			  // Just switched to automatic mode, wait before moving
+	AUTO_DRIVE,			  // Drive forward until an obstacle is too close
+	AUTO_STOP,			  // Stopped in front of an obstacle
+	AUTO_BACK,			  // Backing away from the obstacle
+	AUTO_STOP_AFTER_BACK, // Stopped again before looking around
+	AUTO_LOOK_RIGHT,	  // Servo turned right, waiting for a reading
+	AUTO_LOOK_LEFT,		  // Servo turned left, waiting for a reading
+	AUTO_TURN,			  // Spinning towards the clearer side
+	AUTO_RESAMPLE,		  // Waiting for fresh readings from all sensors before driving again
+} auto_state_t;
+
+// Motor commands a step can ask for
+typedef enum
+{
+	AUTO_MOTOR_KEEP, // Leave the motors as they are
+	AUTO_MOTOR_STOP,
+	AUTO_MOTOR_FORWARD,
+	AUTO_MOTOR_BACK,
+	AUTO_MOTOR_SPIN_LEFT,
+	AUTO_MOTOR_SPIN_RIGHT,
+} auto_motor_t;
+
+// Structure for what a step sees: the last reading of each sensor with the millis() it was taken,
+// the last servo move and the last camera cue
+typedef struct
+{
+	int front;
+	int right;
+	int left;
+	uint32_t front_ms;
+	uint32_t right_ms;
+	uint32_t left_ms;
+	uint32_t servo_moved_ms;
+	int8_t vision_steer;  // -100 (left) .. 100 (right)
+	uint8_t vision_clear; // Free space straight ahead
+	uint32_t vision_ms;	  // 0 = no cue received yet
+} auto_inputs_t;
+
+// Structure for the state machine
+typedef struct
+{
+	auto_state_t state;
+	uint32_t since;		// millis() when the current state was entered
+	int distance_right; // Distance measured when looking right
+	int distance_left;	// Distance measured when looking left
+} auto_drive_t;
+
+// Structure for what a step asks for
+typedef struct
+{
+	auto_motor_t motor;
+	int look;			  // Servo angle, AUTO_LOOK_KEEP = no change
+	bool camera_obstacle; // Stopped because of the camera cue, not the sonar
+} auto_action_t;
+
+// Function to check whether a reading was taken after the given time (safe across millis() overflow)
+static inline bool auto_sampled_after(uint32_t sample_ms, uint32_t since_ms)
+{
+	return (int32_t)(sample_ms - since_ms) > 0;
+}
+
+// Function to check whether the camera cue is recent enough to count
+static inline bool auto_vision_fresh(const auto_inputs_t *in, uint32_t now_ms)
+{
+	return in->vision_ms != 0 && now_ms - in->vision_ms < VISION_MAX_AGE_MS;
+}
+
+static inline void auto_enter(auto_drive_t *a, auto_state_t state, uint32_t now_ms)
+{
+	a->state = state;
+	a->since = now_ms;
+}
+
+// Function to advance the obstacle avoidance sequence by one step
+static inline auto_action_t auto_step(auto_drive_t *a, const auto_inputs_t *in, uint32_t now_ms)
+{
+	auto_action_t action = {AUTO_MOTOR_KEEP, AUTO_LOOK_KEEP, false};
+	uint32_t elapsed = now_ms - a->since;
+	switch (a->state)
+	{
+	case AUTO_START:
+		if (elapsed >= AUTO_START_MS)
+		{
+			auto_enter(a, AUTO_RESAMPLE, now_ms);
+		}
+		break;
+	case AUTO_DRIVE:
+		// Check if any sensor detects an obstacle too close
+		if (in->front <= stop_car_distance || in->right <= stop_car_distance_side || in->left <= stop_car_distance_side)
+		{
+			action.motor = AUTO_MOTOR_STOP;
+			auto_enter(a, AUTO_STOP, now_ms);
+		}
+		else if (auto_vision_fresh(in, now_ms) && in->vision_clear <= VISION_STOP_CLEAR)
+		{
+			// The camera sees something low or soft the sonar misses
+			action.motor = AUTO_MOTOR_STOP;
+			action.camera_obstacle = true;
+			auto_enter(a, AUTO_STOP, now_ms);
+		}
+		else
+		{
+			action.motor = AUTO_MOTOR_FORWARD;
+		}
+		break;
+	case AUTO_STOP:
+		if (elapsed >= AUTO_PAUSE_MS)
+		{
+			action.motor = AUTO_MOTOR_BACK;
+			auto_enter(a, AUTO_BACK, now_ms);
+		}
+		break;
+	case AUTO_BACK:
+		if (elapsed >= AUTO_PAUSE_MS)
+		{
+			action.motor = AUTO_MOTOR_STOP;
+			auto_enter(a, AUTO_STOP_AFTER_BACK, now_ms);
+		}
+		break;
+	case AUTO_STOP_AFTER_BACK:
+		if (elapsed >= AUTO_PAUSE_MS)
+		{
+			// A clear hint from the camera saves sweeping the servo
+			bool fresh = auto_vision_fresh(in, now_ms);
+			if (fresh && in->vision_steer >= VISION_STEER_MIN)
+			{
+				action.motor = AUTO_MOTOR_SPIN_RIGHT;
+				auto_enter(a, AUTO_TURN, now_ms);
+			}
+			else if (fresh && in->vision_steer <= -VISION_STEER_MIN)
+			{
+				action.motor = AUTO_MOTOR_SPIN_LEFT;
+				auto_enter(a, AUTO_TURN, now_ms);
+			}
+			else
+			{
+				action.look = 10; // Turn servo to the right
+				auto_enter(a, AUTO_LOOK_RIGHT, now_ms);
+			}
+		}
+		break;
+	case AUTO_LOOK_RIGHT:
+		// Measure the distance on the right once the front sensor was read again (it is skipped while the servo settles)
+		if (auto_sampled_after(in->front_ms, in->servo_moved_ms))
+		{
+			a->distance_right = in->front;
+			action.look = 170; // Turn servo to the left
+			auto_enter(a, AUTO_LOOK_LEFT, now_ms);
+		}
+		break;
+	case AUTO_LOOK_LEFT:
+		if (auto_sampled_after(in->front_ms, in->servo_moved_ms))
+		{
+			a->distance_left = in->front;
+			action.look = 90; // Return servo to center
+			if (a->distance_right > a->distance_left)
+			{
+				action.motor = AUTO_MOTOR_SPIN_RIGHT; // Right side is clearer
+				auto_enter(a, AUTO_TURN, now_ms);
+			}
+			else if (a->distance_right < a->distance_left)
+			{
+				action.motor = AUTO_MOTOR_SPIN_LEFT; // Left side is clearer
+				auto_enter(a, AUTO_TURN, now_ms);
+			}
+			else
+			{
+				auto_enter(a, AUTO_RESAMPLE, now_ms);
+			}
+		}
+		break;
+	case AUTO_TURN:
+		if (elapsed >= AUTO_TURN_MS)
+		{
+			action.motor = AUTO_MOTOR_STOP;
+			auto_enter(a, AUTO_RESAMPLE, now_ms);
+		}
+		break;
+	case AUTO_RESAMPLE:
+		// The front reading is stale after looking around, wait for new readings from every sensor
+		action.motor = AUTO_MOTOR_STOP;
+		if (auto_sampled_after(in->front_ms, a->since) && auto_sampled_after(in->right_ms, a->since) &&
+			auto_sampled_after(in->left_ms, a->since))
+		{
+			auto_enter(a, AUTO_DRIVE, now_ms);
+		}
+		break;
+	}
+	return action;
+}
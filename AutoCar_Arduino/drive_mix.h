@@ -0,0 +1,88 @@
+/* Mixing and ramping for the proportional drive (CAR_CMD_DRIVE)
+ *
+ * Throttle and steering (-127..127) are mixed into a speed per side, each
+ * side ramps towards its target, speeds map to the PWM range in which the
+ * motors turn, and the shared EN pin runs at the faster side's PWM while the
+ * slower side is switched on for only part of every DRIVE_SLOTS slots.
+ * Plain integer math without Arduino calls, so it also builds on the host.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "car_protocol.h"
+
+#define DRIVE_SLOTS 10     // Slots per on/off cycle of the slower side
+#define DRIVE_ACCEL 6      // Largest speed change per side and step
+#define DRIVE_DEADBAND 8   // Joystick values this close to the center count as 0
+#define DRIVE_MIN_PWM 60   // Below this the motors hum but do not turn
+#define DRIVE_MAX_PWM 255
+#define DRIVE_LEFT 0
+#define DRIVE_RIGHT 1
+
+static inline int drive_abs(int value)
+{
+	return value < 0 ? -value : value;
+}
+
+// Function to clamp a joystick axis to -127..127 and remove the deadband around the center
+static inline int drive_axis(int value)
+{
+	value = value < -127 ? -127 : (value > 127 ? 127 : value);
+	return drive_abs(value) < DRIVE_DEADBAND ? 0 : value;
+}
+
+// Function to mix throttle and steering into a speed per side (-127..127).
+// Both sides are scaled down together, so the turn is kept at full throttle
+static inline void drive_mix(int throttle, int steer, int target[2])
+{
+	throttle = drive_axis(throttle);
+	steer = drive_axis(steer);
+	int left = throttle + steer;
+	int right = throttle - steer;
+	int largest = drive_abs(left) > drive_abs(right) ? drive_abs(left) : drive_abs(right);
+	if (largest > 127)
+	{
+		left = left * 127 / largest;
+		right = right * 127 / largest;
+	}
+	target[DRIVE_LEFT] = left;
+	target[DRIVE_RIGHT] = right;
+}
+
+// Function to move a speed towards its target by at most DRIVE_ACCEL
+static inline int drive_ramp(int speed, int target)
+{
+	int step = target - speed;
+	step = step < -DRIVE_ACCEL ? -DRIVE_ACCEL : (step > DRIVE_ACCEL ? DRIVE_ACCEL : step);
+	return speed + step;
+}
+
+// Function to map a speed of -127..127 to the PWM range in which the motors actually turn
+static inline int drive_speed_to_pwm(int speed)
+{
+	if (speed == 0)
+	{
+		return 0;
+	}
+	int pwm = DRIVE_MIN_PWM + (int32_t)(drive_abs(speed) - 1) * (DRIVE_MAX_PWM - DRIVE_MIN_PWM) / 126;
+	return speed < 0 ? -pwm : pwm;
+}
+
+// Function to pick the slower side and the slots it is switched on for, so that its
+// average speed matches its PWM while EN runs at the faster side's PWM (returned in *fast)
+static inline int drive_slow_slots(const int pwm[2], int *slow_side, int *fast)
+{
+	int left = drive_abs(pwm[DRIVE_LEFT]);
+	int right = drive_abs(pwm[DRIVE_RIGHT]);
+	*fast = left > right ? left : right;
+	*slow_side = left < right ? DRIVE_LEFT : DRIVE_RIGHT;
+	int slow = *slow_side == DRIVE_LEFT ? left : right;
+	return *fast ? (slow * DRIVE_SLOTS + *fast / 2) / *fast : 0;
+}
+
+// Function to check whether the last CAR_CMD_DRIVE frame is too old to keep the motors running
+static inline bool drive_lease_expired(uint32_t now_ms, uint32_t last_ms)
+{
+	return now_ms - last_ms >= CAR_DRIVE_LEASE_MS;
+}
@@ -4,9 +4,15 @@
 #include "esp_camera.h" // Camera library
 #include <WiFi.h> // WiFi library
 #include "esp32_secret.h" // Library containing WiFi information
-#include <TinyGPSPlus.h> // GPS library
-#include <HardwareSerial.h>  // Serial library
 #include <HTTPClient.h> // HTTP library
+#include <Preferences.h> // NVS storage for the last access point
+#include "car_protocol.h" // Binary command frames for the Arduino
+#include "gps.h" // GPS ingest task
+#include "track.h" // Recorded path for /track
+#include "pose.h" // Position estimate between GPS fixes
+#include "frame_ring.h" // Capture task, paused while the camera is reconfigured
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 
 #define CAMERA_MODEL_AI_THINKER
 
@@ -53,85 +59,281 @@
 #endif
 
 extern int LED = 4; /* ESP32 CAM FLASH LED pin = GPIO4 */
-extern float latitude  = 10.8231; // Variable to store latitude
-extern float longitude = 106.6297; // Variable to store longitude
-// Default coordinates of Ho Chi Minh City
-
 extern String WiFiAddr = ""; // Variable to store the IP address of ESP32 CAM
 void startCameraServer();
 
-TinyGPSPlus gps; // Declare GPS
-HardwareSerial gpsSerial(1); // Declare Serial for GPS
+#define CAMERA_STREAM_FRAMESIZE FRAMESIZE_CIF // Largest frame size streamed by default
+#ifndef CAMERA_FB_COUNT
+#define CAMERA_FB_COUNT 2 // Frame buffers with PSRAM: one being filled while the other is read
+#endif
+
+static camera_config_t camera_config;
+static SemaphoreHandle_t camera_reconfigure_lock = NULL;
+static volatile esp_err_t camera_failed = ESP_OK; // Set when the driver could not be brought back, capture stays paused
+static camera_status_t camera_settings;			  // Sensor settings from before the driver went down
+
+// Function to get the size of one JPEG frame buffer, the camera driver allocates width * height / 5
+static size_t camera_fb_size(framesize_t framesize)
+{
+	return resolution[framesize].width * resolution[framesize].height / 5;
+}
+
+// Function to put the sensor settings back after the driver was reinitialized
+static void camera_restore_settings(sensor_t *s, const camera_status_t *st)
+{
+	s->set_quality(s, st->quality);
+	s->set_brightness(s, st->brightness);
+	s->set_contrast(s, st->contrast);
+	s->set_saturation(s, st->saturation);
+	s->set_special_effect(s, st->special_effect);
+	s->set_wb_mode(s, st->wb_mode);
+	s->set_whitebal(s, st->awb);
+	s->set_awb_gain(s, st->awb_gain);
+	s->set_exposure_ctrl(s, st->aec);
+	s->set_aec2(s, st->aec2);
+	s->set_ae_level(s, st->ae_level);
+	s->set_aec_value(s, st->aec_value);
+	s->set_gain_ctrl(s, st->agc);
+	s->set_agc_gain(s, st->agc_gain);
+	s->set_gainceiling(s, (gainceiling_t)st->gainceiling);
+	s->set_bpc(s, st->bpc);
+	s->set_wpc(s, st->wpc);
+	s->set_raw_gma(s, st->raw_gma);
+	s->set_lenc(s, st->lenc);
+	s->set_hmirror(s, st->hmirror);
+	s->set_vflip(s, st->vflip);
+	s->set_dcw(s, st->dcw);
+	s->set_colorbar(s, st->colorbar);
+}
+
+// Function to make sure the frame buffers can hold the given frame size (called from the web server).
+// Smaller sizes fit in the current buffers; a larger one stops capturing and reinitializes the driver.
+// If even the previous size cannot be restored, capturing stays paused and camera_error() reports why;
+// the next call tries again
+bool camera_reconfigure(framesize_t framesize)
+{
+	if (camera_failed == ESP_OK && framesize <= camera_config.frame_size)
+	{
+		return true;
+	}
+	xSemaphoreTake(camera_reconfigure_lock, portMAX_DELAY);
+	if (camera_failed == ESP_OK)
+	{
+		frame_ring_pause(); // Already paused (and the driver down) after a failed attempt
+		camera_settings = esp_camera_sensor_get()->status;
+		esp_camera_deinit();
+	}
+	framesize_t previous = camera_config.frame_size;
+	int64_t start = esp_timer_get_time();
+
+	camera_config.frame_size = max(framesize, previous);
+	esp_err_t err = esp_camera_init(&camera_config);
+	esp_err_t fallback = err;
+	if (err != ESP_OK && camera_config.frame_size != previous)
+	{
+		// Not enough memory for the larger buffers, go back to what worked
+		Serial.printf("Camera reinit for framesize %d failed with error 0x%x\n", framesize, err);
+		camera_config.frame_size = previous;
+		fallback = esp_camera_init(&camera_config);
+	}
+	camera_failed = fallback;
+	if (fallback != ESP_OK)
+	{
+		Serial.printf("Camera reinit failed with error 0x%x, capture stays paused\n", fallback);
+		xSemaphoreGive(camera_reconfigure_lock);
+		return false;
+	}
+	sensor_t *s = esp_camera_sensor_get();
+	if (s)
+	{
+		camera_restore_settings(s, &camera_settings);
+		s->set_framesize(s, camera_config.frame_size);
+	}
+	Serial.printf("Camera buffers resized to %u bytes in %u ms\n", (unsigned)camera_fb_size(camera_config.frame_size),
+				  (unsigned)((esp_timer_get_time() - start) / 1000));
+	frame_ring_resume();
+	xSemaphoreGive(camera_reconfigure_lock);
+	return err == ESP_OK && framesize <= camera_config.frame_size;
+}
+
+// Function to get the error that left the camera down, ESP_OK while it works
+esp_err_t camera_error()
+{
+	return camera_failed;
+}
+
+#define WIFI_CACHE_NAMESPACE "wifi"
+#define WIFI_FAST_CONNECT_MS 3000 // Time to reach the cached access point before scanning all channels
+
+static Preferences wifi_cache;
+static bool wifi_fast_connect = false; // Connecting to the cached BSSID/channel without a scan
+
+// Function to log how long after reset a startup step finished
+void boot_mark(const char *step)
+{
+	Serial.printf("[boot] %5u ms  %s\n", (unsigned)(esp_timer_get_time() / 1000), step);
+}
+
+// Function to start joining the router, the connection completes in the background
+static void wifi_begin()
+{
+	WiFi.mode(WIFI_STA);
+	WiFi.persistent(false); // The access point is cached below, no need for the driver to write flash on every boot
+	WiFi.setSleep(false);
+#ifdef SECRET_STATIC_IP
+	// A fixed address skips the DHCP exchange
+	IPAddress ip, gateway, subnet;
+	ip.fromString(SECRET_STATIC_IP);
+	gateway.fromString(SECRET_GATEWAY);
+	subnet.fromString(SECRET_SUBNET);
+	WiFi.config(ip, gateway, subnet, gateway);
+#endif
+
+	uint8_t bssid[6];
+	wifi_cache.begin(WIFI_CACHE_NAMESPACE, false);
+	int32_t channel = wifi_cache.getInt("channel", 0);
+	if (channel > 0 && wifi_cache.getBytes("bssid", bssid, sizeof(bssid)) == sizeof(bssid))
+	{
+		wifi_fast_connect = true;
+		WiFi.begin(SECRET_SSID, SECRET_PASS, channel, bssid);
+	}
+	else
+	{
+		WiFi.begin(SECRET_SSID, SECRET_PASS);
+	}
+}
+
+// Function to wait until the router accepted us, falling back to a full scan when the cached access point is gone
+static void wifi_wait()
+{
+	uint32_t start = millis();
+	Serial.print("Connecting to WiFi");
+	while (WiFi.status() != WL_CONNECTED)
+	{
+		if (wifi_fast_connect && millis() - start > WIFI_FAST_CONNECT_MS)
+		{
+			Serial.print(" cached access point not found, scanning");
+			wifi_fast_connect = false;
+			WiFi.disconnect();
+			WiFi.begin(SECRET_SSID, SECRET_PASS);
+		}
+		delay(50);
+	}
+	Serial.println();
+
+	// Remember the access point for the next boot, flash is only written when it changed
+	const uint8_t *bssid = WiFi.BSSID();
+	int32_t channel = WiFi.channel();
+	uint8_t cached[6];
+	if (bssid && (wifi_cache.getInt("channel", 0) != channel ||
+				  wifi_cache.getBytes("bssid", cached, sizeof(cached)) != sizeof(cached) || memcmp(cached, bssid, sizeof(cached))))
+	{
+		wifi_cache.putBytes("bssid", bssid, sizeof(cached));
+		wifi_cache.putInt("channel", channel);
+	}
+	wifi_cache.end();
+}
+
+static uint8_t uart_seq = 0; // Sequence number of the next command frame
+volatile uint32_t car_uart_bytes_sent = 0; // Command bytes sent to the Arduino, for /metrics
+
+// Function to send a command frame to the Arduino over Serial (called from the web server and setup)
+void car_uart_send(uint8_t cmd, uint8_t arg0, uint8_t arg1)
+{
+	uint8_t frame[CAR_FRAME_LEN];
+	car_frame_encode(frame, __atomic_fetch_add(&uart_seq, 1, __ATOMIC_RELAXED), cmd, arg0, arg1);
+	Serial.write(frame, sizeof(frame));
+	__atomic_fetch_add(&car_uart_bytes_sent, sizeof(frame), __ATOMIC_RELAXED);
+	pose_command(cmd, arg0, arg1); // The estimator follows the car with the commands it was given
+}
 
 void setup()
 {
 	Serial.begin(115200);
-	Serial.println("/S");
+	car_uart_send(CAR_CMD_STOP, 0, 0);
 	Serial.setDebugOutput(true);
 	Serial.println();
 	
 	pinMode(LED, OUTPUT);
+	camera_reconfigure_lock = xSemaphoreCreateMutex();
+	boot_mark("start");
+
+	//========Connect to specified Router========
+	// Association runs in the background while the GPS and the camera start
+	wifi_begin();
+	boot_mark("WiFi started");
+
+	track_init();
+	// Start the GPS task, it reads the module on RX pin 12, TX pin 13
+	if (!gps_start())
+	{
+		Serial.println("GPS task start failed");
+	}
+	pose_start();
+	boot_mark("GPS started");
 
 	//========Camera Configuration========
-	camera_config_t config;
-	config.ledc_channel = LEDC_CHANNEL_0;
-	config.ledc_timer = LEDC_TIMER_0;
-	config.pin_d0 = Y2_GPIO_NUM;
-	config.pin_d1 = Y3_GPIO_NUM;
-	config.pin_d2 = Y4_GPIO_NUM;
-	config.pin_d3 = Y5_GPIO_NUM;
-	config.pin_d4 = Y6_GPIO_NUM;
-	config.pin_d5 = Y7_GPIO_NUM;
-	config.pin_d6 = Y8_GPIO_NUM;
-	config.pin_d7 = Y9_GPIO_NUM;
-	config.pin_xclk = XCLK_GPIO_NUM;
-	config.pin_pclk = PCLK_GPIO_NUM;
-	config.pin_vsync = VSYNC_GPIO_NUM;
-	config.pin_href = HREF_GPIO_NUM;
-	config.pin_sscb_sda = SIOD_GPIO_NUM;
-	config.pin_sscb_scl = SIOC_GPIO_NUM;
-	config.pin_pwdn = PWDN_GPIO_NUM;
-	config.pin_reset = RESET_GPIO_NUM;
-	config.xclk_freq_hz = 20000000;
-	config.pixel_format = PIXFORMAT_JPEG;
+	camera_config.ledc_channel = LEDC_CHANNEL_0;
+	camera_config.ledc_timer = LEDC_TIMER_0;
+	camera_config.pin_d0 = Y2_GPIO_NUM;
+	camera_config.pin_d1 = Y3_GPIO_NUM;
+	camera_config.pin_d2 = Y4_GPIO_NUM;
+	camera_config.pin_d3 = Y5_GPIO_NUM;
+	camera_config.pin_d4 = Y6_GPIO_NUM;
+	camera_config.pin_d5 = Y7_GPIO_NUM;
+	camera_config.pin_d6 = Y8_GPIO_NUM;
+	camera_config.pin_d7 = Y9_GPIO_NUM;
+	camera_config.pin_xclk = XCLK_GPIO_NUM;
+	camera_config.pin_pclk = PCLK_GPIO_NUM;
+	camera_config.pin_vsync = VSYNC_GPIO_NUM;
+	camera_config.pin_href = HREF_GPIO_NUM;
+	camera_config.pin_sscb_sda = SIOD_GPIO_NUM;
+	camera_config.pin_sscb_scl = SIOC_GPIO_NUM;
+	camera_config.pin_pwdn = PWDN_GPIO_NUM;
+	camera_config.pin_reset = RESET_GPIO_NUM;
+	camera_config.xclk_freq_hz = 20000000;
+	camera_config.pixel_format = PIXFORMAT_JPEG;
+	// Buffers are sized for the streaming resolution, a larger frame size reallocates them (see camera_reconfigure)
+	camera_config.frame_size = CAMERA_STREAM_FRAMESIZE;
+	camera_config.jpeg_quality = 10;
 	if (psramFound())
 	{
-		config.frame_size = FRAMESIZE_UXGA;
-		config.jpeg_quality = 10;
-		config.fb_count = 2;
+		camera_config.fb_count = CAMERA_FB_COUNT;
+		camera_config.fb_location = CAMERA_FB_IN_PSRAM;
+		camera_config.grab_mode = CAMERA_GRAB_LATEST; // Always hand out the newest frame, never a queued one
 	}
 	else
 	{
-		config.frame_size = FRAMESIZE_SVGA;
-		config.jpeg_quality = 12;
-		config.fb_count = 1;
+		camera_config.fb_count = 1;
+		camera_config.fb_location = CAMERA_FB_IN_DRAM;
+		camera_config.grab_mode = CAMERA_GRAB_WHEN_EMPTY;
 	}
-	esp_err_t err = esp_camera_init(&config);
+	size_t psram_before = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+	esp_err_t err = esp_camera_init(&camera_config);
 	if (err != ESP_OK)
 	{
 		Serial.printf("Camera init failed with error 0x%x", err);
 		return;
 	}
+	Serial.printf("Camera: %u frame buffers of %u bytes, %u bytes of PSRAM used (%u for UXGA)\n",
+				  (unsigned)camera_config.fb_count, (unsigned)camera_fb_size(camera_config.frame_size),
+				  (unsigned)(psram_before - heap_caps_get_free_size(MALLOC_CAP_SPIRAM)),
+				  (unsigned)(camera_config.fb_count * camera_fb_size(FRAMESIZE_UXGA)));
 	sensor_t *s = esp_camera_sensor_get(); // Get camera sensor
 	s->set_vflip(s, 1); // Flip image vertically
 	s->set_hmirror(s, 1); // Flip image horizontally
-	s->set_framesize(s, FRAMESIZE_CIF); // Set frame size
+	boot_mark("camera ready");
 
-	//========Connect to specified Router========
-	WiFi.begin(SECRET_SSID, SECRET_PASS);
 	// Wait until connection is successful
-	Serial.print("Connecting to WiFi");
-	while (WiFi.status() != WL_CONNECTED)
-	{
-		delay(500);
-		Serial.print(".");
-	}
+	wifi_wait();
+	boot_mark("WiFi connected");
 	// Print device IP address to Serial Monitor
-	Serial.println("\nConnected to WiFi");
+	Serial.println("Connected to WiFi");
 	WiFiAddr = WiFi.localIP().toString(); // Get device IP address
 	Serial.println("STA IP Address: " + WiFiAddr);
 	
 	startCameraServer(); // Start Camera Web Server
+	boot_mark("servers started");
 	Serial.println("");
 	// Print network information
 	Serial.print("Gateway: ");
@@ -143,26 +345,10 @@ void setup()
 	Serial.println("===========================");
 
 	Serial.println("The car is ready!!!");
-
-	gpsSerial.begin(9600, SERIAL_8N1, 12, 13);
-	// Initialize GPS Serial, with baud rate 9600, RX pin 12, TX pin 13
 }
 
 void loop()
 {
-	// //=======GPS Module=======
-	while (gpsSerial.available() > 0)
-	{
-		gps.encode(gpsSerial.read());
-	}
-
-	if (gps.location.isUpdated())
-	{
-		latitude = gps.location.lat(); // Update latitude variable
-		longitude = gps.location.lng(); // Update longitude variable
-		Serial.print("Latitude= ");
-		Serial.print(latitude, 6); 
-		Serial.print(" Longitude= "); 
-		Serial.println(longitude, 6);
-	}
-}
\ No newline at end of file
+	// GPS, camera capture and web clients all run in their own tasks
+	vTaskDelete(NULL);
+}
@@ -1,17 +1,37 @@
+#include <stdarg.h>
 #include "esp_http_server.h"
 #include "esp_timer.h"
 #include "esp_camera.h"
 #include "esp32_secret.h"
 #include "img_converters.h"
 #include "camera_index.h"
+#include "car_index.h"
 #include "Arduino.h"
+#include "frame_ring.h"
+#include "latency_hist.h"
+#include "car_protocol.h"
+#include "gps.h"
+#include "track.h"
+#include "pose.h"
+#include "stream_control.h"
+#include "vision.h"
+#include "recorder.h"
+#include "exif.h"
+#include "lwip/sockets.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
 
 extern int LED;
-extern String WiFiAddr;
 bool isAutoMode; // Variable to determine automatic mode on ESP32 CAM
 
-extern float latitude;	// Variable to store latitude
-extern float longitude; // Variable to store longitude
+void car_uart_send(uint8_t cmd, uint8_t arg0, uint8_t arg1);
+extern volatile uint32_t car_uart_bytes_sent;
+bool camera_reconfigure(framesize_t framesize);
+esp_err_t camera_error();
+void boot_mark(const char *step);
 
 // Define structure for running average filter
 typedef struct
@@ -30,14 +50,175 @@ typedef struct
 	size_t len;
 } jpg_chunking_t;
 
+// State of a socket handed over from a web server to one of our tasks
+typedef enum
+{
+	HANDOFF_FREE,
+	HANDOFF_ACTIVE,	   // Our task is writing to the socket
+	HANDOFF_PEER_GONE, // Server closed the session, our task still has to stop
+	HANDOFF_TASK_GONE, // Our task stopped, the server still has to close the session
+} handoff_state_t;
+
+// Structure for a long-lived response socket that is written after its handler returned
+typedef struct
+{
+	volatile handoff_state_t state;
+	httpd_handle_t hd;
+	int fd;
+} handoff_socket_t;
+
+// Structure for one viewer of the MJPEG stream
+typedef struct
+{
+	handoff_socket_t sock;
+	ra_filter_t frame_filter; // Running average of the time between frames sent to this client
+	uint32_t avg_frame_time;
+	uint32_t frames;  // Frames sent
+	uint32_t skipped; // Frames captured while this client was busy and never sent to it
+	uint32_t suppressed; // Frames not sent because the scene did not change
+	latency_hist_t wait; // Waiting for the next frame
+	latency_hist_t send; // Each send of a part header, frame or boundary
+	latency_hist_t gap;	 // Time between two frames sent
+	latency_hist_t age;	 // Capture to start of sending (queueing)
+} stream_client_t;
+
+// Structure for one /capture request, answered by its own task once a frame is there
+typedef struct
+{
+	handoff_socket_t sock;
+	bool wait_new; // Only a frame captured after the request will do
+} capture_client_t;
+
+#define MAX_STREAM_CLIENTS 4
+#define MAX_CAPTURE_CLIENTS 4 // Snapshots being waited for or sent at the same time
+#define STREAM_KEEPALIVE_MS 1000 // An unchanged scene is still sent this often
+
+#define EVENTS_MAX_CLIENTS 3			 // Open /events connections (each one keeps a server socket)
+#define EVENTS_STATS_INTERVAL_MS 1000 // Period of the stream health events
+
+// Kinds of position events
+typedef enum
+{
+	POSITION_GPS,  // GPS fix
+	POSITION_POSE, // Estimate between fixes
+} position_kind_t;
+
+// Structure for a position queued for the /events subscribers
+typedef struct
+{
+	position_kind_t kind;
+	uint32_t seq;	  // GPS fix or pose version
+	uint32_t time_ms; // millis() when the position was computed
+	float lat;
+	float lon;
+	float heading; // Degrees, pose only
+} position_event_t;
+
+#define STATUS_MAX_FIELDS 40
+
+#define TRACK_CHUNK_SIZE 1024 // Size of the GeoJSON chunks sent by /track
+
+#define CAPTURE_MAX_AGE_MS 500	// Older cached frames are not served by /capture, it waits for a new one
+#define CAPTURE_TIMEOUT_MS 3000 // Longest /capture waits for the camera
+
+// Structure for the cached /status response
+typedef struct
+{
+	char json[1024];					   // Full JSON document
+	size_t len;
+	uint16_t field_off[STATUS_MAX_FIELDS]; // Start of each "key":value pair in json
+	uint16_t field_len[STATUS_MAX_FIELDS];
+	int field_count;
+	uint32_t version;		// Incremented on every rebuild, used for the ETag
+	char etag[16];
+	camera_status_t camera; // Sensor settings the JSON was built from
+	uint32_t gps_version;	// GPS fix the JSON was built from
+	uint32_t pose_version;	// Pose estimate the JSON was built from
+	esp_err_t camera_error; // Camera driver state the JSON was built from
+} status_snapshot_t;
+
+// Drive directions shared by the GET routes and the WebSocket control channel
+typedef enum
+{
+	DRIVE_STOP,
+	DRIVE_FORWARD,
+	DRIVE_BACK,
+	DRIVE_LEFT,
+	DRIVE_RIGHT,
+	DRIVE_MAX
+} drive_dir_t;
+
+// UART commands sent to the Arduino for each drive direction
+static const uint8_t drive_uart_cmds[DRIVE_MAX] = {CAR_CMD_STOP, CAR_CMD_FORWARD, CAR_CMD_BACK, CAR_CMD_LEFT, CAR_CMD_RIGHT};
+static const char *drive_names[DRIVE_MAX] = {"stop", "forward", "back", "left", "right"};
+
+// Where a drive command came from
+typedef enum
+{
+	COMMAND_HTTP, // GET routes
+	COMMAND_WS,	  // WebSocket control channel
+	COMMAND_SOURCES
+} command_source_t;
+
+// WebSocket control frames
+#define CONTROL_FRAME_LEN 4
+#define CONTROL_DRIVE 0x10	 // Joystick frame [0x10, throttle, steering, seq lo, seq hi]
+#define CONTROL_DRIVE_LEN 5
+#define CONTROL_ACK 0xFF
+#define CONTROL_ACK_OK 0
+#define CONTROL_ACK_BAD_COMMAND 1
+
 // Define constants for image data transmission
 #define PART_BOUNDARY "123456789000000000000987654321"
-static const char *_STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
+static const char *_STREAM_RESPONSE = "HTTP/1.1 200 OK\r\n"
+									   "Content-Type: multipart/x-mixed-replace;boundary=" PART_BOUNDARY "\r\n"
+									   "Access-Control-Allow-Origin: *\r\n"
+									   "Referrer-Policy: no-referrer\r\n"
+									   "Cache-Control: no-cache\r\n"
+									   "Connection: close\r\n\r\n";
+static const char *_EVENTS_RESPONSE = "HTTP/1.1 200 OK\r\n"
+									   "Content-Type: text/event-stream\r\n"
+									   "Access-Control-Allow-Origin: *\r\n"
+									   "Cache-Control: no-cache\r\n"
+									   "Connection: close\r\n\r\n"
+									   "retry: 2000\n\n";
+static const char *_CAPTURE_RESPONSE = "HTTP/1.1 200 OK\r\n"
+										"Content-Type: image/jpeg\r\n"
+										"Content-Length: %u\r\n"
+										"Content-Disposition: inline; filename=capture.jpg\r\n"
+										"Access-Control-Allow-Origin: *\r\n"
+										"Cache-Control: no-cache\r\n"
+										"X-Timestamp: %d.%06d\r\n"
+										"X-Frame-Seq: %u\r\n"
+										"Connection: close\r\n\r\n";
+static const char *_CAPTURE_FAILED = "HTTP/1.1 500 Internal Server Error\r\n"
+									 "Content-Length: 0\r\n"
+									 "Access-Control-Allow-Origin: *\r\n"
+									 "Connection: close\r\n\r\n";
 static const char *_STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
-static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n";
-static ra_filter_t ra_filter;
+static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\nX-Frame-Seq: %u\r\nX-Frame-Age: %u\r\nX-Motion: %d\r\n\r\n";
 httpd_handle_t stream_httpd = NULL;
 httpd_handle_t camera_httpd = NULL;
+static stream_client_t stream_clients[MAX_STREAM_CLIENTS];
+static portMUX_TYPE handoff_mux = portMUX_INITIALIZER_UNLOCKED;
+static handoff_socket_t event_clients[EVENTS_MAX_CLIENTS];
+static capture_client_t capture_clients[MAX_CAPTURE_CLIENTS];
+static QueueHandle_t events_queue = NULL;	  // GPS fixes, every one is sent
+static TaskHandle_t events_task_handle = NULL; // Woken by every published position
+static portMUX_TYPE pose_mux = portMUX_INITIALIZER_UNLOCKED;
+static position_event_t pending_pose; // Newest pose not sent yet, a newer one replaces it
+static bool pose_pending = false;
+static uint32_t event_id = 0;				  // Id of the last event sent, orders gps and stats events
+static volatile uint32_t stream_bytes_sent = 0; // Bytes sent to all stream viewers, for the bitrate
+static volatile uint32_t stream_frames_sent = 0;
+static volatile uint32_t stream_frames_suppressed = 0; // Unchanged frames not sent, summed over all viewers
+static volatile uint32_t captures_served = 0;		   // Still images sent by /capture
+// Counters below are only written by the control server task
+static uint32_t drive_commands[COMMAND_SOURCES][DRIVE_MAX];
+static uint32_t mode_switches[2]; // To auto, to manual
+static uint32_t joystick_commands; // CONTROL_DRIVE frames forwarded to the Arduino
+static status_snapshot_t status_snapshot;
+static SemaphoreHandle_t status_lock = NULL;
 
 // Function to initialize the filter
 static ra_filter_t *ra_filter_init(ra_filter_t *filter, size_t sample_size)
@@ -104,93 +285,415 @@ static esp_err_t options_handler(httpd_req_t *req)
 	return httpd_resp_send(req, NULL, 0); // No content needed
 }
 
-// Handler for streaming image data
-static esp_err_t stream_handler(httpd_req_t *req)
+// Function to send a whole buffer on a handed over socket
+static bool handoff_send_all(int fd, const char *buf, size_t len)
 {
-	set_cors_headers(req);
-	camera_fb_t *fb = NULL;
-	esp_err_t res = ESP_OK;
-	size_t _jpg_buf_len = 0;
-	uint8_t *_jpg_buf = NULL;
-	char *part_buf[64];
+	while (len > 0)
+	{
+		int sent = send(fd, buf, len, 0);
+		if (sent <= 0)
+		{
+			return false;
+		}
+		buf += sent;
+		len -= sent;
+	}
+	return true;
+}
 
-	static int64_t last_frame = 0;
-	if (!last_frame)
+// Function to take over the socket of a request, fails if the slot is in use
+static bool handoff_claim(handoff_socket_t *sock, httpd_req_t *req)
+{
+	bool claimed = false;
+	portENTER_CRITICAL(&handoff_mux);
+	if (sock->state == HANDOFF_FREE)
 	{
-		last_frame = esp_timer_get_time();
+		sock->state = HANDOFF_ACTIVE;
+		claimed = true;
 	}
+	portEXIT_CRITICAL(&handoff_mux);
+	if (claimed)
+	{
+		sock->hd = req->handle;
+		sock->fd = httpd_req_to_sockfd(req);
+		// Do not let a stalled client block our task forever
+		struct timeval timeout = {.tv_sec = 5, .tv_usec = 0};
+		setsockopt(sock->fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+	}
+	return claimed;
+}
 
-	res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
-	if (res != ESP_OK)
+// Function to close a handed over socket once both the server and our task are done with it
+static void handoff_detach(handoff_socket_t *sock, bool from_server)
+{
+	bool close_now = false;
+	portENTER_CRITICAL(&handoff_mux);
+	if (sock->state == HANDOFF_ACTIVE)
 	{
-		return res;
+		// The other side still uses the socket, let it close the descriptor
+		sock->state = from_server ? HANDOFF_PEER_GONE : HANDOFF_TASK_GONE;
+	}
+	else
+	{
+		sock->state = HANDOFF_FREE;
+		close_now = true;
+	}
+	portEXIT_CRITICAL(&handoff_mux);
+	if (close_now)
+	{
+		close(sock->fd);
 	}
+}
 
-	while (true)
+// Function for our task to give up a socket, asking the server to drop the session if the peer is still there
+static void handoff_release(handoff_socket_t *sock)
+{
+	if (sock->state == HANDOFF_ACTIVE)
 	{
-		fb = esp_camera_fb_get(); // Get image from camera
-		if (!fb)
+		// The close callback of the server finishes the cleanup
+		httpd_sess_trigger_close(sock->hd, sock->fd);
+	}
+	handoff_detach(sock, false);
+}
+
+// Function for our task to give a socket back to the server, which closes it with the session
+static void handoff_return(handoff_socket_t *sock)
+{
+	portENTER_CRITICAL(&handoff_mux);
+	// The server has already been through its close callback if the peer is gone
+	bool close_now = sock->state == HANDOFF_PEER_GONE;
+	sock->state = HANDOFF_FREE;
+	portEXIT_CRITICAL(&handoff_mux);
+	if (close_now)
+	{
+		close(sock->fd);
+	}
+}
+
+// Function called from a server close callback, returns false if the socket is not handed over
+static bool handoff_server_closed(handoff_socket_t *sock, int sockfd)
+{
+	if (sock->fd == sockfd && sock->state != HANDOFF_FREE)
+	{
+		handoff_detach(sock, true);
+		return true;
+	}
+	return false;
+}
+
+// Function to send part of a frame to a stream client and record how long it took
+static bool stream_send_timed(stream_client_t *client, const char *buf, size_t len)
+{
+	int64_t start = esp_timer_get_time();
+	bool ok = handoff_send_all(client->sock.fd, buf, len);
+	latency_hist_add(&client->send, esp_timer_get_time() - start);
+	return ok;
+}
+
+// Task that sends the newest captured frames to one stream client
+static void stream_client_task(void *arg)
+{
+	stream_client_t *client = (stream_client_t *)arg;
+	char part_buf[192];
+	uint32_t last_seq = 0;
+	uint32_t last_scene = 0;
+	int64_t last_sent = 0;
+	int64_t last_frame = esp_timer_get_time();
+	int64_t wait_start = last_frame;
+
+	bool ok = handoff_send_all(client->sock.fd, _STREAM_RESPONSE, strlen(_STREAM_RESPONSE));
+	frame_ring_subscribe();
+	while (ok && client->sock.state == HANDOFF_ACTIVE)
+	{
+		shared_frame_t *frame = frame_ring_acquire(last_seq, pdMS_TO_TICKS(100));
+		if (!frame)
 		{
-			Serial.printf("Camera capture failed");
-			res = ESP_FAIL;
+			continue;
 		}
-		else
+		int64_t send_start = esp_timer_get_time();
+		latency_hist_add(&client->wait, send_start - wait_start);
+		// Frames published while the previous one was being sent are skipped
+		if (last_seq)
+		{
+			client->skipped += frame->seq - last_seq - 1;
+		}
+		last_seq = frame->seq;
+		// A parked car sees the same scene over and over, it is only repeated as a keep-alive
+		if (frame->scene == last_scene && send_start - last_sent < STREAM_KEEPALIVE_MS * 1000LL)
 		{
-			if (fb->format != PIXFORMAT_JPEG)
+			frame_ring_release(frame);
+			client->suppressed++;
+			__atomic_fetch_add(&stream_frames_suppressed, 1, __ATOMIC_RELAXED);
+			wait_start = send_start;
+			continue;
+		}
+		last_scene = frame->scene;
+		last_sent = send_start;
+		size_t frame_len = frame->len;
+		int64_t captured = frame->timestamp.tv_sec * 1000000LL + frame->timestamp.tv_usec;
+		uint32_t age = send_start > captured ? send_start - captured : 0;
+		latency_hist_add(&client->age, age);
+		size_t hlen = snprintf(part_buf, sizeof(part_buf), _STREAM_PART, frame->len,
+							   (int)frame->timestamp.tv_sec, (int)frame->timestamp.tv_usec, (unsigned)frame->seq, (unsigned)age, frame->motion);
+		ok = stream_send_timed(client, part_buf, hlen) &&
+			 stream_send_timed(client, (const char *)frame->buf, frame->len) &&
+			 stream_send_timed(client, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+		frame_ring_release(frame);
+		if (ok)
+		{
+			__atomic_fetch_add(&stream_bytes_sent, hlen + frame_len + strlen(_STREAM_BOUNDARY), __ATOMIC_RELAXED);
+			// The first frame after reset closes the boot timeline
+			if (__atomic_fetch_add(&stream_frames_sent, 1, __ATOMIC_RELAXED) == 0)
 			{
-				bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-				esp_camera_fb_return(fb);
-				fb = NULL;
-				if (!jpeg_converted)
-				{
-					Serial.printf("JPEG compression failed");
-					res = ESP_FAIL;
-				}
+				boot_mark("first frame served");
 			}
-			else
+			client->frames++;
+		}
+
+		int64_t fr_end = esp_timer_get_time();
+		latency_hist_add(&client->gap, fr_end - last_frame);
+		int64_t frame_time = (fr_end - last_frame) / 1000;
+		last_frame = fr_end;
+		wait_start = fr_end;
+		client->avg_frame_time = ra_filter_run(&client->frame_filter, frame_time);
+		if (ok)
+		{
+			stream_control_report(client->avg_frame_time, (fr_end - send_start) / 1000, frame_len);
+		}
+	}
+	frame_ring_unsubscribe();
+
+	free(client->frame_filter.values);
+	handoff_release(&client->sock);
+	vTaskDelete(NULL);
+}
+
+// Close callback of the stream server: sockets owned by a client task are closed by that task
+static void stream_close_fn(httpd_handle_t hd, int sockfd)
+{
+	for (int i = 0; i < MAX_STREAM_CLIENTS; i++)
+	{
+		if (handoff_server_closed(&stream_clients[i].sock, sockfd))
+		{
+			return;
+		}
+	}
+	close(sockfd);
+}
+
+// Handler for streaming image data: hands the socket over to a dedicated client task
+static esp_err_t stream_handler(httpd_req_t *req)
+{
+	stream_client_t *client = NULL;
+	for (int i = 0; i < MAX_STREAM_CLIENTS && !client; i++)
+	{
+		if (handoff_claim(&stream_clients[i].sock, req))
+		{
+			client = &stream_clients[i];
+		}
+	}
+	if (!client)
+	{
+		set_cors_headers(req);
+		httpd_resp_set_status(req, "503 Service Unavailable");
+		return httpd_resp_send(req, "Too many viewers", HTTPD_RESP_USE_STRLEN);
+	}
+
+	client->avg_frame_time = 0;
+	client->frames = 0;
+	client->skipped = 0;
+	client->suppressed = 0;
+	memset(&client->wait, 0, sizeof(client->wait));
+	memset(&client->send, 0, sizeof(client->send));
+	memset(&client->gap, 0, sizeof(client->gap));
+	memset(&client->age, 0, sizeof(client->age));
+	ra_filter_init(&client->frame_filter, 20);
+
+	if (xTaskCreatePinnedToCore(stream_client_task, "stream_client", 4096, client, 5, NULL, tskNO_AFFINITY) != pdPASS)
+	{
+		free(client->frame_filter.values);
+		client->sock.state = HANDOFF_FREE;
+		return httpd_resp_send_500(req);
+	}
+	return ESP_OK;
+}
+
+// Function to send one event to every /events subscriber (called from the events task only)
+static void events_broadcast(const char *event, size_t len)
+{
+	for (int i = 0; i < EVENTS_MAX_CLIENTS; i++)
+	{
+		handoff_socket_t *sock = &event_clients[i];
+		if (sock->state == HANDOFF_ACTIVE)
+		{
+			if (!handoff_send_all(sock->fd, event, len))
 			{
-				_jpg_buf_len = fb->len;
-				_jpg_buf = fb->buf;
+				handoff_release(sock);
 			}
 		}
-		if (res == ESP_OK)
+		else if (sock->state == HANDOFF_PEER_GONE)
 		{
-			size_t hlen = snprintf((char *)part_buf, 64, _STREAM_PART, _jpg_buf_len);
-			res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
+			handoff_detach(sock, false);
 		}
-		if (res == ESP_OK)
+	}
+}
+
+// Function to count the connected /events subscribers
+static int events_subscribers()
+{
+	int count = 0;
+	for (int i = 0; i < EVENTS_MAX_CLIENTS; i++)
+	{
+		count += event_clients[i].state == HANDOFF_ACTIVE;
+	}
+	return count;
+}
+
+// Function to send a GPS fix or pose estimate to every /events subscriber (called from the events task only)
+static void events_send_position(const position_event_t *pos)
+{
+	char event[160];
+	int len;
+	if (pos->kind == POSITION_GPS)
+	{
+		len = snprintf(event, sizeof(event), "id: %u\nevent: gps\ndata: {\"seq\":%u,\"t\":%u,\"lat\":%.6f,\"lon\":%.6f}\n\n",
+					   (unsigned)++event_id, (unsigned)pos->seq, (unsigned)pos->time_ms, pos->lat, pos->lon);
+	}
+	else
+	{
+		len = snprintf(event, sizeof(event), "id: %u\nevent: pose\ndata: {\"seq\":%u,\"t\":%u,\"lat\":%.7f,\"lon\":%.7f,\"heading\":%.1f}\n\n",
+					   (unsigned)++event_id, (unsigned)pos->seq, (unsigned)pos->time_ms, pos->lat, pos->lon, pos->heading);
+	}
+	events_broadcast(event, len);
+}
+
+// Task that pushes GPS fixes and pose estimates as they arrive and stream health once per interval
+static void events_task(void *arg)
+{
+	char event[192];
+	position_event_t pos;
+	int64_t last_stats = esp_timer_get_time();
+	uint32_t last_bytes = stream_bytes_sent;
+	while (true)
+	{
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENTS_STATS_INTERVAL_MS));
+		// Every queued GPS fix, then the newest pose (older ones were replaced and never crowd out a fix)
+		while (xQueueReceive(events_queue, &pos, 0) == pdTRUE)
 		{
-			res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
+			events_send_position(&pos);
 		}
-		if (res == ESP_OK)
+		portENTER_CRITICAL(&pose_mux);
+		bool have_pose = pose_pending;
+		pos = pending_pose;
+		pose_pending = false;
+		portEXIT_CRITICAL(&pose_mux);
+		if (have_pose)
 		{
-			res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+			events_send_position(&pos);
 		}
-		if (fb)
+
+		int64_t now = esp_timer_get_time();
+		if (now - last_stats < EVENTS_STATS_INTERVAL_MS * 1000LL)
 		{
-			esp_camera_fb_return(fb);
-			fb = NULL;
-			_jpg_buf = NULL;
+			continue;
 		}
-		else if (_jpg_buf)
+		uint32_t bytes = stream_bytes_sent;
+		uint32_t kbps = (uint64_t)(bytes - last_bytes) * 8000 / (now - last_stats);
+		last_stats = now;
+		last_bytes = bytes;
+		if (!events_subscribers())
 		{
-			free(_jpg_buf);
-			_jpg_buf = NULL;
+			continue;
 		}
-		if (res != ESP_OK)
+
+		int viewers = 0;
+		for (int i = 0; i < MAX_STREAM_CLIENTS; i++)
 		{
-			break;
+			viewers += stream_clients[i].sock.state == HANDOFF_ACTIVE;
 		}
-		int64_t fr_end = esp_timer_get_time();
+		uint32_t frame_time = frame_ring_avg_frame_time();
+		int len = snprintf(event, sizeof(event), "id: %u\nevent: stats\ndata: {\"t\":%u,\"fps\":%.1f,\"kbps\":%u,\"heap\":%u,\"viewers\":%d,\"motion\":%d}\n\n",
+						   (unsigned)++event_id, (unsigned)millis(), (viewers && frame_time) ? 1000.0f / frame_time : 0.0f,
+						   (unsigned)kbps, (unsigned)esp_get_free_heap_size(), viewers, frame_ring_motion());
+		events_broadcast(event, len);
+	}
+}
 
-		int64_t frame_time = fr_end - last_frame;
-		last_frame = fr_end;
-		frame_time /= 1000;
-		uint32_t avg_frame_time = ra_filter_run(&ra_filter, frame_time);
+// Function to queue a new GPS fix for the /events subscribers (called from the GPS task, never blocks)
+void events_publish_gps(float lat, float lon, uint32_t seq)
+{
+	if (!events_task_handle)
+	{
+		return;
+	}
+	position_event_t fix = {.kind = POSITION_GPS, .seq = seq, .time_ms = (uint32_t)millis(), .lat = lat, .lon = lon, .heading = 0};
+	if (xQueueSend(events_queue, &fix, 0) == pdTRUE)
+	{
+		xTaskNotifyGive(events_task_handle);
+	}
+}
+
+// Function to hand a new pose estimate to the /events subscribers (called from the pose task, never blocks).
+// It replaces a pose the events task has not sent yet, so poses never take the place of a GPS fix
+void events_publish_pose(float lat, float lon, float heading, uint32_t seq)
+{
+	if (!events_task_handle || !events_subscribers())
+	{
+		return;
+	}
+	position_event_t pose = {.kind = POSITION_POSE, .seq = seq, .time_ms = (uint32_t)millis(), .lat = lat, .lon = lon, .heading = heading};
+	portENTER_CRITICAL(&pose_mux);
+	pending_pose = pose;
+	pose_pending = true;
+	portEXIT_CRITICAL(&pose_mux);
+	xTaskNotifyGive(events_task_handle);
+}
+
+// Close callback of the control server: /events and /capture sockets are closed by their tasks
+static void camera_close_fn(httpd_handle_t hd, int sockfd)
+{
+	for (int i = 0; i < EVENTS_MAX_CLIENTS; i++)
+	{
+		if (handoff_server_closed(&event_clients[i], sockfd))
+		{
+			return;
+		}
 	}
+	for (int i = 0; i < MAX_CAPTURE_CLIENTS; i++)
+	{
+		if (handoff_server_closed(&capture_clients[i].sock, sockfd))
+		{
+			return;
+		}
+	}
+	close(sockfd);
+}
 
-	last_frame = 0;
-	return res;
+// Handler for the Server-Sent Events telemetry stream: the socket is handed over to the events task
+static esp_err_t events_handler(httpd_req_t *req)
+{
+	// Only the server task claims slots, so a free slot found here stays free until we claim it
+	handoff_socket_t *sock = NULL;
+	for (int i = 0; i < EVENTS_MAX_CLIENTS && !sock; i++)
+	{
+		if (event_clients[i].state == HANDOFF_FREE)
+		{
+			sock = &event_clients[i];
+		}
+	}
+	if (!sock)
+	{
+		set_cors_headers(req);
+		httpd_resp_set_status(req, "503 Service Unavailable");
+		return httpd_resp_send(req, "Too many subscribers", HTTPD_RESP_USE_STRLEN);
+	}
+	// Send the headers before the events task can see the socket
+	if (!handoff_send_all(httpd_req_to_sockfd(req), _EVENTS_RESPONSE, strlen(_EVENTS_RESPONSE)))
+	{
+		return ESP_FAIL;
+	}
+	handoff_claim(sock, req);
+	return ESP_OK;
 }
 
 // Handler for controlling camera parameters via URL
@@ -245,11 +748,37 @@ static esp_err_t cmd_handler(httpd_req_t *req)
 
 	if (!strcmp(variable, "framesize"))
 	{
-		if (s->pixformat == PIXFORMAT_JPEG)
-			res = s->set_framesize(s, (framesize_t)val);
+		if (!s || s->pixformat == PIXFORMAT_JPEG)
+		{
+			stream_control_enable(false); // A manual choice overrides the adaptive controller
+			// Frame buffers are sized for streaming, a larger frame size needs them reallocated first.
+			// With the camera down this also retries bringing it back
+			if (camera_reconfigure((framesize_t)val))
+			{
+				s = esp_camera_sensor_get();
+				res = s->set_framesize(s, (framesize_t)val);
+			}
+			else
+			{
+				res = -1;
+			}
+		}
+	}
+	else if (!s && strcmp(variable, "adaptive") && strcmp(variable, "motion") && strcmp(variable, "record"))
+	{
+		res = -1; // Sensor settings need the driver, answered below
 	}
 	else if (!strcmp(variable, "quality"))
+	{
+		stream_control_enable(false);
 		res = s->set_quality(s, val);
+	}
+	else if (!strcmp(variable, "adaptive"))
+		stream_control_enable(val);
+	else if (!strcmp(variable, "motion"))
+		frame_ring_set_motion_threshold(val); // 0 sends every frame
+	else if (!strcmp(variable, "record"))
+		res = recorder_record(val) ? 0 : -1;
 	else if (!strcmp(variable, "contrast"))
 		res = s->set_contrast(s, val);
 	else if (!strcmp(variable, "brightness"))
@@ -298,6 +827,12 @@ static esp_err_t cmd_handler(httpd_req_t *req)
 	{
 		res = -1;
 	}
+	if (res && camera_error() != ESP_OK)
+	{
+		set_cors_headers(req);
+		httpd_resp_set_status(req, "503 Service Unavailable");
+		return httpd_resp_send(req, "Camera not available", HTTPD_RESP_USE_STRLEN);
+	}
 	if (res)
 	{
 		return httpd_resp_send_500(req);
@@ -306,146 +841,657 @@ static esp_err_t cmd_handler(httpd_req_t *req)
 	return httpd_resp_send(req, NULL, 0);
 }
 
-// Handler to return the status of the camera and GPS coordinates in JSON format
-static esp_err_t status_handler(httpd_req_t *req)
+// Function to check whether the client already has the given version of a resource
+static bool etag_matches(httpd_req_t *req, const char *etag)
+{
+	char value[48];
+	size_t len = httpd_req_get_hdr_value_len(req, "If-None-Match");
+	if (len == 0 || len >= sizeof(value))
+	{
+		return false;
+	}
+	if (httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) != ESP_OK)
+	{
+		return false;
+	}
+	return strstr(value, etag) != NULL;
+}
+
+// Function to append one "key":value pair to the status snapshot
+static void status_add_field(status_snapshot_t *snap, const char *fmt, ...)
+{
+	if (snap->field_count >= STATUS_MAX_FIELDS)
+	{
+		return;
+	}
+	size_t sep = snap->field_count > 0 ? 1 : 0;		  // Comma before every field but the first
+	size_t room = sizeof(snap->json) - snap->len - 1; // Keep space for the closing brace
+	if (room <= sep)
+	{
+		return;
+	}
+	// The field goes after the place of the separator, which is only written once the field fits
+	va_list args;
+	va_start(args, fmt);
+	int n = vsnprintf(&snap->json[snap->len + sep], room - sep, fmt, args);
+	va_end(args);
+	if (n < 0 || (size_t)n >= room - sep)
+	{
+		return;
+	}
+	if (sep)
+	{
+		snap->json[snap->len] = ',';
+	}
+	snap->field_off[snap->field_count] = snap->len + sep;
+	snap->field_len[snap->field_count] = n;
+	snap->field_count++;
+	snap->len += sep + n;
+}
+
+// Function to rebuild the status JSON when the sensor settings or the GPS fix changed (must hold status_lock)
+static void status_refresh(status_snapshot_t *snap)
 {
-	Serial.println("Status handler called");
-	set_cors_headers(req);
-	static char json_response[1024];
 	sensor_t *s = esp_camera_sensor_get();
-	char *p = json_response;
-	*p++ = '{';
-	// ESP32 CAM status
-	p += sprintf(p, "\"framesize\":%u,", s->status.framesize);
-	p += sprintf(p, "\"quality\":%u,", s->status.quality);
-	p += sprintf(p, "\"brightness\":%d,", s->status.brightness);
-	p += sprintf(p, "\"contrast\":%d,", s->status.contrast);
-	p += sprintf(p, "\"saturation\":%d,", s->status.saturation);
-	p += sprintf(p, "\"special_effect\":%u,", s->status.special_effect);
-	p += sprintf(p, "\"wb_mode\":%u,", s->status.wb_mode);
-	p += sprintf(p, "\"awb\":%u,", s->status.awb);
-	p += sprintf(p, "\"awb_gain\":%u,", s->status.awb_gain);
-	p += sprintf(p, "\"aec\":%u,", s->status.aec);
-	p += sprintf(p, "\"aec2\":%u,", s->status.aec2);
-	p += sprintf(p, "\"ae_level\":%d,", s->status.ae_level);
-	p += sprintf(p, "\"aec_value\":%u,", s->status.aec_value);
-	p += sprintf(p, "\"agc\":%u,", s->status.agc);
-	p += sprintf(p, "\"agc_gain\":%u,", s->status.agc_gain);
-	p += sprintf(p, "\"gainceiling\":%u,", s->status.gainceiling);
-	p += sprintf(p, "\"bpc\":%u,", s->status.bpc);
-	p += sprintf(p, "\"wpc\":%u,", s->status.wpc);
-	p += sprintf(p, "\"raw_gma\":%u,", s->status.raw_gma);
-	p += sprintf(p, "\"lenc\":%u,", s->status.lenc);
-	p += sprintf(p, "\"hmirror\":%u,", s->status.hmirror);
-	p += sprintf(p, "\"dcw\":%u,", s->status.dcw);
-	p += sprintf(p, "\"colorbar\":%u,", s->status.colorbar);
+	camera_status_t camera;
+	if (s)
+	{
+		camera = s->status;
+	}
+	else
+	{
+		memset(&camera, 0, sizeof(camera)); // Driver down after a failed reconfigure
+	}
+	esp_err_t error = camera_error();
+	uint32_t gps_version = gps_fix_version();
+	bool pose_changed = pose_version() != snap->pose_version;
+	if (snap->version && gps_version == snap->gps_version && !pose_changed && error == snap->camera_error && !memcmp(&camera, &snap->camera, sizeof(camera_status_t)))
+	{
+		return; // Nothing changed since the last poll
+	}
+	gps_fix_t fix;
+	snap->gps_version = gps_get_fix(&fix);
+	snap->camera = camera;
+	snap->camera_error = error;
+	const camera_status_t *st = &snap->camera;
+	snap->field_count = 0;
+	snap->len = 0;
+	snap->json[snap->len++] = '{';
+	// ESP32 CAM status, camera_error is the esp_err_t that left the driver down (0 while it works)
+	status_add_field(snap, "\"camera_error\":%d", error);
+	status_add_field(snap, "\"framesize\":%u", st->framesize);
+	status_add_field(snap, "\"quality\":%u", st->quality);
+	status_add_field(snap, "\"brightness\":%d", st->brightness);
+	status_add_field(snap, "\"contrast\":%d", st->contrast);
+	status_add_field(snap, "\"saturation\":%d", st->saturation);
+	status_add_field(snap, "\"special_effect\":%u", st->special_effect);
+	status_add_field(snap, "\"wb_mode\":%u", st->wb_mode);
+	status_add_field(snap, "\"awb\":%u", st->awb);
+	status_add_field(snap, "\"awb_gain\":%u", st->awb_gain);
+	status_add_field(snap, "\"aec\":%u", st->aec);
+	status_add_field(snap, "\"aec2\":%u", st->aec2);
+	status_add_field(snap, "\"ae_level\":%d", st->ae_level);
+	status_add_field(snap, "\"aec_value\":%u", st->aec_value);
+	status_add_field(snap, "\"agc\":%u", st->agc);
+	status_add_field(snap, "\"agc_gain\":%u", st->agc_gain);
+	status_add_field(snap, "\"gainceiling\":%u", st->gainceiling);
+	status_add_field(snap, "\"bpc\":%u", st->bpc);
+	status_add_field(snap, "\"wpc\":%u", st->wpc);
+	status_add_field(snap, "\"raw_gma\":%u", st->raw_gma);
+	status_add_field(snap, "\"lenc\":%u", st->lenc);
+	status_add_field(snap, "\"hmirror\":%u", st->hmirror);
+	status_add_field(snap, "\"dcw\":%u", st->dcw);
+	status_add_field(snap, "\"colorbar\":%u", st->colorbar);
 	// Add latitude and longitude to the JSON response
-	p += sprintf(p, "\"latitude\":%.6f,", latitude);
-	p += sprintf(p, "\"longitude\":%.6f", longitude);
-	*p++ = '}';
-	*p++ = 0;
+	status_add_field(snap, "\"latitude\":%.6f", fix.lat_e7 / 1e7);
+	status_add_field(snap, "\"longitude\":%.6f", fix.lon_e7 / 1e7);
+	// Rest of the fix, -1 when the module did not report it. The age is left out so the ETag stays valid between fixes
+	status_add_field(snap, "\"gps_speed\":%.2f", fix.speed_cms < 0 ? -1.0 : fix.speed_cms / 100.0);
+	status_add_field(snap, "\"gps_course\":%.2f", fix.course_cdeg < 0 ? -1.0 : fix.course_cdeg / 100.0);
+	status_add_field(snap, "\"gps_hdop\":%.2f", fix.hdop_c < 0 ? -1.0 : fix.hdop_c / 100.0);
+	status_add_field(snap, "\"gps_sats\":%u", fix.sats);
+	status_add_field(snap, "\"gps_date\":%u", fix.date);
+	status_add_field(snap, "\"gps_time\":%u", fix.time);
+	// Estimated pose between fixes, only changes while the car moves
+	pose_t pose;
+	snap->pose_version = pose_get(&pose);
+	if (!pose.version)
+	{
+		pose.lat_e7 = fix.lat_e7;
+		pose.lon_e7 = fix.lon_e7;
+	}
+	status_add_field(snap, "\"est_latitude\":%.7f", pose.lat_e7 / 1e7);
+	status_add_field(snap, "\"est_longitude\":%.7f", pose.lon_e7 / 1e7);
+	status_add_field(snap, "\"heading\":%.1f", pose.heading * 360.0f / 65536);
+	status_add_field(snap, "\"maps_key\":\"%s\"", AZURE_MAPS_API); // Used by the page to load the map
+	snap->json[snap->len++] = '}';
+	snap->json[snap->len] = 0;
+
+	snap->version++;
+	snprintf(snap->etag, sizeof(snap->etag), "\"s%u\"", (unsigned)snap->version);
+}
+
+// Function to check whether a status field name is listed in a ?fields=a,b,c filter
+static bool status_field_selected(const char *fields, const char *key, size_t key_len)
+{
+	const char *p = fields;
+	while (*p)
+	{
+		const char *end = strchr(p, ',');
+		size_t len = end ? (size_t)(end - p) : strlen(p);
+		if (len == key_len && !strncmp(p, key, len))
+		{
+			return true;
+		}
+		if (!end)
+		{
+			break;
+		}
+		p = end + 1;
+	}
+	return false;
+}
+
+// Handler to return the status of the camera and GPS coordinates in JSON format.
+// The JSON is only rebuilt when something changed, supports If-None-Match and an optional ?fields= filter
+static esp_err_t status_handler(httpd_req_t *req)
+{
+	set_cors_headers(req);
+	char fields[128] = {
+		0,
+	};
+	char query[160];
+	if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+	{
+		httpd_query_key_value(query, "fields", fields, sizeof(fields));
+	}
+
+	char response[sizeof(status_snapshot.json)];
+	char etag[sizeof(status_snapshot.etag)];
+	size_t len = 0;
+
+	xSemaphoreTake(status_lock, portMAX_DELAY);
+	status_refresh(&status_snapshot);
+	strcpy(etag, status_snapshot.etag);
+	if (!fields[0])
+	{
+		len = status_snapshot.len;
+		memcpy(response, status_snapshot.json, len);
+	}
+	else
+	{
+		// Copy only the requested "key":value pairs
+		response[len++] = '{';
+		for (int i = 0; i < status_snapshot.field_count; i++)
+		{
+			const char *pair = &status_snapshot.json[status_snapshot.field_off[i]];
+			const char *key_end = strchr(pair + 1, '"');
+			if (!status_field_selected(fields, pair + 1, key_end - pair - 1))
+			{
+				continue;
+			}
+			if (len > 1)
+			{
+				response[len++] = ',';
+			}
+			memcpy(&response[len], pair, status_snapshot.field_len[i]);
+			len += status_snapshot.field_len[i];
+		}
+		response[len++] = '}';
+	}
+	xSemaphoreGive(status_lock);
+
+	httpd_resp_set_hdr(req, "ETag", etag);
+	httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+	if (etag_matches(req, etag))
+	{
+		httpd_resp_set_status(req, "304 Not Modified");
+		return httpd_resp_send(req, NULL, 0);
+	}
 	httpd_resp_set_type(req, "application/json");
+	return httpd_resp_send(req, response, len);
+}
+
+// Structure for building a chunked /metrics response
+typedef struct
+{
+	httpd_req_t *req;
+	char buf[1024];
+	size_t len;
+	esp_err_t res;
+} metrics_writer_t;
 
-	return httpd_resp_send(req, json_response, strlen(json_response));
+// Function to append one line to the /metrics response, sending a chunk whenever the buffer fills up
+static void metrics_printf(metrics_writer_t *w, const char *fmt, ...)
+{
+	if (w->res != ESP_OK)
+	{
+		return;
+	}
+	for (int attempt = 0; attempt < 2; attempt++)
+	{
+		va_list args;
+		va_start(args, fmt);
+		int n = vsnprintf(&w->buf[w->len], sizeof(w->buf) - w->len, fmt, args);
+		va_end(args);
+		if (n >= 0 && w->len + n < sizeof(w->buf))
+		{
+			w->len += n;
+			return;
+		}
+		// Did not fit: send what is buffered and try again with an empty buffer
+		w->res = httpd_resp_send_chunk(w->req, w->buf, w->len);
+		w->len = 0;
+		if (w->res != ESP_OK)
+		{
+			return;
+		}
+	}
 }
 
-// Handler for the main web page
+// Function to write a capture stage histogram in Prometheus format
+static void metrics_histogram(metrics_writer_t *w, const char *stage, const latency_hist_t *hist)
+{
+	uint32_t cumulative = 0;
+	for (int i = 0; i < LATENCY_HIST_BUCKETS - 1; i++)
+	{
+		cumulative += hist->buckets[i];
+		metrics_printf(w, "car_capture_stage_seconds_bucket{stage=\"%s\",le=\"%.3f\"} %u\n", stage, (1u << i) / 1000.0, (unsigned)cumulative);
+	}
+	metrics_printf(w, "car_capture_stage_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %u\n", stage, (unsigned)hist->count);
+	metrics_printf(w, "car_capture_stage_seconds_sum{stage=\"%s\"} %.6f\n", stage, hist->sum_us / 1e6);
+	metrics_printf(w, "car_capture_stage_seconds_count{stage=\"%s\"} %u\n", stage, (unsigned)hist->count);
+}
+
+// Handler for runtime counters and gauges in the Prometheus text format.
+// Every value is read without locks, so scraping does not slow the stream down
+static esp_err_t metrics_handler(httpd_req_t *req)
+{
+	metrics_writer_t *w = (metrics_writer_t *)malloc(sizeof(metrics_writer_t)); // Too big for the server task stack
+	if (!w)
+	{
+		return httpd_resp_send_500(req);
+	}
+	w->req = req;
+	w->len = 0;
+	w->res = ESP_OK;
+	httpd_resp_set_type(req, "text/plain; version=0.0.4");
+	httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+	metrics_printf(w, "# TYPE car_uptime_seconds gauge\ncar_uptime_seconds %.3f\n", esp_timer_get_time() / 1e6);
+
+	const frame_ring_stats_t *capture = frame_ring_stats();
+	metrics_printf(w, "# TYPE car_frames_captured_total counter\ncar_frames_captured_total %u\n", (unsigned)capture->captured);
+	metrics_printf(w, "# TYPE car_capture_failures_total counter\ncar_capture_failures_total %u\n", (unsigned)capture->capture_failed);
+	metrics_printf(w, "# TYPE car_jpeg_failures_total counter\ncar_jpeg_failures_total %u\n", (unsigned)capture->convert_failed);
+	metrics_printf(w, "# TYPE car_frames_dropped_total counter\ncar_frames_dropped_total %u\n", (unsigned)capture->dropped);
+	metrics_printf(w, "# TYPE car_capture_stage_seconds histogram\n");
+	metrics_histogram(w, "fb_get", &capture->fb_get);
+	metrics_histogram(w, "convert", &capture->convert);
+	metrics_histogram(w, "copy", &capture->copy);
+	metrics_histogram(w, "decode", &capture->decode);
+	metrics_histogram(w, "motion", &capture->motion);
+	const vision_stats_t *vision = vision_stats();
+	metrics_histogram(w, "vision", &vision->process);
+	const recorder_stats_t *record = recorder_stats();
+	metrics_histogram(w, "sd_write", &record->write);
+	metrics_printf(w, "# TYPE car_recording gauge\ncar_recording %d\n", record->recording);
+	metrics_printf(w, "# TYPE car_record_frames_total counter\ncar_record_frames_total %u\n", (unsigned)record->frames);
+	metrics_printf(w, "# TYPE car_record_dropped_total counter\ncar_record_dropped_total %u\n", (unsigned)record->dropped);
+	metrics_printf(w, "# TYPE car_record_bytes_total counter\ncar_record_bytes_total %llu\n", (unsigned long long)record->bytes);
+	metrics_printf(w, "# TYPE car_record_errors_total counter\ncar_record_errors_total %u\n", (unsigned)record->errors);
+	metrics_printf(w, "# TYPE car_motion_percent gauge\ncar_motion_percent %d\n", frame_ring_motion());
+	metrics_printf(w, "# TYPE car_vision_frames_total counter\ncar_vision_frames_total %u\n", (unsigned)vision->frames);
+	metrics_printf(w, "# TYPE car_vision_clear gauge\ncar_vision_clear %u\n", vision->clear);
+	metrics_printf(w, "# TYPE car_vision_steer gauge\ncar_vision_steer %d\n", vision->steer);
+
+	int viewers = 0;
+	for (int i = 0; i < MAX_STREAM_CLIENTS; i++)
+	{
+		viewers += stream_clients[i].sock.state == HANDOFF_ACTIVE;
+	}
+	metrics_printf(w, "# TYPE car_stream_frames_total counter\ncar_stream_frames_total %u\n", (unsigned)stream_frames_sent);
+	metrics_printf(w, "# TYPE car_stream_frames_suppressed_total counter\ncar_stream_frames_suppressed_total %u\n", (unsigned)stream_frames_suppressed);
+	metrics_printf(w, "# TYPE car_stream_bytes_total counter\ncar_stream_bytes_total %u\n", (unsigned)stream_bytes_sent);
+	metrics_printf(w, "# TYPE car_captures_total counter\ncar_captures_total %u\n", (unsigned)captures_served);
+	metrics_printf(w, "# TYPE car_stream_viewers gauge\ncar_stream_viewers %d\n", viewers);
+	metrics_printf(w, "# TYPE car_stream_level gauge\ncar_stream_level %d\n", stream_control_level());
+	metrics_printf(w, "# TYPE car_events_subscribers gauge\ncar_events_subscribers %d\n", events_subscribers());
+
+	metrics_printf(w, "# TYPE car_commands_total counter\n");
+	for (int source = 0; source < COMMAND_SOURCES; source++)
+	{
+		for (int dir = 0; dir < DRIVE_MAX; dir++)
+		{
+			metrics_printf(w, "car_commands_total{source=\"%s\",command=\"%s\"} %u\n", source == COMMAND_WS ? "ws" : "http",
+						   drive_names[dir], (unsigned)drive_commands[source][dir]);
+		}
+	}
+	metrics_printf(w, "car_commands_total{source=\"ws\",command=\"drive\"} %u\n", (unsigned)joystick_commands);
+	metrics_printf(w, "car_commands_total{source=\"http\",command=\"auto\"} %u\n", (unsigned)mode_switches[0]);
+	metrics_printf(w, "car_commands_total{source=\"http\",command=\"manual\"} %u\n", (unsigned)mode_switches[1]);
+	metrics_printf(w, "# TYPE car_uart_bytes_total counter\ncar_uart_bytes_total %u\n", (unsigned)car_uart_bytes_sent);
+
+	metrics_printf(w, "# TYPE car_heap_free_bytes gauge\ncar_heap_free_bytes %u\n", (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+	metrics_printf(w, "# TYPE car_heap_min_free_bytes gauge\ncar_heap_min_free_bytes %u\n", (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+	metrics_printf(w, "# TYPE car_heap_largest_block_bytes gauge\ncar_heap_largest_block_bytes %u\n", (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+	metrics_printf(w, "# TYPE car_psram_free_bytes gauge\ncar_psram_free_bytes %u\n", (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+
+	uint32_t passed, failed, rejected;
+	gps_sentence_counters(&passed, &failed, &rejected);
+	metrics_printf(w, "# TYPE car_gps_sentences_total counter\n");
+	metrics_printf(w, "car_gps_sentences_total{result=\"ok\"} %u\n", (unsigned)passed);
+	metrics_printf(w, "car_gps_sentences_total{result=\"checksum\"} %u\n", (unsigned)failed);
+	metrics_printf(w, "car_gps_sentences_total{result=\"malformed\"} %u\n", (unsigned)rejected);
+	metrics_printf(w, "# TYPE car_gps_fixes_total counter\ncar_gps_fixes_total %u\n", (unsigned)gps_fix_version());
+	metrics_printf(w, "# TYPE car_track_points gauge\ncar_track_points %u\n", (unsigned)track_points());
+
+	esp_err_t res = w->res;
+	if (res == ESP_OK && w->len)
+	{
+		res = httpd_resp_send_chunk(req, w->buf, w->len);
+	}
+	free(w);
+	if (res != ESP_OK)
+	{
+		return res;
+	}
+	return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Function to get the frame for a snapshot: the cached newest one if it is recent, else the next one captured
+static shared_frame_t *capture_wait_frame(bool wait_new)
+{
+	// Keeps the capture task running while nobody streams
+	frame_ring_subscribe();
+	shared_frame_t *frame = frame_ring_acquire(0, 0);
+	uint32_t last_seq = 0;
+	if (frame)
+	{
+		int64_t captured = frame->timestamp.tv_sec * 1000000LL + frame->timestamp.tv_usec;
+		if (wait_new || esp_timer_get_time() - captured > CAPTURE_MAX_AGE_MS * 1000LL)
+		{
+			// Left over from the last time somebody watched, or the caller wants a later one
+			last_seq = frame->seq;
+			frame_ring_release(frame);
+			frame = NULL;
+		}
+	}
+	if (!frame)
+	{
+		frame = frame_ring_acquire(last_seq, pdMS_TO_TICKS(CAPTURE_TIMEOUT_MS));
+	}
+	frame_ring_unsubscribe();
+	return frame;
+}
+
+// Task that waits for the frame of one snapshot and sends it. With a GPS fix the image
+// carries the position as EXIF tags
+static void capture_client_task(void *arg)
+{
+	capture_client_t *client = (capture_client_t *)arg;
+	shared_frame_t *frame = capture_wait_frame(client->wait_new);
+	if (!frame)
+	{
+		handoff_send_all(client->sock.fd, _CAPTURE_FAILED, strlen(_CAPTURE_FAILED));
+		handoff_release(&client->sock);
+		vTaskDelete(NULL);
+		return;
+	}
+
+	gps_fix_t fix;
+	gps_get_fix(&fix);
+	uint8_t app1[EXIF_GPS_MAX_LEN];
+	size_t app1_len = exif_can_splice(frame->buf, frame->len) ? exif_gps_segment(&fix, app1) : 0;
+	char head[320];
+	size_t hlen = snprintf(head, sizeof(head), _CAPTURE_RESPONSE, (unsigned)(frame->len + app1_len),
+						   (int)frame->timestamp.tv_sec, (int)frame->timestamp.tv_usec, (unsigned)frame->seq);
+	const char *jpg = (const char *)frame->buf;
+	bool ok = handoff_send_all(client->sock.fd, head, hlen);
+	if (app1_len)
+	{
+		// SOI, the EXIF segment, then the rest of the frame, straight from the ring slot
+		ok = ok && handoff_send_all(client->sock.fd, jpg, EXIF_SPLICE_AT) &&
+			 handoff_send_all(client->sock.fd, (const char *)app1, app1_len) &&
+			 handoff_send_all(client->sock.fd, jpg + EXIF_SPLICE_AT, frame->len - EXIF_SPLICE_AT);
+	}
+	else
+	{
+		ok = ok && handoff_send_all(client->sock.fd, jpg, frame->len);
+	}
+	frame_ring_release(frame);
+	if (ok)
+	{
+		__atomic_fetch_add(&captures_served, 1, __ATOMIC_RELAXED);
+		// The client closes after Connection: close, and the server then closes the session. Asking the
+		// server to close it could reach it after that, when the descriptor already serves the next client
+		shutdown(client->sock.fd, SHUT_WR);
+		handoff_return(&client->sock);
+	}
+	else
+	{
+		handoff_release(&client->sock);
+	}
+	vTaskDelete(NULL);
+}
+
+// Handler for a still image. It serves the newest frame of the shared ring instead of
+// taking the camera, so snapshots never compete with the live stream.
+// ?wait_new=1 waits for a frame captured after the request arrived. The wait and the
+// send run in a task of their own, so the control routes are not held up meanwhile
+static esp_err_t capture_handler(httpd_req_t *req)
+{
+	char wait_new[4] = {
+		0,
+	};
+	char query[32];
+	if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+	{
+		httpd_query_key_value(query, "wait_new", wait_new, sizeof(wait_new));
+	}
+
+	capture_client_t *client = NULL;
+	for (int i = 0; i < MAX_CAPTURE_CLIENTS && !client; i++)
+	{
+		if (handoff_claim(&capture_clients[i].sock, req))
+		{
+			client = &capture_clients[i];
+		}
+	}
+	if (!client)
+	{
+		set_cors_headers(req);
+		httpd_resp_set_status(req, "503 Service Unavailable");
+		return httpd_resp_send(req, "Too many snapshots", HTTPD_RESP_USE_STRLEN);
+	}
+	client->wait_new = atoi(wait_new) != 0;
+	// Below the stream clients, so snapshots only use time the stream leaves
+	if (xTaskCreatePinnedToCore(capture_client_task, "capture_client", 4096, client, 4, NULL, tskNO_AFFINITY) != pdPASS)
+	{
+		client->sock.state = HANDOFF_FREE;
+		return httpd_resp_send_500(req);
+	}
+	return ESP_OK;
+}
+
+// Handler to report where the video latency goes: capture stages and, per stream client,
+// waiting for a frame, queueing since capture, each send and the gap between frames
+static esp_err_t latency_handler(httpd_req_t *req)
+{
+	static const char *capture_names[] = {"fb_get", "convert", "copy", "decode", "motion", "vision"};
+	static const char *client_names[] = {"wait", "age", "send", "gap"};
+	char buf[320];
+	set_cors_headers(req);
+	httpd_resp_set_type(req, "application/json");
+	httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+	const frame_ring_stats_t *capture = frame_ring_stats();
+	const latency_hist_t *capture_hists[] = {&capture->fb_get, &capture->convert, &capture->copy, &capture->decode, &capture->motion, &vision_stats()->process};
+	esp_err_t res = httpd_resp_send_chunk(req, "{\"capture\":{", HTTPD_RESP_USE_STRLEN);
+	for (int i = 0; i < 6 && res == ESP_OK; i++)
+	{
+		int len = snprintf(buf, sizeof(buf), "%s\"%s\":", i ? "," : "", capture_names[i]);
+		len += latency_hist_json(capture_hists[i], &buf[len], sizeof(buf) - len);
+		res = httpd_resp_send_chunk(req, buf, len);
+	}
+	if (res == ESP_OK)
+	{
+		res = httpd_resp_send_chunk(req, "},\"clients\":[", HTTPD_RESP_USE_STRLEN);
+	}
+	bool first = true;
+	for (int c = 0; c < MAX_STREAM_CLIENTS && res == ESP_OK; c++)
+	{
+		stream_client_t *client = &stream_clients[c];
+		if (client->sock.state != HANDOFF_ACTIVE)
+		{
+			continue;
+		}
+		int len = snprintf(buf, sizeof(buf), "%s{\"slot\":%d,\"frames\":%u,\"skipped\":%u,\"suppressed\":%u", first ? "" : ",", c,
+						   (unsigned)client->frames, (unsigned)client->skipped, (unsigned)client->suppressed);
+		first = false;
+		res = httpd_resp_send_chunk(req, buf, len);
+		const latency_hist_t *client_hists[] = {&client->wait, &client->age, &client->send, &client->gap};
+		for (int i = 0; i < 4 && res == ESP_OK; i++)
+		{
+			len = snprintf(buf, sizeof(buf), ",\"%s\":", client_names[i]);
+			len += latency_hist_json(client_hists[i], &buf[len], sizeof(buf) - len);
+			res = httpd_resp_send_chunk(req, buf, len);
+		}
+		if (res == ESP_OK)
+		{
+			res = httpd_resp_send_chunk(req, "}", 1);
+		}
+	}
+	if (res == ESP_OK)
+	{
+		res = httpd_resp_send_chunk(req, "]}", 2);
+	}
+	if (res != ESP_OK)
+	{
+		return res;
+	}
+	return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Handler to export the recorded path, block by block in chunks.
+// ?format=bin sends the raw blocks (see track.h), otherwise a GeoJSON LineString
+static esp_err_t track_handler(httpd_req_t *req)
+{
+	set_cors_headers(req);
+	char format[8] = {
+		0,
+	};
+	char query[32];
+	if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK)
+	{
+		httpd_query_key_value(query, "format", format, sizeof(format));
+	}
+	bool binary = !strcmp(format, "bin");
+
+	// Too big for the server task stack
+	uint8_t *block = (uint8_t *)malloc(TRACK_BLOCK_SIZE + TRACK_CHUNK_SIZE);
+	if (!block)
+	{
+		httpd_resp_send_500(req);
+		return ESP_FAIL;
+	}
+	char *chunk = (char *)&block[TRACK_BLOCK_SIZE];
+	size_t chunk_len = 0;
+	uint32_t points = 0, start_ms = 0, end_ms = 0;
+	esp_err_t res = ESP_OK;
+
+	httpd_resp_set_type(req, binary ? "application/octet-stream" : "application/geo+json");
+	if (!binary)
+	{
+		chunk_len = snprintf(chunk, TRACK_CHUNK_SIZE, "{\"type\":\"Feature\",\"geometry\":{\"type\":\"LineString\",\"coordinates\":[");
+	}
+	uint32_t seq = 0;
+	size_t len;
+	while (res == ESP_OK && (len = track_copy_block(&seq, block)) > 0)
+	{
+		seq++;
+		if (binary)
+		{
+			uint8_t prefix[2] = {(uint8_t)len, (uint8_t)(len >> 8)};
+			res = httpd_resp_send_chunk(req, (const char *)prefix, sizeof(prefix));
+			if (res == ESP_OK)
+			{
+				res = httpd_resp_send_chunk(req, (const char *)block, len);
+			}
+			continue;
+		}
+		track_reader_t reader;
+		track_reader_init(&reader, block, len);
+		while (res == ESP_OK && track_reader_next(&reader))
+		{
+			if (TRACK_CHUNK_SIZE - chunk_len < 32)
+			{
+				res = httpd_resp_send_chunk(req, chunk, chunk_len);
+				chunk_len = 0;
+			}
+			chunk_len += snprintf(&chunk[chunk_len], TRACK_CHUNK_SIZE - chunk_len, "%s[%.7f,%.7f]", points ? "," : "",
+								  reader.lon_e7 / 1e7, reader.lat_e7 / 1e7);
+			start_ms = points ? start_ms : reader.time_ms;
+			end_ms = reader.time_ms;
+			points++;
+		}
+	}
+	if (res == ESP_OK && !binary)
+	{
+		chunk_len += snprintf(&chunk[chunk_len], TRACK_CHUNK_SIZE - chunk_len, "]},\"properties\":{\"points\":%u,\"start_ms\":%u,\"end_ms\":%u,\"now_ms\":%u}}",
+							  (unsigned)points, (unsigned)start_ms, (unsigned)end_ms, (unsigned)millis());
+		res = httpd_resp_send_chunk(req, chunk, chunk_len);
+	}
+	free(block);
+	if (res != ESP_OK)
+	{
+		return res;
+	}
+	return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// Handler for the main web page, served gzip'd straight from flash (see web/embed_page.py)
 static esp_err_t index_handler(httpd_req_t *req)
 {
-	httpd_resp_set_type(req, "text/html");
 	set_cors_headers(req);
-	String page = "";
-	page += "<!DOCTYPE html>\n";
-	page += "<html>\n";
-	page += "<head>\n";
-	page += "<meta charset=\"UTF-8\">\n";
-	page += "<title>ESP32 CAM car</title>\n";
-	page += "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no\">\n";
-	page += "<link href='https://api.mapbox.com/mapbox-gl-js/v2.6.1/mapbox-gl.css' rel='stylesheet' />";
-
-	page += "<style>";
-	page += "button { touch-action: manipulation; color: black; }";
-	page += "</style>\n";
-
-	page += "<script>var xhttp = new XMLHttpRequest();</script>";
-	page += "<script>function getsend(arg) { xhttp.open('GET', arg +'?' + new Date().getTime(), true); xhttp.send() } </script>";
-	page += "</head>\n";
-	page += "<body>\n";
-	page += "<p align=center><img src='data:image/png;base64,/9j/4AAQSkZJRgABAQEASABIAAD/4gHYSUNDX1BST0ZJTEUAAQEAAAHIAAAAAAQwAABtbnRyUkdCIFhZWiAH4AABAAEAAAAAAABhY3NwAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAQAA9tYAAQAAAADTLQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAlkZXNjAAAA8AAAACRyWFlaAAABFAAAABRnWFlaAAABKAAAABRiWFlaAAABPAAAABR3dHB0AAABUAAAABRyVFJDAAABZAAAAChnVFJDAAABZAAAAChiVFJDAAABZAAAAChjcHJ0AAABjAAAADxtbHVjAAAAAAAAAAEAAAAMZW5VUwAAAAgAAAAcAHMAUgBHAEJYWVogAAAAAAAAb6IAADj1AAADkFhZWiAAAAAAAABimQAAt4UAABjaWFlaIAAAAAAAACSgAAAPhAAAts9YWVogAAAAAAAA9tYAAQAAAADTLXBhcmEAAAAAAAQAAAACZmYAAPKnAAANWQAAE9AAAApbAAAAAAAAAABtbHVjAAAAAAAAAAEAAAAMZW5VUwAAACAAAAAcAEcAbwBvAGcAbABlACAASQBuAGMALgAgADIAMAAxADb/2wBDAAQDAwQDAwQEAwQFBAQFBgoHBgYGBg0JCggKDw0QEA8NDw4RExgUERIXEg4PFRwVFxkZGxsbEBQdHx0aHxgaGxr/2wBDAQQFBQYFBgwHBwwaEQ8RGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhoaGhr/wAARCACCAR0DASIAAhEBAxEB/8QAHQABAAICAwEBAAAAAAAAAAAAAAcIBQYDBEkCAf/EAEkQAAEDBAECAwQECQoEBgMAAAECAwQABQYRBxIhCDFBExRRYSIyN4EVI3F0dZGhscEWFxgkMzRCUrLRNXJzlCUmJzZDVWLS8P/EABwBAQACAgMBAAAAAAAAAAAAAAAFBgQHAQMIAv/EADkRAAEDAgMGAwYEBQUAAAAAAAEAAgMEEQUhMQYSQVFhcYGRsQcTIjKhwTRCctEUFSMz8TVSYrLh/9oADAMBAAIRAxEAPwC/1KUoiUpSiJSlKIlKUoi67zqI7K3XlpbabSVLUrsAB3JNUk5C8R11lcnxbnjEhQsdmdLbLAOky0+S1KHrvXb4aBqUvFNyicesKMUtDykXK6I65K0L7tR/LX5VHY/ID8apXVWxavcx4iiNrZk9dQFvr2e7JQ1FM/Ea5m8HgtaCOByLvHMA8BcjgV6i4flVvzXHYN7sy+uLLbCgD5oPqkj4g9jWe7VR/wALnKJxfJP5MXZ7ptV3WAwpR0GpHp+QK8j89Vd/47NTdFVCrhD+PHutW7T4FJs9iT6Y5sObTzadPEaHqL8V90pSs5VdKUpREpSlESlKURKUpREpSlESlKURKUpREpSlESlKURKUpREpSlEXyfhVcfGHcPYYPaIaVFKpFxC+x9EpV/EirGnzqp3jQkqAxKP/hX7wsj5joH8ajcSduUbyOVvMhXPYmET7RUrXaAk+TSVy8AeIlDqI+L57JCXRpuFcHT2X6BDh+PoD+urVpKVAFJ2D3BHrXk8CQd+tWR4O8SL+Ne74/nby5Np2ERpyiVLj/AK9VJ+fmKhsOxXSKc9j9j+/mtlbZ7AEl1fhTeZdGPqWj1b5cldI9qo54ub0Z/IsWAlZKIEFKSnfYKWSrevjrVXZiTGLhFakwnkPx3kBTbjagUqSfIgjzqgfiabWjmO9lYIStuOUk+o9kkdvvBrPxlxFJYcSPuVU/ZnC2TaC7xm1jiO+Q9CVEVNE7I7geZ+FT3xbxLa02RjJMzSxMlTFJFqszrvSXkqV0h1xI+kpG++gO4FT2tiVbHTGdTi9nciobQzZ0pa/rZ6j1bUrRSCnXSPPfnUDT4U+Vgc82voLXPjmLdtVtvFtvaahqDBTx+8sSCSd0XGRAyJNjkTYAc8iqE1t3F14csPIeNzmV9BRPaQo//AIqUEq/YTVhM/wCHrZljlyjtQ7ZjWYMIS/FaivdLM9K+ohvpOvpgJ1tOxsj0qslkiyGMnt8VxCmpTc5ttSVDRSoLAPb5GseWllopmk5i4sR39VMUWOUW0uGztYN07pDmm2QINiCMiDwI5WIByXqaCDojyr9rijghlsHz6R+6uQ1sJeO1+0pSiJSlKIlKUoiUpSiJSlKIlKUoiUpSiJSlKIlKUoiUpSiJSlKIlKUoi+CNHdVM8aDKlKxF4fVT7ygn5n2ZH7jVtKrj4w7WX8HtU9CdmNcAlRHolST/ABAqNxJpdRvHS/kQrpsRM2DaOlc7QkjzaQPqqU0pStdr2Upq4R55n8by2rXeVuTsadc2psnaoxJ7qR8vUp/VW6eJnH4+Q33Ests7rcuz3cNRFvtnadlQ0SR8Un9Y1VYjUs8Q8gQ4XVh2bj3nE7m8lSVKP0oT4IKXUH0GwN6/L8dzVPVGWP8AhpjkbWPIjQdjp0WtcZwAUNcMcw5lpGg77QPmaRYkD/eNf+Vra62hRHciPX+VZojUaMyI9tgOPFC3G3UKLZUgdyhISRoHWzs+tRNlHLTmMZJMtNls9vdstvdLMhEtj2j0wjs4taz3BJ3+w1NtyxuQ7kt2SYD8iFe4zDYnxQkJZKCVBxY9VdWjseh1XLeODcXyO7tXm+x1v3ApSZYbWUNyFgAbKR8ddwPMdjVrljleLRGxB+56dloTDq/DaWTer2F7S3IDM3s218xmLEXNiCbgZrXJjXXYbmzEY9rDtYiXJlC1JDyIy9uFlDh+r0lvY7/KopXgLeReJpn8HMrTBPsbxJ+j2bHSFaP5VaH31OeSYvMW+7Ah292aqfMYdVI6UpjssoP0WSk/WSE9X3kfKt1s+JwLTdLpdmklyfclJ9s6QAQ2gaQga8gK4kpvflodoCD5XyH0XzR43/Ko5Xx5ukY5otzdugk5/qIyBJ6FbHSlKklSEpSlESlKURKUpREpSlESlKURKUpREpSlESlKURKUpREpSlESlKURfNfnr3qCsz8UuJYtJkQrezMvU+OelSW0eyQT6jqUP4VpH9NCPv8A9pO6+Hvw/wD0qPfiFLG7dc8X6XPoFbaXY7aCsiEsVMd06EkNv4OIP0VrB371H3NmNqyrjHIIDSQX0xy+1seSkHq7fcCPvrTMP8VGGZG41Hu4fsEpfpJAU3v0HtB/ECptjSY9wjoejONyI7qdpWhQUlQP7xXc2SGrYWscCCLG3VR0tHiWz9ZHJURFjmkEXFgSCDkdDpwK8oz8xqlSHzXg68C5BukBCFCC+syYaid7bUT23rzB2Nenao9rXMsbonljtRkvaNBWxYjSR1UJu14BHiPtoeq2HA7TGv2Z2K2XFKnIcya008lKiklKlAHRHcdvWrs/0WeNvW2TP+/c/wB6pnxX9pGLfpNn/VXpn5VZsGgilieXtBIPEdFo32l4pX0FfAylmcwFhJDXEC+9qbKHOZL7P4i4kbewmQY70J5mOyuQA8Q2djR6t77ADZqrn9Kjk3/7aJ/2Lf8AtVk/FmP/AEflev8AX2P3mqDVtLCqeCSnu5gJBIzHCwXnqeR5kLiTnmTzJ1KvH4Y+WMp5Lk5EjL5bMpMJLRYDbCW9FW970Bvy9asXVPvBN/f8v/5GP41cGobEWNjqXNaLDLIdl3RklgJVT/ENzhmnH2fJtGLz48aF7mh3ocjIcPUfPuQTUTL8VPJwST+FoewCf7g3/tWV8Xn2rp/R7VQG5/Zq/JVloqWB9OxzmAkjksWR7g4gFeoPFt8m5Nx/YLvd3EuzpkVLjy0oCQVHfkB5VtMtwtRH3EfWS2og/MA6rReDvsnxT8xR/Gt5uH9wlf8ARV+41T5QGyuA0ufVZgNwFQad4o+S48+Wy1dYgbbfcQkGC2dAKIHp8AK2XjDxF8gZNyBYLRd7lGcgTZSW3kJhtpJSfPRA2Puqu11/4tcPzp3/AFmt04Q+1nEvz5NXSWkpxC4hgvY8ByWC17iRmrZ828oZNhnLHFOP4/MaYtmQ3NMe4trYSsuNlYBAUQSk6J7jVa7mfPeQYT4lWcZubzZwQx47ck+xQDGdfSA24pwjfT17Gt991medOPMkyvl7iO92C3Kl2yyXRL1weCgAygOAkkE7PYHyroZpwpcc95c5Aeu0At2C843GjQZxIPRLbIKVAHuCkjYOqo6kFw4lzHl9y4k5byGfNYcuuOXSZHtqxGSEttthJSCANK1s9z51o2GeITkjH7Nxrluf3C33/F82kriLZZhBh+C4HS2kgp0FbOj39N1nOL+Js5svh85Mx3JLYsZJeJMhyO2XEkyCptACgQddyD51rGBcIch5jYeMMRzXH04vjWES3JUuQ7KSt+c4XS4kIQAekA6B2fj8RRFN/wDOPkX9JC+YZ702MfiYn+EmWPYJ6hI9oB1FetkaJ7b1WmYNztmMnw65hndxZbv1+tV1mRozbbAQkNocSlJKUgbCQoknzIHeu7yhiud4nzU5yNgmNJy6HcrCbPJgtyA06yrq2HBvsRsJ38gR6g1luHsKyrhjg6bGl2FvJMjlTpFwdtDEhKAfbqBLXWoEEgb3saPlRF8cFX/POQMTnX6VyJY76LjbimExEtyEG2TD3HtNd1BO9EEdyK0zj/Keab9zRfcIueb2h1jGUx5M9xNnQkS2lq0UJ0NpOh5kms3wbxnkcLlzIs9lYq3x1YblASwmxNyUuqcfB2pxQSAlIPmNAd+2q2LjrAsgsviP5Lyi5W9bFju8GM1CklQIdUlRKgADsa+dEUbcl8ychwOVORrRj+W2qwWjFLWzPYYmwm3DJJQCWwojq2STrW6zWe88ZpD8NeKZ7b2G7BkdzuUaPJbcjhaQ2pa0qIQsHXUEAj1G+1YPP/Dvd8/5W5XudysYdiXCysjH5q3AAmYlAAKdHYIII79q7/IGBci514YMRsFxs7z+YQblEMuOpxPV7JpSwFk70fodO++yd0Rb/wA+coZFhPGWPScOdaGVX2TFjRippLmitHUtQQQQdaHp23XPgPKd2ynw6z8tkS2XMnt1tnJluoaASiYwlewUa0NEJJGtd61bkji3LuQeTOMo7aJNmx3HLap5+7Rlo9o3JUgJKEhQIJHQnuQRomuvxRxnmeHcdcvYXdYS3o0h2YuxPqUnqmqfaX1KJHYEq6R3AGyaIpb4Gyy65zxDiWRZI8mRdbjBS9JcQ2EBSiSCekAAeXkKkeq++GyRnWNYtj2DZdgMqyxLTb/ZG7LntrQ4sEkANgbG9/GrBURKUpREpSlEUHc7cFw+RLc7dbE03GyaOklCwNCUNb6FfP4H41RGVFfgyXo0xpbEhlZQ62saUhQOiCPiK9XNAnflVWfFJw+mZHczXHI495aAFzaQP7RHkHQPUj1+I0fSq3i2HiRpnjGY169e4W6fZ/te6klbhda68bjZhP5SeB6HhyPQ5VCqT+KebL9xhNbbadXPsa1fj4DqtgA+ZQT9U+vwPqO+6jClVOKV8Dg9hsQvQWIYdS4nTupqpgcw6g+oOoI5jNXd5SsNo8QXGzN/wlxEm628FxhG9L8vxjCh6E62B8QKpK42tlam3UlC0khSSNEEHuCK3fi7k668YZA3cLatTsJ0hMyIVfReR+T0UPQ1L3MnF8DOLKnkrjBIkxpafaXCG0PpBX+JYSP8QP1k/fUvPbEWe+jFngfEOY5j7rXWFGTYyqGGVTr0sp/pPP5XHVjjoL6g5AnuoW4q+0jFf0mz/qFemgrzL4q+0jFf0mz/AKhXpoKlsC/su7/ZUH2rf6lT/oP/AGUGeLX7H5X5+x+81QWr9eLX7H5X5+x+81QWtp4R+GPc+gWiZvnVrfBN/f8AL/8AkY/jVwap94Jv7/l//Ix/Grg1BYn+Lf4egWTD8gVC/F59q6f0c1UCEAgg+RGqnvxefaun9HNVAtWmh/Cs7LDk+cqZMa8TmcYpYoNltaLWYcJoNNF2OVK6R5bOxs1k3fFzyE60ttbdn6VpKTqKreiNf5qgilfRo6YkksF+ye8cMrrkfdVIfdec11urUtWvLZJJ195reuEPtZxL8+TWg1v3CH2s4l+fJrun/sv7H0XDdQru8jczscfZ7g2KO2lyc5lcxMVEhLwQI5KgnZGj1ee9bFfOFc1sZjmef423aHIi8QdW0t8vhQk9JI2BodPl8T51FHisaXYeSeIM0uTbjeN2S8IVcpiG1LTGQFhfUrQJA0D39T2rreHRK8hzHmzNra26rHL1MdNtlqbKBJT9JQUnYBI0R3+PatdqSWz2PxcWi/cX5JmMaxvJlWGWiPJthkjrKVkBLgVr6pJI8vMEVuWe85sYM/x607Z3Zn8snktoKXwn3baUK2ex6vr67a8qoxcsUnWDgOwZlZGlqhXsyrRfGkjQKhLWph5Wu5IOwPQDXerBeIFKjO8Oekk6mN70PL8WzRFMkfnNv+dnJsDuNjehfgS0LuonqfCkyGU9O9I0CD9I+p+qa1ljxRR3eE7ryerGn0QodxMNqIZQ6ngHAj2gV06AO9gaPlUYeMhuZguc45nNpZkOfhG1zLNM9kk6UFNkNpJHmSXCQD/lrKcx4f8AyF8E0OwIHtHYsWD7Q9GipanEqJIHrs6+6iKb8S5PyG745fr1lmDTcWZtsUyWEvy0OmUkIKj0lI7eWu/xqM8Z8YDFyOPTcmwyfYseyGcqDb7p70h9CnkkghSQAQBo7Py9a+OMLrhEnjHO4eBZjecrfFnLs1Fzecd92UGCOlvqQnQ2e4G/IVW7BISsYsXCuV5LMXd8YdyOVGVaZaNsQnOs/j0keuh5HY3RFcbP+fncdztWDYRiU/NMnYiiXLjR30MJYbIBG1qBBJBB0PiK5+U+d/5rLbhMm6Y6+9IyaS1GVGMgIVDWoI2FHRCikr0da8jUOeKSfgkLKJdzx/Irlj3MlrjNmA1b2HFLuAKQUNkBJSsaIG99ta0awviRn3274JwPOzCMY19furC5rXSQUrKme5HoSNEj0JI9KIpi5b8RV54pyJu3yePbhcbdKktxYFwRNQhEp5YGkJBBIOzrvWUy7nW44Ji2IX/LcNl2xq9T0Q57LstJVbCpWgpZAIUNAnYI8tetab4xgoxuMukE6y6Gew3r8YmpW54xuDlXEGYwLs2XGU2x6SnXYhbSS4kg/lSPuJoi4sJ5bRnXIWXYzarU6IGNFtp+6KdBQ6+oAhtKQP8AKd7391YLk3n0YZl0fDsSxqbmWUqimY/CjOhpLDAG+pSyCNkAkDXf477VjPB7aWYXCFkuR63bheSqZNfc7rccJ0NnzIAAA36VHuYZLE4Y8Ul+yrOm5EXG8hx9tiFcS0pbYebT3b2AdKJ7Aefffl3oilaJ4irJdeFbnyXaYL77NsaWZduW4EOtuIOlIJ7gfEHXcEHVZfiXk7IOSGlTLxg83GLW7Eakwpb8tDqZKV9wAAAR20e/xqrmJ4tdLF4POU7neITkJN9efmxWHUFCw19FAJSQDolJI+IINWN8OeFzMdwOx3OXk13vLVys8RTcKatJahjoB02AAQNEDv6AURTPSlKIvwVwyI7UtlxmQhLrLqShaFDYUCNEEVz1+bomi88Od+K3OM8sX7i2fwFcCXYK/RH+Zon4pJ7fIj51FVemnI+BQORsVl2W5pSFLT1R3tbLLo+qofx+RNeceU4zccPvsyzXtkszIqylQ12UPRQPqD5iqLilCaaTfYPhP0PL9l6s2D2oGN0f8NUH+vGM76uGgd34HrnxWGqUuFeX5nF99CZClycfmKCZsbe+n09on4KHqPUfdUW03UVDM+B4ew2IV/xHD6bFKV9LUt3mOGY9CDwI1B4FXfu3BtnyDLMdz7jqTGaYVMZlyWE9mnkb2Vo19VR9R5GrB+naqB8J86zuNJSbdd/aTcaeXtbIO1RyfNaPl8R61ebHcltWV2tq54/NanQ3QClxtW9H4H4EeoPerxh08E7S6MWccyOvMdF5V2ywrF8MljirHGSJgIjfzbe9ieY5HhoSNNC8RGKzMv4ovEO1Nqemx+mU00gbLhQSSkfPRJ+6vOUnpJCgQoEggjRBHmCPQ163aBGq0S6cMYFeroq53PFra/NWoqcWpkfTJ9VAdiat9BiIpGFjgSCb5LW8ke+bgqFPBji8+DZ8gv8AMZUzDuLjbcTqGi4EA9Sh8tkAH171aeuGNGZhsNR4rSGGG0hKG0JASlI8gAPIVzVHVE5qZTIRa/8AhdrWhoAVC/F59q6f0c1UBrJCVEeYBqfPF59q6f0c1UBuf2avyVdqD8KzssCT5yrp8ZeGzAspwKw3i7RJq5s2Kl15SJRSCok70AOwraJXhR43ZjPuJhT9obUof1w+YB+Vbrwd9k+KfmKf41vE/wDuEr/oq/caqMtXUCVwDza54nmswNbYZLygnMoYny2WgQ20+4hIJ2QAogfsFbvwh9rOJfnya0u6/wDFrh+dO/6zW6cIfaziX58mrpNnA7sfRYTdQvQHLc9xTHrxZMbyyW0ibkLwYgRXWC4l9ZIAB7EDuR56r6x7OcVu2R3jEMfktKuljQkzYTbBQllKiQPQJOyD5VW7xapui+XuGU40uO3ejcQIC5IJaD/tE9JWB3Kd+eq6HBCcja5t5uTlDsR3JU2lHt1wUlLRc2vRSD3A3rzrXiklOsrnHiqHkowqTfbYmeHvZGN7AlhLu/qFYT7MK2daJ3v51t+b5XieDWlu7ZvLg2+FHVphyQkEhWvJsaJJ0PICqArFkPgyfUj2ZypWUJ94J17czfafQ2T3+r01KHJSnVc2cBMcjFBsabQwp4TSPYe++zPWVb7dXUEefrqi5srEPc2ccz8DGZzLm09i6ZYjCS/DcIDwGwOhSd70fPX31mpnIeHvZJaMRnTGXrteI3vUKG5HKg60ElXV3HSOwJ79+1Q341kxU8EPC3hlLP4TY7MgBO9K+HbflUZ4w1mDXih4u/nCftciWbGsxDbkKSkMFhegrfcqHqR2ouFbGw5fhtxy294jYVxRfbYyHLhEai9HSgnQJOgFAk67E11cbzzAsxk3u0WGTAmO486oT4vuwSI6gTtQBABGwe4339ahXipQR4vOX1dvo2lo/qcTVa8SyS5Yixcsphoe1yRGulsLqUElEtMghpKT6Egkn5URX5xfkvj/AD+0XLKselxLlEsy1IlTTEIWypKQogFSQrsCD2r8l8sYDK4/Zz2dcI7+LBRLU12KpYSoKKdhJSVA7BG9elV08PNkRifFvOOOFwLftlylMr+JCWAnq+8pNa4joPgEtoc7tmRpQHqPeV7H6qIrezuQsNcn4lBmzY0mTkwLtkSpkuB/pSFkpOiEkAg99Vzs8jYvccsumHonpevkCJ7zMiKaV9Bk6GySOkjuOwJ86pHhDt1sXNfDWBX0OOqx2VKkwJKvquQpUcONgHzPSQsE/LXpW23pvMnfFbnw42ftUe4ixAyTc0KWgsfQ2Egdwretemt0XNlbfA8xxzOLB+EsHktybS3IcjBTTJaSlxs6UkJIGtH5Vr/JPLPHmBqjw+QrrBafdIW1EcZMhwfBXs0gkD4Eio58EnX/ADKOe2ILn4fuPWR5FXte+vlutL4fNskeKrlo5x7FV8Svptgna7RgrsG+r018PSi4ViLhyZhrFyxywXGc371kzKXLZFcjKIkNkdtgjQHyOq1S7eJ/ijGLjNtFyyNuHKtrqo77Ahu6bUgkFPZOuxGu3ao35u6B4o+Eg309H0unp1rXUrWvlX1zrAiDxK8II91YCX5rxdHsk/jD0L7q7d/voinIcuYh+GcbtJunTOyVgSLShTKwJKCCRpRGgdDeiQfKu5i/JGN5pNvMTGJ4uT1mkCNO9myvpacO/o76dE/RPlvyqIPF/jgZ4yj5pZ1og3rCZbc+E8gaIQVBKmxryBJT9wPxrcfDlhSML4utin1Nu3S9qVdri+gnTj756yRv0AIGvTvRFLdKUoi+PPzFRDzjwvF5RtBkwA3GyKIk+6vnsHR5+zWfgfQ+hqXx61+H1rqliZOwseLgrOoK+pwypZVUzt17TcH7HmDoRxC8q7vaJ1guUm23iK7DnRlFDrLqSFJP8R8D5Guj8K9HeT+G8d5Qhf8AirXut0bTpiewAHE/I+ik/I1TzOfDtmuGuuragm9W9JOpMIdRCfipHmn9tUirwuanJLBvN6a+IXqPZ3bzDMYjDKhwil4gmwPVpOR7HMdVEuvhWbxzML9iEkyMausq2uHXV7FwgK16EeR+8Vin4cmKrpkx3WVA+TjZSf2iuEDZ7An5aqJaXRuu02IWwpYoKqIskaHtPAgEHwNwpxtXitz239pi4FwTrsHIwQf1p1WQm+LzNJDJRGhWyMsjsv2ZX3/ITqoStmN3e9SEMWq1zJjyzpKWmVHZ/LrVTnx/4UMhvq25WZufgKCQFFhOlPq+RHkn9tTEE2JTndjcT1/9K1zi2G7FYUDNWRRtI4DU9mg5+VlqyOX+WOQLg3AstznOyVbKWbYyG9j4npHkPiTU14Zw7yrIQmTlfIVytIVsmNHlF5wHfmTvp+7vU6YdgVgwO2og4xb2obYA63ANuOH4qUe6vvrZNHy3+2rDBh7m2dPIXHuQP3K0xi+2EMpMOFUkcMfAljC4+YIHbM9VEWR+HnGM3lsT80fuN1ujTCWTJS+WetKfLaU9t/OsOfCLxsoEGNc9a1/f11Oye3Yiv0fsqwsqp42hrXkAaZla3cA9xc4C56AemSxWNY9DxSxwrNaQtMKE0GmQtZUoJHxJrJutJdaW2v6q0lJ/Ie1fYNfu6x7km5X0oLf8JfHMh915yPcit1alq1PWO5JJ/aayGOeGXAsWvkG82liembCcDrJcmqUkKHxB7Gpk3X551kmrqHNsXm3dfAY0cFqeS8b45l1/sN9v8D3q52F8P253rI9ksEHegdHuPWvqy8d49j2V3rKLTB9her0lKZz/AFk+0CSSBonQ7k+VbXSsZfai1zw78buZecpXjMY3NTpfUnZ9gXSd+0LW+nq333rdbTnHHeM8j2oW3M7THukZJ6m/aJ0tpX+ZCh3SfmK2mlEUajgjBxgicJctbj2OiT7z7u7JWtRc+JWTv9tZlzjDGHcrs+ULt+71Z43usJ/2h/FtdJTrW9HsSO9bjSiLUrZxvjlny285Vb4Hsr5eWQxOkdZPtEAggaJ0O4HlWMtnC+D2m12S2xrEwqJY5y7hbkOEr9hIUSVLBJ8yT61IFKItMt/FmL2qRkz8G3+yXkylKuunFEPFW9nW+xOz5V1P5mcN/kA3gn4L/wDLDaupMT2qux6ir629+Z351v1KItKl8V4pNyTH8ikWltV5sDIYt8oKIU2gJKQk6P0gATrfluueNxrjcTMLllseB0325xfdZUj2hPW127a3oeQrbqURa1hOC2PjyzKs+Jw/cbeqQ5JLfWVbccO1HZJPc1r+e8H4LyVOZn5XY25FwaAAlsrUy8UjySVpIJHyqRaURaXO4rxa5XzHL1MtxcuWONhu2Ol1W2UjyGt9/vrtX7jzHslyaxZHeIPvF3sSyu3vdZHsiQQTrej5nzraqURYLL8StWc45Px/JY3vdqnoCJDPWU9aQQR3HfzArI2y3RrPbotvgI9lFiNJZZRsnpQkaA3+QV3KURKUpREpSlEQeVKUoiwF7s1uuHefb4ko/F5hK/3isHFxSwJc2myWwH4iG3/tSldDgLqVhc4RWBW4QIzEVjojMtso/wAqEBI/ZXa/2pSu4aKMf8xX7SlK5XylKUoiUpSiJSlKIlKUoiUpSiJSlKIlKUoiUpSiJSlKIlKUoiUpSiJSlKIv/9k=' style='width:300px;'></p><br/><br/>"; // Add Base64 image here
-	page += "<h1 align=center>ESP32 CAM car</h1>\n";
-	page += "<p align=center><IMG SRC='http://" + WiFiAddr + ":81/stream' style='width:300px; transform:rotate(180deg);'></p><br/><br/>";
-	page += "<p align=center> <button style=background-color:lightgrey;width:90px;height:80px onmousedown=getsend('go') onmouseup=getsend('stop') ontouchstart=getsend('go') ontouchend=getsend('stop') ><b>TIEN</b></button> </p>";
-	page += "<p align=center>";
-	page += "<button style=background-color:lightgrey;width:90px;height:80px; onmousedown=getsend('left') onmouseup=getsend('stop') ontouchstart=getsend('left') ontouchend=getsend('stop')><b>TRAI</b></button>&nbsp;";
-	page += "<button style=background-color:red;width:90px;height:80px onclick=getsend('/tongleautomode')><b>Auto Mode</b></button>";
-	page += "<button style=background-color:lightgrey;width:90px;height:80px onmousedown=getsend('right') onmouseup=getsend('stop') ontouchstart=getsend('right') ontouchend=getsend('stop')><b>PHAI</b></button>";
-	page += "</p>";
-	page += "<p align=center><button style=background-color:lightgrey;width:90px;height:80px onmousedown=getsend('back') onmouseup=getsend('stop') ontouchstart=getsend('back') ontouchend=getsend('stop') ><b>LUI</b></button></p>";
-	page += "<p align=center>";
-	page += "</p>";
-
-	page += "<p align=center><b>Vĩ Độ:</b> <span id='latitude'>" + String(latitude, 6) + "</span> <b>Kinh Độ:</b> <span id='longitude'>" + String(longitude, 6) + "</span></p>";
-	page += "<div id='map' style='width: 100%; height: 400px;'></div>";
-	page += "<script src='https://atlas.microsoft.com/sdk/javascript/mapcontrol/2/atlas.min.js'></script>";
-	page += "<script>";
-	page += "	var map = new atlas.Map('map', {";
-	page += "	center: [" + String(longitude, 6) + ", " + String(latitude, 6) + "],";
-	page += "	zoom: 18,";
-	page += "	authOptions: {";
-	page += "		authType: 'subscriptionKey',";
-	page += "		subscriptionKey: '" + String(AZURE_MAPS_API) + "'";
-	page += "	},";
-	page += "});";
-	page += "map.events.add('ready', function () {";
-	page += "    var position = new atlas.data.Position(" + String(longitude, 6) + ", " + String(latitude, 6) + ");";
-	page += "    var point = new atlas.data.Point(position);";
-	page += "    var marker = new atlas.HtmlMarker({ position: position });";
-	page += "    map.markers.add(marker);";
-	page += "});";
-	page += "function updateLocation() {";
-	page += "  var xhr = new XMLHttpRequest();";
-	page += "  xhr.open('GET', '/status', true);";
-	page += "  xhr.onreadystatechange = function() {";
-	page += "    if (xhr.readyState == 4 && xhr.status == 200) {";
-	page += "      var response = JSON.parse(xhr.responseText);";
-	page += "      document.getElementById('latitude').innerText = response.latitude.toFixed(6);";
-	page += "      document.getElementById('longitude').innerText = response.longitude.toFixed(6);";
-	page += "      map.setCamera({ center: [response.longitude, response.latitude] });"; // Update map center
-	page += "      var position = new atlas.data.Position(response.longitude, response.latitude);";
-	page += "      var point = new atlas.data.Point(position);";
-	page += "      var marker = new atlas.HtmlMarker({ position: position });";
-	page += "      map.markers.clear();";	  // Clear existing markers
-	page += "      map.markers.add(marker);"; // Add new marker
-	page += "    }";
-	page += "  };";
-	page += "  xhr.send();";
-	page += "}";
-	page += "setInterval(updateLocation, 1000);";
-	page += "</script>";
-
-	page += "<footer style='text-align:center; padding:10px; background-color:#f1f1f1;'>"; // Add footer here
-	page += "<p>Thank you for visiting!</p>";
-	page += "<p>20040311 - Đinh Hoàng Duy</p>";
-	page += "<p>20109941 - Lý Đức Tuấn   </p>";
-	page += "</footer>";
-	page += "</body>\n";
-	page += "</html>";
-
-	return httpd_resp_send(req, &page[0], strlen(&page[0]));
+	httpd_resp_set_hdr(req, "ETag", car_index_html_gz_etag);
+	httpd_resp_set_hdr(req, "Cache-Control", "no-cache"); // Browsers revalidate with the ETag
+	if (etag_matches(req, car_index_html_gz_etag))
+	{
+		httpd_resp_set_status(req, "304 Not Modified");
+		return httpd_resp_send(req, NULL, 0);
+	}
+	httpd_resp_set_type(req, "text/html");
+	httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+	return httpd_resp_send(req, (const char *)car_index_html_gz, car_index_html_gz_len);
+}
+
+// Function to forward a drive command to the Arduino. speed 0 keeps the default speed of the Arduino
+static void send_drive_command(drive_dir_t dir, uint8_t speed, command_source_t source)
+{
+	car_uart_send(drive_uart_cmds[dir], speed, 0);
+	drive_commands[source][dir]++;
+}
+
+// Function to forward a joystick position, the Arduino mixes it into a speed for each side
+static void send_joystick_command(int8_t throttle, int8_t steering)
+{
+	car_uart_send(CAR_CMD_DRIVE, (uint8_t)throttle, (uint8_t)steering);
+	joystick_commands++;
 }
 
 // (Other handlers for car control: go_handler, back_handler, etc.)
 static esp_err_t go_handler(httpd_req_t *req)
 {
 	set_cors_headers(req);
-	Serial.println("/F");
+	send_drive_command(DRIVE_FORWARD, 0, COMMAND_HTTP);
 	httpd_resp_set_type(req, "text/html");
 	return httpd_resp_send(req, "OK", 2);
 }
 static esp_err_t back_handler(httpd_req_t *req)
 {
 	set_cors_headers(req);
-	Serial.println("/B");
+	send_drive_command(DRIVE_BACK, 0, COMMAND_HTTP);
 	httpd_resp_set_type(req, "text/html");
 	return httpd_resp_send(req, "OK", 2);
 }
@@ -453,14 +1499,14 @@ static esp_err_t back_handler(httpd_req_t *req)
 static esp_err_t left_handler(httpd_req_t *req)
 {
 	set_cors_headers(req);
-	Serial.println("/L");
+	send_drive_command(DRIVE_LEFT, 0, COMMAND_HTTP);
 	httpd_resp_set_type(req, "text/html");
 	return httpd_resp_send(req, "OK", 2);
 }
 static esp_err_t right_handler(httpd_req_t *req)
 {
 	set_cors_headers(req);
-	Serial.println("/R");
+	send_drive_command(DRIVE_RIGHT, 0, COMMAND_HTTP);
 	httpd_resp_set_type(req, "text/html");
 	return httpd_resp_send(req, "OK", 2);
 }
@@ -468,10 +1514,68 @@ static esp_err_t right_handler(httpd_req_t *req)
 static esp_err_t stop_handler(httpd_req_t *req)
 {
 	set_cors_headers(req);
-	Serial.println("/S");
+	send_drive_command(DRIVE_STOP, 0, COMMAND_HTTP);
 	httpd_resp_set_type(req, "text/html");
 	return httpd_resp_send(req, "OK", 2);
 }
+
+// Handler for the WebSocket control channel.
+// Each binary frame is [direction, speed, seq lo, seq hi] or a CONTROL_DRIVE frame,
+// and is answered with [0xFF, status, seq lo, seq hi]
+static esp_err_t ws_handler(httpd_req_t *req)
+{
+	if (req->method == HTTP_GET)
+	{
+		return ESP_OK; // Handshake done, nothing else to send
+	}
+
+	uint8_t frame[CONTROL_DRIVE_LEN] = {0};
+	httpd_ws_frame_t pkt;
+	memset(&pkt, 0, sizeof(pkt));
+	esp_err_t res = httpd_ws_recv_frame(req, &pkt, 0); // Read the frame length first
+	if (res != ESP_OK)
+	{
+		return res;
+	}
+	if (pkt.len > sizeof(frame))
+	{
+		return ESP_FAIL; // Not a control frame, drop the connection
+	}
+	pkt.payload = frame;
+	res = httpd_ws_recv_frame(req, &pkt, sizeof(frame));
+	if (res != ESP_OK)
+	{
+		return res;
+	}
+	if (pkt.type != HTTPD_WS_TYPE_BINARY || pkt.len != (frame[0] == CONTROL_DRIVE ? CONTROL_DRIVE_LEN : CONTROL_FRAME_LEN))
+	{
+		return ESP_OK; // Ignore anything that is not a command
+	}
+
+	uint8_t status = CONTROL_ACK_OK;
+	if (frame[0] < DRIVE_MAX)
+	{
+		send_drive_command((drive_dir_t)frame[0], frame[1], COMMAND_WS);
+	}
+	else if (frame[0] == CONTROL_DRIVE)
+	{
+		send_joystick_command((int8_t)frame[1], (int8_t)frame[2]);
+	}
+	else
+	{
+		status = CONTROL_ACK_BAD_COMMAND;
+	}
+
+	uint8_t ack[CONTROL_FRAME_LEN] = {CONTROL_ACK, status, frame[pkt.len - 2], frame[pkt.len - 1]};
+	httpd_ws_frame_t ack_pkt;
+	memset(&ack_pkt, 0, sizeof(ack_pkt));
+	ack_pkt.final = true;
+	ack_pkt.type = HTTPD_WS_TYPE_BINARY;
+	ack_pkt.payload = ack;
+	ack_pkt.len = sizeof(ack);
+	return httpd_ws_send_frame(req, &ack_pkt);
+}
+
 // Handler to toggle automatic mode
 static esp_err_t tongleautomode_handler(httpd_req_t *req)
 {
@@ -479,13 +1583,17 @@ static esp_err_t tongleautomode_handler(httpd_req_t *req)
 	if (isAutoMode == false)
 	{
 		isAutoMode = true;
-		Serial.println("/AUTO");
+		car_uart_send(CAR_CMD_AUTO, 0, 0);
+		vision_enable(true);
+		mode_switches[0]++;
 		// digitalWrite(LED, HIGH);
 	}
 	else
 	{
 		isAutoMode = false;
-		Serial.println("/MANUAL");
+		car_uart_send(CAR_CMD_MANUAL, 0, 0);
+		vision_enable(false);
+		mode_switches[1]++;
 		// digitalWrite(LED, LOW);
 	}
 
@@ -498,6 +1606,10 @@ void startCameraServer()
 {
 	httpd_config_t config = HTTPD_DEFAULT_CONFIG();
 	config.uri_match_fn = httpd_uri_match_wildcard;
+	config.max_uri_handlers = 20; // Default of 8 is too small for all the control routes
+	config.close_fn = camera_close_fn; // /events sockets are closed by the events task
+	status_lock = xSemaphoreCreateMutex();
+	events_queue = xQueueCreate(8, sizeof(position_event_t));
 
 	httpd_uri_t go_uri = {
 		.uri = "/go",
@@ -535,6 +1647,19 @@ void startCameraServer()
 		.handler = tongleautomode_handler,
 		.user_ctx = NULL};
 
+	httpd_uri_t ws_uri = {
+		.uri = "/ws",
+		.method = HTTP_GET,
+		.handler = ws_handler,
+		.user_ctx = NULL,
+		.is_websocket = true};
+
+	httpd_uri_t events_uri = {
+		.uri = "/events",
+		.method = HTTP_GET,
+		.handler = events_handler,
+		.user_ctx = NULL};
+
 	httpd_uri_t index_uri = {
 		.uri = "/",
 		.method = HTTP_GET,
@@ -547,6 +1672,30 @@ void startCameraServer()
 		.handler = status_handler,
 		.user_ctx = NULL};
 
+	httpd_uri_t metrics_uri = {
+		.uri = "/metrics",
+		.method = HTTP_GET,
+		.handler = metrics_handler,
+		.user_ctx = NULL};
+
+	httpd_uri_t latency_uri = {
+		.uri = "/latency",
+		.method = HTTP_GET,
+		.handler = latency_handler,
+		.user_ctx = NULL};
+
+	httpd_uri_t track_uri = {
+		.uri = "/track",
+		.method = HTTP_GET,
+		.handler = track_handler,
+		.user_ctx = NULL};
+
+	httpd_uri_t capture_uri = {
+		.uri = "/capture",
+		.method = HTTP_GET,
+		.handler = capture_handler,
+		.user_ctx = NULL};
+
 	httpd_uri_t cmd_uri = {
 		.uri = "/control",
 		.method = HTTP_GET,
@@ -565,7 +1714,6 @@ void startCameraServer()
 		.handler = options_handler,
 		.user_ctx = NULL};
 
-	ra_filter_init(&ra_filter, 20);
 	Serial.printf("Starting web server on port: '%d'", config.server_port);
 	if (httpd_start(&camera_httpd, &config) == ESP_OK)
 	{
@@ -579,11 +1727,32 @@ void startCameraServer()
 		httpd_register_uri_handler(camera_httpd, &right_uri);
 		// httpd_register_uri_handler(camera_httpd, &tongleheadlight_uri);
 		httpd_register_uri_handler(camera_httpd, &tongleautomode_uri);
+		httpd_register_uri_handler(camera_httpd, &ws_uri);
+		httpd_register_uri_handler(camera_httpd, &events_uri);
+		httpd_register_uri_handler(camera_httpd, &track_uri);
+		httpd_register_uri_handler(camera_httpd, &latency_uri);
+		httpd_register_uri_handler(camera_httpd, &metrics_uri);
+		httpd_register_uri_handler(camera_httpd, &capture_uri);
+		httpd_register_uri_handler(camera_httpd, &cmd_uri);
+		xTaskCreatePinnedToCore(events_task, "events", 3072, NULL, 4, &events_task_handle, tskNO_AFFINITY);
 		httpd_register_uri_handler(camera_httpd, &options_uri);
 	}
 
 	config.server_port += 1;
 	config.ctrl_port += 1;
+	config.close_fn = stream_close_fn; // Stream sockets are closed by their client task
+	if (!frame_ring_start())
+	{
+		Serial.printf("Failed to start the capture task");
+	}
+	if (!vision_start())
+	{
+		Serial.printf("Failed to start the vision task");
+	}
+	if (!recorder_start())
+	{
+		Serial.printf("Failed to start the recorder");
+	}
 	Serial.printf("Starting stream server on port: '%d'", config.server_port);
 	if (httpd_start(&stream_httpd, &config) == ESP_OK)
 	{
@@ -0,0 +1,752 @@
+//File: index.html.gz, Size: 11929 
+// Generated by web/embed_page.py from web/index.html, do not edit
+#define car_index_html_gz_len 11929
+#define car_index_html_gz_etag "\"240546c5\""
+const uint8_t car_index_html_gz[] = {
+ 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xBD, 0xBC, 0xD9, 0xB2, 0xE3, 0xC8,
+ 0x92, 0x18, 0xF8, 0x5E, 0x5F, 0xC1, 0xDB, 0x32, 0xDD, 0xCC, 0x1C, 0x64, 0x25, 0x88, 0x8D, 0x00,
+ 0x2A, 0xAB, 0xAA, 0x0D, 0x24, 0xB1, 0x12, 0x24, 0xB1, 0x10, 0x1B, 0xDB, 0xDA, 0xDA, 0xB0, 0xAF,
+ 0xC4, 0x0E, 0x12, 0xE0, 0x55, 0xFD, 0x83, 0x5E, 0xF5, 0xA6, 0x17, 0x3D, 0xE8, 0x17, 0x66, 0x6C,
+ 0x9E, 0xD4, 0x3F, 0xA2, 0x3F, 0x99, 0x00, 0x79, 0xCE, 0xC9, 0xCC, 0xDA, 0xE6, 0x76, 0x6B, 0x34,
+ 0x4C, 0x3B, 0x24, 0x22, 0xE0, 0xE1, 0xE1, 0xEE, 0xE1, 0x2B, 0x93, 0x8E, 0x1F, 0xFF, 0xB2, 0x3D,
+ 0x6E, 0x4E, 0x8E, 0xC2, 0x2E, 0x92, 0xFE, 0x52, 0xFC, 0xFC, 0xDD, 0x8F, 0xAF, 0x1F, 0xA1, 0x1B,
+ 0x80, 0x8F, 0x4B, 0xD8, 0xBB, 0x0B, 0x3F, 0x71, 0xDB, 0x2E, 0xEC, 0x7F, 0xFA, 0x07, 0xE3, 0xC4,
+ 0x7D, 0x4F, 0xFD, 0x03, 0x98, 0xEE, 0xD3, 0xBE, 0x08, 0x7F, 0x66, 0x75, 0x05, 0x43, 0x17, 0x1B,
+ 0x66, 0xBF, 0xF0, 0xDD, 0xF6, 0x47, 0xF8, 0x39, 0xF9, 0xB2, 0xA6, 0x74, 0x2F, 0xE1, 0x4F, 0xFF,
+ 0x70, 0x4D, 0xC3, 0x5B, 0x5D, 0xB5, 0xFD, 0x3F, 0x2C, 0xFC, 0xAA, 0xEC, 0xC3, 0x12, 0xE0, 0xB8,
+ 0xA5, 0x41, 0x9F, 0xFC, 0x14, 0x84, 0xD7, 0xD4, 0x0F, 0xBF, 0x7F, 0x0C, 0x3E, 0x2E, 0xD2, 0x32,
+ 0xED, 0x53, 0xB7, 0xF8, 0xBE, 0xF3, 0xDD, 0x22, 0xFC, 0x09, 0xF9, 0xB4, 0xFC, 0xB8, 0xB8, 0xB8,
+ 0x63, 0x7A, 0x19, 0x2E, 0x5F, 0x4F, 0x0D, 0x5D, 0xD8, 0x3E, 0xC6, 0xAE, 0x07, 0xA6, 0xCA, 0x6A,
+ 0x26, 0xA4, 0x48, 0xCB, 0x7C, 0x91, 0xB4, 0x61, 0xF4, 0xD3, 0xBB, 0xA4, 0xEF, 0xEB, 0xEE, 0x07,
+ 0x18, 0x76, 0xEB, 0xF4, 0xD3, 0xC5, 0xAD, 0xBD, 0x6A, 0xFC, 0xE4, 0x57, 0x17, 0xF8, 0x79, 0xF9,
+ 0x7D, 0x5C, 0x7C, 0x9F, 0x75, 0xF0, 0x15, 0xFD, 0xB4, 0xFA, 0x84, 0x7C, 0x99, 0xFB, 0xE4, 0x77,
+ 0xDD, 0xBB, 0x45, 0x1B, 0x16, 0x3F, 0xBD, 0xEB, 0xFA, 0xA9, 0x08, 0xBB, 0x24, 0x0C, 0xFB, 0x77,
+ 0x0B, 0x18, 0x60, 0x7E, 0x8C, 0x7F, 0xFE, 0xCE, 0x1B, 0xFA, 0xBE, 0x2A, 0x17, 0x7F, 0x5B, 0xF4,
+ 0xD5, 0xE0, 0x27, 0xDF, 0xBB, 0x7E, 0x9F, 0x56, 0xE5, 0x0F, 0x80, 0xBC, 0x32, 0xAD, 0x87, 0xC2,
+ 0x9D, 0x47, 0x9F, 0x01, 0x73, 0x45, 0xD5, 0xFE, 0xB0, 0xF0, 0x0A, 0xD7, 0xCF, 0x3F, 0x2F, 0x7E,
+ 0xF9, 0xEE, 0x3F, 0x64, 0xD5, 0x04, 0x96, 0xD4, 0x55, 0x97, 0x3E, 0xC1, 0xC1, 0x0E, 0x00, 0xF4,
+ 0x1A, 0x7E, 0x5E, 0x3C, 0x38, 0xFE, 0x61, 0x81, 0x50, 0xCB, 0x7A, 0xFC, 0xBC, 0x48, 0xC2, 0x34,
+ 0x4E, 0xFA, 0xB7, 0xE1, 0xC5, 0x6D, 0xE3, 0x14, 0x80, 0xBB, 0x43, 0x5F, 0x7D, 0x5E, 0x78, 0x55,
+ 0x1B, 0x00, 0x8E, 0x5B, 0x37, 0x48, 0x87, 0xEE, 0x87, 0x05, 0xB1, 0xFC, 0x8F, 0x60, 0x0E, 0xEC,
+ 0x10, 0xB7, 0xD5, 0x50, 0x06, 0xDF, 0xBF, 0x6C, 0x5A, 0xCC, 0x18, 0xE2, 0x36, 0x9C, 0x3E, 0xFF,
+ 0x8A, 0xC4, 0xB2, 0x2A, 0xC3, 0x07, 0x31, 0x79, 0x59, 0x79, 0xDF, 0x50, 0xE3, 0x7A, 0x5D, 0x55,
+ 0x0C, 0x3D, 0xB8, 0x5B, 0x84, 0x11, 0xD8, 0x7D, 0x45, 0xCC, 0x9B, 0xF7, 0x55, 0xFD, 0x7A, 0xF9,
+ 0x42, 0x24, 0xF1, 0x0D, 0x8D, 0xCF, 0xD1, 0xDF, 0x47, 0xD4, 0x93, 0x9E, 0xBA, 0x4A, 0xC1, 0xA1,
+ 0xB7, 0xDF, 0x87, 0x57, 0x70, 0xF2, 0xDD, 0x17, 0x8A, 0x7E, 0x84, 0x5F, 0x84, 0xFB, 0x63, 0xE7,
+ 0xB7, 0x69, 0xDD, 0xFF, 0x7C, 0x75, 0xDB, 0xC5, 0x38, 0x9F, 0xDF, 0xE2, 0xA7, 0x45, 0x19, 0xDE,
+ 0x16, 0xF6, 0x5E, 0x16, 0xC0, 0x48, 0x0B, 0x9B, 0x21, 0xEC, 0xFA, 0xF7, 0x1F, 0x3E, 0x83, 0x15,
+ 0x4F, 0xC8, 0xEF, 0x7E, 0xFC, 0xCB, 0xF7, 0xDF, 0x2F, 0xB6, 0x2D, 0x90, 0x25, 0x90, 0xFA, 0x05,
+ 0x1C, 0x43, 0xD0, 0x2D, 0xE2, 0x6A, 0x51, 0x5D, 0xC3, 0x76, 0xD1, 0x27, 0xE1, 0xC2, 0x0A, 0x3D,
+ 0xBD, 0xF2, 0xF3, 0xB0, 0x7F, 0x68, 0x5C, 0x5B, 0x15, 0xB3, 0xF6, 0x96, 0x65, 0x58, 0x2C, 0x6E,
+ 0x49, 0x58, 0x2E, 0xD2, 0x7E, 0x91, 0x76, 0x8B, 0xAA, 0x0E, 0xCB, 0x8F, 0x80, 0xCB, 0x3E, 0x59,
+ 0xF0, 0xEC, 0x09, 0x9C, 0xCE, 0x63, 0x9F, 0x6E, 0xE1, 0x76, 0x8B, 0xC8, 0x2D, 0x8A, 0x99, 0x9F,
+ 0xC5, 0xF7, 0xDF, 0x7F, 0xA1, 0xEF, 0xBB, 0x99, 0xC0, 0x5B, 0x37, 0x53, 0x37, 0x14, 0x05, 0x58,
+ 0xD9, 0xE9, 0x61, 0x03, 0x46, 0x40, 0x29, 0x83, 0x99, 0x94, 0x4D, 0x15, 0x84, 0xF3, 0xDD, 0xBF,
+ 0x2D, 0xBA, 0x87, 0x14, 0xC1, 0x7C, 0x5C, 0x81, 0x53, 0xFD, 0xF8, 0x10, 0xCD, 0x0F, 0x0B, 0xF4,
+ 0xE3, 0x8B, 0xA4, 0xB1, 0x8F, 0x8B, 0xF6, 0x29, 0x4D, 0x7C, 0xF1, 0xCB, 0xE7, 0xEF, 0xA2, 0xA1,
+ 0x7C, 0x1C, 0x16, 0x40, 0xB8, 0xA9, 0x00, 0x91, 0x3E, 0xE0, 0x75, 0xF1, 0xB7, 0xEF, 0x16, 0x2F,
+ 0x7B, 0x01, 0x49, 0xBC, 0xB1, 0xF3, 0xFE, 0xDD, 0x6D, 0x56, 0xEE, 0x77, 0x0B, 0x68, 0x51, 0x54,
+ 0xFE, 0x43, 0xEF, 0x3E, 0x25, 0x55, 0xD7, 0x83, 0xF1, 0x3B, 0xF8, 0xD6, 0xBD, 0xFB, 0xF0, 0xF9,
+ 0xB1, 0xEC, 0x93, 0x97, 0x96, 0x6E, 0x3B, 0x9D, 0xA6, 0x3A, 0x04, 0x18, 0xDE, 0xB9, 0x6D, 0xEB,
+ 0x4E, 0xDE, 0x10, 0x45, 0x61, 0xFB, 0xEE, 0x05, 0xA0, 0x2A, 0xFD, 0xA2, 0xEA, 0xE6, 0xBB, 0x6F,
+ 0xBB, 0xCF, 0x9B, 0x7E, 0x61, 0xEF, 0xF3, 0x02, 0xD8, 0xFA, 0x29, 0xBD, 0x84, 0xD5, 0xD0, 0xBF,
+ 0x7F, 0x23, 0xEC, 0xE3, 0x02, 0x59, 0x2E, 0x97, 0x1F, 0x3E, 0xCF, 0x64, 0xFF, 0xF2, 0xDD, 0x57,
+ 0xF4, 0x7E, 0xC5, 0x45, 0x1C, 0xF6, 0x5D, 0x58, 0x06, 0xEF, 0x81, 0x16, 0x3F, 0xD9, 0x48, 0xA3,
+ 0xC5, 0x3C, 0x00, 0xF6, 0xFD, 0xB5, 0x9C, 0xFE, 0xFA, 0xD7, 0x79, 0xB3, 0xC7, 0xFB, 0xA7, 0x16,
+ 0xB8, 0x99, 0x49, 0xEF, 0xDD, 0x1E, 0x10, 0xF4, 0xD3, 0x02, 0x79, 0x2E, 0x7B, 0xD0, 0xF9, 0xC0,
+ 0x34, 0x8B, 0xC0, 0x00, 0x4A, 0x44, 0x31, 0x33, 0x23, 0xEF, 0xFF, 0xE9, 0x0B, 0x96, 0x7F, 0x02,
+ 0x78, 0xFF, 0xF9, 0xE3, 0x2C, 0xE9, 0xE7, 0x61, 0xFC, 0x75, 0x81, 0x12, 0xC4, 0xEB, 0xE0, 0xE7,
+ 0x9F, 0x17, 0xD4, 0x3F, 0x7F, 0x78, 0x88, 0x64, 0xF1, 0x76, 0x58, 0xEF, 0x9F, 0x17, 0xD0, 0xBC,
+ 0xCB, 0x5F, 0x17, 0xCB, 0x31, 0x02, 0xAF, 0x27, 0x44, 0x1B, 0xF6, 0x43, 0x5B, 0xCE, 0xD7, 0xBF,
+ 0x80, 0xBF, 0x87, 0x22, 0x7E, 0x9A, 0x55, 0xE4, 0xFD, 0x3B, 0xA0, 0x1D, 0xEF, 0x3E, 0x2E, 0x66,
+ 0x16, 0x80, 0x98, 0xFF, 0x71, 0x16, 0xFE, 0x4C, 0xD1, 0x16, 0x90, 0xFB, 0xFE, 0xC3, 0xA7, 0xF8,
+ 0x29, 0xA6, 0xF7, 0x1F, 0x3E, 0x2E, 0xFA, 0x76, 0x08, 0x81, 0x6C, 0x9E, 0x4B, 0x1F, 0x94, 0x7F,
+ 0x98, 0xC5, 0xF4, 0x95, 0xDA, 0xC2, 0x2F, 0x0E, 0xD5, 0xAB, 0x82, 0x09, 0x7C, 0xD4, 0x0B, 0x17,
+ 0x18, 0x6E, 0xF9, 0x93, 0x1F, 0xCE, 0x16, 0xF2, 0xF3, 0x8F, 0xE9, 0x25, 0x5E, 0x74, 0xAD, 0xFF,
+ 0xD3, 0xBB, 0xC0, 0xED, 0xDD, 0x1F, 0xD2, 0x8B, 0x1B, 0x87, 0x70, 0x5D, 0xC6, 0x9F, 0x3D, 0xB7,
+ 0x0B, 0x57, 0xF8, 0x47, 0x98, 0xCE, 0x60, 0x9C, 0x61, 0x54, 0x3D, 0x3F, 0x4B, 0x5A, 0xCC, 0xAC,
+ 0x19, 0x95, 0x65, 0x74, 0x66, 0x2D, 0x32, 0xCC, 0x16, 0xC6, 0x63, 0xC1, 0xD1, 0x8D, 0xC3, 0xD6,
+ 0x46, 0xD6, 0xFA, 0x69, 0x79, 0x96, 0x4E, 0xAC, 0xC1, 0xCC, 0xF7, 0x19, 0x46, 0x00, 0xF7, 0xE7,
+ 0x97, 0x7A, 0x63, 0x98, 0x75, 0xEF, 0x95, 0xDA, 0x64, 0xE4, 0xC1, 0x46, 0xE4, 0x92, 0xB3, 0x95,
+ 0x32, 0x02, 0xC0, 0xB7, 0x66, 0x18, 0xF6, 0x09, 0xC2, 0xAC, 0x13, 0x07, 0x3B, 0xDC, 0x98, 0xBF,
+ 0xE7, 0xA5, 0x32, 0x0C, 0xDD, 0x3B, 0x8F, 0x4F, 0xB0, 0xFF, 0x49, 0x56, 0x99, 0xFF, 0x0F, 0x5E,
+ 0x45, 0x7E, 0xB6, 0x0F, 0xD9, 0x7C, 0x45, 0xCD, 0x6F, 0x1B, 0x6D, 0xB2, 0xB8, 0xC2, 0x9D, 0x09,
+ 0xE3, 0x1E, 0xE4, 0x69, 0xE5, 0xEB, 0x78, 0xF7, 0x1C, 0xA7, 0xAF, 0x63, 0xE5, 0x39, 0xC6, 0x02,
+ 0x61, 0xBD, 0x9C, 0xAF, 0x8C, 0xE7, 0x78, 0x32, 0x39, 0x69, 0x3B, 0x5F, 0x9D, 0x1F, 0xF8, 0x92,
+ 0xF2, 0x57, 0xE3, 0xF4, 0x57, 0xE3, 0xCC, 0x17, 0xA4, 0xC7, 0xFA, 0x07, 0x11, 0xDB, 0xB1, 0xF7,
+ 0x04, 0x33, 0xFB, 0x42, 0xDF, 0x43, 0x4E, 0xFB, 0xB3, 0x45, 0x98, 0xC6, 0x43, 0x4A, 0xF1, 0xFC,
+ 0xE6, 0x33, 0xC2, 0x9E, 0x31, 0xE2, 0xB5, 0xC0, 0xB0, 0x92, 0x63, 0x99, 0x55, 0xFC, 0x0A, 0xED,
+ 0xAD, 0xE6, 0xA3, 0xC9, 0x90, 0x19, 0x53, 0xFE, 0x94, 0xF7, 0xAB, 0x9C, 0xD3, 0x0B, 0x90, 0x57,
+ 0x8F, 0x1B, 0xF3, 0x4E, 0xEE, 0xCC, 0x83, 0xF8, 0x7A, 0x6B, 0xA3, 0xCF, 0xEB, 0x95, 0x04, 0xBC,
+ 0xF5, 0x1D, 0xFD, 0x0D, 0xBE, 0x6F, 0xE4, 0x6D, 0xAF, 0x13, 0xFF, 0xC2, 0x7E, 0x39, 0x0C, 0xB0,
+ 0xF2, 0x7C, 0x01, 0xF7, 0x95, 0x5D, 0x09, 0xAE, 0x0F, 0x16, 0x98, 0x62, 0xE9, 0x79, 0xBA, 0xF6,
+ 0xBE, 0xD0, 0xBF, 0xFE, 0x73, 0x7E, 0x36, 0xCC, 0x93, 0x1F, 0xD6, 0x67, 0xBC, 0xDB, 0xFA, 0xCA,
+ 0xF0, 0xE0, 0x93, 0x59, 0x17, 0xF3, 0xBC, 0xAE, 0xAE, 0x07, 0x86, 0xDF, 0x33, 0x72, 0x0C, 0x98,
+ 0xDE, 0x8A, 0xCC, 0x9E, 0x61, 0x46, 0x66, 0xEB, 0xC1, 0xE8, 0x6D, 0x0D, 0xE4, 0xA7, 0x6E, 0x99,
+ 0xDB, 0xE3, 0x8F, 0x05, 0x7F, 0x1C, 0x50, 0x4C, 0x6E, 0x1D, 0x57, 0xC2, 0x3A, 0x76, 0xF8, 0x75,
+ 0xBC, 0x94, 0x36, 0x71, 0xBC, 0xDB, 0xDE, 0x96, 0xE0, 0x26, 0x75, 0xD8, 0xDE, 0x70, 0x8D, 0x1D,
+ 0x63, 0x83, 0xD5, 0x44, 0x9B, 0x8D, 0x71, 0x85, 0xD3, 0x6E, 0x26, 0x37, 0xE6, 0x67, 0x7E, 0xEC,
+ 0x3C, 0x76, 0xAD, 0x06, 0xC2, 0xB8, 0x74, 0x85, 0x31, 0x76, 0xF9, 0xB1, 0x7D, 0xE2, 0x56, 0x01,
+ 0x2E, 0xD5, 0x01, 0xF8, 0x6E, 0xC2, 0xFA, 0x76, 0x73, 0x59, 0x95, 0xD2, 0xF8, 0xA4, 0x72, 0xFF,
+ 0xD7, 0xFE, 0x5A, 0x18, 0xB0, 0xAB, 0x6D, 0x98, 0xCD, 0x86, 0xD1, 0x96, 0x5B, 0x46, 0x07, 0xD2,
+ 0x4F, 0xD8, 0x35, 0x33, 0xB2, 0x6B, 0x98, 0x52, 0x19, 0x41, 0x9D, 0x6D, 0x42, 0xDC, 0x30, 0x37,
+ 0x30, 0xF7, 0xCD, 0xCB, 0x17, 0x01, 0x2D, 0xDB, 0x35, 0x9B, 0x6F, 0x98, 0x08, 0x66, 0x19, 0x36,
+ 0x9F, 0xA5, 0xBC, 0x5D, 0x33, 0xEC, 0x66, 0xE6, 0x7D, 0xA3, 0x56, 0xEC, 0x3A, 0xDE, 0xCF, 0x72,
+ 0x9D, 0xC7, 0x0C, 0x80, 0xD5, 0xD6, 0xA3, 0x98, 0x6C, 0xB6, 0xDC, 0x9A, 0x1D, 0x35, 0xCD, 0xD1,
+ 0xC5, 0xE9, 0x80, 0xB3, 0xA6, 0x88, 0x71, 0xCB, 0xE0, 0xCC, 0x27, 0x9D, 0xCF, 0x5A, 0xDC, 0x18,
+ 0xE7, 0xFB, 0xBB, 0xB6, 0x31, 0x5A, 0x59, 0x3B, 0xD8, 0xD2, 0xBD, 0xD8, 0x18, 0x17, 0xE9, 0x7E,
+ 0xDE, 0x9A, 0x96, 0xAC, 0x53, 0x0A, 0xD8, 0x63, 0x7D, 0x03, 0xE2, 0x04, 0x27, 0x10, 0xEF, 0x7F,
+ 0x45, 0x0B, 0x03, 0x64, 0xA2, 0x0A, 0x8C, 0xBA, 0x17, 0x99, 0x2B, 0x80, 0xDB, 0xE6, 0xDA, 0x4C,
+ 0x0B, 0x80, 0xE3, 0x99, 0x9B, 0x03, 0x44, 0x69, 0x7C, 0x39, 0xE3, 0x78, 0xCF, 0xB2, 0xAA, 0x91,
+ 0xEC, 0x55, 0x47, 0x57, 0x4D, 0x2E, 0xF1, 0x1D, 0x5E, 0xEB, 0x54, 0xFF, 0x24, 0x66, 0xBB, 0xE4,
+ 0x76, 0xD2, 0x36, 0x7E, 0xCF, 0x1A, 0x9C, 0xBE, 0xBF, 0x53, 0x27, 0x53, 0x77, 0x5A, 0x39, 0x81,
+ 0xE9, 0x8A, 0xD9, 0x32, 0xF3, 0x7E, 0xA2, 0x06, 0x64, 0xC2, 0x28, 0xB7, 0x0D, 0x8C, 0xEC, 0x8C,
+ 0x2A, 0x35, 0x6A, 0x3D, 0x95, 0xF4, 0x62, 0x27, 0x16, 0xF3, 0x68, 0x45, 0xDE, 0x1B, 0x91, 0xDC,
+ 0x61, 0x76, 0x51, 0x7B, 0xAE, 0xA7, 0x9B, 0xB2, 0xD1, 0x76, 0xCC, 0x1A, 0x93, 0x0E, 0x46, 0x4E,
+ 0x6C, 0x28, 0x0D, 0x41, 0x0A, 0xBF, 0x1C, 0xBD, 0x32, 0x63, 0x13, 0xB5, 0x0B, 0x2E, 0x81, 0xEC,
+ 0xC9, 0xCC, 0x31, 0x9F, 0x96, 0x90, 0x8E, 0xEC, 0x84, 0xF6, 0x6A, 0x7B, 0xB8, 0xBB, 0x6E, 0x8C,
+ 0x2B, 0x77, 0x98, 0x40, 0x0E, 0xD8, 0xED, 0xF6, 0x46, 0xBF, 0x9D, 0x72, 0x7B, 0xB7, 0x12, 0x57,
+ 0xC4, 0x6E, 0x29, 0x93, 0xBD, 0x06, 0xCB, 0x36, 0x61, 0x0A, 0x0E, 0x2C, 0x6E, 0x29, 0xB7, 0xB6,
+ 0x4D, 0x6B, 0x74, 0xAF, 0xFE, 0x88, 0xA7, 0xE9, 0xA1, 0x3D, 0xE7, 0x74, 0xA0, 0x72, 0xD7, 0x16,
+ 0x0D, 0x49, 0x49, 0x45, 0xB8, 0x3D, 0xCC, 0xBA, 0xC4, 0x85, 0x12, 0xE2, 0xDE, 0xDD, 0x1C, 0xD7,
+ 0x93, 0x7C, 0x05, 0xF6, 0x48, 0xAD, 0xFD, 0x2C, 0x36, 0x57, 0x29, 0x1E, 0x15, 0xE6, 0xF5, 0x6E,
+ 0x0B, 0xCE, 0x81, 0xEC, 0x26, 0x68, 0x90, 0x65, 0x6F, 0x13, 0x6F, 0x89, 0x4A, 0x69, 0xF2, 0x0C,
+ 0x8F, 0xE9, 0xCC, 0x0A, 0x49, 0x53, 0x03, 0xCA, 0x20, 0x97, 0x3B, 0x69, 0x8C, 0x24, 0x85, 0xD8,
+ 0xDB, 0x67, 0xB2, 0xEE, 0x4D, 0xCC, 0x62, 0x6E, 0xB5, 0xB6, 0xE4, 0x6B, 0xA1, 0x86, 0xD4, 0x1D,
+ 0x95, 0x51, 0xB4, 0x19, 0xC0, 0x38, 0x79, 0x38, 0x05, 0x9C, 0xB9, 0x69, 0x93, 0x2D, 0xA4, 0x08,
+ 0x43, 0x6F, 0x91, 0x27, 0x9C, 0x93, 0x3A, 0x3A, 0x3D, 0xAD, 0x1C, 0xA2, 0x3B, 0x7A, 0xA7, 0xBB,
+ 0x1B, 0x28, 0xAC, 0x2B, 0x34, 0x32, 0x65, 0xD2, 0xCB, 0x5A, 0xEF, 0x08, 0x33, 0xD8, 0x19, 0xB5,
+ 0xC6, 0xD6, 0x7A, 0xC1, 0x02, 0xB1, 0x19, 0xDA, 0xDF, 0x35, 0xB2, 0xA7, 0x28, 0x31, 0xFD, 0x88,
+ 0x17, 0x7C, 0xC5, 0x71, 0x14, 0x57, 0x74, 0x4D, 0x6E, 0x57, 0x73, 0xE3, 0x06, 0x1A, 0x69, 0xB6,
+ 0x36, 0x61, 0x36, 0x6D, 0xF9, 0xF2, 0xDE, 0xD4, 0x58, 0xA6, 0xE6, 0x0D, 0x33, 0xEE, 0x14, 0x38,
+ 0xB1, 0xC9, 0x5B, 0x97, 0x11, 0x59, 0x25, 0x50, 0x6E, 0xE6, 0xEB, 0xC1, 0x60, 0x78, 0xD3, 0xD1,
+ 0xBC, 0xEE, 0x13, 0x5B, 0x71, 0x2E, 0xEC, 0x89, 0xD4, 0x8C, 0xD6, 0x76, 0x99, 0x1C, 0x3A, 0xE9,
+ 0xE6, 0x44, 0x31, 0xA1, 0x58, 0x6C, 0x1B, 0x11, 0x92, 0x09, 0x52, 0xDA, 0xD8, 0x5A, 0x3D, 0x70,
+ 0xBE, 0x70, 0x42, 0xED, 0xD5, 0x7A, 0x9B, 0x40, 0x4A, 0xB5, 0x85, 0x86, 0xD6, 0xAC, 0x77, 0x26,
+ 0xC3, 0x49, 0xE8, 0x16, 0x5B, 0x0B, 0xAD, 0x9D, 0x53, 0x1B, 0x35, 0x80, 0x7A, 0x4B, 0xC3, 0x8F,
+ 0x94, 0x2E, 0x43, 0x87, 0x90, 0xC4, 0xE1, 0xD2, 0x9B, 0x88, 0x43, 0x8D, 0xB2, 0x5A, 0x3D, 0xA5,
+ 0xA6, 0x9C, 0xC1, 0xCC, 0x8E, 0x36, 0x25, 0x28, 0xBA, 0xEC, 0x92, 0xEE, 0x38, 0xDA, 0xFA, 0xCE,
+ 0xA7, 0x33, 0x3A, 0x83, 0xE0, 0x4B, 0x5F, 0x78, 0x67, 0x92, 0x61, 0x0B, 0x24, 0x4A, 0x4E, 0xE1,
+ 0x39, 0xE0, 0x95, 0xC6, 0xCA, 0x10, 0x8F, 0xF0, 0x8B, 0x40, 0xA4, 0x9B, 0x8A, 0xC0, 0x07, 0x6F,
+ 0x79, 0x86, 0xC5, 0xCE, 0x62, 0x8A, 0xF3, 0x4E, 0x64, 0xB9, 0x9D, 0x5E, 0x46, 0xCE, 0xCE, 0xD2,
+ 0xDB, 0xF0, 0x9A, 0xB5, 0xA6, 0x7D, 0x4E, 0x4F, 0xBC, 0x9C, 0x70, 0x6E, 0x7E, 0x2B, 0x73, 0x65,
+ 0xC4, 0xF2, 0xF5, 0xC9, 0xCB, 0xDC, 0xD8, 0x68, 0xF4, 0x48, 0x8C, 0xB3, 0x7B, 0x13, 0x47, 0xA9,
+ 0xEB, 0x59, 0xD9, 0xE5, 0x48, 0x17, 0x8E, 0xA8, 0xF7, 0xC3, 0xD1, 0xC8, 0xA1, 0x8A, 0xCE, 0xF3,
+ 0xE0, 0x7A, 0x5D, 0xB7, 0xCA, 0x58, 0x8C, 0x9C, 0xE4, 0xF8, 0xBA, 0x32, 0x98, 0x06, 0x7C, 0x2E,
+ 0x37, 0xE8, 0xC9, 0xDD, 0x90, 0xE3, 0x05, 0xC9, 0xD2, 0x23, 0xA4, 0xD2, 0x1B, 0x93, 0x35, 0x0F,
+ 0x2C, 0x29, 0x92, 0x71, 0x78, 0x86, 0xB8, 0x13, 0x36, 0x7A, 0xA3, 0xEC, 0x2E, 0x51, 0x2D, 0x93,
+ 0xF6, 0x77, 0x7D, 0xDC, 0x17, 0x27, 0x4E, 0xE2, 0x9A, 0xEE, 0xDE, 0x5E, 0x75, 0x3B, 0x6F, 0xCC,
+ 0x65, 0x82, 0x8C, 0x22, 0x94, 0xD7, 0x3C, 0x04, 0xC5, 0x47, 0x9C, 0x3B, 0xA1, 0x7D, 0x6A, 0x7A,
+ 0xC2, 0x89, 0x0F, 0x4E, 0x29, 0x5D, 0xFA, 0x69, 0xE5, 0xA9, 0xF7, 0xF3, 0xB2, 0x76, 0xE1, 0xF6,
+ 0xBC, 0x02, 0xEC, 0x19, 0xAD, 0xA6, 0x6F, 0x4A, 0x5B, 0x57, 0x94, 0xA8, 0x34, 0xB6, 0x27, 0xDC,
+ 0x80, 0xCC, 0xD8, 0xA7, 0xD0, 0x6B, 0x25, 0xDB, 0x4A, 0x76, 0x91, 0x83, 0xDE, 0xEC, 0xAF, 0x5C,
+ 0x7F, 0x75, 0xDD, 0xA4, 0xD9, 0xAE, 0x4F, 0x23, 0x44, 0x75, 0xFA, 0x46, 0x0F, 0x96, 0x36, 0xAF,
+ 0x31, 0x93, 0x74, 0xC8, 0xF2, 0x93, 0xC3, 0xF8, 0x54, 0xDA, 0xB0, 0x48, 0x8F, 0x71, 0x08, 0xEE,
+ 0x77, 0x8A, 0x18, 0x1E, 0xEE, 0x17, 0x93, 0x5E, 0x6B, 0x8A, 0xAB, 0x56, 0x30, 0xCC, 0x88, 0x8D,
+ 0xC1, 0x36, 0xB0, 0x73, 0x32, 0x93, 0x3D, 0x7C, 0xDB, 0x08, 0xED, 0xB9, 0xC8, 0x8A, 0x29, 0xEB,
+ 0x55, 0xF2, 0x9C, 0x59, 0xCE, 0x5E, 0xD4, 0x61, 0xCE, 0x4D, 0xAF, 0x81, 0xBC, 0xA7, 0x77, 0x50,
+ 0x95, 0x5C, 0xEB, 0xE3, 0xB5, 0x8E, 0x25, 0xA4, 0x3F, 0x8E, 0x5D, 0xB6, 0x6C, 0xBA, 0x22, 0x4F,
+ 0x27, 0x7E, 0x0F, 0x72, 0x29, 0x73, 0xDC, 0x5C, 0xEA, 0x93, 0x4F, 0xF4, 0xBD, 0x6E, 0x6E, 0x35,
+ 0xBD, 0x92, 0x19, 0xC5, 0x23, 0xF8, 0x2E, 0xB4, 0x8A, 0xA2, 0xAA, 0x2F, 0x39, 0x91, 0xE2, 0x9D,
+ 0x86, 0xD1, 0xE6, 0xDE, 0xB0, 0x8E, 0x86, 0xB5, 0x1C, 0xF8, 0x7B, 0xEF, 0x1C, 0x96, 0x64, 0xBD,
+ 0xBD, 0x5C, 0x50, 0x55, 0x3C, 0xA4, 0x9B, 0x7D, 0xBA, 0xBD, 0x89, 0x84, 0x25, 0xAE, 0x27, 0xBB,
+ 0x71, 0x37, 0xDB, 0x2A, 0x9B, 0x5A, 0xBA, 0x4D, 0xB3, 0x38, 0x29, 0x3A, 0xE1, 0xBE, 0xD2, 0xA0,
+ 0xD5, 0xA0, 0x22, 0x9D, 0x14, 0x1E, 0x11, 0x68, 0xF9, 0x8D, 0xD7, 0x30, 0xFE, 0xEE, 0x11, 0xB4,
+ 0x39, 0x08, 0x81, 0xB9, 0xA7, 0xDC, 0xED, 0xAE, 0xD8, 0x8D, 0x1C, 0x1E, 0x99, 0x27, 0x72, 0x8A,
+ 0x4B, 0xA2, 0x44, 0xCF, 0x02, 0x99, 0x99, 0xFD, 0xAE, 0xCD, 0xF0, 0x1B, 0x69, 0xD9, 0x94, 0xD0,
+ 0x1B, 0xF4, 0x26, 0xB8, 0x1C, 0x7C, 0xA6, 0xD0, 0x84, 0xAA, 0xD0, 0x4F, 0x30, 0xF0, 0xDF, 0xCD,
+ 0x61, 0x94, 0xEA, 0x40, 0xBB, 0x0A, 0x3A, 0x9C, 0xAB, 0x6D, 0xDD, 0x69, 0x7B, 0x74, 0xEB, 0x1E,
+ 0x0B, 0x9F, 0x54, 0xF3, 0xEC, 0xEE, 0xAA, 0x4A, 0xD3, 0x18, 0x80, 0xB0, 0x3E, 0x68, 0x51, 0xA3,
+ 0x6E, 0x70, 0x8D, 0x20, 0x4A, 0xCA, 0x9B, 0xD0, 0xD6, 0x0E, 0xCD, 0xE1, 0xD4, 0xB9, 0x81, 0x8F,
+ 0xD6, 0x5D, 0xE9, 0x56, 0xA3, 0x44, 0x36, 0x1A, 0x75, 0x35, 0x6A, 0xD8, 0xB4, 0x56, 0xA1, 0x54,
+ 0x0A, 0x38, 0xA4, 0x62, 0x18, 0x0B, 0xCA, 0x04, 0xB2, 0xF5, 0x87, 0x3B, 0xE6, 0x1F, 0x34, 0xEE,
+ 0xDA, 0x97, 0x6E, 0x50, 0xA8, 0x4B, 0x5D, 0xA3, 0x8C, 0x92, 0x76, 0x10, 0xD3, 0xC9, 0x8C, 0x8E,
+ 0x52, 0xA9, 0x58, 0xC5, 0x6D, 0x33, 0x41, 0xBD, 0x0C, 0x2B, 0x59, 0xF2, 0x42, 0x15, 0xBA, 0xB9,
+ 0x53, 0x96, 0xD5, 0x09, 0x17, 0x77, 0xB6, 0x21, 0x2C, 0xF9, 0xDB, 0x61, 0x05, 0xCB, 0x54, 0x70,
+ 0x37, 0x15, 0x93, 0xB7, 0x14, 0x8A, 0x49, 0xEA, 0x2C, 0xF7, 0x2C, 0x45, 0xCC, 0xD4, 0x20, 0xAB,
+ 0x97, 0x56, 0xEF, 0x9F, 0x6F, 0x8C, 0x71, 0xF0, 0xF7, 0xFE, 0x8D, 0x28, 0x6A, 0x3E, 0x26, 0x49,
+ 0x55, 0xB9, 0xB8, 0x9A, 0x93, 0x6F, 0xE1, 0xF0, 0x10, 0x41, 0x66, 0xEB, 0xAE, 0xD0, 0x44, 0x13,
+ 0xFC, 0x54, 0xB1, 0x21, 0xF3, 0x5C, 0x65, 0x86, 0xBB, 0x9F, 0x44, 0xBA, 0x8F, 0x8F, 0x0A, 0xB7,
+ 0xC1, 0x78, 0xCC, 0xD8, 0xC9, 0x67, 0x23, 0x0E, 0xA6, 0x44, 0xD4, 0xB5, 0x4A, 0xB0, 0xEE, 0x1D,
+ 0xD4, 0x6B, 0x87, 0x42, 0x90, 0x4F, 0x97, 0xFD, 0x59, 0xDA, 0xF7, 0x87, 0xA2, 0xA3, 0xAF, 0x41,
+ 0xD7, 0xCF, 0x7A, 0x92, 0xB0, 0x7D, 0x86, 0x66, 0xCB, 0x5B, 0xD6, 0xE1, 0xBD, 0x7B, 0xC7, 0xD6,
+ 0x12, 0x06, 0xDD, 0x90, 0x43, 0x3F, 0x8D, 0x83, 0x4A, 0xE6, 0x3D, 0xAA, 0x3B, 0x5B, 0x2A, 0xE5,
+ 0x42, 0xFC, 0xBE, 0x75, 0xCA, 0x51, 0xCD, 0xA5, 0xF3, 0x6E, 0x63, 0xAE, 0x47, 0x07, 0x38, 0x44,
+ 0x2B, 0xEB, 0xC2, 0x04, 0xB1, 0xE5, 0xF0, 0xB8, 0xF5, 0xED, 0xE9, 0x48, 0xF6, 0xF6, 0x05, 0x1A,
+ 0x91, 0x2B, 0xC6, 0xD4, 0xFA, 0xD9, 0xF1, 0x2C, 0xE3, 0x30, 0x71, 0x31, 0xE3, 0xED, 0x34, 0x2A,
+ 0x08, 0x6E, 0xCA, 0x3E, 0xC8, 0xCC, 0x16, 0x68, 0x6A, 0x28, 0x6B, 0xFC, 0xB8, 0x86, 0x88, 0x55,
+ 0x50, 0x54, 0xA7, 0x6D, 0x03, 0x6F, 0x5D, 0xEB, 0x14, 0xB6, 0x28, 0x47, 0xEA, 0x98, 0xB8, 0xDD,
+ 0x63, 0x1D, 0x8A, 0x50, 0xE3, 0x45, 0x66, 0x6D, 0xA0, 0x62, 0x5E, 0x7C, 0x6E, 0x6D, 0x29, 0xB3,
+ 0x6D, 0xC7, 0xBB, 0xDC, 0x59, 0x87, 0x6E, 0xB7, 0xBD, 0x93, 0xDA, 0x52, 0xB1, 0x41, 0xA4, 0xED,
+ 0x24, 0x4E, 0xF4, 0xC0, 0x15, 0xC0, 0x69, 0xB5, 0xCB, 0xE2, 0xEA, 0x90, 0xF0, 0xAE, 0xAA, 0xED,
+ 0x58, 0x0E, 0xB5, 0x50, 0xAA, 0x4B, 0x4A, 0xD8, 0xB7, 0xA7, 0xB5, 0xD2, 0x79, 0xA3, 0x04, 0x65,
+ 0xA8, 0x27, 0xE8, 0x9C, 0xAB, 0x10, 0xA6, 0x2B, 0x60, 0xC8, 0x31, 0xD4, 0x9D, 0xEB, 0xDE, 0x82,
+ 0x48, 0x26, 0x41, 0x69, 0xD4, 0x6D, 0xA2, 0xBD, 0x13, 0x98, 0xE2, 0xCA, 0xA8, 0xB3, 0xAE, 0xAB,
+ 0x94, 0xA5, 0xA5, 0xE7, 0xB0, 0xA5, 0xB3, 0xB4, 0x8D, 0xE5, 0xD1, 0xAE, 0x47, 0x3A, 0x48, 0xBA,
+ 0xC9, 0xA7, 0x40, 0xAE, 0x83, 0x4B, 0x5E, 0x4C, 0x91, 0x5F, 0x48, 0x74, 0xB7, 0x52, 0x19, 0x15,
+ 0x8D, 0x5D, 0x35, 0x76, 0xA9, 0x78, 0x87, 0xE7, 0xF5, 0x35, 0x2A, 0xAA, 0xA0, 0xDA, 0x6C, 0x09,
+ 0x7B, 0x12, 0x96, 0xF6, 0x5D, 0xC3, 0x31, 0x40, 0x0A, 0x61, 0x8F, 0xC4, 0x90, 0x3B, 0x44, 0xD5,
+ 0xDF, 0x83, 0x21, 0xCE, 0x09, 0xB8, 0x11, 0xA7, 0xB5, 0xB4, 0xE2, 0x00, 0x29, 0xC5, 0x2E, 0x2F,
+ 0xF4, 0x7F, 0x63, 0x44, 0x78, 0x8C, 0xA2, 0x43, 0x54, 0xB6, 0x58, 0xB3, 0xE9, 0xEE, 0x94, 0x31,
+ 0x48, 0x4E, 0x2F, 0x01, 0xB5, 0x0E, 0xEF, 0xFB, 0xAB, 0x01, 0x1D, 0xC3, 0x42, 0xB7, 0x96, 0xE1,
+ 0xA4, 0x9E, 0x56, 0x59, 0x63, 0x28, 0xB8, 0x59, 0x0B, 0xF4, 0x61, 0xA3, 0x5C, 0x29, 0x86, 0xAE,
+ 0x8F, 0x2B, 0x48, 0xB8, 0xDE, 0xE0, 0xDB, 0x76, 0xD9, 0x28, 0x51, 0xCA, 0xC9, 0x3C, 0x19, 0xF8,
+ 0x94, 0xBD, 0xB2, 0x95, 0x8A, 0xF3, 0x5C, 0xDB, 0x21, 0xDD, 0x4D, 0x97, 0xB2, 0x9D, 0xB9, 0x0F,
+ 0x96, 0x2B, 0x36, 0x3F, 0x5C, 0xF1, 0xA3, 0xA8, 0x2C, 0xCD, 0x76, 0x8D, 0x91, 0x88, 0x80, 0x1D,
+ 0x2E, 0x87, 0x66, 0x6A, 0x33, 0x41, 0x14, 0xB7, 0xBA, 0x6A, 0x2F, 0xC7, 0x09, 0x42, 0xBA, 0x50,
+ 0xCF, 0x85, 0x86, 0x8C, 0x7C, 0x80, 0xBE, 0x3D, 0xED, 0x15, 0xCA, 0xE4, 0xF9, 0x33, 0x8F, 0x23,
+ 0xC2, 0x80, 0x47, 0x1D, 0x5B, 0x47, 0xB5, 0xC4, 0x18, 0xD8, 0x75, 0x29, 0xF4, 0x6B, 0x98, 0xDD,
+ 0xD4, 0x7D, 0xA6, 0x3B, 0xF4, 0x2D, 0xAB, 0xC2, 0xEC, 0x78, 0x98, 0x44, 0xB2, 0x09, 0x6A, 0x2B,
+ 0x51, 0x8D, 0x42, 0x55, 0xC8, 0xD1, 0xF6, 0x51, 0x9D, 0x6F, 0x1D, 0xAB, 0xF3, 0x37, 0x1B, 0x99,
+ 0xC7, 0x4C, 0x6D, 0xD9, 0x0B, 0xA9, 0x75, 0xA7, 0xCF, 0x82, 0x64, 0x68, 0x5C, 0x76, 0xC9, 0x59,
+ 0x9B, 0x8B, 0xF5, 0xCD, 0x36, 0x0F, 0xB6, 0xF5, 0x6D, 0x47, 0x55, 0x77, 0x6A, 0x6C, 0x0A, 0x5D,
+ 0xB8, 0xDB, 0xF1, 0x8A, 0xDA, 0x10, 0xEB, 0x21, 0x5F, 0x6F, 0xB8, 0xCD, 0x06, 0xEA, 0x26, 0xC7,
+ 0x4D, 0x03, 0xD2, 0x33, 0x4E, 0x28, 0xD6, 0xDE, 0xD7, 0xE8, 0x21, 0x04, 0x46, 0x4B, 0xB7, 0xF6,
+ 0xBE, 0xF3, 0xAA, 0xB2, 0xC8, 0x7A, 0x2D, 0xBF, 0xBA, 0x87, 0xB5, 0x35, 0x3A, 0x99, 0xAE, 0x21,
+ 0x86, 0x34, 0x20, 0xF8, 0x5A, 0x48, 0x95, 0xBE, 0x0A, 0x1B, 0x54, 0x60, 0xC8, 0x13, 0x7F, 0x45,
+ 0xCF, 0xE8, 0x0E, 0xB5, 0xB9, 0x5D, 0x29, 0xFA, 0x93, 0xBB, 0x5C, 0x52, 0xC5, 0x2E, 0xCD, 0x8B,
+ 0x5D, 0xC1, 0x08, 0xC0, 0xB4, 0x82, 0xAB, 0xD5, 0x76, 0xF0, 0xD2, 0x0A, 0x0F, 0x57, 0x0B, 0x3D,
+ 0x29, 0x10, 0xEC, 0xC3, 0xB7, 0xF5, 0xAA, 0x2E, 0x47, 0x9B, 0xAE, 0x79, 0x39, 0xAA, 0x0F, 0x25,
+ 0x6C, 0xDA, 0x75, 0x49, 0x98, 0xE7, 0x8E, 0x8F, 0xD3, 0x22, 0x0D, 0xED, 0x7E, 0x2D, 0x2A, 0x6C,
+ 0xC0, 0x55, 0x18, 0x5A, 0xE0, 0xB5, 0xBD, 0xE4, 0x22, 0x66, 0x2A, 0x2E, 0xFE, 0x8D, 0x4B, 0xA4,
+ 0xAD, 0xCD, 0x6E, 0x20, 0xBA, 0xF1, 0x76, 0xC2, 0xF1, 0x2C, 0x93, 0x0A, 0x9E, 0xE2, 0xB9, 0x17,
+ 0xDE, 0x2E, 0xAA, 0x43, 0x2E, 0x25, 0xE2, 0x72, 0x9C, 0x06, 0x95, 0xA1, 0x54, 0x34, 0xC8, 0xB4,
+ 0x55, 0x4F, 0x92, 0xCC, 0xF6, 0xDC, 0xB4, 0x25, 0xBD, 0xCB, 0x72, 0x0C, 0x26, 0x5D, 0x09, 0x46,
+ 0xE5, 0x88, 0x62, 0x7A, 0x33, 0x87, 0xB9, 0x8B, 0x02, 0x33, 0x6C, 0x54, 0x84, 0xE0, 0x6C, 0x6D,
+ 0x54, 0xC1, 0x2E, 0xCD, 0xD6, 0xEC, 0xE5, 0x4D, 0x13, 0x6E, 0xF4, 0x72, 0x20, 0x62, 0x69, 0x2D,
+ 0xDE, 0x85, 0xCD, 0xCD, 0x2E, 0x9B, 0x50, 0x23, 0x72, 0x39, 0x3D, 0x95, 0x97, 0xD3, 0x5D, 0x42,
+ 0x76, 0x57, 0x01, 0x77, 0x20, 0x6B, 0x5F, 0x13, 0x72, 0x4E, 0xB0, 0x99, 0x4C, 0x78, 0xFB, 0x7A,
+ 0x2F, 0xC9, 0x9A, 0xB3, 0xF5, 0x36, 0x16, 0xCD, 0x59, 0x34, 0xB9, 0x5C, 0x5F, 0x27, 0xDA, 0xED,
+ 0x6C, 0x53, 0xB9, 0xAE, 0x0F, 0x70, 0x44, 0x5D, 0x61, 0x82, 0x57, 0x70, 0xC4, 0xE7, 0x2B, 0x8F,
+ 0xB5, 0x0E, 0x59, 0x63, 0x1F, 0x5C, 0x79, 0x2B, 0x8B, 0x41, 0x81, 0x69, 0x79, 0x11, 0x4B, 0xE6,
+ 0x09, 0x66, 0x0F, 0xF7, 0xE4, 0x52, 0x0A, 0x68, 0x24, 0xF5, 0xBC, 0x7C, 0xC7, 0x29, 0x97, 0x23,
+ 0x2F, 0x09, 0x56, 0xF9, 0x99, 0xE8, 0x2B, 0x46, 0xA4, 0x0C, 0xEA, 0xC9, 0x38, 0x81, 0x34, 0x48,
+ 0x91, 0x6E, 0xFA, 0x09, 0xE2, 0xAA, 0xF0, 0xB6, 0x89, 0xC8, 0x18, 0x83, 0x7B, 0xCB, 0xA4, 0xEC,
+ 0x12, 0x6D, 0x6B, 0x58, 0x23, 0x4D, 0x95, 0x27, 0xE0, 0x73, 0x03, 0x4B, 0x66, 0x51, 0x35, 0xD6,
+ 0x9A, 0x3E, 0x8E, 0xF7, 0x0B, 0x93, 0x67, 0x79, 0x67, 0x69, 0x64, 0x8C, 0xC7, 0x5C, 0x58, 0x29,
+ 0x5C, 0x4F, 0x5D, 0x88, 0xC3, 0x08, 0x3B, 0xF2, 0x35, 0xC0, 0xD8, 0xE1, 0x5E, 0xE7, 0x20, 0xDD,
+ 0x98, 0x96, 0xD5, 0x46, 0x35, 0x85, 0x28, 0x5F, 0x13, 0x66, 0xBF, 0xEF, 0x6F, 0xBD, 0x26, 0x60,
+ 0x6C, 0x64, 0xE9, 0x68, 0x15, 0xC3, 0x7B, 0x66, 0xD5, 0x6A, 0xE1, 0xF6, 0xDA, 0x95, 0xE3, 0x89,
+ 0x1A, 0x35, 0x98, 0xEF, 0x89, 0x41, 0xA0, 0x6F, 0x05, 0x90, 0x9F, 0x66, 0x42, 0x38, 0x72, 0x22,
+ 0x54, 0x7E, 0x1A, 0x98, 0xE5, 0x10, 0x99, 0xE7, 0xF8, 0x70, 0xE3, 0x54, 0x37, 0xC0, 0x2B, 0x48,
+ 0xC7, 0x29, 0xC8, 0x9A, 0x90, 0xC0, 0x89, 0x3D, 0x2F, 0xF2, 0xD5, 0x9C, 0xDF, 0xA0, 0x01, 0xB3,
+ 0x13, 0x85, 0x9A, 0x62, 0x80, 0x72, 0x64, 0xDB, 0x91, 0xA3, 0xE2, 0xF3, 0x61, 0x5A, 0x3B, 0xB2,
+ 0x16, 0x90, 0x05, 0xEF, 0xC7, 0xA7, 0xB3, 0x6E, 0x61, 0xB9, 0x94, 0xF4, 0xB5, 0xA4, 0x47, 0x8A,
+ 0xC6, 0xA0, 0xCA, 0xD0, 0x0C, 0x08, 0x02, 0xE3, 0xBD, 0xAF, 0xDC, 0x6B, 0x0C, 0x66, 0xB8, 0x4B,
+ 0xBF, 0xC4, 0x55, 0x08, 0x29, 0xD9, 0xEB, 0x9D, 0x38, 0xD8, 0xBA, 0x95, 0xD7, 0xE3, 0x06, 0x4F,
+ 0xE2, 0xAB, 0x43, 0xAD, 0x27, 0x6B, 0x83, 0x90, 0xA9, 0x76, 0x69, 0xCF, 0x14, 0x4A, 0x55, 0xE7,
+ 0x43, 0x52, 0xCA, 0x02, 0x77, 0x54, 0x70, 0x78, 0xEF, 0x3A, 0xFD, 0x45, 0xC5, 0x0E, 0xFB, 0x10,
+ 0xEF, 0x5B, 0x47, 0xEF, 0x86, 0x43, 0xE1, 0xAC, 0x19, 0x03, 0xD4, 0xFB, 0x2B, 0x09, 0x04, 0x3C,
+ 0x97, 0xBC, 0x44, 0x4A, 0xA8, 0x3A, 0x27, 0xBC, 0xB0, 0xFC, 0xF3, 0xE0, 0xDD, 0xCF, 0x37, 0x75,
+ 0xC4, 0x49, 0x3F, 0x87, 0x46, 0x75, 0xCB, 0x07, 0x91, 0xCE, 0xA0, 0x78, 0x7D, 0xCB, 0xA2, 0x13,
+ 0x42, 0xF2, 0x3D, 0x4D, 0x23, 0x97, 0x30, 0x38, 0x2A, 0xFB, 0x7C, 0xBA, 0x16, 0x64, 0x7A, 0xA4,
+ 0xD1, 0x0D, 0xB6, 0x2B, 0xD0, 0x69, 0xB2, 0x35, 0x19, 0xB9, 0x85, 0x9B, 0x98, 0x99, 0xE2, 0x23,
+ 0x93, 0xE7, 0x2C, 0xA9, 0x38, 0xC2, 0xD4, 0x56, 0xE7, 0xFA, 0x56, 0xFB, 0x3E, 0x4D, 0xF8, 0x04,
+ 0x13, 0x0E, 0x4B, 0xA6, 0x47, 0x37, 0x14, 0x8E, 0xF1, 0x99, 0x7A, 0x1E, 0x45, 0x45, 0x93, 0x3D,
+ 0x11, 0xA4, 0x84, 0xC2, 0xB0, 0xC9, 0x33, 0xE7, 0xD8, 0x54, 0xAB, 0x9C, 0xBB, 0xE1, 0xC5, 0x5D,
+ 0x28, 0xE8, 0x09, 0xCF, 0x09, 0x6F, 0xE2, 0xA3, 0x83, 0xE3, 0x0F, 0xC3, 0xD1, 0xD6, 0xCF, 0x42,
+ 0xDF, 0x8C, 0xBC, 0xCE, 0xF6, 0x7D, 0x9F, 0x48, 0xFA, 0x86, 0x39, 0xEC, 0x90, 0x8E, 0xBE, 0x13,
+ 0x48, 0x85, 0xF2, 0xA1, 0x78, 0xCA, 0x33, 0x81, 0x3C, 0x8C, 0x6D, 0x31, 0x44, 0xD8, 0x06, 0xC3,
+ 0x60, 0x8E, 0x42, 0xF3, 0x36, 0x95, 0xCF, 0xE7, 0x64, 0x9D, 0x40, 0x1B, 0x5C, 0xD0, 0xD1, 0x3C,
+ 0xAE, 0x97, 0x9C, 0x77, 0xCC, 0x30, 0xFA, 0x80, 0x94, 0x47, 0x19, 0x92, 0x3A, 0xA2, 0xBB, 0x26,
+ 0x14, 0xB1, 0x1F, 0x31, 0x49, 0x76, 0xBA, 0xB3, 0x14, 0x4A, 0xFB, 0x64, 0x3A, 0xA2, 0x36, 0x9B,
+ 0x4F, 0xC0, 0xBB, 0x30, 0x9B, 0x58, 0x0D, 0x82, 0x69, 0x4B, 0x20, 0x2D, 0xBF, 0xF6, 0x45, 0x3F,
+ 0x21, 0x32, 0x27, 0xDC, 0xEF, 0x35, 0x90, 0xEE, 0x2F, 0xF1, 0x6B, 0x66, 0xB1, 0x3A, 0x26, 0x19,
+ 0x20, 0x88, 0xED, 0xF4, 0x1E, 0xF2, 0x71, 0x5B, 0xC7, 0x73, 0x51, 0x65, 0xC2, 0x9C, 0x59, 0xAD,
+ 0xD1, 0x28, 0xA3, 0x34, 0x8D, 0x3B, 0x00, 0xBF, 0x78, 0x54, 0x72, 0x9B, 0x96, 0x36, 0x90, 0x73,
+ 0x26, 0x97, 0xE8, 0x3E, 0x4A, 0x9D, 0x12, 0x62, 0x2F, 0x96, 0xE2, 0x48, 0xAB, 0x44, 0xA4, 0xAB,
+ 0x35, 0xC2, 0x85, 0x7D, 0xEE, 0x4A, 0xA4, 0x87, 0x58, 0x17, 0xE7, 0x70, 0xEF, 0x2F, 0xFB, 0xF2,
+ 0xB6, 0x22, 0x92, 0x32, 0x18, 0xCF, 0xDE, 0x15, 0x81, 0x7A, 0x13, 0xB9, 0x68, 0xD5, 0xDD, 0xF3,
+ 0x18, 0x35, 0x3F, 0x54, 0xBE, 0x5E, 0x48, 0x3B, 0x23, 0xF6, 0x40, 0x21, 0x98, 0x97, 0x77, 0x51,
+ 0x08, 0x07, 0x72, 0x4A, 0xD2, 0x21, 0xC0, 0xCB, 0xBB, 0x41, 0x4C, 0x87, 0xF8, 0x72, 0x90, 0xA6,
+ 0x95, 0xE0, 0xB7, 0x1B, 0x4F, 0x91, 0xE2, 0x7E, 0x62, 0x96, 0xAB, 0xA9, 0x05, 0x8E, 0x68, 0x7D,
+ 0xED, 0xB4, 0x4E, 0xC2, 0xA8, 0x58, 0x5B, 0xC5, 0x48, 0x31, 0x08, 0xDD, 0x6E, 0x6A, 0x93, 0x2C,
+ 0x5E, 0x79, 0x7C, 0x81, 0x72, 0x57, 0x69, 0x9F, 0x15, 0xA7, 0x9A, 0xBB, 0x05, 0xFD, 0x96, 0x4D,
+ 0x76, 0x4C, 0xE4, 0x35, 0x6B, 0xD9, 0xB6, 0x2A, 0x96, 0x8D, 0x3D, 0xAC, 0x73, 0x95, 0x42, 0xE3,
+ 0x28, 0x9F, 0xB3, 0x61, 0xE5, 0xA8, 0xEE, 0x4F, 0xA5, 0xBD, 0x32, 0x27, 0xC9, 0x21, 0x57, 0x72,
+ 0xE6, 0xA5, 0x17, 0x76, 0x64, 0xFB, 0x89, 0xE5, 0xD1, 0xD3, 0x16, 0x13, 0xFA, 0x43, 0x80, 0xAC,
+ 0x8F, 0x34, 0xCB, 0x06, 0xD3, 0x6E, 0x79, 0xCF, 0xE0, 0x5D, 0xE8, 0x7A, 0xF4, 0x5D, 0x8B, 0x7C,
+ 0x71, 0x08, 0x3D, 0x34, 0x41, 0x32, 0xDE, 0x18, 0x89, 0x3D, 0x3D, 0x1E, 0x4A, 0x35, 0xD7, 0xD1,
+ 0xA2, 0x59, 0x1A, 0xD2, 0xF2, 0x50, 0x1F, 0x13, 0x22, 0xBF, 0x74, 0xD8, 0xCD, 0x1B, 0xCB, 0xDC,
+ 0x97, 0x8B, 0xBB, 0xD8, 0x81, 0x64, 0xBB, 0xC1, 0x46, 0xC4, 0xF1, 0x0A, 0x46, 0xBF, 0x5D, 0xC6,
+ 0xC3, 0x64, 0x0C, 0x8D, 0x1F, 0xAD, 0xD1, 0x7A, 0x54, 0x75, 0xA6, 0x10, 0x95, 0xCB, 0x81, 0x09,
+ 0x20, 0xB4, 0x41, 0xE5, 0xAC, 0x65, 0xBA, 0xB8, 0xBB, 0xA6, 0x0A, 0x21, 0x4F, 0x29, 0x61, 0xD1,
+ 0x1E, 0x97, 0x0D, 0x14, 0xBF, 0x47, 0x36, 0x79, 0xA1, 0x8A, 0x81, 0x51, 0x68, 0xBB, 0x98, 0xD9,
+ 0x76, 0x2E, 0x14, 0xB0, 0x86, 0xE7, 0x17, 0xD4, 0xE4, 0x27, 0xB7, 0xA3, 0x79, 0xD4, 0x5A, 0x2D,
+ 0x83, 0x2C, 0xB4, 0xB9, 0x59, 0x19, 0x27, 0x5B, 0x77, 0x50, 0x00, 0x5D, 0x6E, 0x17, 0x6C, 0x2B,
+ 0x49, 0xEA, 0xC6, 0xBA, 0x55, 0x59, 0x83, 0xEA, 0xA7, 0xD6, 0x5A, 0xDD, 0xAD, 0x90, 0xA2, 0xCE,
+ 0xF5, 0x96, 0x3A, 0x84, 0xBB, 0x33, 0xE9, 0xA1, 0x3C, 0xB9, 0xCE, 0x83, 0xFB, 0x60, 0xB8, 0x8A,
+ 0xE4, 0xF9, 0x59, 0xE2, 0xAA, 0x68, 0xED, 0x2E, 0x1B, 0x51, 0xED, 0x04, 0xDB, 0x60, 0x99, 0x0C,
+ 0xE1, 0x21, 0xC4, 0x51, 0x14, 0x78, 0x7B, 0x0D, 0x28, 0x98, 0xB0, 0x08, 0x7B, 0x08, 0xA6, 0xCE,
+ 0x09, 0x52, 0x7B, 0x33, 0x75, 0x99, 0x40, 0x34, 0x18, 0xC3, 0x5C, 0x9C, 0x82, 0x61, 0x76, 0x81,
+ 0xE0, 0x88, 0xA2, 0x48, 0xD2, 0x0D, 0x09, 0x8B, 0x40, 0xA3, 0x52, 0x02, 0xC1, 0x9D, 0xBD, 0xD6,
+ 0x71, 0x63, 0x47, 0xDE, 0x21, 0x47, 0xF5, 0x0A, 0x76, 0x3F, 0x1C, 0xEB, 0x51, 0x31, 0x49, 0xA9,
+ 0xD6, 0x6F, 0x5C, 0x4E, 0x2E, 0xA3, 0x2A, 0x38, 0x42, 0xD0, 0x14, 0x2C, 0x35, 0x0F, 0x54, 0x91,
+ 0x90, 0x5F, 0x9D, 0xB9, 0x44, 0x01, 0xE9, 0x9C, 0xEE, 0x1F, 0x03, 0x97, 0x37, 0x6D, 0xF4, 0xC4,
+ 0x65, 0x5A, 0x5A, 0xD7, 0xF2, 0x25, 0xED, 0x05, 0xA3, 0x57, 0xC1, 0x2B, 0x70, 0x85, 0x1A, 0xC5,
+ 0x6C, 0x25, 0x56, 0x76, 0x01, 0x3A, 0x01, 0x6D, 0xBA, 0x53, 0x3D, 0x10, 0xB9, 0x0D, 0x92, 0x72,
+ 0xA4, 0x2F, 0xA5, 0x62, 0xA8, 0x5C, 0x46, 0x4F, 0x9D, 0x5B, 0x11, 0xDE, 0x0C, 0x77, 0x79, 0x60,
+ 0x25, 0x89, 0xEF, 0x83, 0x15, 0xE2, 0xE5, 0x59, 0x8A, 0xC9, 0x83, 0x1A, 0x9E, 0x8E, 0xFB, 0x0A,
+ 0x04, 0x85, 0xC3, 0x65, 0xC4, 0x04, 0xD9, 0xAD, 0x09, 0x88, 0xD4, 0x8A, 0x8A, 0xAE, 0x80, 0xAA,
+ 0xC7, 0xD2, 0x0E, 0xD4, 0xDA, 0xA2, 0x24, 0xA8, 0xE5, 0xA0, 0x6A, 0xD5, 0x65, 0xB8, 0x8E, 0xDA,
+ 0x58, 0x5E, 0x42, 0x10, 0xC9, 0xFC, 0xAB, 0x63, 0x07, 0x8E, 0x8E, 0x55, 0xCB, 0x04, 0x75, 0x86,
+ 0x51, 0x69, 0x8C, 0xB2, 0xB9, 0x34, 0x91, 0x6B, 0x23, 0x3B, 0x49, 0x70, 0xD8, 0x66, 0xA5, 0x61,
+ 0x0C, 0x3F, 0xB9, 0x62, 0xED, 0xE1, 0xFC, 0x34, 0xAD, 0x88, 0xFB, 0xB8, 0x4D, 0x2D, 0xED, 0x2C,
+ 0x52, 0x17, 0x2D, 0xF0, 0xB2, 0xB5, 0x4E, 0x4B, 0xBE, 0x8A, 0xB2, 0x6B, 0x3D, 0xD5, 0x37, 0xC0,
+ 0x80, 0x98, 0xD0, 0xCE, 0x77, 0x79, 0xD8, 0x40, 0x10, 0x3F, 0x69, 0xA5, 0x75, 0x70, 0x40, 0x02,
+ 0xB9, 0x3D, 0x07, 0xF1, 0xBE, 0x99, 0x46, 0xF9, 0xE4, 0xC1, 0x67, 0x9E, 0x94, 0xCB, 0xBE, 0x55,
+ 0xF1, 0x8E, 0xCD, 0x99, 0x43, 0xEC, 0xF1, 0x34, 0xCC, 0xB7, 0xEB, 0xAF, 0x12, 0x1A, 0x43, 0xF0,
+ 0x49, 0x9F, 0xBB, 0x41, 0x9A, 0xEC, 0x93, 0x81, 0xC7, 0x2E, 0x31, 0xB0, 0xF7, 0x31, 0x2F, 0x36,
+ 0xB7, 0xC3, 0xC6, 0x38, 0x78, 0x2B, 0x2E, 0x52, 0x70, 0x01, 0x47, 0x34, 0xDE, 0xE4, 0xA2, 0x78,
+ 0xB2, 0xAB, 0xE5, 0x58, 0x7B, 0x6C, 0x52, 0x9C, 0xD5, 0x15, 0xDA, 0xB9, 0x46, 0xA2, 0x1E, 0xD3,
+ 0x8D, 0x92, 0xEE, 0x68, 0xFB, 0xC0, 0x94, 0xA0, 0xBC, 0xB7, 0x22, 0x4E, 0xBA, 0x41, 0x97, 0xB3,
+ 0xE0, 0x03, 0xC3, 0x17, 0x71, 0x9A, 0x70, 0x19, 0x6E, 0xCE, 0xF0, 0x49, 0x4D, 0xC8, 0x05, 0x55,
+ 0x31, 0x32, 0x04, 0x12, 0x97, 0x91, 0xDE, 0x60, 0x29, 0x2A, 0xA4, 0x5A, 0x5D, 0x66, 0xBC, 0x83,
+ 0xAC, 0xE8, 0x10, 0xB7, 0x56, 0xD1, 0x19, 0xEE, 0xC3, 0x55, 0x5E, 0x78, 0x49, 0xE0, 0xAE, 0x28,
+ 0x2F, 0x3B, 0x27, 0x0A, 0xA1, 0x87, 0xEB, 0x95, 0x90, 0x4C, 0x8A, 0x4A, 0x98, 0x9B, 0xE6, 0x04,
+ 0xED, 0x42, 0x4F, 0xA6, 0xC7, 0xE4, 0xE0, 0x79, 0x6E, 0x60, 0x2B, 0x9D, 0x8B, 0x44, 0x19, 0xBE,
+ 0x6D, 0xFA, 0x98, 0x81, 0xCE, 0xEA, 0x89, 0x36, 0xA0, 0xEB, 0x4D, 0x69, 0x8E, 0xD0, 0x2A, 0xDB,
+ 0x14, 0xE6, 0x71, 0x67, 0x52, 0xDB, 0x98, 0x4E, 0x3A, 0xF5, 0xAA, 0x5A, 0xA2, 0x13, 0xE8, 0x78,
+ 0x79, 0x1A, 0xEA, 0xA6, 0x8E, 0xFD, 0xDB, 0x2A, 0x86, 0xAA, 0x63, 0x25, 0x12, 0xD9, 0xC1, 0x0E,
+ 0x08, 0xBD, 0x3B, 0x54, 0x94, 0x6A, 0xF3, 0x77, 0xE0, 0x7E, 0x8A, 0x91, 0xBD, 0xAC, 0x50, 0x8A,
+ 0x1B, 0x13, 0x9E, 0x96, 0xA9, 0xEB, 0x98, 0x6D, 0x92, 0x15, 0xBB, 0x42, 0xD7, 0x94, 0xBA, 0xAB,
+ 0x77, 0x38, 0xDA, 0x17, 0xEE, 0x05, 0x33, 0x8A, 0xCD, 0x32, 0x4F, 0x74, 0xFD, 0xC0, 0xB2, 0xC0,
+ 0x05, 0xEF, 0xB0, 0x28, 0x25, 0xF3, 0xD5, 0x8A, 0x72, 0xCE, 0x0C, 0xE6, 0xCB, 0x6E, 0x7F, 0xEA,
+ 0xA4, 0x65, 0x02, 0x72, 0x7F, 0x33, 0xD2, 0x42, 0x0D, 0x3A, 0x2D, 0x0D, 0x45, 0x45, 0x64, 0x6C,
+ 0x5F, 0x72, 0xD4, 0xF6, 0x28, 0xEF, 0xCA, 0xBC, 0xCD, 0xD6, 0x62, 0x3E, 0xD6, 0x2E, 0x38, 0xEC,
+ 0x0D, 0xBF, 0x54, 0xEA, 0xB5, 0x0D, 0x49, 0x8E, 0xAE, 0x50, 0xAA, 0x82, 0xE4, 0x70, 0x64, 0x5C,
+ 0x15, 0x10, 0xE2, 0x43, 0x28, 0xE3, 0xCA, 0x38, 0x62, 0x8F, 0x0E, 0x91, 0x91, 0xAD, 0x6D, 0x71,
+ 0xFC, 0xC9, 0x99, 0x1A, 0x9E, 0x37, 0x4F, 0xED, 0xB2, 0xAB, 0xE1, 0x5A, 0x51, 0x08, 0x5B, 0x30,
+ 0xB3, 0xAC, 0x92, 0x57, 0x31, 0xC1, 0x94, 0x43, 0x65, 0xE1, 0x0D, 0xB4, 0xCC, 0xB8, 0x68, 0x79,
+ 0xB9, 0xC3, 0x0D, 0x17, 0x5E, 0xE2, 0xF6, 0x2E, 0x7F, 0x35, 0xC5, 0xEC, 0x12, 0xBB, 0xAE, 0x76,
+ 0x45, 0xB7, 0x81, 0xBB, 0x81, 0x84, 0xCF, 0x86, 0x80, 0xB6, 0xD1, 0xAA, 0x38, 0xC1, 0x15, 0xC8,
+ 0x5F, 0x78, 0x83, 0x0F, 0x65, 0x9B, 0x14, 0x08, 0x9B, 0x80, 0x40, 0xF9, 0x8B, 0xA8, 0x56, 0x4B,
+ 0xFF, 0x6A, 0xA2, 0xAF, 0x71, 0x0D, 0xE2, 0x15, 0x1F, 0x8A, 0xAD, 0xF4, 0x7C, 0x2D, 0xCD, 0x36,
+ 0x7A, 0xA4, 0x25, 0x8C, 0x0C, 0x53, 0x4C, 0xEE, 0xC0, 0x99, 0x79, 0x73, 0x6B, 0x1A, 0x97, 0xAE,
+ 0x24, 0x5C, 0xC0, 0xB0, 0x38, 0x02, 0xED, 0x8A, 0x91, 0x35, 0xF0, 0xDC, 0x72, 0x84, 0x87, 0xB1,
+ 0x75, 0xDA, 0x52, 0xB1, 0xB9, 0x81, 0x39, 0x82, 0x6E, 0x56, 0xD1, 0xD2, 0x47, 0x8C, 0x0D, 0xCB,
+ 0xC4, 0x31, 0xA4, 0xF1, 0x4D, 0x79, 0x1D, 0xC3, 0xC8, 0x1D, 0x4A, 0x5A, 0x38, 0x98, 0x4C, 0x6F,
+ 0x5D, 0x12, 0x78, 0xD3, 0x91, 0xF2, 0x36, 0x87, 0xFC, 0xE6, 0xBC, 0x77, 0xA9, 0xD3, 0xC5, 0x77,
+ 0x6A, 0xA7, 0x3A, 0x14, 0xBD, 0x2B, 0x5B, 0x8E, 0x2F, 0x55, 0x87, 0x03, 0x87, 0x1E, 0xCD, 0xDD,
+ 0x4A, 0x23, 0x3C, 0x50, 0x3F, 0x23, 0x39, 0x16, 0x71, 0xF7, 0x89, 0x5D, 0x2D, 0xFB, 0xDE, 0x0B,
+ 0xCA, 0x95, 0x59, 0xEF, 0x4E, 0xCD, 0xAE, 0x0D, 0xD3, 0x43, 0x44, 0x34, 0x20, 0x01, 0x8C, 0xB4,
+ 0x6A, 0xE5, 0xE4, 0x79, 0xC7, 0x41, 0x53, 0x48, 0xF9, 0xFB, 0xB6, 0xCD, 0x23, 0x50, 0x5C, 0x44,
+ 0x41, 0xE8, 0x23, 0xC8, 0xD0, 0x1A, 0xBD, 0x75, 0x95, 0xCF, 0x92, 0x84, 0xD0, 0x44, 0x1B, 0x0E,
+ 0xAC, 0xD2, 0x9F, 0x47, 0x99, 0x82, 0x4E, 0x56, 0x0C, 0x2A, 0xA6, 0x8D, 0x80, 0x76, 0x78, 0x01,
+ 0x45, 0x52, 0x3B, 0x94, 0x70, 0x77, 0x25, 0x41, 0x25, 0xB1, 0x0D, 0xD4, 0x76, 0xA0, 0x32, 0xFF,
+ 0xDE, 0xF9, 0xD1, 0x99, 0x8C, 0xD1, 0xDD, 0x11, 0x2D, 0x26, 0x9F, 0x28, 0xFC, 0x71, 0x6F, 0xB2,
+ 0x89, 0x7C, 0x53, 0x45, 0x62, 0x17, 0x97, 0x67, 0x3E, 0x43, 0xC2, 0x10, 0x38, 0xD7, 0xE8, 0xC8,
+ 0xF9, 0x48, 0x77, 0xCE, 0x2E, 0x61, 0x84, 0xA3, 0x98, 0x2B, 0x88, 0x29, 0xA5, 0x06, 0xD6, 0xB2,
+ 0xA7, 0xAE, 0x89, 0x9A, 0xD3, 0x92, 0x88, 0xAE, 0xAB, 0x40, 0x29, 0xA8, 0x13, 0x81, 0x70, 0x42,
+ 0xDA, 0x81, 0xCC, 0x3F, 0xD4, 0x43, 0x71, 0xBF, 0x1C, 0x4E, 0x5E, 0x16, 0x1E, 0x50, 0x9D, 0x12,
+ 0x4D, 0xBF, 0x4E, 0x79, 0x44, 0x3E, 0xF1, 0x2A, 0x97, 0x44, 0x46, 0xAB, 0x4A, 0xCC, 0x72, 0x8B,
+ 0xD1, 0x27, 0xB4, 0x6D, 0x43, 0x41, 0xDB, 0x51, 0xC9, 0x5D, 0xB8, 0xDC, 0x0F, 0xAD, 0x8B, 0xAE,
+ 0x5A, 0x41, 0x46, 0xF6, 0xC1, 0xA1, 0x2F, 0x40, 0x32, 0xBB, 0x96, 0x4E, 0xB4, 0xA4, 0x1A, 0xA5,
+ 0xB3, 0x16, 0x97, 0x1A, 0x06, 0x29, 0x6E, 0x1F, 0x34, 0xBA, 0x75, 0x47, 0x95, 0xD1, 0xB7, 0x52,
+ 0xD8, 0xB7, 0x09, 0xE9, 0xB2, 0x77, 0xC7, 0xAB, 0x54, 0x58, 0xBC, 0x95, 0x2A, 0x52, 0x9F, 0xE4,
+ 0x59, 0xBB, 0x33, 0xF3, 0xB5, 0x1C, 0x9B, 0xED, 0xAA, 0x96, 0x44, 0xEA, 0xBA, 0x67, 0xCD, 0x01,
+ 0x78, 0x73, 0xA2, 0x73, 0xF6, 0xF0, 0xB8, 0x5A, 0x92, 0x67, 0xEC, 0x5C, 0x52, 0x5D, 0x99, 0xF7,
+ 0xD5, 0xCE, 0xBE, 0x95, 0x98, 0xE7, 0x1A, 0x3B, 0x34, 0x1C, 0x57, 0xD7, 0x76, 0x45, 0xBA, 0x54,
+ 0x53, 0x8D, 0x7E, 0x67, 0x94, 0xD6, 0x36, 0x3E, 0xDE, 0xCE, 0xC5, 0x99, 0x2F, 0x9A, 0xC4, 0xEE,
+ 0xA6, 0x56, 0x8B, 0xF8, 0x3C, 0x53, 0x77, 0x89, 0x6C, 0xD5, 0x09, 0x61, 0x0D, 0x84, 0x78, 0xBC,
+ 0x29, 0xEA, 0xD6, 0x0E, 0xDB, 0x75, 0x28, 0x72, 0xBB, 0xEC, 0x48, 0x1D, 0xC3, 0x3C, 0x5F, 0x5D,
+ 0x0E, 0xE4, 0x52, 0x91, 0x29, 0xEB, 0xAE, 0x71, 0xFB, 0x3C, 0x2A, 0x0F, 0x57, 0x28, 0x28, 0xA5,
+ 0x6E, 0x3B, 0x1C, 0xB2, 0x30, 0x89, 0x62, 0x7D, 0x29, 0x0F, 0x55, 0xD9, 0x44, 0x9B, 0x7C, 0xE2,
+ 0x0D, 0xFA, 0x48, 0x8B, 0xCB, 0xCD, 0x96, 0x16, 0xA1, 0x1A, 0x6A, 0x5C, 0xA4, 0xC8, 0x46, 0x4D,
+ 0xC3, 0x42, 0x96, 0x6C, 0xA7, 0xB0, 0xE5, 0xCB, 0xA5, 0x5A, 0x05, 0xE3, 0xFE, 0xD0, 0x88, 0xC0,
+ 0x1F, 0x95, 0xB1, 0xC0, 0x64, 0x68, 0x6C, 0x2E, 0x57, 0xCC, 0x91, 0x8E, 0x41, 0x34, 0x36, 0x40,
+ 0x06, 0x92, 0x0C, 0xE7, 0x78, 0xF0, 0x71, 0xA2, 0x3C, 0xD4, 0xE7, 0xFC, 0x18, 0x25, 0x3C, 0x72,
+ 0x97, 0x0F, 0x7B, 0x1A, 0xD0, 0x60, 0x70, 0x87, 0xFC, 0x50, 0x4B, 0xC2, 0x45, 0xB7, 0x37, 0xEA,
+ 0x16, 0x2E, 0xDA, 0x9D, 0x3F, 0xE2, 0x40, 0xAF, 0x27, 0x8E, 0x62, 0x97, 0xC7, 0x9B, 0x28, 0xF4,
+ 0x82, 0xD3, 0x59, 0x5B, 0x52, 0xA5, 0xF9, 0xB4, 0x76, 0x4B, 0xB6, 0x91, 0x44, 0xA1, 0xED, 0x56,
+ 0xD0, 0x2A, 0xDD, 0x79, 0x94, 0x4E, 0x28, 0x13, 0x4F, 0xE2, 0x44, 0xD4, 0x22, 0xC5, 0x65, 0x7B,
+ 0xF2, 0xAD, 0x73, 0xDF, 0x19, 0x93, 0xC5, 0x5E, 0xA7, 0xE5, 0xF1, 0x62, 0xE4, 0xE2, 0x2E, 0x5B,
+ 0x16, 0x22, 0x19, 0x5A, 0x03, 0x3C, 0x36, 0x7B, 0xEA, 0x4C, 0x39, 0x5B, 0x6E, 0x3A, 0x2A, 0x27,
+ 0xFF, 0x72, 0x9B, 0x22, 0xA7, 0x0B, 0x27, 0xDE, 0x6F, 0xB6, 0x1E, 0x59, 0x93, 0xCB, 0x84, 0xDE,
+ 0x94, 0x79, 0x1E, 0x27, 0x3A, 0x28, 0x65, 0xD7, 0x15, 0xA9, 0x80, 0xD4, 0x1F, 0x3A, 0xEE, 0xE5,
+ 0x36, 0x61, 0xCB, 0x4C, 0x38, 0xE2, 0xE1, 0xFA, 0x9C, 0x85, 0x7E, 0x1B, 0x71, 0xA5, 0xDC, 0x21,
+ 0xDC, 0x3D, 0xF4, 0x03, 0x1A, 0x35, 0xF8, 0xCD, 0xB1, 0xB8, 0x36, 0x6A, 0xA9, 0xA2, 0x21, 0xCE,
+ 0xC3, 0xA2, 0x69, 0x91, 0x6B, 0x51, 0xEF, 0x9C, 0xCE, 0xDE, 0x0C, 0x26, 0x21, 0xEF, 0xED, 0x80,
+ 0x72, 0x82, 0xE9, 0x68, 0xF2, 0xA6, 0x7B, 0x76, 0x0F, 0x9D, 0x5A, 0x1E, 0x3B, 0x38, 0x5B, 0xE6,
+ 0xE1, 0x90, 0x10, 0x82, 0x83, 0x69, 0x9C, 0xEF, 0x29, 0x50, 0x54, 0xFA, 0xC1, 0xBD, 0xB7, 0xB6,
+ 0x8E, 0x96, 0x1A, 0xF0, 0x61, 0x5F, 0x3A, 0x69, 0x6A, 0xCB, 0x99, 0x86, 0x2D, 0xF7, 0x92, 0xE3,
+ 0x89, 0x6B, 0x1E, 0x69, 0xD6, 0x6B, 0x69, 0xBD, 0x5E, 0x02, 0xD7, 0x4E, 0x40, 0x06, 0x14, 0xC0,
+ 0x44, 0x2B, 0x7B, 0xC9, 0xFE, 0xB2, 0x72, 0x56, 0x10, 0x2D, 0x4E, 0xAE, 0x8E, 0xF0, 0x26, 0xBF,
+ 0x8F, 0x45, 0x73, 0x6B, 0x55, 0x22, 0xCA, 0x09, 0xDA, 0x26, 0xCD, 0xDB, 0x65, 0xE0, 0x52, 0x99,
+ 0x71, 0x0C, 0x77, 0x7A, 0x14, 0xE7, 0xF2, 0x4E, 0x0A, 0xEE, 0x23, 0x2C, 0xB6, 0x45, 0x86, 0xED,
+ 0x8B, 0x36, 0x3B, 0x5C, 0x18, 0xC4, 0x43, 0x05, 0x4E, 0x1E, 0x98, 0x9D, 0x6A, 0x1C, 0xF2, 0xB5,
+ 0xA4, 0x77, 0xAE, 0xC8, 0xD3, 0x74, 0xEF, 0x2E, 0xDD, 0xDB, 0x35, 0xD5, 0x4A, 0x0C, 0x25, 0x71,
+ 0xE9, 0xA6, 0x1C, 0xEF, 0x9B, 0xBD, 0x83, 0xD0, 0xD1, 0xD0, 0x6E, 0x88, 0xD6, 0xD6, 0x55, 0xA3,
+ 0xDD, 0x5D, 0x42, 0x42, 0xA8, 0x80, 0xCF, 0xCD, 0x96, 0x92, 0x48, 0xEF, 0xC4, 0x3A, 0x25, 0x3C,
+ 0x4A, 0x33, 0x09, 0xBC, 0x9E, 0xA4, 0x01, 0x9B, 0x42, 0xC5, 0x4B, 0x7C, 0x2F, 0xD8, 0xE5, 0xFD,
+ 0xE8, 0x70, 0x37, 0xED, 0xA0, 0x26, 0x6C, 0x4D, 0x38, 0x7C, 0x0E, 0xE8, 0x17, 0x8F, 0xF7, 0xF6,
+ 0x6A, 0x19, 0x13, 0x59, 0x5A, 0x38, 0x2E, 0xA5, 0xA8, 0x68, 0xC3, 0xB2, 0x7F, 0x28, 0xD0, 0xB1,
+ 0xA1, 0x4F, 0x4B, 0x95, 0x20, 0xE5, 0xAE, 0x97, 0x4C, 0x6F, 0x53, 0x5B, 0x71, 0x7D, 0x66, 0x44,
+ 0x03, 0xC4, 0x30, 0x47, 0xA4, 0xFA, 0xB0, 0x77, 0x3D, 0x7C, 0x8C, 0xAB, 0x71, 0xD8, 0x0F, 0x39,
+ 0xBB, 0x9A, 0x56, 0x7C, 0x78, 0xC3, 0x5A, 0xCA, 0xB9, 0xD4, 0x16, 0x81, 0x8F, 0xC3, 0xB6, 0xB0,
+ 0x59, 0xDE, 0xB9, 0xC9, 0x1D, 0x6A, 0xF3, 0x06, 0x3A, 0xAE, 0xF4, 0xD2, 0x76, 0x12, 0x4F, 0x07,
+ 0x29, 0x6D, 0x0C, 0x17, 0xBA, 0x32, 0x48, 0x55, 0x8A, 0x77, 0x12, 0xE1, 0x69, 0xA5, 0x2D, 0x5A,
+ 0xB6, 0x73, 0x77, 0x5B, 0x63, 0x25, 0xF2, 0x07, 0xAE, 0xAF, 0xA1, 0xD5, 0x2E, 0x58, 0xAB, 0x2B,
+ 0xA8, 0x62, 0x92, 0x7E, 0xA7, 0x2A, 0xA0, 0xA2, 0x09, 0x48, 0x8C, 0x46, 0x1C, 0x39, 0xC7, 0xCA,
+ 0xA5, 0x73, 0x2E, 0x96, 0xD1, 0xB6, 0xD3, 0xC7, 0xC6, 0xBB, 0x58, 0x46, 0x93, 0x5E, 0x1C, 0x78,
+ 0x93, 0x1D, 0x93, 0x5A, 0xDE, 0x32, 0x3C, 0x54, 0xEB, 0xD3, 0xE6, 0x90, 0x33, 0xF9, 0xD6, 0x8E,
+ 0x70, 0x92, 0x34, 0x33, 0x65, 0x4D, 0xBA, 0x96, 0x63, 0x6F, 0xB8, 0x7C, 0xD0, 0x56, 0x98, 0x97,
+ 0x84, 0x7A, 0x73, 0x3E, 0x44, 0x3E, 0xD9, 0xFA, 0x3E, 0xC8, 0x15, 0x41, 0xBE, 0xCB, 0x30, 0x0C,
+ 0xB6, 0x32, 0x85, 0xC1, 0x39, 0xCB, 0x2C, 0xEE, 0x50, 0x46, 0x01, 0x4D, 0xED, 0xF1, 0x42, 0xB0,
+ 0x36, 0x4F, 0x25, 0x23, 0xDD, 0xA7, 0x9C, 0xAF, 0x2F, 0x6B, 0xCF, 0x09, 0xBD, 0x13, 0xE6, 0xA1,
+ 0x4C, 0xB0, 0x93, 0x48, 0x26, 0x8C, 0xA2, 0xA8, 0xC0, 0xAA, 0xB4, 0x70, 0x25, 0x3C, 0x6D, 0xA5,
+ 0x20, 0xE4, 0xBC, 0x72, 0xB2, 0x5D, 0x47, 0x26, 0xC9, 0x43, 0xE7, 0x5A, 0xE7, 0x60, 0xB0, 0x70,
+ 0xF6, 0xD8, 0x0F, 0xE2, 0xB1, 0x10, 0x25, 0x12, 0x44, 0x28, 0xC1, 0xF6, 0x59, 0xC1, 0x3C, 0x47,
+ 0xA9, 0x9D, 0x93, 0xE2, 0x51, 0xE7, 0x8B, 0x93, 0x3C, 0xC6, 0x14, 0xC6, 0xCB, 0x16, 0xC9, 0xBA,
+ 0xF9, 0xAD, 0xF6, 0xA8, 0x7E, 0xDB, 0x9C, 0x77, 0x26, 0x3D, 0xFF, 0x7F, 0x96, 0x86, 0x2E, 0x43,
+ 0x60, 0x0C, 0xED, 0x45, 0xC2, 0xFB, 0x40, 0xE6, 0x70, 0xE5, 0x68, 0x90, 0xE5, 0x5C, 0x88, 0x48,
+ 0x07, 0x3A, 0x8C, 0x2E, 0xA3, 0x25, 0x18, 0xDC, 0xE6, 0x86, 0xD0, 0x1C, 0x23, 0xE9, 0xEA, 0xB6,
+ 0x2A, 0x24, 0x11, 0x12, 0xC5, 0x83, 0x75, 0x00, 0x0E, 0x83, 0xBB, 0xEF, 0x83, 0xDB, 0x71, 0xC4,
+ 0x8E, 0x76, 0x8E, 0x60, 0x57, 0xD9, 0x9C, 0x3A, 0x4A, 0x3B, 0xF9, 0x3B, 0xB7, 0x97, 0xDC, 0x24,
+ 0xAB, 0xD6, 0x4B, 0x94, 0x61, 0xD4, 0x03, 0xBB, 0xBD, 0xAE, 0x18, 0x43, 0x3B, 0x29, 0xF3, 0x77,
+ 0x96, 0xD7, 0x9B, 0x79, 0x9B, 0x44, 0xD2, 0xE8, 0x8B, 0xF1, 0xA2, 0x26, 0x72, 0x2B, 0x37, 0x7A,
+ 0xE2, 0x72, 0x5B, 0xC7, 0xD8, 0x80, 0xC0, 0x6D, 0xDE, 0x11, 0xC8, 0xAB, 0x2E, 0x29, 0x45, 0x1D,
+ 0x03, 0x68, 0x87, 0x1D, 0xF7, 0x54, 0x67, 0x93, 0x29, 0x1A, 0xDD, 0x38, 0x7F, 0x63, 0x3B, 0x3B,
+ 0x58, 0x13, 0xA0, 0x73, 0x55, 0xE2, 0xB5, 0x44, 0x46, 0x62, 0x06, 0x7C, 0xB4, 0x19, 0x5E, 0x4A,
+ 0x11, 0x5A, 0xAB, 0x47, 0xAD, 0x33, 0x0B, 0xD4, 0x22, 0x6A, 0x9D, 0x93, 0x4F, 0x88, 0x86, 0xF5,
+ 0x9E, 0x2C, 0x57, 0x50, 0x53, 0x45, 0x23, 0xA4, 0x1D, 0x42, 0x3F, 0x34, 0xF0, 0xBB, 0xEF, 0x2B,
+ 0xD7, 0x6E, 0xBA, 0xDB, 0x7D, 0xDE, 0xDD, 0xC5, 0x66, 0x2A, 0x54, 0x04, 0x35, 0x14, 0x4D, 0x55,
+ 0x9A, 0x2D, 0x91, 0x36, 0x72, 0x5A, 0x6C, 0x5C, 0xF7, 0x14, 0x39, 0x4A, 0xA2, 0x00, 0xEF, 0x47,
+ 0x17, 0xAB, 0x0E, 0xDD, 0xA2, 0x15, 0x7F, 0x58, 0x46, 0xD4, 0xC1, 0x10, 0xA0, 0x2B, 0xBF, 0x27,
+ 0x57, 0x03, 0x1F, 0x07, 0x18, 0x2E, 0xB4, 0xE5, 0x68, 0xF1, 0x8D, 0x31, 0x70, 0xA1, 0x4D, 0x94,
+ 0x1C, 0x4D, 0x6F, 0xCE, 0x1B, 0x10, 0x71, 0xA2, 0xCB, 0x6E, 0x73, 0xEE, 0xBC, 0x10, 0x2A, 0x97,
+ 0x34, 0xA0, 0x70, 0x27, 0x34, 0xA0, 0xBE, 0x0F, 0x0C, 0x6B, 0x89, 0x19, 0xE6, 0x76, 0x0F, 0xAD,
+ 0xF1, 0xF0, 0x86, 0x8A, 0x26, 0x3C, 0x0A, 0xDB, 0x95, 0xC7, 0x01, 0xB9, 0xCB, 0x46, 0x8F, 0x5D,
+ 0x8E, 0xBC, 0x43, 0x6F, 0xB6, 0x37, 0x11, 0x59, 0xE3, 0x9C, 0x1D, 0x0D, 0xD8, 0xBA, 0x2F, 0xA7,
+ 0xAD, 0xBC, 0x0F, 0xEE, 0x64, 0xD6, 0x9C, 0x78, 0xD7, 0x31, 0xF7, 0xE7, 0x02, 0x78, 0x2E, 0xFA,
+ 0x52, 0xE6, 0x1E, 0x6A, 0x56, 0x08, 0x6D, 0x6A, 0xB4, 0x46, 0x80, 0x1C, 0x11, 0x2A, 0xDD, 0x66,
+ 0x4D, 0x49, 0xD4, 0xEA, 0x3E, 0x1C, 0x24, 0xDD, 0x0B, 0x02, 0xD8, 0x3D, 0xF9, 0x6E, 0x68, 0xF7,
+ 0x9E, 0x78, 0x44, 0xB4, 0x29, 0x3A, 0x00, 0x17, 0x4B, 0x69, 0x2B, 0x24, 0xF4, 0x04, 0xBF, 0xE8,
+ 0x2D, 0x13, 0xED, 0x1B, 0x02, 0x87, 0x0F, 0x6E, 0xA9, 0x62, 0xEA, 0xA6, 0x18, 0x7B, 0x8B, 0x16,
+ 0x40, 0xE6, 0xC8, 0x86, 0x95, 0x12, 0xB6, 0x63, 0xB2, 0xA4, 0x58, 0x52, 0x5F, 0xED, 0x2D, 0xDF,
+ 0x9F, 0x8E, 0xD7, 0x7D, 0xC0, 0x11, 0x26, 0x3A, 0xDD, 0x5A, 0x8E, 0xDA, 0x17, 0x59, 0xDA, 0x0A,
+ 0xBC, 0x2E, 0xC5, 0x62, 0x16, 0xDD, 0xBD, 0x90, 0x4E, 0x43, 0x87, 0x10, 0x12, 0x60, 0xEE, 0x87,
+ 0x0D, 0xA5, 0xF1, 0xBB, 0xFB, 0xFE, 0x8A, 0x57, 0x57, 0xF6, 0x88, 0x1C, 0x9A, 0xF0, 0x32, 0x42,
+ 0x17, 0x63, 0xB9, 0x8C, 0x3D, 0x39, 0x51, 0x75, 0x3D, 0x07, 0xD5, 0xBE, 0x04, 0xAD, 0xAE, 0x47,
+ 0xA3, 0xAC, 0x25, 0x50, 0x7E, 0x56, 0x6C, 0x1C, 0x67, 0xDA, 0x5A, 0xB8, 0x6C, 0x40, 0xD6, 0xB5,
+ 0xC2, 0xDC, 0x35, 0xDF, 0x2C, 0xF5, 0x95, 0xBF, 0x77, 0xB8, 0xB0, 0xAD, 0x1A, 0x02, 0x53, 0xB8,
+ 0xD6, 0x85, 0x0F, 0x56, 0xD5, 0xF8, 0x56, 0x9D, 0x47, 0x27, 0x89, 0x36, 0x99, 0x20, 0x75, 0x7B,
+ 0x7A, 0x9D, 0x8A, 0x35, 0xCF, 0x65, 0xB1, 0xBE, 0xF1, 0x08, 0xD9, 0xA2, 0xF2, 0x10, 0xF2, 0xE2,
+ 0x86, 0x53, 0xD6, 0x59, 0x4A, 0x41, 0xDB, 0x33, 0x15, 0x5F, 0x29, 0x66, 0x7F, 0x36, 0xEE, 0xDB,
+ 0x01, 0x14, 0x72, 0xFE, 0xA9, 0xE1, 0x53, 0x9C, 0x65, 0x68, 0x3D, 0x01, 0x95, 0x02, 0x23, 0x20,
+ 0x24, 0xE2, 0x86, 0x03, 0x7F, 0xE0, 0xCF, 0x49, 0x77, 0xD0, 0xF0, 0x56, 0xE7, 0x79, 0x7E, 0x99,
+ 0xEC, 0xF8, 0xA5, 0xC4, 0xE8, 0x85, 0x48, 0xC5, 0x8C, 0x22, 0x9A, 0x77, 0x53, 0x30, 0x59, 0xA2,
+ 0x39, 0x9F, 0x44, 0xCD, 0x05, 0x39, 0x53, 0x12, 0xB4, 0x56, 0x52, 0x31, 0xDF, 0x24, 0x45, 0xEB,
+ 0x56, 0xDA, 0x98, 0x6C, 0xE8, 0xAC, 0x9B, 0x48, 0xF9, 0x6A, 0x76, 0x88, 0x50, 0xF7, 0x3A, 0x99,
+ 0x41, 0xB3, 0xA5, 0x76, 0xF7, 0xAE, 0xDB, 0x9C, 0x88, 0xA9, 0xAD, 0xA9, 0x73, 0xC8, 0xDF, 0x99,
+ 0xAE, 0xBE, 0xED, 0x6E, 0x58, 0x4A, 0x6A, 0x52, 0x43, 0x74, 0xE8, 0xAE, 0x40, 0x08, 0x5D, 0xD2,
+ 0xF4, 0x4D, 0x05, 0xEA, 0x20, 0xE6, 0x78, 0x6B, 0x5D, 0xC9, 0x4E, 0x34, 0x1C, 0x3B, 0x67, 0xC0,
+ 0x1D, 0x25, 0x27, 0xBA, 0xF2, 0x8C, 0x2A, 0x42, 0x6E, 0x90, 0xB3, 0x86, 0x4C, 0xAF, 0xBD, 0x05,
+ 0x74, 0x0E, 0xED, 0x80, 0x32, 0x45, 0x38, 0x72, 0x65, 0x41, 0xDD, 0x3D, 0xB0, 0x2D, 0x5C, 0x35,
+ 0xB0, 0xEF, 0x36, 0xFB, 0xDE, 0x36, 0x36, 0xE6, 0x6D, 0x7B, 0x77, 0x09, 0xBC, 0xBC, 0x74, 0xB7,
+ 0x83, 0x07, 0x1C, 0xC8, 0x14, 0x97, 0xFB, 0xCA, 0x29, 0x27, 0xD4, 0x8A, 0x55, 0x74, 0x09, 0xE1,
+ 0x89, 0x28, 0xA1, 0x2A, 0x53, 0xC5, 0x51, 0xC7, 0x79, 0xD7, 0x5B, 0x42, 0xB7, 0x47, 0x29, 0x2A,
+ 0x27, 0x77, 0x39, 0xAC, 0x00, 0x2E, 0xAE, 0x4D, 0xA0, 0xE0, 0x08, 0x83, 0xBA, 0x70, 0xE5, 0x8B,
+ 0x91, 0x7B, 0x4F, 0x6D, 0x82, 0xBA, 0xB4, 0xF5, 0xA1, 0x64, 0xC8, 0x2E, 0xD2, 0x9C, 0x53, 0x00,
+ 0x32, 0x72, 0x41, 0xF6, 0xE9, 0xF1, 0x24, 0xB4, 0xE3, 0x79, 0xEF, 0x4D, 0x93, 0xB5, 0x4C, 0xBD,
+ 0x5C, 0xBE, 0x39, 0xB1, 0x66, 0x5B, 0x1B, 0xBC, 0xA0, 0xCF, 0x22, 0xB3, 0x26, 0xD9, 0xED, 0xA0,
+ 0x11, 0xAB, 0x76, 0x35, 0x92, 0x47, 0xDF, 0x1C, 0x50, 0x0D, 0xCB, 0xD8, 0x7D, 0x94, 0xF7, 0xBB,
+ 0xA1, 0xC8, 0xD4, 0xFC, 0xEE, 0x9C, 0xBC, 0xB5, 0x5A, 0x14, 0xBB, 0x54, 0x55, 0x54, 0xE9, 0x38,
+ 0x6D, 0x09, 0x10, 0x03, 0x47, 0xB7, 0x1E, 0x52, 0xC8, 0x1E, 0x78, 0x03, 0x5F, 0x0E, 0x47, 0x2C,
+ 0xCC, 0x7C, 0x55, 0xDC, 0x10, 0xA2, 0xE4, 0x6E, 0xE1, 0x9E, 0xA5, 0x25, 0x6B, 0x8D, 0xED, 0x02,
+ 0x28, 0x6C, 0x56, 0xC2, 0x7A, 0xE3, 0x67, 0x2E, 0xD1, 0x13, 0xC3, 0xA9, 0xD8, 0x76, 0x1A, 0xA8,
+ 0xD5, 0xD0, 0x42, 0xE8, 0x91, 0x9B, 0x51, 0xC8, 0x9A, 0x8F, 0x5E, 0x35, 0x7D, 0x8B, 0x31, 0x58,
+ 0x7B, 0x6F, 0xED, 0x34, 0x2F, 0x8E, 0x5D, 0x5B, 0x0A, 0x69, 0x23, 0xE4, 0xD5, 0xAD, 0x39, 0x45,
+ 0x9E, 0x03, 0xEA, 0xB7, 0xEB, 0x99, 0x3F, 0x90, 0x4C, 0x91, 0xC8, 0x03, 0x48, 0xB6, 0x9D, 0x13,
+ 0xB9, 0xDF, 0xA1, 0x81, 0x2B, 0x61, 0x57, 0x02, 0xE9, 0x21, 0x8F, 0xB0, 0xD3, 0x70, 0x6B, 0x15,
+ 0x03, 0x79, 0xBE, 0xCA, 0x31, 0x0A, 0x71, 0x82, 0x59, 0x27, 0x93, 0x9A, 0xB3, 0x89, 0x75, 0x95,
+ 0x3A, 0x57, 0x92, 0x96, 0x8A, 0xB8, 0x69, 0x98, 0x96, 0xCB, 0x95, 0x78, 0x8A, 0x8C, 0x0C, 0x3D,
+ 0x4F, 0xB5, 0x65, 0x48, 0x20, 0x7B, 0x46, 0x48, 0xFF, 0x1E, 0xB9, 0x91, 0x8A, 0x9E, 0x30, 0xA8,
+ 0x5D, 0x22, 0x3B, 0x41, 0xD2, 0x4B, 0xD3, 0x47, 0xFD, 0xF5, 0xDE, 0xCF, 0xB8, 0x75, 0xE7, 0x7A,
+ 0xEA, 0xAD, 0xC6, 0x4F, 0xBA, 0xE2, 0x84, 0x10, 0x74, 0x57, 0x2C, 0xD3, 0x23, 0x03, 0x50, 0x4E,
+ 0x87, 0x51, 0xDB, 0xA4, 0x44, 0xD7, 0xB2, 0x0A, 0x00, 0xF5, 0xEF, 0xD4, 0x96, 0x3F, 0xDF, 0xE5,
+ 0xCB, 0x92, 0x4E, 0x57, 0x67, 0x27, 0xDB, 0xE8, 0xF0, 0xD6, 0x17, 0xB7, 0x37, 0xFE, 0x76, 0x4C,
+ 0xF4, 0x00, 0x94, 0xC7, 0x8A, 0x8D, 0x21, 0x97, 0xBA, 0x14, 0x67, 0x1E, 0x24, 0x77, 0xAF, 0x95,
+ 0x27, 0xDE, 0x6E, 0xFB, 0x50, 0xC4, 0xAE, 0xC6, 0x8E, 0x27, 0x84, 0x5D, 0xBC, 0x5A, 0xB2, 0x85,
+ 0x6D, 0x62, 0x82, 0x7E, 0xBC, 0x49, 0x24, 0x0D, 0x21, 0x2A, 0x86, 0x23, 0xF9, 0x68, 0x50, 0xAC,
+ 0xB2, 0xC1, 0x92, 0x42, 0x56, 0xF0, 0x93, 0x43, 0xEE, 0xE3, 0xF5, 0x91, 0xDE, 0x41, 0x82, 0x17,
+ 0x15, 0xC6, 0x19, 0xBF, 0x21, 0x97, 0xAD, 0x9D, 0x26, 0xF8, 0x00, 0x97, 0x9B, 0xA8, 0xF7, 0x53,
+ 0xCB, 0xE3, 0xBB, 0x71, 0xEB, 0xE5, 0x3B, 0x3D, 0xDF, 0x73, 0x49, 0x18, 0xB7, 0x91, 0xDF, 0x08,
+ 0x8D, 0x86, 0x56, 0x03, 0xE7, 0xF1, 0x37, 0x22, 0x4A, 0xFA, 0x71, 0x42, 0x69, 0x3C, 0x73, 0xCC,
+ 0x51, 0x03, 0xE2, 0x9C, 0x04, 0x39, 0x61, 0xDD, 0x94, 0x16, 0xF4, 0xB8, 0x04, 0xE7, 0x18, 0x73,
+ 0x4C, 0xBE, 0x22, 0x59, 0x04, 0xF1, 0xBD, 0x3B, 0xD0, 0xF0, 0x31, 0xC7, 0x86, 0xA5, 0xC5, 0x9F,
+ 0x98, 0xCB, 0x11, 0xA7, 0x56, 0xD5, 0x09, 0xBF, 0x0E, 0x37, 0x5D, 0x5C, 0xC5, 0xA7, 0x5E, 0x5D,
+ 0x33, 0x6B, 0xFE, 0x16, 0xE2, 0x18, 0x46, 0xBB, 0x89, 0x9D, 0xD6, 0xAA, 0x86, 0x5F, 0x8F, 0x36,
+ 0x12, 0x5C, 0x2B, 0xB4, 0xA8, 0xE0, 0xC6, 0x3F, 0x99, 0x2E, 0xA5, 0x4F, 0x3A, 0xE1, 0xA4, 0x20,
+ 0x47, 0xAD, 0x93, 0x2A, 0x44, 0x26, 0x8D, 0x1F, 0x8A, 0x4E, 0x6E, 0x0C, 0xB6, 0x60, 0xFB, 0x7D,
+ 0x9C, 0x80, 0x6A, 0x61, 0xC5, 0xC6, 0x79, 0x49, 0x18, 0x9A, 0x4D, 0x8C, 0x51, 0x7E, 0xCD, 0x60,
+ 0x66, 0x0B, 0x2D, 0x6D, 0x79, 0xD7, 0x85, 0xC5, 0x28, 0x17, 0x6C, 0x37, 0x21, 0x62, 0x71, 0x3A,
+ 0xB1, 0xA2, 0x35, 0xD5, 0x3B, 0xB5, 0x8A, 0x39, 0x5D, 0x6D, 0xBB, 0xCD, 0x16, 0x6D, 0xA9, 0x82,
+ 0xEA, 0x9C, 0xED, 0x0E, 0x87, 0xCF, 0x77, 0x34, 0xF0, 0x45, 0x12, 0x92, 0xD7, 0x9A, 0x6C, 0x20,
+ 0xE8, 0xAE, 0x76, 0xF4, 0x6A, 0xB7, 0x0B, 0x12, 0x49, 0x37, 0x19, 0x72, 0xCD, 0xD3, 0x61, 0x61,
+ 0x2E, 0x29, 0xE5, 0x90, 0x6B, 0x69, 0xC4, 0x5D, 0x8F, 0xC7, 0x23, 0x77, 0x93, 0xA3, 0xBE, 0x98,
+ 0x8A, 0x7D, 0x0B, 0x49, 0x1B, 0x8B, 0x29, 0x1B, 0x88, 0xAA, 0x0F, 0x2E, 0x9E, 0x55, 0x4A, 0xCC,
+ 0xF6, 0x95, 0x4F, 0xF6, 0x17, 0xAD, 0x56, 0x81, 0x47, 0x0F, 0x4D, 0x52, 0x58, 0x35, 0x62, 0x1B,
+ 0xDE, 0x07, 0xB5, 0x3B, 0xF8, 0x25, 0x5E, 0xAC, 0x2F, 0x77, 0x67, 0x79, 0x39, 0xE5, 0x37, 0xB9,
+ 0xCF, 0xF5, 0x3A, 0x1F, 0xD6, 0x30, 0x08, 0x41, 0x79, 0x7D, 0x4C, 0x41, 0x45, 0x1F, 0xD3, 0xB4,
+ 0x79, 0xEF, 0xA8, 0xCC, 0xB9, 0xFA, 0x7E, 0x37, 0x5C, 0x84, 0xAA, 0xAC, 0xC3, 0x6B, 0xBE, 0x91,
+ 0xC8, 0xFB, 0x3E, 0xDD, 0xB9, 0x26, 0xBD, 0xCE, 0x57, 0xFC, 0xA4, 0x1F, 0xF3, 0x6C, 0x00, 0x87,
+ 0x4A, 0xAD, 0x6A, 0x21, 0xD9, 0xF6, 0x48, 0x67, 0x1F, 0xA2, 0xAD, 0xB5, 0xB6, 0x97, 0xC7, 0x63,
+ 0x33, 0xA2, 0xE6, 0x2E, 0xBF, 0x49, 0xBB, 0x6B, 0x33, 0xA8, 0xB5, 0xE1, 0x1F, 0x0F, 0xB1, 0x70,
+ 0x57, 0x74, 0xB5, 0x63, 0x61, 0xD9, 0xAE, 0x2D, 0x14, 0xAB, 0xAF, 0xFB, 0x32, 0x02, 0x99, 0xC0,
+ 0x0D, 0x47, 0xA3, 0xDE, 0x08, 0xF1, 0x74, 0x64, 0xA6, 0x93, 0xBF, 0xDC, 0x59, 0x71, 0x07, 0xD4,
+ 0x95, 0x8D, 0x83, 0x5B, 0x1B, 0xF6, 0xE1, 0xA5, 0x5F, 0xDA, 0x87, 0xC2, 0x8B, 0x18, 0x6A, 0x1C,
+ 0xEF, 0x47, 0x79, 0x0D, 0xB1, 0x9D, 0x90, 0xF7, 0x93, 0xA7, 0x63, 0xA2, 0x9F, 0xAD, 0x4F, 0x27,
+ 0xC9, 0xD5, 0x8B, 0xB1, 0x5B, 0x19, 0xB9, 0x24, 0xF2, 0xBD, 0x40, 0x98, 0x2D, 0x2C, 0x29, 0xB2,
+ 0x22, 0x5C, 0xD6, 0x4D, 0x76, 0x83, 0xD4, 0xB6, 0x5D, 0xBB, 0x51, 0x20, 0x5A, 0x08, 0xEB, 0x9F,
+ 0xF7, 0xC9, 0x2D, 0x5A, 0xDB, 0xDD, 0x32, 0xCE, 0xB7, 0x38, 0x9B, 0x56, 0x04, 0xC5, 0x96, 0x36,
+ 0x38, 0x9B, 0xDD, 0x31, 0x44, 0x45, 0xB9, 0xC4, 0xA3, 0x41, 0xB1, 0x34, 0x82, 0xB3, 0xFB, 0x10,
+ 0xBA, 0x16, 0x43, 0x2F, 0xE3, 0xD1, 0xA1, 0xCB, 0xC3, 0x5D, 0x5B, 0x54, 0xC4, 0x48, 0x72, 0x26,
+ 0xA5, 0x5F, 0xEB, 0x3E, 0x2E, 0x5D, 0x52, 0x8B, 0xDB, 0x8E, 0x9F, 0x4D, 0x89, 0x52, 0xF4, 0x14,
+ 0x37, 0x53, 0x39, 0x99, 0xCE, 0x49, 0xCB, 0x4D, 0xE3, 0x74, 0xB3, 0x79, 0x1F, 0x23, 0x91, 0xFC,
+ 0xBE, 0xB3, 0xE5, 0x33, 0xE7, 0x67, 0x3B, 0x31, 0x3F, 0xE4, 0x41, 0x1F, 0x67, 0xAA, 0x30, 0x1D,
+ 0x1B, 0x44, 0x27, 0x43, 0x09, 0x4E, 0x33, 0x5E, 0xCE, 0x0E, 0x3D, 0x37, 0x4D, 0x87, 0x41, 0xD8,
+ 0xF5, 0x6D, 0x53, 0x91, 0x24, 0x93, 0x0C, 0x2B, 0xCF, 0x88, 0x73, 0x4E, 0x39, 0x1F, 0x87, 0x91,
+ 0x1F, 0x30, 0xB7, 0xC2, 0x88, 0x61, 0xB5, 0xC6, 0x2B, 0x88, 0x8D, 0xB1, 0x25, 0x2D, 0x2C, 0x87,
+ 0xB2, 0x46, 0x5A, 0xDB, 0x68, 0xAD, 0x6B, 0x61, 0x23, 0xF7, 0x96, 0x49, 0xB7, 0xE3, 0x8E, 0x12,
+ 0x45, 0x90, 0xE0, 0x6D, 0x6C, 0xA2, 0x1D, 0x03, 0xA1, 0xCB, 0xE1, 0x6C, 0xBB, 0x94, 0xC9, 0x86,
+ 0x0C, 0xE0, 0x6B, 0x95, 0x96, 0xA2, 0x3F, 0x38, 0x09, 0xC4, 0xFB, 0x5E, 0x2F, 0x0D, 0xE5, 0xE9,
+ 0x38, 0x99, 0xB1, 0x2E, 0xEB, 0xC9, 0x69, 0x07, 0x8E, 0x63, 0xB3, 0xD1, 0x6A, 0x0D, 0xE4, 0x02,
+ 0xDB, 0x30, 0x55, 0xA3, 0xDD, 0x40, 0xA4, 0xB0, 0xC4, 0x1F, 0x88, 0xFA, 0x70, 0xDD, 0x9F, 0x78,
+ 0x09, 0x1F, 0x4E, 0xC8, 0x25, 0xDF, 0x1C, 0x8E, 0xF4, 0x65, 0xBA, 0xD6, 0xAE, 0x7F, 0x84, 0x2B,
+ 0x72, 0x15, 0xB0, 0xB0, 0xA6, 0x14, 0xD7, 0xA9, 0x11, 0x15, 0x0E, 0xCE, 0xE2, 0x33, 0x3E, 0x65,
+ 0x44, 0x7D, 0x46, 0xAA, 0x18, 0x6B, 0x37, 0x67, 0xCF, 0x87, 0x58, 0x2A, 0x76, 0x45, 0xD5, 0x5C,
+ 0xEF, 0x2E, 0x63, 0x3B, 0xCD, 0xC5, 0xE2, 0x4D, 0x19, 0x5B, 0x3F, 0xDA, 0x16, 0x89, 0xBE, 0x97,
+ 0xF1, 0xA1, 0x4F, 0x4B, 0xE4, 0x30, 0x60, 0x3A, 0xDD, 0x98, 0x41, 0x9B, 0x42, 0x71, 0x79, 0xCA,
+ 0x48, 0x62, 0x35, 0x69, 0xD7, 0x25, 0x23, 0xF2, 0xD7, 0xD3, 0x55, 0xE3, 0xE4, 0xE0, 0xF1, 0x3F,
+ 0xC1, 0x8A, 0x72, 0xE7, 0xB4, 0xED, 0x3D, 0xBB, 0x5D, 0x39, 0x42, 0xEB, 0xD7, 0xF9, 0x8D, 0xC1,
+ 0xF8, 0x09, 0x08, 0x11, 0x44, 0xE2, 0xB2, 0x13, 0x34, 0x02, 0xBA, 0x5B, 0x51, 0x1C, 0xA9, 0x50,
+ 0xD2, 0xD8, 0xE3, 0x0A, 0x81, 0x04, 0xA4, 0x6D, 0x8A, 0xF4, 0x7C, 0xBC, 0x75, 0xA1, 0x1C, 0xB7,
+ 0xC7, 0x6A, 0x07, 0xD5, 0xB7, 0xA9, 0x3E, 0x9B, 0xC6, 0xBD, 0x47, 0xC8, 0x93, 0x2F, 0x90, 0xC2,
+ 0x65, 0x5B, 0x69, 0xE3, 0x86, 0x6A, 0xC8, 0xAB, 0x2B, 0x21, 0xF1, 0x60, 0x5C, 0x50, 0x2C, 0xDD,
+ 0x91, 0xDB, 0x52, 0x2B, 0xB8, 0xED, 0x9C, 0xB9, 0x71, 0x92, 0x42, 0x69, 0xD4, 0x96, 0xE0, 0x87,
+ 0x8C, 0xDA, 0xD1, 0x42, 0x78, 0x82, 0x78, 0x2A, 0x20, 0xD4, 0x04, 0xD4, 0x6A, 0x69, 0x6B, 0x0F,
+ 0xFD, 0xD2, 0x3B, 0xD5, 0x69, 0x78, 0x63, 0x04, 0x16, 0x16, 0xA1, 0x34, 0x87, 0x45, 0xE4, 0x74,
+ 0x3F, 0x46, 0xDB, 0xFE, 0x32, 0xF0, 0xC3, 0xD0, 0xBA, 0xF1, 0x85, 0xB6, 0x68, 0xE9, 0x58, 0xEF,
+ 0xC5, 0x40, 0xDB, 0x44, 0x69, 0x2D, 0x5C, 0x4A, 0xBA, 0x37, 0xD2, 0xF6, 0x36, 0xB8, 0xA5, 0x24,
+ 0xAF, 0xAF, 0x87, 0x95, 0x0B, 0x89, 0x76, 0xA3, 0x9C, 0x31, 0xEF, 0xBE, 0xDD, 0x3B, 0xD9, 0x76,
+ 0x97, 0xDC, 0xD2, 0x02, 0x8F, 0x2F, 0x37, 0xC5, 0xAC, 0x8F, 0x1A, 0x29, 0xEC, 0x03, 0x93, 0x1D,
+ 0xAE, 0x89, 0xE5, 0x8D, 0xF7, 0xBD, 0x4C, 0x03, 0xA3, 0x9B, 0xF6, 0xEE, 0xD0, 0x35, 0xE8, 0x20,
+ 0xD8, 0x26, 0xC9, 0xDD, 0xE2, 0x1D, 0xB2, 0x62, 0x43, 0x0D, 0xA2, 0xCC, 0xB4, 0xC4, 0xFD, 0xCB,
+ 0xAE, 0xAD, 0xF3, 0x11, 0xB3, 0x4C, 0x06, 0x3A, 0x65, 0x67, 0x3D, 0x42, 0xD3, 0x81, 0xDD, 0x9E,
+ 0x49, 0xA6, 0x24, 0xDC, 0x46, 0x72, 0x6D, 0x6D, 0x18, 0x96, 0xA8, 0x68, 0xDD, 0x6A, 0xA7, 0xDA,
+ 0x35, 0x62, 0x97, 0xBB, 0x42, 0xAF, 0x30, 0x31, 0x2B, 0xDC, 0x0E, 0xB7, 0x7A, 0xEC, 0xED, 0xB4,
+ 0xBF, 0xA3, 0x18, 0x5D, 0xA7, 0x38, 0x77, 0x3B, 0xB5, 0x9D, 0x20, 0xDE, 0xD4, 0x08, 0xA9, 0x11,
+ 0x4B, 0xBD, 0x40, 0xF2, 0xFD, 0x20, 0x6D, 0x25, 0x8D, 0x4F, 0xAC, 0x69, 0xDF, 0x65, 0xDD, 0x15,
+ 0x3D, 0xDB, 0x18, 0x2C, 0x9E, 0x9A, 0x4A, 0xEF, 0x2F, 0x07, 0x2C, 0xA4, 0x75, 0x76, 0x6F, 0x35,
+ 0xC8, 0x5D, 0xCA, 0xA6, 0x7B, 0xBD, 0xB3, 0x2E, 0xA6, 0x70, 0x86, 0xE5, 0xD6, 0x3C, 0x95, 0x23,
+ 0x8C, 0x1B, 0xFB, 0xE4, 0xDA, 0xA0, 0x84, 0x75, 0x1E, 0xA2, 0x78, 0xB7, 0x51, 0x39, 0x2E, 0x39,
+ 0x16, 0x4A, 0x03, 0x69, 0x42, 0x0E, 0x04, 0x71, 0x62, 0x59, 0x54, 0x3A, 0x95, 0x41, 0xE6, 0x9F,
+ 0x10, 0x98, 0xDE, 0x21, 0xF7, 0x14, 0xE5, 0x49, 0xCE, 0x31, 0xB6, 0x07, 0x4B, 0xD3, 0x7A, 0x11,
+ 0xDF, 0x1A, 0xF4, 0x25, 0x26, 0x20, 0xB3, 0x68, 0xA6, 0xA3, 0x0D, 0x59, 0x47, 0x55, 0x8E, 0x31,
+ 0xA6, 0xEB, 0xEF, 0x25, 0xD0, 0x56, 0x6F, 0x67, 0x01, 0x1F, 0xCE, 0xD3, 0x19, 0x5E, 0xD6, 0x42,
+ 0xAE, 0xA4, 0x27, 0x03, 0xC1, 0xCF, 0x37, 0x72, 0x6A, 0x45, 0xF5, 0x72, 0x2A, 0x22, 0xD1, 0x9C,
+ 0x7A, 0xD1, 0xEC, 0x2E, 0x07, 0xA1, 0xE0, 0x88, 0x9B, 0x10, 0x5D, 0x4E, 0xD7, 0x1A, 0x22, 0xAF,
+ 0xC6, 0xCA, 0x09, 0x62, 0x33, 0xBE, 0x1D, 0xD1, 0x2A, 0xC6, 0x47, 0x0F, 0xAD, 0x3C, 0x87, 0x59,
+ 0x61, 0xCC, 0x61, 0x38, 0x0A, 0x78, 0x63, 0x84, 0xAB, 0xEB, 0xB5, 0x3D, 0x1F, 0x84, 0x09, 0x83,
+ 0xD0, 0x76, 0xBB, 0x4E, 0xC8, 0x0B, 0x1A, 0x28, 0xA2, 0x2D, 0x0C, 0xAA, 0x82, 0xED, 0x96, 0x63,
+ 0x0A, 0xA1, 0xEC, 0xBE, 0xDE, 0x1F, 0x39, 0x23, 0xF7, 0xF7, 0x11, 0x53, 0x64, 0x1B, 0x1C, 0x72,
+ 0x44, 0xC1, 0xDB, 0xD3, 0x26, 0x6B, 0x69, 0x90, 0x50, 0xF2, 0x7B, 0xAC, 0xE8, 0x4E, 0xD4, 0x32,
+ 0x1A, 0x0E, 0xC8, 0x90, 0x9D, 0x36, 0xD6, 0x49, 0xD2, 0x21, 0x2B, 0xEC, 0x77, 0x91, 0xEC, 0x1A,
+ 0x74, 0x0F, 0x1F, 0xBB, 0x63, 0xB4, 0x91, 0xC7, 0xAE, 0x62, 0xF9, 0x83, 0x4F, 0xBB, 0x08, 0x1C,
+ 0x21, 0xC8, 0x71, 0x0A, 0x31, 0x27, 0xBD, 0x2E, 0xA3, 0xAE, 0xB9, 0x75, 0x4D, 0x8D, 0xA3, 0x49,
+ 0x6B, 0xE7, 0x8C, 0x7B, 0x2E, 0x5C, 0xCC, 0x67, 0xE8, 0xD1, 0xC7, 0x37, 0xC4, 0x8A, 0x09, 0x2F,
+ 0xFA, 0x68, 0x1D, 0x1C, 0x7A, 0x3B, 0xEA, 0xE3, 0xAD, 0x3D, 0xB8, 0x6A, 0xBF, 0xDF, 0xB1, 0x4B,
+ 0xFE, 0xA2, 0xF6, 0x67, 0xA3, 0x92, 0x84, 0x51, 0x6A, 0xA5, 0xA1, 0x97, 0x02, 0xD7, 0x42, 0xAF,
+ 0xAB, 0x66, 0x59, 0x48, 0xB0, 0x18, 0x22, 0x91, 0x73, 0x88, 0x06, 0x90, 0xC2, 0xE4, 0x17, 0xC2,
+ 0x5E, 0x56, 0x72, 0x44, 0x49, 0x91, 0xB0, 0x4F, 0x68, 0x84, 0x98, 0x14, 0x3F, 0xED, 0x11, 0xB7,
+ 0x68, 0x10, 0xC5, 0x3A, 0x12, 0x92, 0x04, 0xBB, 0xEE, 0xC4, 0x1F, 0x43, 0xDE, 0x66, 0x3A, 0xEB,
+ 0x9A, 0xF3, 0x14, 0x5A, 0xA4, 0xE1, 0xC5, 0xDB, 0xF8, 0xDB, 0x56, 0xF2, 0x2F, 0x8D, 0x91, 0xEF,
+ 0x84, 0x71, 0x4D, 0xF2, 0x75, 0x8E, 0xD9, 0x04, 0x81, 0xE4, 0x97, 0xB6, 0x11, 0x0E, 0x9D, 0x7D,
+ 0xC1, 0x82, 0x88, 0x71, 0x96, 0x3E, 0xD7, 0x84, 0x3A, 0xE5, 0xE1, 0x44, 0x81, 0xC0, 0xDD, 0x81,
+ 0xBE, 0x52, 0x5B, 0xAC, 0x21, 0x50, 0x8E, 0x52, 0x50, 0x02, 0x6B, 0x45, 0x3A, 0xEF, 0x58, 0x21,
+ 0x8C, 0x03, 0x01, 0xF8, 0xCD, 0x6B, 0x33, 0x51, 0x01, 0x4E, 0x67, 0xA8, 0x89, 0xB5, 0x3B, 0xF9,
+ 0xB4, 0xA6, 0x93, 0xB0, 0x5D, 0x16, 0xBB, 0xF3, 0x1D, 0x66, 0xB8, 0x1C, 0x5A, 0x6E, 0x74, 0x7D,
+ 0x5D, 0x95, 0x2A, 0x99, 0x83, 0x1C, 0xD1, 0xD6, 0xBB, 0x73, 0xE4, 0xA6, 0xC8, 0xFD, 0x46, 0x52,
+ 0xDE, 0x70, 0x0E, 0xFD, 0xDA, 0xCE, 0xF6, 0x0E, 0x76, 0x38, 0xD5, 0x91, 0x51, 0x9E, 0xE9, 0xD8,
+ 0xD6, 0x03, 0x68, 0x29, 0x5B, 0x50, 0xD9, 0x60, 0x18, 0xD6, 0x06, 0xDE, 0xA9, 0x14, 0x84, 0x70,
+ 0x4F, 0x65, 0x68, 0x65, 0x61, 0x7B, 0xF2, 0x24, 0x0C, 0xF9, 0x59, 0x5A, 0x5D, 0x60, 0x57, 0x5A,
+ 0xF6, 0xB5, 0x0D, 0x9D, 0x37, 0x09, 0xA6, 0x83, 0x7C, 0x13, 0xBD, 0x14, 0xAC, 0xE1, 0x66, 0x71,
+ 0xB6, 0x1E, 0xE3, 0xD4, 0x97, 0xFC, 0xDE, 0xCB, 0xD0, 0x63, 0x7A, 0x22, 0xEF, 0xE4, 0x40, 0x4A,
+ 0x56, 0xAF, 0xF9, 0x90, 0x64, 0x9D, 0xAE, 0x74, 0x7F, 0x2E, 0xEE, 0xD9, 0x96, 0x17, 0xFC, 0xB6,
+ 0x83, 0x0C, 0xB9, 0x87, 0x48, 0xE4, 0x8C, 0x63, 0x43, 0x27, 0xC1, 0x68, 0x02, 0x73, 0x7D, 0x20,
+ 0x9D, 0x5A, 0x50, 0x5A, 0x74, 0xFA, 0x91, 0xF6, 0x32, 0x3D, 0x95, 0x8D, 0xF6, 0x3C, 0x5E, 0xB3,
+ 0x02, 0xA4, 0xA7, 0x14, 0x61, 0x7A, 0xB8, 0xD0, 0xB5, 0x44, 0x68, 0xA9, 0xE3, 0x31, 0x0F, 0xCE,
+ 0x4A, 0x3F, 0x7F, 0xD9, 0x08, 0x88, 0x38, 0xE2, 0x42, 0x61, 0xED, 0xFB, 0x72, 0x03, 0x6D, 0xD1,
+ 0x0B, 0x82, 0xEA, 0xE8, 0xD8, 0xB2, 0xB7, 0x46, 0x72, 0x88, 0x89, 0x4C, 0xBC, 0xFC, 0xC8, 0xB6,
+ 0x74, 0x22, 0x1A, 0xBA, 0x29, 0xAF, 0x25, 0x6A, 0x3A, 0xAD, 0x10, 0x91, 0xDB, 0x89, 0xFD, 0xBE,
+ 0x87, 0xB9, 0x8B, 0x8C, 0x36, 0x5A, 0x7E, 0xA7, 0x78, 0x0C, 0x9A, 0xEC, 0x7C, 0x2A, 0x76, 0xC3,
+ 0x50, 0x72, 0xAC, 0xC2, 0x59, 0x74, 0x69, 0x41, 0xE3, 0xF1, 0x4E, 0x98, 0x88, 0x42, 0x5C, 0xFC,
+ 0x03, 0x9C, 0x33, 0x58, 0x5C, 0xE2, 0x32, 0xC8, 0x7F, 0xE5, 0xAD, 0x3B, 0xD4, 0xFB, 0x13, 0xDA,
+ 0x0C, 0xE3, 0x2A, 0x6D, 0x57, 0x28, 0x0D, 0x9D, 0x31, 0x02, 0xB9, 0x22, 0x00, 0xE3, 0xAE, 0xA0,
+ 0x4C, 0xBC, 0x3E, 0x4C, 0x27, 0x81, 0x4A, 0x73, 0xAB, 0xE8, 0x4D, 0xA2, 0xDB, 0x8A, 0x4E, 0x4F,
+ 0x55, 0x3B, 0xD1, 0x40, 0x63, 0x69, 0xA7, 0xE6, 0x2B, 0x65, 0x19, 0x33, 0xA7, 0x36, 0x2A, 0x86,
+ 0x21, 0x3C, 0x8C, 0x2D, 0x30, 0xCA, 0xBD, 0x5C, 0x14, 0x5D, 0xB8, 0x5E, 0x62, 0x28, 0x48, 0x53,
+ 0x82, 0x33, 0xC8, 0x19, 0x13, 0xC5, 0x42, 0x50, 0xD2, 0xC5, 0xAA, 0x50, 0x6D, 0xBD, 0xC6, 0xD0,
+ 0x5C, 0x24, 0x39, 0x6E, 0x50, 0x05, 0x18, 0xFE, 0x6E, 0xFE, 0x8D, 0x04, 0xEC, 0x7B, 0x61, 0xA3,
+ 0x12, 0x92, 0x1C, 0x81, 0x2C, 0xD1, 0xF7, 0x8F, 0x88, 0x70, 0x96, 0x14, 0x1F, 0x69, 0xA1, 0x90,
+ 0x12, 0x70, 0x79, 0x32, 0x8F, 0xE7, 0x92, 0xB0, 0x1D, 0x94, 0xE0, 0x6E, 0x2E, 0xC3, 0x14, 0x5D,
+ 0x6B, 0x4C, 0x94, 0x91, 0x4D, 0xBA, 0x59, 0x8B, 0x92, 0x30, 0x35, 0x9A, 0x0B, 0x10, 0xDA, 0x47,
+ 0xBC, 0x1D, 0x5D, 0xC2, 0xBE, 0xCF, 0xDF, 0x2E, 0xF6, 0xA3, 0x3F, 0x58, 0xC7, 0x43, 0x32, 0xA0,
+ 0xC7, 0x02, 0xB1, 0x50, 0x00, 0xCB, 0xF7, 0x34, 0x7C, 0x6D, 0x7B, 0x9B, 0xCC, 0xEE, 0x42, 0x57,
+ 0x4C, 0xEE, 0x78, 0x16, 0x42, 0x51, 0xB9, 0x72, 0x58, 0xA7, 0x4F, 0x03, 0x76, 0x0D, 0xCE, 0x42,
+ 0x97, 0xAA, 0xEA, 0xA9, 0x0D, 0x33, 0xA2, 0xBC, 0xB7, 0x2E, 0x20, 0xD1, 0x91, 0x65, 0x4A, 0xEF,
+ 0x2D, 0x1F, 0x27, 0x94, 0x11, 0x96, 0x1C, 0x00, 0xD3, 0x94, 0xD5, 0x46, 0xDA, 0x2A, 0x96, 0x41,
+ 0xBB, 0xAA, 0xAA, 0x61, 0x42, 0x74, 0x67, 0x5A, 0x11, 0x9D, 0x30, 0xAD, 0x55, 0xBC, 0xAA, 0xBF,
+ 0xC6, 0x22, 0x5D, 0x70, 0xE9, 0x41, 0x3A, 0x9F, 0xB5, 0xAE, 0xAC, 0xD5, 0xDC, 0x65, 0x30, 0x48,
+ 0x35, 0xB1, 0xAF, 0x7F, 0x87, 0xA1, 0x86, 0xE6, 0x1C, 0x8E, 0x6E, 0x1C, 0xD9, 0x21, 0xC3, 0x20,
+ 0x84, 0x91, 0x87, 0xE7, 0x15, 0x28, 0xA9, 0x92, 0x1D, 0x8C, 0xA5, 0x9D, 0xC0, 0x8D, 0xFA, 0x4D,
+ 0xF2, 0xD1, 0xCB, 0x64, 0xDD, 0x04, 0x3C, 0xE5, 0x31, 0xB8, 0xD7, 0x8B, 0x60, 0x1B, 0xCB, 0x8D,
+ 0x99, 0xF8, 0xB8, 0x66, 0xAD, 0x2D, 0x5C, 0x15, 0xEF, 0xAC, 0x99, 0x55, 0xD9, 0xBE, 0xEF, 0x2A,
+ 0xF8, 0xC6, 0x34, 0xEC, 0x5A, 0x84, 0xCF, 0xB6, 0x0B, 0xA3, 0xB5, 0x3E, 0xE0, 0xEE, 0x6E, 0x1F,
+ 0x51, 0xA3, 0x4D, 0xEA, 0xC5, 0x8E, 0xB0, 0xA7, 0x7F, 0xE3, 0x8F, 0xA5, 0xDE, 0x46, 0x57, 0x98,
+ 0xCE, 0x7F, 0x7A, 0xB7, 0x78, 0xF4, 0x56, 0xFC, 0xF4, 0xEE, 0xD9, 0xC3, 0x81, 0x2D, 0xE7, 0xAE,
+ 0x8D, 0x77, 0x3F, 0xFF, 0x08, 0xD7, 0x3F, 0xFF, 0xE8, 0xB5, 0xF0, 0xF3, 0xED, 0xBB, 0x1F, 0x13,
+ 0xE4, 0xDB, 0x1F, 0xA0, 0xFF, 0xAA, 0x95, 0x27, 0x41, 0xFE, 0xE0, 0x37, 0xEA, 0x69, 0x30, 0x77,
+ 0xCA, 0xB4, 0xA1, 0x7B, 0xF9, 0xDD, 0x8D, 0x16, 0x7D, 0xEB, 0x96, 0x5D, 0x54, 0xB5, 0x97, 0x1F,
+ 0xDA, 0x6A, 0xFE, 0x55, 0xFF, 0x7B, 0x84, 0x5A, 0x06, 0x61, 0xFC, 0xE1, 0x77, 0x48, 0x78, 0xF9,
+ 0x69, 0x7C, 0x50, 0xF9, 0xC3, 0x05, 0xEC, 0x30, 0xFF, 0x9C, 0x9E, 0x2D, 0xC2, 0xF9, 0x72, 0x3D,
+ 0x89, 0xC1, 0xFB, 0xD7, 0x6D, 0x3E, 0x7C, 0xEA, 0x5A, 0x7F, 0xEE, 0x65, 0x98, 0x7F, 0x5B, 0xFF,
+ 0x7B, 0x1D, 0x10, 0x73, 0xA7, 0xD1, 0xFC, 0xF3, 0xFC, 0x1F, 0x28, 0xE0, 0x91, 0x9E, 0x6B, 0xBE,
+ 0xEE, 0x17, 0xF9, 0x15, 0x17, 0x8B, 0x1F, 0x5F, 0x3A, 0x7A, 0x9E, 0xD4, 0xFF, 0xA6, 0x75, 0xE5,
+ 0x4B, 0x3B, 0xCD, 0x93, 0x2F, 0x7A, 0x66, 0xEB, 0xA5, 0x05, 0x66, 0x6E, 0xD2, 0x59, 0x54, 0xE5,
+ 0xA5, 0x1A, 0xBA, 0x30, 0xA8, 0x6E, 0xE5, 0x4F, 0xAF, 0x0D, 0x0F, 0xEF, 0xE2, 0xEA, 0xDD, 0x87,
+ 0xD7, 0x3B, 0x43, 0xFD, 0x65, 0x7E, 0x6E, 0x07, 0x79, 0xDC, 0x79, 0xB4, 0xE6, 0x74, 0xBD, 0xDB,
+ 0xF6, 0xBF, 0x59, 0xF4, 0xB8, 0x05, 0x26, 0x7E, 0xB3, 0x0A, 0x08, 0xEA, 0xE7, 0x93, 0xC8, 0x1E,
+ 0x7E, 0x84, 0x3D, 0x20, 0xBC, 0x27, 0xD9, 0x80, 0x7E, 0x20, 0xC6, 0xDF, 0x70, 0xF5, 0xDD, 0xFF,
+ 0x22, 0x57, 0x9F, 0x7F, 0x9F, 0xAD, 0xB9, 0x69, 0xE5, 0xDF, 0xC1, 0xD8, 0xDB, 0xB2, 0x3F, 0x62,
+ 0xED, 0xC1, 0x99, 0xC6, 0x88, 0xDF, 0x70, 0xF6, 0xD7, 0xD2, 0xEB, 0xEA, 0xCF, 0xFF, 0x6F, 0x9C,
+ 0xB4, 0x61, 0xF0, 0xC7, 0x27, 0xE3, 0x17, 0xA9, 0x9F, 0x7F, 0xD9, 0x0C, 0x06, 0x78, 0xE2, 0x22,
+ 0x9C, 0xBB, 0xA9, 0x2E, 0x55, 0x10, 0x3E, 0xF7, 0x65, 0xC0, 0x68, 0xB1, 0x07, 0xC3, 0x6F, 0x36,
+ 0xFF, 0xEE, 0x7F, 0x8B, 0x5A, 0x3C, 0x7A, 0x7D, 0xFE, 0x1D, 0x02, 0xFC, 0xB2, 0xEE, 0xCF, 0x24,
+ 0xA8, 0x08, 0xBF, 0x92, 0xE0, 0x77, 0xBF, 0xAB, 0x1B, 0xFF, 0x5B, 0x38, 0x9B, 0xD1, 0xFC, 0x3B,
+ 0x18, 0x7B, 0x5B, 0xF6, 0xA7, 0x4A, 0x2F, 0x1B, 0xDF, 0xF2, 0xF5, 0x64, 0x2B, 0x48, 0xAF, 0x0F,
+ 0xF7, 0x93, 0x55, 0x13, 0x70, 0x26, 0xAF, 0xA3, 0xB9, 0xB9, 0x6D, 0xF6, 0x2D, 0x60, 0xFC, 0xF2,
+ 0xFE, 0x6C, 0x11, 0x93, 0xAA, 0xA9, 0xEB, 0xD3, 0xB9, 0xF9, 0xAA, 0x4F, 0x80, 0x2B, 0xEA, 0x8B,
+ 0x70, 0xE1, 0x96, 0x01, 0x10, 0x42, 0x18, 0xB6, 0x69, 0x19, 0xFF, 0x41, 0xCF, 0x58, 0x08, 0xA6,
+ 0xA6, 0x85, 0x74, 0x74, 0xFE, 0x45, 0x61, 0x35, 0xF1, 0xB8, 0xFD, 0x97, 0xBD, 0xBE, 0xB8, 0x25,
+ 0x29, 0x58, 0xFC, 0x6C, 0x1C, 0x4B, 0xC2, 0x22, 0xF8, 0xF8, 0x40, 0x04, 0x94, 0x2D, 0x9C, 0xFB,
+ 0xC5, 0x96, 0x5F, 0xF7, 0x95, 0x15, 0x00, 0x45, 0x5C, 0x7D, 0x7A, 0x34, 0x15, 0x2D, 0x4E, 0x00,
+ 0x33, 0x70, 0xA6, 0x8F, 0x96, 0xB0, 0x6E, 0xE1, 0x4D, 0x00, 0x06, 0x54, 0xFB, 0xD1, 0xDC, 0x14,
+ 0x35, 0x6F, 0x1A, 0xB5, 0xC0, 0x6F, 0x75, 0x8F, 0xBB, 0x73, 0x27, 0xDB, 0x4C, 0xD3, 0x6F, 0x5A,
+ 0xCE, 0xBE, 0x25, 0xE4, 0xA7, 0x05, 0xB1, 0xFC, 0xB8, 0x00, 0xEC, 0x2B, 0x6E, 0x00, 0x06, 0x7F,
+ 0xE8, 0x38, 0x67, 0x01, 0x7D, 0x78, 0x00, 0xEE, 0xE6, 0xCE, 0xBF, 0x3F, 0x81, 0x7C, 0x08, 0xEF,
+ 0xC3, 0xE7, 0xC7, 0x5E, 0x00, 0xFC, 0xF4, 0x2A, 0xA9, 0x47, 0x67, 0x1B, 0x98, 0xD0, 0x67, 0x69,
+ 0xBD, 0x8D, 0xE6, 0x66, 0xA7, 0xF6, 0xB5, 0x49, 0xEC, 0x4B, 0xD7, 0xD7, 0x0C, 0xF7, 0xE8, 0x78,
+ 0x7A, 0x6B, 0xF9, 0xFA, 0xCB, 0xAD, 0x5B, 0xFC, 0xA7, 0xFF, 0xF4, 0xAB, 0xF6, 0xAE, 0xBF, 0x3C,
+ 0xDA, 0xBB, 0xBE, 0xB4, 0x5A, 0xFD, 0x51, 0x8B, 0xD7, 0x72, 0x44, 0x5E, 0xB6, 0x7B, 0xA5, 0xE6,
+ 0xA5, 0xB5, 0xEB, 0x8D, 0x9E, 0x6F, 0x5A, 0xBD, 0xFE, 0xA8, 0xEF, 0xEB, 0xCF, 0xBB, 0xBE, 0x7E,
+ 0xF9, 0x86, 0xFC, 0x3D, 0xD0, 0x84, 0xF7, 0xE1, 0x93, 0xFE, 0x59, 0x14, 0x33, 0x93, 0x4F, 0x31,
+ 0xCF, 0x12, 0x5B, 0xCF, 0xC6, 0x02, 0x8E, 0x67, 0x03, 0xB2, 0xE4, 0xB2, 0xD7, 0x5E, 0x9A, 0xDE,
+ 0x9E, 0x90, 0x23, 0x80, 0xDC, 0xBB, 0x7D, 0xF2, 0xE9, 0xE2, 0x8E, 0xEF, 0xBF, 0x47, 0x3E, 0xBE,
+ 0x0C, 0xD2, 0xF2, 0x3D, 0xB8, 0x7E, 0x1F, 0x7E, 0xF2, 0x1F, 0x6B, 0xEC, 0xC5, 0xF7, 0x8B, 0xF6,
+ 0xD3, 0xEC, 0x15, 0x3F, 0x2C, 0x60, 0x70, 0xF5, 0x30, 0xB4, 0xC5, 0xFF, 0xB1, 0x40, 0xC1, 0x3C,
+ 0xF2, 0xE1, 0x0D, 0xD9, 0xF4, 0x67, 0xC8, 0x10, 0x00, 0xFB, 0x86, 0xD0, 0x79, 0x20, 0x04, 0x9A,
+ 0xF3, 0xC4, 0xF7, 0xB4, 0xD6, 0x19, 0xE1, 0x13, 0xD9, 0xB7, 0x47, 0xF9, 0xC0, 0xF2, 0xB0, 0xF8,
+ 0xF7, 0x13, 0x80, 0x01, 0xD9, 0xDC, 0x2B, 0xD0, 0xEB, 0xF1, 0x7E, 0x05, 0x31, 0x7E, 0x0B, 0x31,
+ 0x2B, 0xD0, 0xA7, 0x87, 0xE3, 0x78, 0x90, 0x3F, 0xCB, 0x73, 0x45, 0x00, 0x61, 0xCE, 0x60, 0x2B,
+ 0xE2, 0xC3, 0x1C, 0x76, 0xEB, 0xF1, 0xDD, 0x6F, 0x81, 0x67, 0xA5, 0x7E, 0xC2, 0x7E, 0xBF, 0x98,
+ 0x7E, 0x05, 0xFB, 0xAD, 0xEC, 0xB5, 0x10, 0x38, 0xE8, 0x2E, 0xFC, 0x4A, 0x7B, 0xBE, 0x68, 0xDA,
+ 0x53, 0xD5, 0xBE, 0x56, 0x1A, 0x1F, 0x00, 0xB7, 0xE2, 0xEC, 0xD6, 0xAE, 0x6E, 0xF1, 0x06, 0xF9,
+ 0xC6, 0xF4, 0x37, 0x0A, 0xFA, 0x6B, 0x39, 0x2C, 0x3F, 0x7F, 0xA3, 0xD2, 0xAF, 0x32, 0x78, 0x69,
+ 0xD6, 0xFB, 0x03, 0x76, 0xDF, 0xCD, 0x0D, 0xB1, 0xEF, 0x3E, 0xFF, 0x2E, 0x7B, 0x2F, 0xF7, 0x00,
+ 0x43, 0x2F, 0xCA, 0x52, 0x95, 0x2F, 0x1D, 0xAF, 0xB3, 0xAF, 0xFC, 0xA6, 0xC1, 0xF2, 0x45, 0xB9,
+ 0x5E, 0xE0, 0xBA, 0xB0, 0x57, 0x9E, 0x80, 0x1B, 0xB7, 0x06, 0xAC, 0x01, 0xE5, 0xFB, 0xF4, 0xB2,
+ 0x52, 0x0C, 0x5E, 0x69, 0x79, 0x51, 0xCA, 0xDF, 0x90, 0xF9, 0xFB, 0x22, 0xFA, 0x8A, 0x7B, 0x80,
+ 0xFD, 0x6B, 0x09, 0xCD, 0x2B, 0x3F, 0x7E, 0xEB, 0x49, 0xE6, 0xDE, 0xC4, 0xCF, 0xBF, 0x21, 0xFA,
+ 0x02, 0x36, 0xFC, 0x0D, 0xD1, 0xDF, 0x6E, 0xF7, 0x97, 0xAF, 0xB6, 0x7B, 0xA5, 0x6F, 0xF1, 0x3B,
+ 0xA8, 0x86, 0xFA, 0x69, 0x41, 0x2F, 0x87, 0xFB, 0x5B, 0x00, 0xDF, 0x05, 0xEE, 0xB3, 0xF8, 0x15,
+ 0xD0, 0x1F, 0x27, 0x6D, 0xCF, 0xC0, 0xF6, 0x3B, 0x91, 0xED, 0x67, 0xF3, 0x5F, 0xFF, 0xFB, 0xE2,
+ 0x5F, 0xFF, 0xF3, 0xFF, 0xFC, 0xBF, 0xFE, 0xCB, 0x0F, 0x73, 0xC4, 0x58, 0xFC, 0xD8, 0xD5, 0x6E,
+ 0xF9, 0x88, 0x0B, 0x73, 0xBF, 0x75, 0x3F, 0x80, 0xA0, 0x0F, 0xA2, 0xC2, 0x3C, 0x39, 0x27, 0x7E,
+ 0x3F, 0xEF, 0xD2, 0x32, 0xF9, 0x03, 0x70, 0x90, 0x29, 0x7C, 0x0B, 0xFF, 0x7B, 0xB1, 0xF4, 0x01,
+ 0x9A, 0x84, 0x6E, 0xD1, 0x27, 0xEF, 0x7E, 0x15, 0x95, 0x2E, 0x6E, 0xFD, 0xAB, 0x8C, 0x78, 0x6E,
+ 0x98, 0xFD, 0x8F, 0x5F, 0xDA, 0xA7, 0xF1, 0xB7, 0x4C, 0xFC, 0x19, 0xA4, 0x9E, 0xBC, 0x3E, 0x9B,
+ 0x3E, 0xDF, 0x5A, 0xD7, 0xFB, 0xC2, 0xED, 0x80, 0xC5, 0xFB, 0x6D, 0xD5, 0x55, 0x51, 0xFF, 0xE8,
+ 0x5F, 0xEF, 0x82, 0x1C, 0xCE, 0xDC, 0xAB, 0xFB, 0x84, 0x9F, 0x5B, 0xD7, 0x5F, 0x1A, 0x9B, 0x61,
+ 0xF4, 0x0D, 0xBE, 0xFC, 0x94, 0x75, 0x0F, 0xC2, 0x5F, 0xE5, 0xF7, 0x7A, 0x01, 0xC3, 0x8F, 0x30,
+ 0x54, 0xBB, 0x71, 0x38, 0xC7, 0xA7, 0x0E, 0x68, 0x45, 0x18, 0x80, 0xD0, 0x53, 0x5D, 0x16, 0x11,
+ 0x58, 0x9A, 0x7C, 0x7C, 0x84, 0x22, 0xBF, 0xAA, 0x5A, 0xE0, 0xE1, 0x80, 0x97, 0xEE, 0x1E, 0xB1,
+ 0x6D, 0x9E, 0xDB, 0xBB, 0x20, 0x68, 0xE5, 0xE1, 0x34, 0xC7, 0xA6, 0xF0, 0xB9, 0x02, 0x64, 0xD7,
+ 0x6E, 0x3F, 0x74, 0x8F, 0x68, 0x01, 0xC8, 0x78, 0x33, 0xB4, 0xE7, 0xB8, 0xCD, 0xBF, 0xB2, 0xBD,
+ 0x79, 0x0A, 0x94, 0x02, 0x7E, 0xFE, 0xD6, 0x53, 0x0C, 0x28, 0x51, 0x80, 0x9B, 0x79, 0xF6, 0x01,
+ 0x83, 0x64, 0xA4, 0x5A, 0x44, 0x6E, 0xFB, 0x11, 0x64, 0xF2, 0x6E, 0xF0, 0x4A, 0x11, 0xFC, 0x5C,
+ 0x31, 0x53, 0x10, 0x8E, 0x3D, 0x50, 0x5B, 0x70, 0xE3, 0xD1, 0xA3, 0xFD, 0x8C, 0xCA, 0x51, 0x3A,
+ 0x7E, 0xD3, 0x6A, 0xAC, 0x3F, 0xA8, 0x79, 0xEF, 0xBF, 0x34, 0x6C, 0x7F, 0x04, 0x00, 0x20, 0x3A,
+ 0x77, 0x5F, 0xDC, 0xF8, 0x98, 0xB4, 0x7F, 0xD4, 0x4F, 0xFE, 0x68, 0xF3, 0x6D, 0xBF, 0x69, 0xF2,
+ 0x7D, 0xAE, 0x5E, 0xFC, 0xE3, 0xE2, 0xDD, 0x0B, 0x9F, 0xFF, 0xF8, 0x9C, 0xF9, 0x69, 0x2E, 0x38,
+ 0x5E, 0x6E, 0xFE, 0xF0, 0x76, 0xF3, 0xDD, 0x6B, 0xCF, 0xEF, 0x2B, 0xA6, 0xF2, 0x11, 0xEA, 0xE6,
+ 0x9B, 0xE1, 0xDC, 0x70, 0x1E, 0x7F, 0x6D, 0x4A, 0xEF, 0x5F, 0xDB, 0x9A, 0x67, 0x63, 0x9A, 0xA1,
+ 0xBF, 0xED, 0x7A, 0xC6, 0xE7, 0x5E, 0xE8, 0x79, 0xFA, 0x89, 0x7A, 0x9E, 0x42, 0x97, 0xCB, 0xD7,
+ 0x35, 0xC0, 0xE9, 0xBD, 0x70, 0xF8, 0x5E, 0xD2, 0x8F, 0x87, 0x4F, 0xF5, 0xFC, 0x2C, 0x86, 0x17,
+ 0x2C, 0x5D, 0x5D, 0x95, 0x5D, 0x78, 0x02, 0xD2, 0x7A, 0x6D, 0x76, 0x9E, 0x1B, 0x98, 0x7F, 0x79,
+ 0x25, 0xEA, 0x4B, 0x23, 0xF2, 0x9B, 0xDC, 0xBA, 0xA4, 0xBA, 0xC9, 0x2F, 0xD5, 0xD3, 0xFB, 0x57,
+ 0x04, 0xCF, 0xAD, 0xFE, 0x30, 0x4B, 0x78, 0x33, 0xA5, 0x0F, 0x9F, 0xD2, 0xB2, 0x0C, 0xDB, 0x79,
+ 0x3F, 0xC0, 0xDD, 0xEB, 0xEA, 0x4F, 0xAF, 0xF7, 0x81, 0x5B, 0xE4, 0xD2, 0x31, 0x0C, 0xDE, 0xAF,
+ 0x1E, 0xC4, 0xFC, 0x31, 0xBE, 0x37, 0x5B, 0xFB, 0x23, 0x84, 0xAF, 0x00, 0xBF, 0xC2, 0x08, 0x94,
+ 0x6E, 0xF6, 0x9D, 0x1B, 0x90, 0x38, 0xB5, 0xEE, 0xFB, 0xBF, 0x2D, 0x9E, 0x46, 0xF9, 0xC3, 0xE2,
+ 0x9F, 0x7E, 0xBB, 0xF2, 0xE3, 0x6F, 0xC9, 0xFB, 0xE7, 0xC5, 0x2F, 0x1F, 0x1E, 0x7A, 0x68, 0xD4,
+ 0xC1, 0x2C, 0xF9, 0x59, 0x85, 0x9F, 0x18, 0x66, 0xD4, 0xC0, 0x9B, 0xED, 0x1F, 0x3A, 0xFC, 0xFE,
+ 0xEF, 0x42, 0xF6, 0xE6, 0x8A, 0x1F, 0x3A, 0xFB, 0x7A, 0x56, 0xB3, 0xD6, 0x3D, 0x8C, 0x69, 0xEE,
+ 0xA5, 0x7F, 0xDC, 0x99, 0x99, 0xDF, 0x7C, 0x31, 0xAF, 0xF7, 0x2F, 0xC7, 0xF4, 0x04, 0xFA, 0x54,
+ 0x0F, 0x5D, 0xF2, 0xFE, 0xEF, 0xA4, 0xFE, 0x65, 0xE5, 0x13, 0x6B, 0xF7, 0x2D, 0xD6, 0x27, 0xBA,
+ 0x0F, 0xCF, 0x0E, 0xF6, 0xAF, 0x4E, 0xFB, 0x2B, 0xAE, 0x00, 0x6E, 0x60, 0x6D, 0x6E, 0xFF, 0xC5,
+ 0x3C, 0x5E, 0x9F, 0x07, 0xF1, 0x62, 0x23, 0x4F, 0x5F, 0x32, 0xB7, 0x9F, 0x7F, 0x52, 0x5E, 0xEE,
+ 0x7C, 0x59, 0xF4, 0xCA, 0xED, 0x5F, 0x9E, 0x76, 0xFE, 0xCA, 0xEF, 0x17, 0xAB, 0x7F, 0x43, 0x20,
+ 0xF4, 0x97, 0xE2, 0x65, 0xCB, 0xAF, 0x1F, 0x39, 0xF1, 0xB6, 0xD9, 0x2F, 0x2F, 0x7C, 0xCC, 0x67,
+ 0xF9, 0x5C, 0xDE, 0x7D, 0x72, 0x83, 0xE0, 0xFD, 0x0B, 0xE2, 0x07, 0x0B, 0x8B, 0xB0, 0xE8, 0xC2,
+ 0x6F, 0xB6, 0x98, 0x19, 0x3E, 0xD6, 0x33, 0x82, 0xEE, 0xCF, 0xD0, 0x7E, 0xC3, 0xFC, 0xEC, 0x5A,
+ 0x4E, 0xB3, 0xB4, 0xDE, 0xFF, 0x7B, 0x5D, 0xC2, 0xBB, 0xA7, 0x47, 0xFA, 0xFF, 0xD3, 0xD6, 0x67,
+ 0x22, 0xBB, 0x6A, 0x68, 0xFD, 0xF0, 0x1B, 0xA9, 0x3E, 0xA7, 0x3E, 0x6D, 0xC1, 0xE9, 0xE8, 0x8F,
+ 0xCB, 0x57, 0x45, 0x7A, 0x31, 0x8A, 0xC7, 0xDC, 0x53, 0x90, 0xCF, 0xEB, 0x6F, 0x6E, 0x17, 0xEE,
+ 0xF4, 0x2A, 0xE6, 0x2F, 0x28, 0x1F, 0x93, 0x9F, 0xE4, 0xB4, 0x0C, 0xE5, 0xF9, 0xEA, 0x65, 0xDD,
+ 0xC7, 0x97, 0x27, 0x5C, 0xCC, 0x4F, 0xB2, 0x68, 0xAB, 0x3C, 0xDC, 0x3C, 0x9F, 0xE7, 0xF1, 0x0E,
+ 0x94, 0xDD, 0x40, 0x0C, 0xCF, 0x39, 0xEB, 0x19, 0xDE, 0x30, 0x20, 0xF4, 0xB7, 0x6D, 0xDE, 0x9C,
+ 0xFD, 0x1B, 0x7E, 0x3D, 0x71, 0xEB, 0xF0, 0xFD, 0xAF, 0x34, 0x6B, 0xDE, 0x4E, 0xEF, 0xE7, 0x02,
+ 0xEC, 0x4F, 0x9D, 0x19, 0xB0, 0x1A, 0x10, 0x75, 0xFA, 0x76, 0xFA, 0xF4, 0x55, 0x68, 0xFA, 0xB2,
+ 0xD9, 0x8B, 0x34, 0x66, 0x7E, 0x9E, 0xE6, 0xF7, 0xF7, 0xF9, 0xBE, 0xE1, 0x61, 0xF7, 0x6F, 0xDE,
+ 0xEF, 0x29, 0xF4, 0x2F, 0x81, 0xE4, 0x6B, 0xD7, 0x08, 0xCE, 0xFE, 0xD5, 0xF0, 0x3E, 0x7E, 0xE5,
+ 0xAE, 0x66, 0x74, 0x5F, 0x16, 0x7C, 0xC9, 0x94, 0xBE, 0x75, 0xA4, 0x2F, 0xB1, 0xF1, 0x8D, 0x73,
+ 0x10, 0x4A, 0xDF, 0x3F, 0xF2, 0x83, 0x8F, 0x2F, 0xC7, 0xFC, 0x6F, 0xF4, 0x5B, 0x1F, 0x1F, 0x8B,
+ 0xEE, 0x55, 0x75, 0x99, 0x1F, 0x14, 0xF3, 0x1C, 0xB9, 0x43, 0x9F, 0xBC, 0x18, 0xC4, 0x0F, 0x6F,
+ 0xCA, 0x33, 0x4F, 0xCE, 0x4F, 0xFE, 0x00, 0xE7, 0xD5, 0x0D, 0xDE, 0x33, 0x07, 0x00, 0x10, 0xBB,
+ 0x70, 0x7A, 0xF7, 0xF1, 0x55, 0x74, 0xDF, 0xCE, 0xFF, 0xF0, 0x65, 0x3B, 0x40, 0x60, 0xF7, 0x2F,
+ 0x20, 0xE0, 0x3F, 0x45, 0x39, 0xC3, 0xFF, 0xF2, 0xE6, 0x74, 0x9F, 0x0F, 0x70, 0x79, 0x08, 0xFC,
+ 0xDD, 0x43, 0x9F, 0xE7, 0x78, 0xF9, 0xF5, 0xD3, 0x43, 0x1E, 0x8B, 0x7E, 0x3F, 0xB6, 0x3C, 0xCF,
+ 0xE6, 0x2B, 0x63, 0xFC, 0xFC, 0x66, 0x1E, 0x7F, 0xB9, 0xA5, 0x25, 0x48, 0x95, 0x3F, 0xB1, 0x33,
+ 0xFA, 0xA7, 0x5E, 0x7F, 0xB1, 0x84, 0xAF, 0xD3, 0xD8, 0x6F, 0x4F, 0xEE, 0xED, 0x51, 0x24, 0xC0,
+ 0x97, 0x1F, 0xAA, 0x85, 0x3E, 0x27, 0x35, 0xED, 0xF7, 0x20, 0xCF, 0xED, 0x17, 0x0F, 0x4C, 0x20,
+ 0xCF, 0x19, 0xEA, 0xF9, 0xA9, 0x43, 0x1F, 0x81, 0x7F, 0x28, 0x8A, 0x45, 0x5A, 0x82, 0xAA, 0xDF,
+ 0x0D, 0x5E, 0xF0, 0x7E, 0x29, 0x26, 0x9E, 0x1A, 0xB3, 0x98, 0xD1, 0xCC, 0x51, 0xA6, 0x7B, 0xF9,
+ 0x82, 0x60, 0xFE, 0x06, 0x71, 0xF1, 0x4C, 0xF2, 0x16, 0x6E, 0x0B, 0x92, 0x27, 0xE0, 0xA4, 0x41,
+ 0x26, 0x02, 0x0A, 0xF8, 0xFE, 0xA5, 0xA2, 0x07, 0x65, 0x3F, 0xB8, 0x9C, 0x16, 0x40, 0xC3, 0x81,
+ 0xB7, 0x78, 0xF3, 0xFC, 0x4F, 0x29, 0xBD, 0x1C, 0xFD, 0x57, 0x3C, 0xBD, 0x7F, 0x07, 0x3F, 0x6F,
+ 0xBD, 0x7B, 0xE1, 0xFD, 0x8B, 0x38, 0x1F, 0x50, 0x72, 0x0A, 0xE8, 0x03, 0x61, 0xF0, 0xFD, 0xBB,
+ 0xB8, 0xEE, 0xBE, 0x91, 0x6C, 0xF8, 0xAD, 0x63, 0x00, 0x19, 0x10, 0xC0, 0xFE, 0x95, 0xE1, 0x84,
+ 0x0F, 0xAB, 0xFA, 0x62, 0x17, 0x5F, 0x1F, 0xC0, 0xDF, 0x16, 0xAF, 0x0A, 0xF4, 0xC3, 0xBC, 0x70,
+ 0x56, 0xA7, 0x39, 0xDD, 0x7A, 0xD1, 0xB3, 0x97, 0xB9, 0xAF, 0x1C, 0xF2, 0xEB, 0x27, 0x90, 0x06,
+ 0xDB, 0xF5, 0xE9, 0x05, 0x08, 0x3C, 0xF8, 0xE2, 0x5F, 0xBD, 0xB0, 0xBF, 0x85, 0x20, 0x6F, 0x8B,
+ 0x66, 0x41, 0xCD, 0x4F, 0x67, 0x2A, 0x81, 0x38, 0xD2, 0xF9, 0x0B, 0x8C, 0x1A, 0x04, 0x80, 0x2E,
+ 0x04, 0x39, 0x69, 0xF0, 0xF2, 0x4D, 0xC9, 0x9C, 0xE1, 0x01, 0x03, 0xFF, 0x73, 0x4E, 0x01, 0xE2,
+ 0xF0, 0xCF, 0x58, 0xAD, 0x9F, 0x8F, 0xA8, 0xF9, 0x63, 0x5E, 0xBF, 0x0A, 0x6D, 0x33, 0xEC, 0xA7,
+ 0x47, 0xA8, 0x7A, 0x5E, 0xBD, 0xC4, 0xAB, 0x2F, 0x2C, 0xFD, 0x21, 0x15, 0xB3, 0x13, 0xFE, 0x53,
+ 0x89, 0x3F, 0x00, 0xFE, 0x94, 0x8E, 0x3F, 0xCC, 0x72, 0x5E, 0xCA, 0x84, 0x6F, 0x53, 0x9C, 0x07,
+ 0xBE, 0x4F, 0x51, 0xDD, 0xBD, 0x65, 0x36, 0xC8, 0xA3, 0x30, 0x5E, 0x80, 0x29, 0xE0, 0x73, 0xC0,
+ 0xE5, 0x13, 0x22, 0xF7, 0x40, 0xF6, 0x3D, 0xCF, 0xCF, 0x17, 0x5F, 0xDF, 0x98, 0x1F, 0xA8, 0x05,
+ 0x7C, 0xF9, 0xE3, 0xDE, 0xF3, 0xFA, 0x7D, 0xF7, 0xE1, 0xE3, 0xAC, 0xAE, 0xF5, 0x57, 0x50, 0xF3,
+ 0xF0, 0x6B, 0x11, 0xCC, 0xEF, 0xF3, 0xDF, 0x97, 0x0A, 0xE1, 0xBB, 0x1F, 0xA3, 0xAA, 0x9A, 0x2B,
+ 0x9A, 0x97, 0x92, 0xA5, 0x07, 0xF4, 0x7D, 0xFF, 0x28, 0x75, 0x7E, 0x78, 0x7A, 0xA7, 0xCF, 0xA0,
+ 0x68, 0x08, 0xE6, 0xAF, 0x3D, 0x7E, 0x40, 0x9E, 0xCF, 0x7D, 0xFA, 0xF5, 0xF7, 0x86, 0xFF, 0x21,
+ 0x42, 0xE6, 0x7F, 0xA0, 0xA2, 0x01, 0x55, 0xD2, 0xCF, 0x27, 0x10, 0x07, 0xF3, 0xC5, 0x54, 0x0D,
+ 0x8B, 0xA8, 0x6A, 0x01, 0x65, 0xB3, 0xDA, 0x94, 0xF1, 0x5F, 0x5E, 0x8A, 0xA8, 0x9F, 0x41, 0x8C,
+ 0xC3, 0x97, 0x18, 0x32, 0x7F, 0x89, 0xF1, 0xAF, 0xFF, 0x79, 0x2E, 0xC2, 0x84, 0xEA, 0x7F, 0xFC,
+ 0xD7, 0x32, 0x5E, 0x6C, 0x87, 0xE9, 0x0B, 0x08, 0xB2, 0xA4, 0x69, 0x7C, 0x06, 0x91, 0xFF, 0xC7,
+ 0xFF, 0xFD, 0xA8, 0xD2, 0xFE, 0xBB, 0xBF, 0x38, 0x0D, 0xFF, 0xF3, 0xFF, 0xFC, 0x6F, 0x25, 0x60,
+ 0xE4, 0x09, 0x06, 0x3F, 0xA9, 0x9E, 0xAF, 0x5E, 0x1E, 0xA4, 0x03, 0x3F, 0x9F, 0x57, 0xF6, 0xFF,
+ 0x00, 0xA3, 0xA5, 0x2F, 0xE6, 0xC7, 0x4C, 0x00, 0x00,
+};
@@ -0,0 +1,126 @@
+/* Binary UART protocol between the ESP32 CAM and the Arduino UNO R4
+ *
+ * Every command is a fixed 6 byte frame:
+ *   [0xA5 sync][seq][cmd][arg0][arg1][crc8]
+ * The CRC (polynomial 0x07) covers seq, cmd and both arguments. The parser
+ * is fed one byte at a time, never blocks and never allocates, and it finds
+ * the next frame again after noise or debug text on the line.
+ *
+ * This file is shared with AutoCar_Arduino/car_protocol.h, keep both copies identical.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define CAR_FRAME_SYNC 0xA5
+#define CAR_FRAME_LEN 6
+
+// Command codes (ASCII, so frames stay readable on a logic analyzer)
+#define CAR_CMD_STOP 'S'
+#define CAR_CMD_FORWARD 'F'
+#define CAR_CMD_BACK 'B'
+#define CAR_CMD_LEFT 'L'
+#define CAR_CMD_RIGHT 'R'
+#define CAR_CMD_AUTO 'A'
+#define CAR_CMD_MANUAL 'M'
+#define CAR_CMD_VISION 'V' // Camera obstacle cue, not a command: arg0 = steering hint (int8), arg1 = free space ahead
+#define CAR_CMD_DRIVE 'D'  // Proportional drive: arg0 = throttle, arg1 = steering (int8, -127..127, positive = forward / right)
+
+#define CAR_DRIVE_LEASE_MS 300 // The motors stop when no CAR_CMD_DRIVE frame came for this long
+
+// Structure for a decoded command frame
+typedef struct
+{
+	uint8_t seq;
+	uint8_t cmd;
+	uint8_t arg0; // Speed for drive commands, 0 = default speed
+	uint8_t arg1;
+} car_frame_t;
+
+// Structure for the receive state machine
+typedef struct
+{
+	uint8_t buf[CAR_FRAME_LEN];
+	uint8_t pos;		  // Number of bytes of the current frame received so far
+	uint8_t last_seq;
+	bool synced;		  // A valid frame has been received, last_seq is meaningful
+	uint32_t frames;	  // Valid frames received
+	uint32_t crc_errors;  // Frames dropped because of a bad CRC
+	uint32_t lost_frames; // Gaps in the sequence numbers
+} car_parser_t;
+
+// Function to compute the CRC-8 of a frame body
+static inline uint8_t car_crc8(const uint8_t *data, uint8_t len)
+{
+	uint8_t crc = 0;
+	while (len--)
+	{
+		crc ^= *data++;
+		for (uint8_t i = 0; i < 8; i++)
+		{
+			crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+		}
+	}
+	return crc;
+}
+
+// Function to build a frame into out (CAR_FRAME_LEN bytes)
+static inline void car_frame_encode(uint8_t *out, uint8_t seq, uint8_t cmd, uint8_t arg0, uint8_t arg1)
+{
+	out[0] = CAR_FRAME_SYNC;
+	out[1] = seq;
+	out[2] = cmd;
+	out[3] = arg0;
+	out[4] = arg1;
+	out[5] = car_crc8(&out[1], 4);
+}
+
+static inline void car_parser_init(car_parser_t *p)
+{
+	memset(p, 0, sizeof(car_parser_t));
+}
+
+// Function to feed one received byte to the parser.
+// Returns true and fills out when the byte completes a valid frame
+static inline bool car_parser_feed(car_parser_t *p, uint8_t byte, car_frame_t *out)
+{
+	if (p->pos == 0 && byte != CAR_FRAME_SYNC)
+	{
+		return false; // Skip noise until the next sync byte
+	}
+	p->buf[p->pos++] = byte;
+	if (p->pos < CAR_FRAME_LEN)
+	{
+		return false;
+	}
+
+	if (car_crc8(&p->buf[1], 4) != p->buf[5])
+	{
+		// Bad frame: restart from the next sync byte already in the buffer, if any
+		p->crc_errors++;
+		uint8_t i = 1;
+		while (i < CAR_FRAME_LEN && p->buf[i] != CAR_FRAME_SYNC)
+		{
+			i++;
+		}
+		p->pos = CAR_FRAME_LEN - i;
+		memmove(p->buf, &p->buf[i], p->pos);
+		return false;
+	}
+
+	p->pos = 0;
+	out->seq = p->buf[1];
+	out->cmd = p->buf[2];
+	out->arg0 = p->buf[3];
+	out->arg1 = p->buf[4];
+	if (p->synced)
+	{
+		p->lost_frames += (uint8_t)(out->seq - p->last_seq - 1);
+	}
+	p->last_seq = out->seq;
+	p->synced = true;
+	p->frames++;
+	return true;
+}
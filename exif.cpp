@@ -0,0 +1,148 @@
+#include "exif.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define EXIF_TIFF_START 10 // FF E1, segment length, "Exif\0\0"
+#define EXIF_GPS_IFD 26	   // TIFF header (8) and IFD0 with the GPS pointer (18)
+
+#define TIFF_BYTE 1
+#define TIFF_ASCII 2
+#define TIFF_LONG 4
+#define TIFF_RATIONAL 5
+
+// Structure for the IFD being written: entries grow from the front, values longer than 4 bytes from data
+typedef struct
+{
+	uint8_t *tiff;	// Start of the TIFF header, offsets count from here
+	uint8_t *entry; // Next directory entry
+	uint32_t data;	// Offset of the next free byte of the value area
+	int count;
+} exif_ifd_t;
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	p[2] = v >> 16;
+	p[3] = v >> 24;
+}
+
+// Function to add one entry, values of up to 4 bytes are stored in the entry itself
+static void ifd_add(exif_ifd_t *ifd, uint16_t tag, uint16_t type, uint32_t count, const void *value, size_t len)
+{
+	put_u16(&ifd->entry[0], tag);
+	put_u16(&ifd->entry[2], type);
+	put_u32(&ifd->entry[4], count);
+	memset(&ifd->entry[8], 0, 4);
+	if (len <= 4)
+	{
+		memcpy(&ifd->entry[8], value, len);
+	}
+	else
+	{
+		put_u32(&ifd->entry[8], ifd->data);
+		memcpy(&ifd->tiff[ifd->data], value, len);
+		ifd->data += (len + 1) & ~1; // Values start on a word boundary
+	}
+	ifd->entry += 12;
+	ifd->count++;
+}
+
+// Function to add an ASCII entry, the count includes the terminating zero
+static void ifd_add_ascii(exif_ifd_t *ifd, uint16_t tag, const char *text)
+{
+	ifd_add(ifd, tag, TIFF_ASCII, strlen(text) + 1, text, strlen(text) + 1);
+}
+
+// Function to add up to 3 rationals given as numerator / denominator pairs
+static void ifd_add_rationals(exif_ifd_t *ifd, uint16_t tag, const uint32_t *pairs, int count)
+{
+	uint8_t value[24];
+	for (int i = 0; i < count * 2; i++)
+	{
+		put_u32(&value[i * 4], pairs[i]);
+	}
+	ifd_add(ifd, tag, TIFF_RATIONAL, count, value, count * 8);
+}
+
+// Function to add a coordinate in 1e-7 degrees as degrees, minutes and seconds
+static void ifd_add_coordinate(exif_ifd_t *ifd, uint16_t ref_tag, int32_t e7, const char *positive, const char *negative)
+{
+	ifd_add_ascii(ifd, ref_tag, e7 < 0 ? negative : positive);
+	uint32_t a = abs(e7);
+	uint32_t minutes_e7 = a % 10000000 * 60;
+	uint32_t dms[6] = {a / 10000000, 1, minutes_e7 / 10000000, 1, minutes_e7 % 10000000 * 60 / 10000, 1000};
+	ifd_add_rationals(ifd, ref_tag + 1, dms, 3);
+}
+
+size_t exif_gps_segment(const gps_fix_t *fix, uint8_t *out)
+{
+	if (!fix->version)
+	{
+		return 0;
+	}
+	uint8_t *tiff = &out[EXIF_TIFF_START];
+	memcpy(out, "\xFF\xE1\0\0Exif\0\0", EXIF_TIFF_START);
+
+	// Little endian TIFF header and IFD0 holding only the pointer to the GPS IFD
+	memcpy(tiff, "II\x2A\0", 4);
+	put_u32(&tiff[4], 8);
+	exif_ifd_t ifd0 = {tiff, &tiff[10], 0, 0};
+	uint8_t pointer[4];
+	put_u32(pointer, EXIF_GPS_IFD);
+	ifd_add(&ifd0, 0x8825, TIFF_LONG, 1, pointer, 4);
+	put_u16(&tiff[8], ifd0.count);
+	put_u32(ifd0.entry, 0); // No IFD1
+
+	// Version, position and datum are always there, the value area starts after the last entry
+	int tags = 6 + (fix->time != 0) + (fix->hdop_c >= 0) + (fix->speed_cms >= 0) * 2 + (fix->course_cdeg >= 0) * 2 + (fix->date != 0);
+	exif_ifd_t gps = {tiff, &tiff[EXIF_GPS_IFD + 2], (uint32_t)(EXIF_GPS_IFD + 2 + tags * 12 + 4), 0};
+	static const uint8_t version[4] = {2, 3, 0, 0};
+	ifd_add(&gps, 0x0000, TIFF_BYTE, 4, version, 4);
+	ifd_add_coordinate(&gps, 0x0001, fix->lat_e7, "N", "S");
+	ifd_add_coordinate(&gps, 0x0003, fix->lon_e7, "E", "W");
+	if (fix->time)
+	{
+		uint32_t hms[6] = {fix->time / 1000000, 1, fix->time / 10000 % 100, 1, fix->time % 10000, 100};
+		ifd_add_rationals(&gps, 0x0007, hms, 3);
+	}
+	if (fix->hdop_c >= 0)
+	{
+		uint32_t dop[2] = {(uint32_t)fix->hdop_c, 100};
+		ifd_add_rationals(&gps, 0x000B, dop, 1);
+	}
+	if (fix->speed_cms >= 0)
+	{
+		uint32_t kmh[2] = {(uint32_t)fix->speed_cms * 36, 1000};
+		ifd_add_ascii(&gps, 0x000C, "K");
+		ifd_add_rationals(&gps, 0x000D, kmh, 1);
+	}
+	if (fix->course_cdeg >= 0)
+	{
+		uint32_t track[2] = {(uint32_t)fix->course_cdeg, 100};
+		ifd_add_ascii(&gps, 0x000E, "T");
+		ifd_add_rationals(&gps, 0x000F, track, 1);
+	}
+	ifd_add_ascii(&gps, 0x0012, "WGS-84");
+	if (fix->date)
+	{
+		char date[11];
+		snprintf(date, sizeof(date), "20%02u:%02u:%02u", (unsigned)(fix->date % 100), (unsigned)(fix->date / 100 % 100),
+				 (unsigned)(fix->date / 10000 % 100));
+		ifd_add_ascii(&gps, 0x001D, date);
+	}
+	put_u16(&tiff[EXIF_GPS_IFD], gps.count);
+	put_u32(gps.entry, 0); // No next IFD
+
+	size_t len = EXIF_TIFF_START + gps.data;
+	out[2] = (len - 2) >> 8; // The segment length is big endian and counts itself but not the marker
+	out[3] = len - 2;
+	return len;
+}
@@ -0,0 +1,25 @@
+/* GPS tags for the camera JPEGs
+ *
+ * Builds an EXIF APP1 segment holding only a GPS IFD (position, UTC time and
+ * date, speed, course, HDOP) from a GPS fix. The camera frame itself is
+ * never copied or re-encoded: senders write the 2 byte SOI of the frame,
+ * then the segment, then the rest of the frame (EXIF_SPLICE_AT).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gps.h"
+
+#define EXIF_GPS_MAX_LEN 384 // Largest segment exif_gps_segment writes
+#define EXIF_SPLICE_AT 2	 // The segment goes right after the SOI marker
+
+// Function to build the APP1 segment for a fix into out (EXIF_GPS_MAX_LEN bytes).
+// Returns its length, or 0 if there is no fix yet
+size_t exif_gps_segment(const gps_fix_t *fix, uint8_t *out);
+
+// Function to check that a frame starts with SOI, so the segment can be spliced in after it
+static inline bool exif_can_splice(const uint8_t *jpg, size_t len)
+{
+	return len > EXIF_SPLICE_AT && jpg[0] == 0xFF && jpg[1] == 0xD8;
+}
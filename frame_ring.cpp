@@ -0,0 +1,415 @@
+#include "frame_ring.h"
+#include "motion.h"
+#include "img_converters.h"
+#include "esp_timer.h"
+#include "Arduino.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+// Structure for a client sleeping in frame_ring_acquire. Each has its own semaphore, so a wakeup
+// that arrives after a timeout is drained here and never ends some other wait of the same task
+typedef struct
+{
+	SemaphoreHandle_t wake; // Given by publish_slot
+	bool waiting;			// Entry in use (guarded by ring_lock)
+} frame_waiter_t;
+
+static shared_frame_t frames[FRAME_RING_SLOTS];
+static shared_frame_t *latest = NULL;		 // Most recently published frame
+static uint32_t next_seq = 1;				 // Sequence number of the next published frame
+static SemaphoreHandle_t ring_lock = NULL;	 // Protects frames, latest and waiters
+static frame_waiter_t waiters[FRAME_RING_MAX_WAITERS];
+static volatile int subscribers = 0;
+static TaskHandle_t capture_task = NULL;
+static volatile uint32_t avg_frame_time = 0; // Running average of the capture interval (ms)
+static frame_ring_stats_t stats;
+static volatile bool pause_requested = false;
+static SemaphoreHandle_t paused_sem = NULL; // Given by the capture task once it has stopped
+static SemaphoreHandle_t resume_sem = NULL; // Given to let the capture task continue
+static volatile int motion_threshold = FRAME_RING_MOTION_THRESHOLD;
+static volatile int last_motion = 0;
+static volatile int thumbnail_users = 0;
+// Decode and change detection state, only touched by the capture task
+static uint8_t *thumb = NULL; // 1/8 scale RGB565 decode, converted to grayscale in place
+static size_t thumb_cap = 0;
+static size_t thumb_w = 0; // Size of the grayscale thumbnail, 0 if the last decode failed
+static size_t thumb_h = 0;
+static motion_signature_t scene_start; // Signature of the frame that started the current scene
+static motion_signature_t frame_sig;
+static uint32_t scene = 0;
+
+// Function to find a slot the capture task can overwrite (must hold ring_lock)
+static shared_frame_t *claim_slot()
+{
+	for (int i = 0; i < FRAME_RING_SLOTS; i++)
+	{
+		shared_frame_t *slot = &frames[i];
+		if (slot != latest && slot->refs == 0)
+		{
+			slot->seq = 0; // Hide the slot from readers while it is rewritten
+			return slot;
+		}
+	}
+	return NULL;
+}
+
+// Function to publish a filled slot and wake every waiting client. The entries stay taken
+// until their owners are back, a new waiter must not pick up a wakeup meant for another one
+static void publish_slot(shared_frame_t *slot)
+{
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	slot->seq = next_seq++;
+	latest = slot;
+	for (int i = 0; i < FRAME_RING_MAX_WAITERS; i++)
+	{
+		if (waiters[i].waiting)
+		{
+			xSemaphoreGive(waiters[i].wake);
+		}
+	}
+	xSemaphoreGive(ring_lock);
+}
+
+// Function to make a buffer at least len bytes large, in PSRAM when there is some
+static bool buffer_reserve(uint8_t **buf, size_t *cap, size_t len)
+{
+	if (*cap >= len)
+	{
+		return true;
+	}
+	uint8_t *grown = (uint8_t *)(psramFound() ? ps_realloc(*buf, len) : realloc(*buf, len));
+	if (!grown)
+	{
+		return false;
+	}
+	*buf = grown;
+	*cap = len;
+	return true;
+}
+
+// Function to decode a JPEG at 1/8 scale into the grayscale thumbnail. At that scale the decoder
+// only uses the DC coefficient of each 8x8 block
+static bool decode_thumb(const uint8_t *jpg, size_t len, size_t width, size_t height)
+{
+	size_t w = (width + 7) / 8;
+	size_t h = (height + 7) / 8;
+	thumb_w = 0;
+	if (!buffer_reserve(&thumb, &thumb_cap, w * h * 2) || !jpg2rgb565(jpg, len, thumb, JPG_SCALE_8X))
+	{
+		return false;
+	}
+	for (size_t i = 0; i < w * h; i++)
+	{
+		uint16_t c = (thumb[i * 2] << 8) | thumb[i * 2 + 1]; // RGB565 with the high byte first
+		uint32_t r = (c >> 11) << 3;
+		uint32_t g = ((c >> 5) & 0x3F) << 2;
+		uint32_t b = (c & 0x1F) << 3;
+		thumb[i] = (r * 77 + g * 150 + b * 29) >> 8;
+	}
+	thumb_w = w;
+	thumb_h = h;
+	return true;
+}
+
+// Function to copy a JPEG image into a ring slot, growing the slot buffer if needed
+static bool fill_slot(shared_frame_t *slot, camera_fb_t *fb, const uint8_t *jpg_buf, size_t jpg_len)
+{
+	if (slot->cap < jpg_len)
+	{
+		size_t cap = jpg_len + jpg_len / 4; // Leave headroom so busier scenes do not realloc every frame
+		uint8_t *buf = (uint8_t *)(psramFound() ? ps_realloc(slot->buf, cap) : realloc(slot->buf, cap));
+		if (!buf)
+		{
+			return false;
+		}
+		slot->buf = buf;
+		slot->cap = cap;
+	}
+	memcpy(slot->buf, jpg_buf, jpg_len);
+	slot->len = jpg_len;
+	slot->width = fb->width;
+	slot->height = fb->height;
+	slot->timestamp = fb->timestamp;
+	slot->gray_w = 0;
+	if (thumb_w && buffer_reserve(&slot->gray, &slot->gray_cap, thumb_w * thumb_h))
+	{
+		memcpy(slot->gray, thumb, thumb_w * thumb_h);
+		slot->gray_w = thumb_w;
+		slot->gray_h = thumb_h;
+	}
+	return true;
+}
+
+// Task that owns the camera: captures one frame at a time for all clients
+static void capture_task_fn(void *arg)
+{
+	int64_t last_frame = 0;
+	while (true)
+	{
+		if (pause_requested)
+		{
+			xSemaphoreGive(paused_sem);
+			xSemaphoreTake(resume_sem, portMAX_DELAY);
+			last_frame = 0;
+			scene_start.valid = false; // The frame size may have changed
+			continue;
+		}
+		if (subscribers == 0)
+		{
+			// Nobody is watching, sleep until a client subscribes
+			last_frame = 0;
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			continue;
+		}
+
+		int64_t stage_start = esp_timer_get_time();
+		camera_fb_t *fb = esp_camera_fb_get(); // Get image from camera
+		int64_t stage_end = esp_timer_get_time();
+		if (!fb)
+		{
+			stats.capture_failed++;
+			Serial.printf("Camera capture failed");
+			vTaskDelay(pdMS_TO_TICKS(10));
+			continue;
+		}
+
+		uint8_t *jpg_buf = fb->buf;
+		size_t jpg_len = fb->len;
+		bool converted = false;
+		latency_hist_add(&stats.fb_get, stage_end - stage_start);
+		if (fb->format != PIXFORMAT_JPEG)
+		{
+			stage_start = stage_end;
+			converted = frame2jpg(fb, 80, &jpg_buf, &jpg_len);
+			stage_end = esp_timer_get_time();
+			latency_hist_add(&stats.convert, stage_end - stage_start);
+			if (!converted)
+			{
+				stats.convert_failed++;
+				Serial.printf("JPEG compression failed");
+				esp_camera_fb_return(fb);
+				continue;
+			}
+		}
+
+		// One decode per frame serves the change detection and every thumbnail consumer
+		int threshold = motion_threshold;
+		int motion = 100;
+		thumb_w = 0;
+		if (threshold > 0 || thumbnail_users > 0)
+		{
+			stage_start = esp_timer_get_time();
+			decode_thumb(jpg_buf, jpg_len, fb->width, fb->height);
+			stage_end = esp_timer_get_time();
+			latency_hist_add(&stats.decode, stage_end - stage_start);
+		}
+		frame_sig.valid = false;
+		if (threshold > 0)
+		{
+			stage_start = esp_timer_get_time();
+			if (thumb_w)
+			{
+				motion_signature(thumb, thumb_w, thumb_h, &frame_sig);
+			}
+			motion = motion_compare(&frame_sig, &scene_start);
+			stage_end = esp_timer_get_time();
+			latency_hist_add(&stats.motion, stage_end - stage_start);
+		}
+		if (motion >= threshold)
+		{
+			scene++;
+			scene_start = frame_sig;
+		}
+		last_motion = motion;
+
+		xSemaphoreTake(ring_lock, portMAX_DELAY);
+		shared_frame_t *slot = claim_slot();
+		xSemaphoreGive(ring_lock);
+
+		// When every slot is held by a slow client the frame is dropped
+		if (slot && fill_slot(slot, fb, jpg_buf, jpg_len))
+		{
+			latency_hist_add(&stats.copy, esp_timer_get_time() - stage_end);
+			slot->scene = scene;
+			slot->motion = motion;
+			publish_slot(slot);
+			stats.captured++;
+		}
+		else
+		{
+			stats.dropped++;
+		}
+
+		if (converted)
+		{
+			free(jpg_buf);
+		}
+		esp_camera_fb_return(fb);
+
+		int64_t fr_end = esp_timer_get_time();
+		if (last_frame)
+		{
+			uint32_t frame_time = (fr_end - last_frame) / 1000;
+			avg_frame_time = avg_frame_time ? (avg_frame_time * 7 + frame_time) / 8 : frame_time;
+		}
+		last_frame = fr_end;
+	}
+}
+
+bool frame_ring_start()
+{
+	if (capture_task)
+	{
+		return true;
+	}
+	ring_lock = xSemaphoreCreateMutex();
+	paused_sem = xSemaphoreCreateBinary();
+	resume_sem = xSemaphoreCreateBinary();
+	if (!ring_lock || !paused_sem || !resume_sem)
+	{
+		return false;
+	}
+	for (int i = 0; i < FRAME_RING_MAX_WAITERS; i++)
+	{
+		waiters[i].wake = xSemaphoreCreateBinary();
+		if (!waiters[i].wake)
+		{
+			return false;
+		}
+	}
+	return xTaskCreatePinnedToCore(capture_task_fn, "capture", 6144, NULL, 5, &capture_task, 1) == pdPASS;
+}
+
+void frame_ring_pause()
+{
+	if (!capture_task)
+	{
+		return;
+	}
+	pause_requested = true;
+	xTaskNotifyGive(capture_task); // Wake it up if it sleeps without subscribers
+	xSemaphoreTake(paused_sem, portMAX_DELAY);
+}
+
+void frame_ring_resume()
+{
+	if (!capture_task)
+	{
+		return;
+	}
+	pause_requested = false;
+	xSemaphoreGive(resume_sem);
+}
+
+void frame_ring_subscribe()
+{
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	subscribers++;
+	xSemaphoreGive(ring_lock);
+	xTaskNotifyGive(capture_task);
+}
+
+void frame_ring_unsubscribe()
+{
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	if (subscribers > 0)
+	{
+		subscribers--;
+	}
+	xSemaphoreGive(ring_lock);
+}
+
+shared_frame_t *frame_ring_acquire(uint32_t last_seq, TickType_t wait)
+{
+	shared_frame_t *frame = NULL;
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	TickType_t start = xTaskGetTickCount();
+	TickType_t waited = 0;
+	while ((!latest || latest->seq <= last_seq) && waited < wait)
+	{
+		// Register as a waiter and sleep until the capture task publishes
+		frame_waiter_t *waiter = NULL;
+		for (int i = 0; i < FRAME_RING_MAX_WAITERS && !waiter; i++)
+		{
+			if (!waiters[i].waiting)
+			{
+				waiter = &waiters[i];
+			}
+		}
+		if (waiter)
+		{
+			waiter->waiting = true;
+			xSemaphoreGive(ring_lock);
+			xSemaphoreTake(waiter->wake, wait - waited);
+			xSemaphoreTake(ring_lock, portMAX_DELAY);
+			// Free the entry; after a timeout a publish may still have given the semaphore
+			waiter->waiting = false;
+			xSemaphoreTake(waiter->wake, 0);
+		}
+		else
+		{
+			// Every entry is taken, look again a little later
+			xSemaphoreGive(ring_lock);
+			vTaskDelay(min(wait - waited, (TickType_t)pdMS_TO_TICKS(FRAME_RING_POLL_MS)));
+			xSemaphoreTake(ring_lock, portMAX_DELAY);
+		}
+		waited = xTaskGetTickCount() - start;
+	}
+	if (latest && latest->seq > last_seq)
+	{
+		frame = latest;
+		frame->refs++;
+	}
+	xSemaphoreGive(ring_lock);
+	return frame;
+}
+
+void frame_ring_release(shared_frame_t *frame)
+{
+	if (!frame)
+	{
+		return;
+	}
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	frame->refs--;
+	xSemaphoreGive(ring_lock);
+}
+
+void frame_ring_set_motion_threshold(int percent)
+{
+	motion_threshold = percent < 0 ? 0 : percent;
+}
+
+int frame_ring_motion_threshold()
+{
+	return motion_threshold;
+}
+
+void frame_ring_want_thumbnails(bool want)
+{
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	if (want)
+	{
+		thumbnail_users++;
+	}
+	else if (thumbnail_users > 0)
+	{
+		thumbnail_users--;
+	}
+	xSemaphoreGive(ring_lock);
+}
+
+int frame_ring_motion()
+{
+	return last_motion;
+}
+
+uint32_t frame_ring_avg_frame_time()
+{
+	return avg_frame_time;
+}
+
+const frame_ring_stats_t *frame_ring_stats()
+{
+	return &stats;
+}
@@ -0,0 +1,92 @@
+/* Shared frame ring for the ESP32 CAM car
+ *
+ * A single capture task pulls frames from the camera and publishes them into a
+ * small ring of reference-counted JPEG slots. Every stream client takes the
+ * newest frame it has not sent yet, so N viewers cost one capture.
+ *
+ * Each frame also gets a scene number from the change detector (motion.h):
+ * frames that look like the one that started the current scene share its
+ * number, so clients can skip them.
+ *
+ * The capture task is the only place a JPEG is decoded (the esp32-camera
+ * decoder keeps its state in globals and is not reentrant). While change
+ * detection is on or a consumer asked for thumbnails, every frame is decoded
+ * once at 1/8 scale and its grayscale thumbnail is published with it.
+ */
+#pragma once
+
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include "latency_hist.h"
+
+#define FRAME_RING_SLOTS 4		  // Newest frame, frames still being sent, and the slot being written
+#define FRAME_RING_MAX_WAITERS 8 // Maximum number of tasks waiting for a new frame
+#define FRAME_RING_POLL_MS 10	 // Wait of a client that finds every waiter entry taken
+#define FRAME_RING_MOTION_THRESHOLD 3 // Default percentage of the image that must change to start a new scene
+
+// Structure for a JPEG frame shared between all stream clients
+typedef struct
+{
+	uint8_t *buf;	  // JPEG data, owned by the ring
+	size_t len;		  // Length of the JPEG data
+	size_t cap;		  // Allocated size of buf
+	size_t width;
+	size_t height;
+	struct timeval timestamp; // Capture time reported by the camera driver
+	uint32_t seq;			  // Frame sequence number, 0 while the slot is empty or being written
+	uint32_t scene;			  // Changes only when the image differs from the previous scene
+	int motion;				  // Percentage of the image changed since the scene started
+	uint8_t *gray;			  // 1/8 scale grayscale thumbnail, one byte per pixel, owned by the ring
+	size_t gray_w;			  // Thumbnail size, 0 when the frame was not decoded
+	size_t gray_h;
+	size_t gray_cap;		  // Allocated size of gray
+	int refs;				  // Number of clients currently holding the frame
+} shared_frame_t;
+
+// Structure for the counters and timing of the capture stages, written by the capture task only
+typedef struct
+{
+	uint32_t captured;		 // Frames published to the ring
+	uint32_t capture_failed; // esp_camera_fb_get returned no frame
+	uint32_t convert_failed; // JPEG compression failed
+	uint32_t dropped;		 // No free slot (or no memory) for a captured frame
+	latency_hist_t fb_get;	 // Waiting for the camera driver to hand out a frame
+	latency_hist_t convert;	 // JPEG compression (only for non-JPEG pixel formats)
+	latency_hist_t copy;	 // Copying the JPEG into a ring slot
+	latency_hist_t decode;	 // Decoding the grayscale thumbnail
+	latency_hist_t motion;	 // Computing and comparing the change detection signature
+} frame_ring_stats_t;
+
+// Function to start the capture task (call once after esp_camera_init)
+bool frame_ring_start();
+
+// Stop / restart capturing so the camera driver can be reinitialized. frame_ring_pause returns
+// once the capture task holds no camera frame
+void frame_ring_pause();
+void frame_ring_resume();
+
+// Register / unregister a frame consumer. The capture task only runs while there is at least one
+void frame_ring_subscribe();
+void frame_ring_unsubscribe();
+
+// Get the newest frame with a sequence number above last_seq, waiting up to wait ticks for one.
+// Returns NULL on timeout. Every acquired frame must be handed back with frame_ring_release
+shared_frame_t *frame_ring_acquire(uint32_t last_seq, TickType_t wait);
+void frame_ring_release(shared_frame_t *frame);
+
+// Set the percentage of the image that must change before a frame starts a new scene, 0 makes every frame a new scene
+void frame_ring_set_motion_threshold(int percent);
+int frame_ring_motion_threshold();
+
+// Ask for a grayscale thumbnail with every frame, and drop the request again with false.
+// Requests are counted, thumbnails are made while there is at least one (or change detection is on)
+void frame_ring_want_thumbnails(bool want);
+
+// Motion score of the last captured frame (see shared_frame_t.motion)
+int frame_ring_motion();
+
+// Average time between captured frames in milliseconds
+uint32_t frame_ring_avg_frame_time();
+
+// Counters and timing of the capture stages since boot
+const frame_ring_stats_t *frame_ring_stats();
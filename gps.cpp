@@ -0,0 +1,273 @@
+#include "gps.h"
+#include "track.h"
+#include "nmea.h"			// NMEA parser
+#include <HardwareSerial.h> // Serial library
+#include "Arduino.h"
+#include "freertos/task.h"
+#include <string.h>
+
+#define GPS_RX_PIN 12
+#define GPS_TX_PIN 13
+#define GPS_BAUD 9600			// Factory default of the ATGM336H
+#define GPS_FAST_BAUD 115200	// Baud rate the module is switched to
+#define GPS_FAST_BAUD_CODE 5	// PCAS01 code for 115200
+#define GPS_FAST_UPDATE_MS 100	// 10 Hz, needs the fast baud rate
+#define GPS_SLOW_UPDATE_MS 200	// 5 Hz, still fits in 9600 baud with only GGA and RMC
+#define GPS_PROBE_MS 1500		// Time to wait for valid sentences after each step
+#define GPS_SETTLE_MS 1100		// After a command: the update on the wire and the next one, still at the old rate
+#define GPS_RX_BUFFER 1024
+
+void events_publish_gps(float lat, float lon, uint32_t seq);
+
+// Structure for one of the two published fix buffers.
+// seq is odd while the buffer is being written, readers retry or use the other buffer
+typedef struct
+{
+	volatile uint32_t seq;
+	gps_fix_t fix;
+} fix_slot_t;
+
+static nmea_parser_t nmea;			  // Parser for the GPS output
+static HardwareSerial gpsSerial(1);	  // Declare Serial for GPS
+static TaskHandle_t gps_task = NULL;
+static fix_slot_t fix_slots[2];
+static volatile uint32_t latest_slot = 0; // Buffer holding the newest complete fix
+static uint32_t update_ms = 1000;		  // Update interval the module was configured for
+
+// Function to publish a fix (GPS task only): write the older buffer, then make it the latest
+static void publish_fix(const gps_fix_t *fix)
+{
+	uint32_t index = latest_slot ^ 1;
+	fix_slot_t *slot = &fix_slots[index];
+	uint32_t seq = slot->seq;
+	__atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	slot->fix = *fix;
+	__atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+	__atomic_store_n(&latest_slot, index, __ATOMIC_RELEASE);
+}
+
+// Function to build a fix record from the last complete update the parser decoded
+static void read_fix(gps_fix_t *fix, uint32_t version)
+{
+	const nmea_data_t *d = &nmea.fix;
+	fix->version = version;
+	fix->fix_ms = millis();
+	fix->date = d->date;
+	fix->time = d->time;
+	fix->lat_e7 = d->lat_e7;
+	fix->lon_e7 = d->lon_e7;
+	fix->speed_cms = d->speed_cms;
+	fix->course_cdeg = d->course_cdeg;
+	fix->hdop_c = d->hdop_c;
+	fix->sats = d->sats;
+}
+
+// Function to publish the parser's last complete update if its timestamp is new, returns true if it was.
+// The version readers poll is keyed on the UTC date and time of the fix, so one update is one
+// generation however many sentences or passes of the task loop it takes to arrive
+static bool publish_update(gps_fix_t *fix)
+{
+	const nmea_data_t *d = &nmea.fix;
+	if (fix->version != 0 && d->time == fix->time && d->date == fix->date)
+	{
+		return false;
+	}
+	read_fix(fix, fix->version + 1);
+	publish_fix(fix);
+	track_add(fix);
+	events_publish_gps(fix->lat_e7 / 1e7, fix->lon_e7 / 1e7, fix->version); // Push the fix to the /events subscribers
+	return true;
+}
+
+// Function to send a PCAS (CASIC) command, the checksum is added here
+static void gps_send_pcas(const char *body)
+{
+	uint8_t checksum = 0;
+	for (const char *c = body; *c; c++)
+	{
+		checksum ^= *c;
+	}
+	char sentence[80];
+	int len = snprintf(sentence, sizeof(sentence), "$%s*%02X\r\n", body, checksum);
+	gpsSerial.write((const uint8_t *)sentence, len);
+	gpsSerial.flush(); // Wait until the command has left the UART before changing anything else
+}
+
+// Function to feed the parser for a while and return the number of valid sentences received
+static uint32_t gps_count_sentences(uint32_t duration_ms)
+{
+	uint32_t passed = nmea.passed;
+	uint32_t start = millis();
+	while (millis() - start < duration_ms)
+	{
+		while (gpsSerial.available() > 0)
+		{
+			nmea_parser_feed(&nmea, gpsSerial.read());
+		}
+		delay(10);
+	}
+	return nmea.passed - passed;
+}
+
+// Function to switch the UART and check that the module talks at that baud rate
+static bool gps_try_baud(uint32_t baud)
+{
+	gpsSerial.updateBaudRate(baud);
+	delay(20);
+	while (gpsSerial.available() > 0)
+	{
+		gpsSerial.read(); // Drop whatever was received at the old baud rate
+	}
+	return gps_count_sentences(GPS_PROBE_MS) > 0;
+}
+
+// Function to configure the module for a high update rate: only the sentences the parser
+// decodes (GGA, RMC), a faster baud rate and a shorter update interval.
+// Every step is checked by reading back the output. The settings are not saved to the module,
+// but it keeps them while powered, so the fast baud rate is probed first after an ESP32 reset
+static void gps_configure()
+{
+	bool fast = gps_try_baud(GPS_FAST_BAUD);
+	if (!fast && !gps_try_baud(GPS_BAUD))
+	{
+		Serial.println("GPS: no NMEA output, keeping the default settings");
+		return;
+	}
+
+	// Only GGA and RMC, one each per update
+	gps_send_pcas("PCAS03,1,0,0,0,1,0,0,0,0,0,,,0,0");
+	gps_count_sentences(GPS_SETTLE_MS);
+	uint32_t per_second = gps_count_sentences(1000); // Still 1 Hz here
+	if (per_second > 3)
+	{
+		Serial.printf("GPS: sentence filter not applied (%u sentences/s)\n", per_second);
+	}
+
+	if (!fast)
+	{
+		char command[16];
+		snprintf(command, sizeof(command), "PCAS01,%d", GPS_FAST_BAUD_CODE);
+		gps_send_pcas(command);
+		fast = gps_try_baud(GPS_FAST_BAUD);
+		if (!fast && !gps_try_baud(GPS_BAUD))
+		{
+			Serial.println("GPS: lost the module while changing the baud rate");
+			return;
+		}
+	}
+
+	uint32_t new_update_ms = fast ? GPS_FAST_UPDATE_MS : GPS_SLOW_UPDATE_MS;
+	char command[16];
+	snprintf(command, sizeof(command), "PCAS02,%u", (unsigned)new_update_ms);
+	gps_send_pcas(command);
+	gps_count_sentences(GPS_SETTLE_MS);
+	// Two sentences per update, allow for a few lost to timing
+	uint32_t sentences = gps_count_sentences(1000);
+	if (sentences >= 2 * 1000 / new_update_ms * 3 / 4)
+	{
+		update_ms = new_update_ms;
+	}
+	Serial.printf("GPS: %u baud, %u sentences/s, update every %u ms\n", fast ? GPS_FAST_BAUD : GPS_BAUD, sentences, (unsigned)update_ms);
+}
+
+// UART receive callback, runs in the UART event task: wake the GPS task
+static void gps_on_receive()
+{
+	xTaskNotifyGive(gps_task);
+}
+
+// Task that decodes NMEA sentences as they arrive
+static void gps_task_fn(void *arg)
+{
+	gps_fix_t fix; // Last published fix
+	memset(&fix, 0, sizeof(fix));
+	uint32_t fixes = 0;
+	uint32_t printed_ms = 0;
+	gps_configure();
+	while (true)
+	{
+		// The timeout only matters if a receive event is ever missed
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+		while (gpsSerial.available() > 0)
+		{
+			nmea_parser_feed(&nmea, gpsSerial.read());
+		}
+
+		// GGA and RMC of the same update give a single fix, published once the parser has both
+		if (nmea.fixes != fixes)
+		{
+			fixes = nmea.fixes;
+			if (!publish_update(&fix))
+			{
+				continue;
+			}
+			if (fix.fix_ms - printed_ms >= 1000) // Print at most once per second, the fix rate can be 10 Hz
+			{
+				printed_ms = fix.fix_ms;
+				Serial.print("Latitude= ");
+				Serial.print(fix.lat_e7 / 1e7, 6);
+				Serial.print(" Longitude= ");
+				Serial.println(fix.lon_e7 / 1e7, 6);
+			}
+		}
+	}
+}
+
+bool gps_start()
+{
+	nmea_parser_init(&nmea);
+	for (int i = 0; i < 2; i++)
+	{
+		fix_slots[i].fix.lat_e7 = GPS_DEFAULT_LAT_E7;
+		fix_slots[i].fix.lon_e7 = GPS_DEFAULT_LON_E7;
+		fix_slots[i].fix.speed_cms = -1;
+		fix_slots[i].fix.course_cdeg = -1;
+		fix_slots[i].fix.hdop_c = -1;
+	}
+	// Initialize GPS Serial, with baud rate 9600, RX pin 12, TX pin 13. The task raises the baud rate
+	gpsSerial.setRxBufferSize(GPS_RX_BUFFER);
+	gpsSerial.begin(GPS_BAUD, SERIAL_8N1, GPS_RX_PIN, GPS_TX_PIN);
+	if (xTaskCreatePinnedToCore(gps_task_fn, "gps", 4096, NULL, 4, &gps_task, tskNO_AFFINITY) != pdPASS)
+	{
+		return false;
+	}
+	gpsSerial.onReceive(gps_on_receive);
+	return true;
+}
+
+uint32_t gps_get_fix(gps_fix_t *fix)
+{
+	while (true)
+	{
+		// Try the newest buffer first, fall back to the other one if it is being rewritten
+		uint32_t index = __atomic_load_n(&latest_slot, __ATOMIC_ACQUIRE);
+		for (int i = 0; i < 2; i++)
+		{
+			fix_slot_t *slot = &fix_slots[index ^ i];
+			uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+			if (seq & 1)
+			{
+				continue;
+			}
+			*fix = slot->fix;
+			__atomic_thread_fence(__ATOMIC_ACQUIRE);
+			if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq)
+			{
+				return fix->version;
+			}
+		}
+	}
+}
+
+uint32_t gps_fix_version()
+{
+	return fix_slots[__atomic_load_n(&latest_slot, __ATOMIC_ACQUIRE)].fix.version;
+}
+
+void gps_sentence_counters(uint32_t *passed, uint32_t *failed, uint32_t *rejected)
+{
+	*passed = nmea.passed;
+	*failed = nmea.failed;
+	*rejected = nmea.rejected;
+}
@@ -0,0 +1,44 @@
+/* GPS ingest for the ESP32 CAM car
+ *
+ * A dedicated task wakes up on UART receive events, feeds the NMEA parser and
+ * publishes every new fix as a whole record. Readers on other tasks (web
+ * server, telemetry) copy the latest record without locks and never see half
+ * of an update.
+ * Before that the task switches the ATGM336H to 115200 baud, GGA and RMC only
+ * and 10 Hz updates (5 Hz if the baud rate cannot be changed).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Default position before the first fix: Ho Chi Minh City
+#define GPS_DEFAULT_LAT_E7 108231000
+#define GPS_DEFAULT_LON_E7 1066297000
+
+// Structure for one GPS fix
+typedef struct
+{
+	uint32_t version;	 // Incremented once per fix with a new UTC time, 0 = default position (no fix yet)
+	uint32_t fix_ms;	 // millis() when the fix was decoded, age = millis() - fix_ms
+	uint32_t date;		 // UTC date as ddmmyy, 0 if unknown
+	uint32_t time;		 // UTC time as hhmmsscc, 0 if unknown
+	int32_t lat_e7;		 // Latitude in 1e-7 degrees
+	int32_t lon_e7;		 // Longitude in 1e-7 degrees
+	int32_t speed_cms;	 // Ground speed in cm/s, -1 if unknown
+	int32_t course_cdeg; // Course over ground in 1/100 degree, -1 if unknown
+	int16_t hdop_c;		 // Horizontal dilution of precision x100, -1 if unknown
+	uint8_t sats;		 // Satellites in use
+} gps_fix_t;
+
+// Function to open the GPS UART and start the ingest task
+bool gps_start();
+
+// Copy the latest fix into fix and return its version (never blocks)
+uint32_t gps_get_fix(gps_fix_t *fix);
+
+// Version of the latest fix, cheap enough to poll
+uint32_t gps_fix_version();
+
+// NMEA sentence counters: valid, checksum mismatches and malformed
+void gps_sentence_counters(uint32_t *passed, uint32_t *failed, uint32_t *rejected);
@@ -0,0 +1,66 @@
+#include "latency_hist.h"
+#include <stdio.h>
+
+void latency_hist_add(latency_hist_t *hist, uint32_t us)
+{
+	uint32_t ms = us / 1000;
+	int bucket = 0;
+	while (ms && bucket < LATENCY_HIST_BUCKETS - 1)
+	{
+		ms >>= 1;
+		bucket++;
+	}
+	hist->buckets[bucket]++;
+	hist->sum_us += us;
+	if (us > hist->max_us)
+	{
+		hist->max_us = us;
+	}
+	hist->count++;
+}
+
+uint32_t latency_hist_bucket_ms(const latency_hist_t *hist, int bucket)
+{
+	if (bucket == LATENCY_HIST_BUCKETS - 1)
+	{
+		return (hist->max_us + 999) / 1000;
+	}
+	return 1u << bucket;
+}
+
+uint32_t latency_hist_percentile(const latency_hist_t *hist, int percent)
+{
+	uint32_t count = hist->count;
+	if (!count)
+	{
+		return 0;
+	}
+	uint32_t target = ((uint64_t)count * percent + 99) / 100;
+	uint32_t seen = 0;
+	for (int i = 0; i < LATENCY_HIST_BUCKETS; i++)
+	{
+		seen += hist->buckets[i];
+		if (seen >= target)
+		{
+			return latency_hist_bucket_ms(hist, i);
+		}
+	}
+	return latency_hist_bucket_ms(hist, LATENCY_HIST_BUCKETS - 1);
+}
+
+int latency_hist_json(const latency_hist_t *hist, char *buf, size_t len)
+{
+	uint32_t count = hist->count;
+	int n = snprintf(buf, len, "{\"n\":%u,\"avg_us\":%u,\"max_us\":%u,\"p50_ms\":%u,\"p99_ms\":%u,\"buckets\":[",
+					 (unsigned)count, (unsigned)(count ? hist->sum_us / count : 0), (unsigned)hist->max_us,
+					 (unsigned)latency_hist_percentile(hist, 50), (unsigned)latency_hist_percentile(hist, 99));
+	for (int i = 0; i < LATENCY_HIST_BUCKETS && n < (int)len; i++)
+	{
+		n += snprintf(&buf[n], len - n, "%s%u", i ? "," : "", (unsigned)hist->buckets[i]);
+	}
+	if (n < (int)len)
+	{
+		n += snprintf(&buf[n], len - n, "]}");
+	}
+	return n;
+}
@@ -0,0 +1,34 @@
+/* Small fixed-size latency histograms
+ *
+ * Buckets double in width: < 1 ms, < 2 ms, < 4 ms ... < 1024 ms, and one for
+ * everything slower. Each histogram has a single writer task; readers may
+ * see a sample counted in a bucket before it shows up in the totals, which
+ * is fine for monitoring.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define LATENCY_HIST_BUCKETS 12
+
+// Structure for one histogram
+typedef struct
+{
+	uint32_t buckets[LATENCY_HIST_BUCKETS];
+	uint32_t count;
+	uint32_t max_us;
+	uint64_t sum_us;
+} latency_hist_t;
+
+// Function to add one sample in microseconds
+void latency_hist_add(latency_hist_t *hist, uint32_t us);
+
+// Upper bound in ms of the bucket holding the given percentile, 0 without samples
+uint32_t latency_hist_percentile(const latency_hist_t *hist, int percent);
+
+// Upper bound in ms of a bucket (the last bucket reports the largest sample)
+uint32_t latency_hist_bucket_ms(const latency_hist_t *hist, int bucket);
+
+// Function to write the histogram as a JSON object, returns the length like snprintf
+int latency_hist_json(const latency_hist_t *hist, char *buf, size_t len);
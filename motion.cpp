@@ -0,0 +1,46 @@
+#include "motion.h"
+
+bool motion_signature(const uint8_t *gray, size_t w, size_t h, motion_signature_t *sig)
+{
+	sig->valid = false;
+	if (w < MOTION_GRID_W || h < MOTION_GRID_H)
+	{
+		return false;
+	}
+
+	// Box-average the thumbnail into the grid
+	uint32_t sum[MOTION_GRID_W * MOTION_GRID_H] = {0};
+	uint16_t count[MOTION_GRID_W * MOTION_GRID_H] = {0};
+	for (size_t y = 0; y < h; y++)
+	{
+		const uint8_t *row = &gray[y * w];
+		size_t cell_row = y * MOTION_GRID_H / h * MOTION_GRID_W;
+		for (size_t x = 0; x < w; x++)
+		{
+			size_t cell = cell_row + x * MOTION_GRID_W / w;
+			sum[cell] += row[x];
+			count[cell]++;
+		}
+	}
+	for (int i = 0; i < MOTION_GRID_W * MOTION_GRID_H; i++)
+	{
+		sig->luma[i] = count[i] ? sum[i] / count[i] : 0;
+	}
+	sig->valid = true;
+	return true;
+}
+
+int motion_compare(const motion_signature_t *a, const motion_signature_t *b)
+{
+	if (!a->valid || !b->valid)
+	{
+		return 100;
+	}
+	int changed = 0;
+	for (int i = 0; i < MOTION_GRID_W * MOTION_GRID_H; i++)
+	{
+		int delta = a->luma[i] - b->luma[i];
+		changed += delta > MOTION_CELL_DELTA || delta < -MOTION_CELL_DELTA;
+	}
+	return changed * 100 / (MOTION_GRID_W * MOTION_GRID_H);
+}
@@ -0,0 +1,30 @@
+/* Change detection for the ESP32 CAM car stream
+ *
+ * Every frame is reduced to a small luma signature: the grayscale thumbnail
+ * the capture task decodes at 1/8 scale (see frame_ring.h) is averaged down
+ * to a MOTION_GRID_W x MOTION_GRID_H grid. Two
+ * signatures are compared cell by cell; the score is the percentage of
+ * cells whose brightness changed by more than MOTION_CELL_DELTA, so sensor
+ * noise and JPEG artifacts in a parked scene stay at 0.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MOTION_GRID_W 16
+#define MOTION_GRID_H 12
+#define MOTION_CELL_DELTA 12 // Luma change (0-255) of one cell counted as motion
+
+// Structure for the signature of one frame
+typedef struct
+{
+	uint8_t luma[MOTION_GRID_W * MOTION_GRID_H];
+	bool valid;
+} motion_signature_t;
+
+// Function to compute the signature of a w x h grayscale thumbnail
+bool motion_signature(const uint8_t *gray, size_t w, size_t h, motion_signature_t *sig);
+
+// Percentage (0-100) of grid cells that differ between two signatures, 100 if one is missing
+int motion_compare(const motion_signature_t *a, const motion_signature_t *b);
@@ -0,0 +1,424 @@
+#include "nmea.h"
+#include <string.h>
+
+// Parser states
+#define STATE_WAIT_START 0
+#define STATE_FIELDS 1
+#define STATE_CHECKSUM_HI 2
+#define STATE_CHECKSUM_LO 3
+
+// Bits of nmea_values_t.present
+#define HAS_TIME 0x01
+#define HAS_LAT 0x02
+#define HAS_LON 0x04
+#define HAS_SPEED 0x08
+#define HAS_COURSE 0x10
+#define HAS_DATE 0x20
+#define HAS_HDOP 0x40
+#define HAS_SATS 0x80
+
+// Bits of nmea_parser_t.epoch_sentences
+#define EPOCH_GGA 0x01
+#define EPOCH_RMC 0x02
+
+// What a field holds
+typedef enum
+{
+	F_SKIP,
+	F_TIME,
+	F_LAT,
+	F_NS,
+	F_LON,
+	F_EW,
+	F_QUALITY,
+	F_SATS,
+	F_HDOP,
+	F_STATUS,
+	F_SPEED_KNOTS,
+	F_COURSE,
+	F_DATE,
+} field_kind_t;
+
+// Field tables, index 0 is the sentence type
+static const uint8_t gga_fields[] = {F_SKIP, F_TIME, F_LAT, F_NS, F_LON, F_EW, F_QUALITY, F_SATS, F_HDOP};
+static const uint8_t rmc_fields[] = {F_SKIP, F_TIME, F_STATUS, F_LAT, F_NS, F_LON, F_EW, F_SPEED_KNOTS, F_COURSE, F_DATE};
+static const uint8_t vtg_fields[] = {F_SKIP, F_COURSE, F_SKIP, F_SKIP, F_SKIP, F_SPEED_KNOTS};
+
+// Structure to find the table of a sentence type
+typedef struct
+{
+	const char *name;
+	nmea_type_t type;
+	const uint8_t *fields;
+	uint8_t count;
+} sentence_def_t;
+
+static const sentence_def_t sentences[] = {
+	{"GGA", NMEA_GGA, gga_fields, sizeof(gga_fields)},
+	{"RMC", NMEA_RMC, rmc_fields, sizeof(rmc_fields)},
+	{"VTG", NMEA_VTG, vtg_fields, sizeof(vtg_fields)},
+};
+#define SENTENCE_COUNT (int)(sizeof(sentences) / sizeof(sentences[0]))
+
+static const sentence_def_t *current_def(const nmea_parser_t *parser)
+{
+	for (int i = 0; i < SENTENCE_COUNT; i++)
+	{
+		if (sentences[i].type == parser->type)
+		{
+			return &sentences[i];
+		}
+	}
+	return NULL;
+}
+
+// Function to parse a decimal number as an integer with a fixed number of decimals ("12.5", 2 -> 1250).
+// Extra decimals are dropped, returns false if the field is not a number
+static bool parse_fixed(const char *s, int decimals, int32_t *out)
+{
+	int64_t value = 0;
+	int digits = 0;
+	int frac = -1; // Decimals read so far, -1 before the point
+	for (; *s; s++)
+	{
+		if (*s == '.' && frac < 0)
+		{
+			frac = 0;
+			continue;
+		}
+		if (*s < '0' || *s > '9')
+		{
+			return false;
+		}
+		if (frac >= decimals)
+		{
+			continue;
+		}
+		value = value * 10 + (*s - '0');
+		if (++digits > 10 || value > INT32_MAX)
+		{
+			return false;
+		}
+		frac += frac >= 0;
+	}
+	if (!digits)
+	{
+		return false;
+	}
+	for (frac = frac < 0 ? 0 : frac; frac < decimals; frac++)
+	{
+		value *= 10;
+	}
+	if (value > INT32_MAX)
+	{
+		return false;
+	}
+	*out = (int32_t)value;
+	return true;
+}
+
+// Function to convert (d)ddmm.mmmmm to 1e-7 degrees
+static bool parse_coordinate(const char *s, int32_t *out)
+{
+	int32_t value;
+	if (!parse_fixed(s, 5, &value))
+	{
+		return false;
+	}
+	int32_t degrees = value / 10000000;
+	int32_t minutes_e5 = value % 10000000;
+	if (minutes_e5 >= 6000000)
+	{
+		return false;
+	}
+	*out = degrees * 10000000 + (minutes_e5 * 100 + 30) / 60;
+	return true;
+}
+
+// Function to decode a finished field into the values of the current sentence, returns false if it is malformed
+static bool decode_field(nmea_parser_t *parser, uint8_t kind)
+{
+	nmea_values_t *v = &parser->values;
+	const char *f = parser->field;
+	int32_t value;
+	if (!parser->field_len)
+	{
+		return true; // Empty field: value not reported
+	}
+	switch (kind)
+	{
+	case F_TIME:
+		if (!parse_fixed(f, 2, &value))
+			return false;
+		v->time = value;
+		v->present |= HAS_TIME;
+		break;
+	case F_LAT:
+		if (!parse_coordinate(f, &v->lat_e7))
+			return false;
+		v->present |= HAS_LAT;
+		break;
+	case F_LON:
+		if (!parse_coordinate(f, &v->lon_e7))
+			return false;
+		v->present |= HAS_LON;
+		break;
+	case F_NS:
+		v->south = f[0] == 'S';
+		break;
+	case F_EW:
+		v->west = f[0] == 'W';
+		break;
+	case F_QUALITY:
+		if (!parse_fixed(f, 0, &value))
+			return false;
+		v->quality = value;
+		break;
+	case F_SATS:
+		if (!parse_fixed(f, 0, &value))
+			return false;
+		v->sats = value;
+		v->present |= HAS_SATS;
+		break;
+	case F_HDOP:
+		if (!parse_fixed(f, 2, &value))
+			return false;
+		v->hdop_c = value > INT16_MAX ? INT16_MAX : value;
+		v->present |= HAS_HDOP;
+		break;
+	case F_STATUS:
+		v->status_valid = f[0] == 'A';
+		break;
+	case F_SPEED_KNOTS:
+		if (!parse_fixed(f, 3, &value))
+			return false;
+		v->speed_cms = (int64_t)value * 514444 / 10000000; // 1 knot = 51.4444 cm/s
+		v->present |= HAS_SPEED;
+		break;
+	case F_COURSE:
+		if (!parse_fixed(f, 2, &value))
+			return false;
+		v->course_cdeg = value;
+		v->present |= HAS_COURSE;
+		break;
+	case F_DATE:
+		if (!parse_fixed(f, 0, &value))
+			return false;
+		v->date = value;
+		v->present |= HAS_DATE;
+		break;
+	}
+	return true;
+}
+
+// Function to handle the end of a field, returns false if the sentence has to be rejected
+static bool end_field(nmea_parser_t *parser)
+{
+	parser->field[parser->field_len] = 0;
+	if (parser->field_index == 0)
+	{
+		// Talker ID (2 letters) followed by the sentence name
+		parser->type = NMEA_OTHER;
+		if (parser->field_len == 5)
+		{
+			for (int i = 0; i < SENTENCE_COUNT; i++)
+			{
+				if (!memcmp(&parser->field[2], sentences[i].name, 3))
+				{
+					parser->type = sentences[i].type;
+				}
+			}
+		}
+		return true;
+	}
+	const sentence_def_t *def = current_def(parser);
+	if (!def || parser->field_index >= def->count)
+	{
+		return true;
+	}
+	return decode_field(parser, def->fields[parser->field_index]);
+}
+
+// Function to close the update being collected: its data becomes the fix readers see
+static void close_epoch(nmea_parser_t *parser)
+{
+	parser->fix = parser->data;
+	parser->fixes++;
+	parser->closed = true;
+	parser->closed_time = parser->epoch_time;
+	parser->epoch_sentences = 0;
+}
+
+// Function to merge the values of a sentence with a valid checksum into the data
+static void commit(nmea_parser_t *parser)
+{
+	const nmea_values_t *v = &parser->values;
+	nmea_data_t *d = &parser->data;
+	bool position = false;
+	bool timed = v->present & HAS_TIME;
+	if (parser->epoch_sentences && timed && v->time != parser->epoch_time)
+	{
+		close_epoch(parser); // First sentence of the next update, the open one gets nothing more
+	}
+	if (timed)
+	{
+		d->time = v->time;
+	}
+	switch (parser->type)
+	{
+	case NMEA_GGA:
+		d->quality = v->quality;
+		if (v->present & HAS_SATS)
+			d->sats = v->sats;
+		if (v->present & HAS_HDOP)
+			d->hdop_c = v->hdop_c;
+		position = v->quality > 0;
+		break;
+	case NMEA_RMC:
+		if (v->present & HAS_DATE)
+			d->date = v->date;
+		position = v->status_valid;
+		// fall through
+	case NMEA_VTG:
+		d->speed_cms = v->present & HAS_SPEED ? v->speed_cms : -1;
+		d->course_cdeg = v->present & HAS_COURSE ? v->course_cdeg : -1;
+		break;
+	default:
+		break;
+	}
+	if (position && (v->present & HAS_LAT) && (v->present & HAS_LON))
+	{
+		d->lat_e7 = v->south ? -v->lat_e7 : v->lat_e7;
+		d->lon_e7 = v->west ? -v->lon_e7 : v->lon_e7;
+		d->location_updates++;
+
+		// GGA and RMC of one update count as a single fix
+		if (timed && !(parser->closed && v->time == parser->closed_time))
+		{
+			parser->epoch_time = v->time;
+			parser->epoch_sentences |= parser->type == NMEA_GGA ? EPOCH_GGA : EPOCH_RMC;
+			if (parser->epoch_sentences == (EPOCH_GGA | EPOCH_RMC))
+			{
+				close_epoch(parser);
+			}
+		}
+	}
+}
+
+static int hex_value(char c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	return -1;
+}
+
+// Function to drop the current sentence as malformed
+static nmea_type_t reject(nmea_parser_t *parser)
+{
+	parser->rejected++;
+	parser->state = STATE_WAIT_START;
+	return NMEA_NONE;
+}
+
+void nmea_parser_init(nmea_parser_t *parser)
+{
+	memset(parser, 0, sizeof(nmea_parser_t));
+	parser->data.speed_cms = -1;
+	parser->data.course_cdeg = -1;
+	parser->data.hdop_c = -1;
+	parser->fix = parser->data;
+}
+
+nmea_type_t nmea_parser_feed(nmea_parser_t *parser, char c)
+{
+	if (c == '$')
+	{
+		if (parser->state != STATE_WAIT_START)
+		{
+			parser->rejected++; // Truncated by the start of the next sentence
+		}
+		parser->state = STATE_FIELDS;
+		parser->checksum = 0;
+		parser->field_index = 0;
+		parser->field_len = 0;
+		parser->sentence_len = 1;
+		parser->type = NMEA_NONE;
+		memset(&parser->values, 0, sizeof(nmea_values_t));
+		return NMEA_NONE;
+	}
+	if (parser->state == STATE_WAIT_START)
+	{
+		return NMEA_NONE;
+	}
+	if (++parser->sentence_len > NMEA_MAX_SENTENCE)
+	{
+		return reject(parser);
+	}
+
+	int hex;
+	switch (parser->state)
+	{
+	case STATE_FIELDS:
+		if (c == ',' || c == '*')
+		{
+			if (!end_field(parser))
+			{
+				return reject(parser);
+			}
+			parser->field_index++;
+			parser->field_len = 0;
+			if (c == '*')
+			{
+				parser->state = STATE_CHECKSUM_HI;
+			}
+			else
+			{
+				parser->checksum ^= c;
+			}
+			return NMEA_NONE;
+		}
+		if (c < 0x20 || c > 0x7E)
+		{
+			return reject(parser); // Line ended without a checksum, or noise
+		}
+		parser->checksum ^= c;
+		if (parser->field_len < NMEA_MAX_FIELD)
+		{
+			parser->field[parser->field_len++] = c;
+		}
+		else if (parser->field_index == 0 || parser->type != NMEA_OTHER)
+		{
+			return reject(parser); // Only fields of sentences that are not decoded may be this long
+		}
+		return NMEA_NONE;
+
+	case STATE_CHECKSUM_HI:
+		if ((hex = hex_value(c)) < 0)
+		{
+			return reject(parser);
+		}
+		parser->received_checksum = hex << 4;
+		parser->state = STATE_CHECKSUM_LO;
+		return NMEA_NONE;
+
+	case STATE_CHECKSUM_LO:
+		if ((hex = hex_value(c)) < 0)
+		{
+			return reject(parser);
+		}
+		parser->state = STATE_WAIT_START;
+		if ((parser->received_checksum | hex) != parser->checksum)
+		{
+			parser->failed++;
+			return NMEA_NONE;
+		}
+		parser->passed++;
+		commit(parser);
+		return parser->type;
+	}
+	return NMEA_NONE;
+}
@@ -0,0 +1,92 @@
+/* Streaming NMEA 0183 parser for the sentences the car uses (GGA, RMC, VTG)
+ *
+ * Bytes are fed one at a time; nothing is allocated and no floating point is
+ * used. Each sentence type has a table that maps its field positions to the
+ * value they hold. Values are collected on the side and only merged into the
+ * parser's data when the checksum matches, so a corrupted or truncated
+ * sentence never changes the reported position. Any talker ID is accepted
+ * (GP, GN, BD, ...).
+ * The module sends GGA and RMC for every update with the same UTC time. They
+ * are grouped into one fix: an update is complete once both have arrived, or
+ * when a sentence with a new time starts the next one. Readers that want one
+ * event per update watch fixes and read fix, not data.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NMEA_MAX_SENTENCE 96 // Longer sentences are rejected (the standard allows 82 characters)
+#define NMEA_MAX_FIELD 15
+
+typedef enum
+{
+	NMEA_NONE,	  // No complete sentence yet
+	NMEA_GGA,
+	NMEA_RMC,
+	NMEA_VTG,
+	NMEA_OTHER,	  // Valid sentence of a type that is not decoded
+} nmea_type_t;
+
+// Structure for the latest decoded values, -1 (or 0 for date, time and sats) = not reported
+typedef struct
+{
+	int32_t lat_e7;
+	int32_t lon_e7;
+	uint32_t time; // UTC hhmmsscc
+	uint32_t date; // UTC ddmmyy
+	int32_t speed_cms;
+	int32_t course_cdeg;
+	int16_t hdop_c;
+	uint8_t sats;
+	uint8_t quality;		   // GGA fix quality, 0 = no fix
+	uint32_t location_updates; // Incremented for every sentence that carried a valid position
+} nmea_data_t;
+
+// Structure for the values of the sentence being received
+typedef struct
+{
+	int32_t lat_e7;
+	int32_t lon_e7;
+	uint32_t time;
+	uint32_t date;
+	int32_t speed_cms;
+	int32_t course_cdeg;
+	int16_t hdop_c;
+	uint8_t sats;
+	uint8_t quality;
+	bool status_valid; // RMC status A
+	bool south;
+	bool west;
+	uint8_t present; // Bit mask of the fields received
+} nmea_values_t;
+
+// Structure for the parser state, counters and decoded data
+typedef struct
+{
+	uint8_t state;
+	uint8_t checksum;
+	uint8_t received_checksum;
+	uint8_t field_index;
+	uint8_t field_len;
+	uint8_t sentence_len;
+	nmea_type_t type;
+	char field[NMEA_MAX_FIELD + 1];
+	nmea_values_t values;
+	nmea_data_t data;
+	nmea_data_t fix;		// Data as of the last complete update
+	uint32_t fixes;			// Complete updates with a valid position, one per UTC time
+	uint32_t epoch_time;	// UTC time of the update being collected
+	uint8_t epoch_sentences; // Position sentences of that update seen so far, 0 = none open
+	bool closed;			// closed_time is valid
+	uint32_t closed_time;	// UTC time of the last complete update, repeats of it do not open a new one
+	uint32_t passed;   // Sentences with a valid checksum
+	uint32_t failed;   // Sentences with a checksum mismatch
+	uint32_t rejected; // Malformed sentences: bad characters, too long, no checksum
+} nmea_parser_t;
+
+// Function to reset the parser and its data
+void nmea_parser_init(nmea_parser_t *parser);
+
+// Feed one byte, returns the type of the sentence it completed or NMEA_NONE
+nmea_type_t nmea_parser_feed(nmea_parser_t *parser, char c);
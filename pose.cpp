@@ -0,0 +1,222 @@
+#include "pose.h"
+#include "gps.h"
+#include "car_protocol.h"
+#include "Arduino.h"
+#include "freertos/task.h"
+
+#define MM_PER_E7_Q16 729547 // 11.132 mm per 1e-7 degree of latitude, x65536
+#define TURN_BAM_PER_S ((int32_t)POSE_MAX_TURN_DPS * 65536 / 360)
+
+void events_publish_pose(float lat, float lon, float heading, uint32_t seq);
+
+static int16_t sin_table[256]; // sin() in Q14, one entry per 1/256 turn
+static portMUX_TYPE pose_mux = portMUX_INITIALIZER_UNLOCKED;
+static pose_t published;
+static volatile uint8_t drive_cmd = CAR_CMD_STOP; // Last command sent to the Arduino
+static volatile uint8_t drive_pwm = 0;
+static volatile int8_t drive_steering = 0;  // Second axis of CAR_CMD_DRIVE, drive_pwm holds the throttle
+static volatile uint32_t drive_time_ms = 0; // millis() of the last command, the Arduino stops CAR_DRIVE_LEASE_MS after a CAR_CMD_DRIVE
+
+// Filter state, only used by the pose task
+static bool has_origin = false;
+static int32_t origin_lat_e7, origin_lon_e7;
+static int32_t lon_scale_q16; // cos(origin latitude), x65536
+static int32_t x_mm, y_mm;	  // Estimate east and north of the origin
+static uint16_t heading;
+
+static int32_t sin_q14(uint16_t angle)
+{
+	return sin_table[(uint8_t)((angle + 128) >> 8)];
+}
+
+static int32_t cos_q14(uint16_t angle)
+{
+	return sin_q14(angle + 16384);
+}
+
+// Function to place the local origin at a fix, the cosine is the only floating point math
+static void set_origin(const gps_fix_t *fix)
+{
+	origin_lat_e7 = fix->lat_e7;
+	origin_lon_e7 = fix->lon_e7;
+	lon_scale_q16 = (int32_t)(cosf(fix->lat_e7 * 1e-7f * (float)PI / 180) * 65536);
+	x_mm = 0;
+	y_mm = 0;
+	has_origin = true;
+}
+
+// Function to move the estimate along the current drive command for one update interval
+static bool predict(uint32_t dt_ms)
+{
+	uint8_t cmd = drive_cmd;
+	int32_t pwm = drive_pwm;
+	switch (cmd)
+	{
+	case CAR_CMD_FORWARD:
+	case CAR_CMD_BACK:
+	{
+		int32_t step = (pwm ? pwm : POSE_DEFAULT_STRAIGHT_PWM) * POSE_MAX_SPEED_MMS / 255 * (int32_t)dt_ms / 1000;
+		step = cmd == CAR_CMD_BACK ? -step : step;
+		x_mm += step * sin_q14(heading) >> 14;
+		y_mm += step * cos_q14(heading) >> 14;
+		return true;
+	}
+	case CAR_CMD_LEFT:
+	case CAR_CMD_RIGHT:
+	{
+		int32_t turn = (pwm ? pwm : POSE_DEFAULT_TURN_PWM) * TURN_BAM_PER_S / 255 * (int32_t)dt_ms / 1000;
+		heading += cmd == CAR_CMD_LEFT ? -turn : turn;
+		return true;
+	}
+	case CAR_CMD_DRIVE:
+	{
+		// The Arduino mixes both axes into a speed per side: throttle moves, steering turns
+		if (millis() - drive_time_ms >= CAR_DRIVE_LEASE_MS)
+		{
+			return false;
+		}
+		int32_t step = (int8_t)pwm * POSE_MAX_SPEED_MMS / 127 * (int32_t)dt_ms / 1000;
+		x_mm += step * sin_q14(heading) >> 14;
+		y_mm += step * cos_q14(heading) >> 14;
+		heading += drive_steering * TURN_BAM_PER_S / 127 * (int32_t)dt_ms / 1000;
+		return true;
+	}
+	default:
+		return false; // Stopped, or auto mode where the Arduino decides how to move
+	}
+}
+
+// Function to pull the estimate towards a new fix
+static void correct(const gps_fix_t *fix)
+{
+	if (!has_origin)
+	{
+		set_origin(fix);
+		return;
+	}
+	int32_t gx = (int64_t)(fix->lon_e7 - origin_lon_e7) * MM_PER_E7_Q16 * lon_scale_q16 >> 32;
+	int32_t gy = (int64_t)(fix->lat_e7 - origin_lat_e7) * MM_PER_E7_Q16 >> 16;
+	int32_t ex = gx - x_mm;
+	int32_t ey = gy - y_mm;
+	// Without a motion model (auto mode) the fix is the best estimate there is
+	bool dead_reckoning = drive_cmd != CAR_CMD_AUTO;
+	if (!dead_reckoning || abs(ex) > POSE_SNAP_MM || abs(ey) > POSE_SNAP_MM)
+	{
+		x_mm = gx;
+		y_mm = gy;
+	}
+	else
+	{
+		int32_t gain = fix->hdop_c >= 0 && fix->hdop_c <= 200 ? POSE_GPS_GAIN_Q8 : POSE_GPS_GAIN_Q8 / 2;
+		x_mm += ex * gain / 256;
+		y_mm += ey * gain / 256;
+	}
+
+	if (fix->speed_cms >= POSE_COURSE_MIN_CMS && fix->course_cdeg >= 0)
+	{
+		uint16_t course = (uint32_t)fix->course_cdeg * 65536 / 36000;
+		if (drive_cmd == CAR_CMD_BACK || (drive_cmd == CAR_CMD_DRIVE && (int8_t)drive_pwm < 0))
+		{
+			course += 32768; // Driving backwards, the car points away from its course
+		}
+		int16_t error = (int16_t)(course - heading);
+		heading += error * POSE_HEADING_GAIN_Q8 / 256;
+	}
+}
+
+// Function to convert the estimate back to latitude and longitude and publish it
+static void publish()
+{
+	pose_t pose;
+	pose.time_ms = millis();
+	pose.lat_e7 = origin_lat_e7 + (int32_t)(((int64_t)y_mm << 16) / MM_PER_E7_Q16);
+	pose.lon_e7 = origin_lon_e7 + (int32_t)(((int64_t)x_mm << 32) / ((int64_t)MM_PER_E7_Q16 * lon_scale_q16));
+	pose.heading = heading;
+	pose.dead_reckoning = drive_cmd != CAR_CMD_AUTO;
+
+	portENTER_CRITICAL(&pose_mux);
+	pose.version = published.version + 1;
+	published = pose;
+	portEXIT_CRITICAL(&pose_mux);
+
+	events_publish_pose(pose.lat_e7 / 1e7, pose.lon_e7 / 1e7, pose.heading * 360.0f / 65536, pose.version);
+}
+
+// Task that runs the filter at POSE_RATE_HZ
+static void pose_task_fn(void *arg)
+{
+	const uint32_t dt_ms = 1000 / POSE_RATE_HZ;
+	uint32_t gps_version = 0;
+	TickType_t wake = xTaskGetTickCount();
+	while (true)
+	{
+		vTaskDelayUntil(&wake, pdMS_TO_TICKS(dt_ms));
+		bool changed = has_origin && predict(dt_ms);
+		if (gps_fix_version() != gps_version)
+		{
+			gps_fix_t fix;
+			gps_version = gps_get_fix(&fix);
+			correct(&fix);
+			changed = true;
+		}
+		if (changed)
+		{
+			publish();
+		}
+	}
+}
+
+// Function to fill the sine table once before the task starts
+static void sin_table_init()
+{
+	for (int i = 0; i < 256; i++)
+	{
+		sin_table[i] = (int16_t)lroundf(sinf(i * 2 * (float)PI / 256) * 16384);
+	}
+}
+
+bool pose_start()
+{
+	sin_table_init();
+	return xTaskCreatePinnedToCore(pose_task_fn, "pose", 3072, NULL, 3, NULL, tskNO_AFFINITY) == pdPASS;
+}
+
+void pose_command(uint8_t cmd, uint8_t arg0, uint8_t arg1)
+{
+	switch (cmd)
+	{
+	case CAR_CMD_MANUAL:
+		drive_cmd = CAR_CMD_STOP; // The Arduino stops when it leaves auto mode
+		break;
+	case CAR_CMD_STOP:
+	case CAR_CMD_FORWARD:
+	case CAR_CMD_BACK:
+	case CAR_CMD_LEFT:
+	case CAR_CMD_RIGHT:
+	case CAR_CMD_DRIVE:
+		if (drive_cmd == CAR_CMD_AUTO)
+		{
+			break; // Drive commands are ignored by the Arduino in auto mode
+		}
+		// fall through
+	case CAR_CMD_AUTO:
+		drive_pwm = arg0;
+		drive_steering = (int8_t)arg1;
+		drive_time_ms = millis();
+		drive_cmd = cmd;
+		break;
+	}
+}
+
+uint32_t pose_get(pose_t *pose)
+{
+	portENTER_CRITICAL(&pose_mux);
+	*pose = published;
+	portEXIT_CRITICAL(&pose_mux);
+	return pose->version;
+}
+
+uint32_t pose_version()
+{
+	return published.version;
+}
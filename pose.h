@@ -0,0 +1,45 @@
+/* Position estimate between GPS fixes
+ *
+ * The GPS only updates a few times per second. A task running at
+ * POSE_RATE_HZ moves the estimated position along with the drive commands sent
+ * to the Arduino (dead reckoning), then pulls it towards every new fix with a
+ * fixed gain (complementary filter). The GPS course corrects the heading
+ * while the car is moving fast enough for it to mean something.
+ * All per-update math is integer: positions in mm around a local origin,
+ * heading as a 16 bit binary angle.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define POSE_RATE_HZ 20				 // Estimate updates per second
+#define POSE_MAX_SPEED_MMS 1200		 // Ground speed at full PWM (255)
+#define POSE_MAX_TURN_DPS 270		 // Spin rate at full PWM
+#define POSE_DEFAULT_STRAIGHT_PWM 150 // Arduino MANUAL_STRAIGHT_SPEED, used when a command has no speed
+#define POSE_DEFAULT_TURN_PWM 170	 // Arduino MANUAL_TURN_SPEED
+#define POSE_GPS_GAIN_Q8 96			 // Share of the position error removed by each fix (/256)
+#define POSE_HEADING_GAIN_Q8 64		 // Share of the heading error removed by each GPS course (/256)
+#define POSE_COURSE_MIN_CMS 50		 // GPS course is ignored below this speed
+#define POSE_SNAP_MM 20000			 // Further than this from a fix, the estimate jumps to it
+
+// Structure for one estimated pose
+typedef struct
+{
+	uint32_t version; // Incremented every time the estimate changes, 0 = no fix yet
+	uint32_t time_ms;
+	int32_t lat_e7;
+	int32_t lon_e7;
+	uint16_t heading; // 65536 = 360 degrees, 0 = north, clockwise
+	bool dead_reckoning; // Motion since the last fix is predicted from the drive commands
+} pose_t;
+
+// Function to start the estimator task
+bool pose_start();
+
+// Function to tell the estimator about a command sent to the Arduino (CAR_CMD_* and its two arguments)
+void pose_command(uint8_t cmd, uint8_t arg0, uint8_t arg1);
+
+// Copy the latest estimate, returns its version
+uint32_t pose_get(pose_t *pose);
+uint32_t pose_version();
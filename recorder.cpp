@@ -0,0 +1,450 @@
+#include "recorder.h"
+#include "frame_ring.h"
+#include "gps.h"
+#include "exif.h"
+#include "esp_timer.h"
+#include "Arduino.h"
+#include "SD_MMC.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#define AVI_HEADER_SIZE 224 // RIFF header, hdrl list and the start of the movi list
+#define AVI_INDEX_BATCH 32	// idx1 entries converted per read of the sidecar
+
+// Structure for a frame copied out of the ring, waiting for the writer
+typedef struct
+{
+	uint8_t *buf;
+	size_t cap;
+	size_t len;
+	uint32_t width;
+	uint32_t height;
+	int64_t captured_us;
+	gps_fix_t fix;
+} record_buffer_t;
+
+// Structure for the file being written (writer task only)
+typedef struct
+{
+	FILE *avi;
+	FILE *idx;
+	uint32_t frames;
+	uint32_t movi_bytes; // Bytes of chunks after the 'movi' fourcc
+	uint32_t max_frame;
+	uint32_t width;
+	uint32_t height;
+	int64_t first_us;
+	int64_t last_us;
+	uint32_t synced_ms;
+} record_file_t;
+
+static record_buffer_t buffers[RECORD_BUFFERS];
+static QueueHandle_t free_q = NULL; // Buffers the grabber may fill
+static QueueHandle_t full_q = NULL; // Buffers to write, NULL closes the file
+static TaskHandle_t grab_task = NULL;
+static volatile bool recording = false;
+static bool mounted = false;
+static record_file_t file;
+static recorder_stats_t stats;
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+	p[0] = v;
+	p[1] = v >> 8;
+	p[2] = v >> 16;
+	p[3] = v >> 24;
+}
+
+static void put_fourcc(uint8_t *p, const char *fourcc)
+{
+	memcpy(p, fourcc, 4);
+}
+
+// Function to build the AVI header for the current state of the file, riff_size is 0 while recording
+static void avi_header(uint8_t *h, const record_file_t *f, uint32_t riff_size)
+{
+	uint32_t us_per_frame = f->frames > 1 ? (f->last_us - f->first_us) / (f->frames - 1) : 100000;
+	if (!us_per_frame)
+	{
+		us_per_frame = 1;
+	}
+	memset(h, 0, AVI_HEADER_SIZE);
+	put_fourcc(&h[0], "RIFF");
+	put_u32(&h[4], riff_size);
+	put_fourcc(&h[8], "AVI ");
+	put_fourcc(&h[12], "LIST");
+	put_u32(&h[16], 192);
+	put_fourcc(&h[20], "hdrl");
+
+	// Main header
+	put_fourcc(&h[24], "avih");
+	put_u32(&h[28], 56);
+	put_u32(&h[32], us_per_frame);
+	put_u32(&h[36], (uint64_t)f->max_frame * 1000000 / us_per_frame);
+	put_u32(&h[44], 0x10); // AVIF_HASINDEX
+	put_u32(&h[48], f->frames);
+	put_u32(&h[56], 1); // Streams
+	put_u32(&h[60], f->max_frame);
+	put_u32(&h[64], f->width);
+	put_u32(&h[68], f->height);
+
+	// Video stream header
+	put_fourcc(&h[88], "LIST");
+	put_u32(&h[92], 116);
+	put_fourcc(&h[96], "strl");
+	put_fourcc(&h[100], "strh");
+	put_u32(&h[104], 56);
+	put_fourcc(&h[108], "vids");
+	put_fourcc(&h[112], "MJPG");
+	put_u32(&h[128], us_per_frame); // Scale / rate = seconds per frame
+	put_u32(&h[132], 1000000);
+	put_u32(&h[140], f->frames);
+	put_u32(&h[144], f->max_frame);
+	put_u32(&h[148], 0xFFFFFFFF); // Default quality
+	put_u16(&h[160], f->width);
+	put_u16(&h[162], f->height);
+
+	// Video format (BITMAPINFOHEADER)
+	put_fourcc(&h[164], "strf");
+	put_u32(&h[168], 40);
+	put_u32(&h[172], 40);
+	put_u32(&h[176], f->width);
+	put_u32(&h[180], f->height);
+	put_u16(&h[184], 1);
+	put_u16(&h[186], 24);
+	put_fourcc(&h[188], "MJPG");
+	put_u32(&h[192], f->width * f->height * 3);
+
+	put_fourcc(&h[212], "LIST");
+	put_u32(&h[216], f->movi_bytes + 4);
+	put_fourcc(&h[220], "movi");
+}
+
+// Function to pick the next unused file number on the card
+static bool record_next_path(char *path, size_t len)
+{
+	struct stat st;
+	for (int i = 1; i < 10000; i++)
+	{
+		snprintf(path, len, RECORD_ROOT "/rec_%04d.avi", i);
+		if (stat(path, &st) != 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Function to start a new AVI file and its sidecar index for frames like b
+static bool record_open(const record_buffer_t *b)
+{
+	char path[sizeof(stats.path)];
+	if (!record_next_path(path, sizeof(path)))
+	{
+		return false;
+	}
+	memset(&file, 0, sizeof(file));
+	file.width = b->width;
+	file.height = b->height;
+	file.first_us = b->captured_us;
+	file.synced_ms = millis();
+	file.avi = fopen(path, "wb");
+	strcpy(&path[strlen(path) - 3], "idx");
+	file.idx = fopen(path, "w+b");
+	strcpy(&path[strlen(path) - 3], "avi");
+	if (!file.avi || !file.idx)
+	{
+		if (file.avi)
+		{
+			fclose(file.avi);
+		}
+		if (file.idx)
+		{
+			fclose(file.idx);
+		}
+		file.avi = file.idx = NULL;
+		return false;
+	}
+
+	uint8_t header[AVI_HEADER_SIZE];
+	avi_header(header, &file, 0);
+	uint8_t idx_header[8] = {'C', 'A', 'R', 'I', 'D', 'X'};
+	put_u16(&idx_header[6], RECORD_INDEX_VERSION);
+	if (fwrite(header, 1, sizeof(header), file.avi) != sizeof(header) ||
+		fwrite(idx_header, 1, sizeof(idx_header), file.idx) != sizeof(idx_header))
+	{
+		fclose(file.avi);
+		fclose(file.idx);
+		file.avi = file.idx = NULL;
+		return false;
+	}
+	strcpy(stats.path, path);
+	stats.files++;
+	Serial.printf("Recording to %s\n", path);
+	return true;
+}
+
+// Function to append one frame, tagged with its GPS fix, to the AVI file and the sidecar index
+static bool record_write(const record_buffer_t *b)
+{
+	uint8_t app1[EXIF_GPS_MAX_LEN];
+	size_t app1_len = exif_can_splice(b->buf, b->len) ? exif_gps_segment(&b->fix, app1) : 0;
+	size_t head = app1_len ? EXIF_SPLICE_AT : b->len; // Part of the frame written before the EXIF segment
+	size_t len = b->len + app1_len;
+
+	record_index_t entry;
+	entry.offset = 4 + file.movi_bytes;
+	entry.size = len;
+	entry.time_ms = (b->captured_us - file.first_us) / 1000;
+	entry.gps_version = b->fix.version;
+	entry.lat_e7 = b->fix.lat_e7;
+	entry.lon_e7 = b->fix.lon_e7;
+	entry.gps_date = b->fix.date;
+	entry.gps_time = b->fix.time;
+
+	uint8_t chunk[8];
+	put_fourcc(chunk, "00dc");
+	put_u32(&chunk[4], len);
+	static const uint8_t pad = 0;
+	if (fwrite(chunk, 1, sizeof(chunk), file.avi) != sizeof(chunk) ||
+		fwrite(b->buf, 1, head, file.avi) != head ||
+		fwrite(app1, 1, app1_len, file.avi) != app1_len ||
+		fwrite(b->buf + head, 1, b->len - head, file.avi) != b->len - head ||
+		((len & 1) && fwrite(&pad, 1, 1, file.avi) != 1) ||
+		fwrite(&entry, 1, sizeof(entry), file.idx) != sizeof(entry))
+	{
+		return false;
+	}
+	file.movi_bytes += sizeof(chunk) + len + (len & 1);
+	file.frames++;
+	file.last_us = b->captured_us;
+	if (len > file.max_frame)
+	{
+		file.max_frame = len;
+	}
+
+	// Flush now and then so a power loss costs seconds, not the whole recording
+	if (millis() - file.synced_ms >= RECORD_SYNC_MS)
+	{
+		fflush(file.avi);
+		fsync(fileno(file.avi));
+		fflush(file.idx);
+		fsync(fileno(file.idx));
+		file.synced_ms = millis();
+	}
+	return true;
+}
+
+// Function to finish the AVI file: append idx1 from the sidecar and write the final header
+static void record_close()
+{
+	if (!file.avi)
+	{
+		return;
+	}
+	uint8_t chunk[8];
+	put_fourcc(chunk, "idx1");
+	put_u32(chunk + 4, file.frames * 16);
+	bool ok = fwrite(chunk, 1, sizeof(chunk), file.avi) == sizeof(chunk);
+
+	record_index_t entries[AVI_INDEX_BATCH];
+	uint8_t idx1[AVI_INDEX_BATCH * 16];
+	fflush(file.idx);
+	fseek(file.idx, 8, SEEK_SET);
+	size_t n;
+	while (ok && (n = fread(entries, sizeof(record_index_t), AVI_INDEX_BATCH, file.idx)) > 0)
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			put_fourcc(&idx1[i * 16], "00dc");
+			put_u32(&idx1[i * 16 + 4], 0x10); // AVIIF_KEYFRAME, every JPEG stands alone
+			put_u32(&idx1[i * 16 + 8], entries[i].offset);
+			put_u32(&idx1[i * 16 + 12], entries[i].size);
+		}
+		ok = fwrite(idx1, 16, n, file.avi) == n;
+	}
+
+	uint8_t header[AVI_HEADER_SIZE];
+	avi_header(header, &file, AVI_HEADER_SIZE - 8 + file.movi_bytes + 8 + file.frames * 16);
+	ok = ok && fseek(file.avi, 0, SEEK_SET) == 0 && fwrite(header, 1, sizeof(header), file.avi) == sizeof(header);
+	ok = (fclose(file.avi) == 0) && ok;
+	ok = (fclose(file.idx) == 0) && ok;
+	file.avi = file.idx = NULL;
+	if (!ok)
+	{
+		stats.errors++;
+	}
+	Serial.printf("Recorded %u frames to %s\n", (unsigned)file.frames, stats.path);
+}
+
+// Task that copies new frames out of the ring while recording
+static void grab_task_fn(void *arg)
+{
+	bool subscribed = false;
+	uint32_t last_seq = 0;
+	while (true)
+	{
+		if (!recording)
+		{
+			if (subscribed)
+			{
+				frame_ring_unsubscribe();
+				subscribed = false;
+				record_buffer_t *end = NULL;
+				xQueueSend(full_q, &end, portMAX_DELAY); // The writer closes the file after the frames before it
+			}
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			continue;
+		}
+		if (!subscribed)
+		{
+			frame_ring_subscribe();
+			subscribed = true;
+		}
+
+		shared_frame_t *frame = frame_ring_acquire(last_seq, pdMS_TO_TICKS(100));
+		if (!frame)
+		{
+			continue;
+		}
+		last_seq = frame->seq;
+		record_buffer_t *b;
+		if (xQueueReceive(free_q, &b, 0) != pdTRUE)
+		{
+			// The card is behind, the frame is only missing from the recording
+			frame_ring_release(frame);
+			stats.dropped++;
+			continue;
+		}
+		bool ok = true;
+		if (b->cap < frame->len)
+		{
+			size_t cap = frame->len + frame->len / 4;
+			uint8_t *buf = (uint8_t *)(psramFound() ? ps_realloc(b->buf, cap) : realloc(b->buf, cap));
+			ok = buf != NULL;
+			if (ok)
+			{
+				b->buf = buf;
+				b->cap = cap;
+			}
+		}
+		if (ok)
+		{
+			memcpy(b->buf, frame->buf, frame->len);
+			b->len = frame->len;
+			b->width = frame->width;
+			b->height = frame->height;
+			b->captured_us = frame->timestamp.tv_sec * 1000000LL + frame->timestamp.tv_usec;
+		}
+		frame_ring_release(frame);
+		if (!ok)
+		{
+			stats.dropped++;
+			xQueueSend(free_q, &b, 0);
+			continue;
+		}
+		gps_get_fix(&b->fix);
+		xQueueSend(full_q, &b, portMAX_DELAY);
+	}
+}
+
+// Task that writes the copied frames to the card, the only one touching the files
+static void write_task_fn(void *arg)
+{
+	while (true)
+	{
+		record_buffer_t *b;
+		xQueueReceive(full_q, &b, portMAX_DELAY);
+		if (!b)
+		{
+			record_close();
+			continue;
+		}
+
+		// A new file after a frame size change or before the offsets get too large
+		if (file.avi && (b->width != file.width || b->height != file.height || file.movi_bytes > RECORD_MAX_BYTES))
+		{
+			record_close();
+		}
+		int64_t start = esp_timer_get_time();
+		bool ok = file.avi || record_open(b);
+		uint32_t written = file.movi_bytes;
+		ok = ok && record_write(b);
+		if (ok)
+		{
+			latency_hist_add(&stats.write, esp_timer_get_time() - start);
+			stats.frames++;
+			stats.bytes += file.movi_bytes - written;
+		}
+		else
+		{
+			stats.errors++;
+			if (recording)
+			{
+				Serial.println("Recording failed, card full or removed?");
+				recording = stats.recording = false;
+				xTaskNotifyGive(grab_task);
+			}
+		}
+		xQueueSend(free_q, &b, portMAX_DELAY);
+	}
+}
+
+bool recorder_start()
+{
+	if (grab_task)
+	{
+		return true;
+	}
+	free_q = xQueueCreate(RECORD_BUFFERS, sizeof(record_buffer_t *));
+	full_q = xQueueCreate(RECORD_BUFFERS + 1, sizeof(record_buffer_t *));
+	if (!free_q || !full_q)
+	{
+		return false;
+	}
+	for (int i = 0; i < RECORD_BUFFERS; i++)
+	{
+		record_buffer_t *b = &buffers[i];
+		xQueueSend(free_q, &b, 0);
+	}
+	// The writer runs below the stream tasks, a stalled card only delays the recording
+	if (xTaskCreatePinnedToCore(write_task_fn, "rec_write", 6144, NULL, 2, NULL, tskNO_AFFINITY) != pdPASS)
+	{
+		return false;
+	}
+	return xTaskCreatePinnedToCore(grab_task_fn, "rec_grab", 3072, NULL, 4, &grab_task, tskNO_AFFINITY) == pdPASS;
+}
+
+bool recorder_record(bool record)
+{
+	if (!grab_task)
+	{
+		return false;
+	}
+	if (record && !mounted)
+	{
+		mounted = SD_MMC.begin(RECORD_ROOT, true);
+		if (!mounted)
+		{
+			Serial.println("No SD card");
+			return false;
+		}
+	}
+	recording = stats.recording = record;
+	xTaskNotifyGive(grab_task);
+	return true;
+}
+
+const recorder_stats_t *recorder_stats()
+{
+	return &stats;
+}
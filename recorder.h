@@ -0,0 +1,69 @@
+/* microSD recording of the camera stream
+ *
+ * Two tasks form a pipeline so a slow card never holds up the live stream:
+ * the grabber copies each new frame of the shared ring into one of
+ * RECORD_BUFFERS buffers and lets go of the ring slot at once, the writer
+ * appends the filled buffers to the card. When the writer is stalled and
+ * every buffer is full, the grabber drops frames from the recording only.
+ *
+ * Every recording is an AVI file (MJPEG, one '00dc' chunk per frame, idx1
+ * index written when the file is closed) next to a sidecar index with the
+ * same name and the .idx extension:
+ *   8 byte header "CARIDX" + uint16 RECORD_INDEX_VERSION
+ *   then one record_index_t (little endian) per frame
+ * The sidecar is flushed every RECORD_SYNC_MS, so it survives a power loss
+ * that leaves the AVI header unfinished, and it maps each frame to the GPS
+ * fix that was current when it was captured.
+ *
+ * The card runs in 1-bit SD mode: 4-bit mode would also take GPIO 4 (flash
+ * LED), 12 and 13 (GPS UART).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "latency_hist.h"
+
+#ifndef RECORD_ROOT
+#define RECORD_ROOT "/sdcard" // Mount point of the card, files are written with stdio so any directory works
+#endif
+#define RECORD_BUFFERS 2						 // Frames copied but not written yet
+#define RECORD_MAX_BYTES (1000UL * 1024 * 1024) // A new file is started before AVI offsets get too big
+#define RECORD_SYNC_MS 2000						 // Period of flushing both files to the card
+#define RECORD_INDEX_VERSION 1
+
+// Structure for one frame in the sidecar index
+typedef struct
+{
+	uint32_t offset;	  // Position of the frame's '00dc' chunk, counted from the 'movi' fourcc like idx1
+	uint32_t size;		  // JPEG length
+	uint32_t time_ms;	  // Capture time since the first frame of the file
+	uint32_t gps_version; // gps_fix_t.version of the fix, 0 = no fix yet
+	int32_t lat_e7;
+	int32_t lon_e7;
+	uint32_t gps_date; // UTC date as ddmmyy
+	uint32_t gps_time; // UTC time as hhmmsscc
+} record_index_t;
+
+// Structure for the recorder counters, written by the recorder tasks (recording also by recorder_record)
+typedef struct
+{
+	bool recording;
+	uint32_t frames;	   // Frames written
+	uint32_t dropped;	   // Frames not recorded because the writer was behind
+	uint32_t files;		   // Files started since boot
+	uint32_t errors;	   // Card or file errors, each one stops the recording
+	uint64_t bytes;		   // Bytes written to AVI files
+	char path[32];		   // Current or last AVI file
+	latency_hist_t write;  // Writing one frame to the card
+} recorder_stats_t;
+
+// Function to create the recorder tasks, recording starts with recorder_record(true)
+bool recorder_start();
+
+// Function to start or stop recording, the card is mounted the first time.
+// Returns false if the card could not be mounted
+bool recorder_record(bool record);
+
+// Counters of the recorder since boot
+const recorder_stats_t *recorder_stats();
@@ -0,0 +1,155 @@
+#include "stream_control.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "Arduino.h"
+
+// One step of the quality ladder
+typedef struct
+{
+	framesize_t framesize;
+	int quality; // JPEG quality, lower is better
+} stream_level_t;
+
+// Ladder of settings from the boot configuration (CIF) down to the cheapest picture.
+// Quality is lowered first because it is cheaper to change than the frame size
+static const stream_level_t levels[] = {
+	{FRAMESIZE_CIF, 10},
+	{FRAMESIZE_CIF, 15},
+	{FRAMESIZE_CIF, 22},
+	{FRAMESIZE_QVGA, 12},
+	{FRAMESIZE_QVGA, 20},
+	{FRAMESIZE_HQVGA, 15},
+	{FRAMESIZE_QQVGA, 15},
+};
+#define LEVEL_COUNT (int)(sizeof(levels) / sizeof(levels[0]))
+
+// Structure for the measurements of the current window
+typedef struct
+{
+	int64_t start;			// Start of the window (us)
+	uint32_t frames;
+	uint32_t frame_time_sum; // Sum of the client frame intervals (ms)
+	uint32_t send_time_sum;
+	uint32_t send_time_max;
+	uint32_t bytes;
+} stream_window_t;
+
+static portMUX_TYPE control_mux = portMUX_INITIALIZER_UNLOCKED;
+static stream_window_t window;
+static volatile bool enabled = true;
+static volatile int level = 0;
+static int good_windows = 0; // Consecutive windows with headroom
+static bool settling = false; // Skip the window right after a change, the sensor needs a few frames
+
+// Function to apply a ladder step through the sensor API
+static void apply_level(int new_level)
+{
+	sensor_t *s = esp_camera_sensor_get();
+	if (!s)
+	{
+		return;
+	}
+	const stream_level_t *l = &levels[new_level];
+	if (s->status.framesize != l->framesize)
+	{
+		s->set_framesize(s, l->framesize);
+	}
+	s->set_quality(s, l->quality);
+	level = new_level;
+	settling = true;
+	good_windows = 0;
+	Serial.printf("Stream level %d: framesize %d, quality %d\n", new_level, l->framesize, l->quality);
+}
+
+// Function to decide on the next step from the measurements of a finished window
+static void evaluate_window(const stream_window_t *w)
+{
+	if (w->frames == 0)
+	{
+		return;
+	}
+	if (settling)
+	{
+		settling = false;
+		return;
+	}
+	uint32_t avg_frame_time = w->frame_time_sum / w->frames;
+	uint32_t avg_send_time = w->send_time_sum / w->frames;
+	uint32_t target_frame_time = 1000 / STREAM_TARGET_FPS;
+
+	// The link is the bottleneck when clients spend most of each frame interval sending
+	bool too_slow = avg_frame_time > target_frame_time * 5 / 4 && avg_send_time * 2 > avg_frame_time;
+	bool too_late = w->send_time_max > STREAM_LATENCY_BUDGET_MS;
+	if (too_slow || too_late)
+	{
+		if (level < LEVEL_COUNT - 1)
+		{
+			apply_level(level + 1);
+		}
+		good_windows = 0;
+		return;
+	}
+
+	// Step up only after several windows with clear headroom
+	bool headroom = avg_send_time * 3 < target_frame_time && w->send_time_max * 2 < STREAM_LATENCY_BUDGET_MS;
+	good_windows = headroom ? good_windows + 1 : 0;
+	if (good_windows >= STREAM_CONTROL_UPGRADE_WINDOWS && level > 0)
+	{
+		apply_level(level - 1);
+	}
+}
+
+void stream_control_report(uint32_t frame_time_ms, uint32_t send_time_ms, size_t frame_len)
+{
+	if (!enabled)
+	{
+		return;
+	}
+	int64_t now = esp_timer_get_time();
+	stream_window_t finished;
+	bool evaluate = false;
+
+	portENTER_CRITICAL(&control_mux);
+	if (!window.start)
+	{
+		window.start = now;
+	}
+	window.frames++;
+	window.frame_time_sum += frame_time_ms;
+	window.send_time_sum += send_time_ms;
+	window.send_time_max = max(window.send_time_max, send_time_ms);
+	window.bytes += frame_len;
+	if (now - window.start >= STREAM_CONTROL_WINDOW_MS * 1000LL)
+	{
+		// Only the task that closes the window evaluates it
+		finished = window;
+		memset(&window, 0, sizeof(window));
+		evaluate = true;
+	}
+	portEXIT_CRITICAL(&control_mux);
+
+	if (evaluate)
+	{
+		evaluate_window(&finished);
+	}
+}
+
+void stream_control_enable(bool enable)
+{
+	portENTER_CRITICAL(&control_mux);
+	memset(&window, 0, sizeof(window));
+	portEXIT_CRITICAL(&control_mux);
+	good_windows = 0;
+	settling = false;
+	enabled = enable;
+}
+
+bool stream_control_enabled()
+{
+	return enabled;
+}
+
+int stream_control_level()
+{
+	return level;
+}
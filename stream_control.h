@@ -0,0 +1,27 @@
+/* Adaptive frame size / JPEG quality controller for the MJPEG stream
+ *
+ * Stream clients report every frame they send. Once per window the controller
+ * checks whether the link keeps up with the target frame rate and latency
+ * budget and moves one step along a ladder of (frame size, quality) settings.
+ * It steps down after one bad window and back up only after several good
+ * ones, so it does not oscillate.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define STREAM_TARGET_FPS 15		   // Frame rate the controller tries to hold
+#define STREAM_LATENCY_BUDGET_MS 150   // Longest acceptable time to send one frame
+#define STREAM_CONTROL_WINDOW_MS 2000  // Length of one measurement window
+#define STREAM_CONTROL_UPGRADE_WINDOWS 3 // Good windows needed before stepping back up
+
+// Function to report one frame sent to a stream client
+void stream_control_report(uint32_t frame_time_ms, uint32_t send_time_ms, size_t frame_len);
+
+// Enable or disable the controller. Disabling keeps the current sensor settings
+void stream_control_enable(bool enable);
+bool stream_control_enabled();
+
+// Current step on the ladder, 0 = best picture
+int stream_control_level();
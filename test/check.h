@@ -0,0 +1,38 @@
+/* Minimal checks for the host tests
+ *
+ * CHECK and CHECK_EQ report the failing line and keep going, so one run
+ * shows every broken expectation. main() returns check_result().
+ */
+#pragma once
+
+#include <stdio.h>
+
+static int check_failures = 0;
+
+#define CHECK(cond)                                                          \
+	do                                                                       \
+	{                                                                        \
+		if (!(cond))                                                         \
+		{                                                                    \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+			check_failures++;                                                \
+		}                                                                    \
+	} while (0)
+
+#define CHECK_EQ(actual, expected)                                                           \
+	do                                                                                       \
+	{                                                                                        \
+		long long a_ = (long long)(actual), e_ = (long long)(expected);                     \
+		if (a_ != e_)                                                                        \
+		{                                                                                    \
+			printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+			check_failures++;                                                                \
+		}                                                                                    \
+	} while (0)
+
+// Function to print the outcome of a test program and return its exit code
+static inline int check_result(const char *name)
+{
+	printf("%s: %s\n", name, check_failures ? "FAILED" : "passed");
+	return check_failures ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+// Host build of the car firmware: setup() of the sketch, with the real web handlers on local sockets.
+// Open http://127.0.0.1:8080/ (the stream server is on 8081), or give another port for the page server.
+// The stand-in camera sees a moving scene, so the stream sends every frame
+#include "host.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+void setup();
+
+int main(int argc, char **argv)
+{
+	int port = argc > 1 ? atoi(argv[1]) : 8080;
+	if (port <= 80 || port > 65534)
+	{
+		fprintf(stderr, "usage: %s [port]\n", argv[0]);
+		return 2;
+	}
+	host_httpd_set_port_offset(port - 80);
+	host_camera_set_moving(true);
+	setup();
+	fflush(stdout);
+	while (true)
+	{
+		pause();
+	}
+}
@@ -0,0 +1,303 @@
+#include "http_client.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#define HTTP_CLIENT_TIMEOUT_S 10 // Longest wait for any read or write
+
+bool http_connect(http_conn_t *conn, uint16_t port, int timeout_ms)
+{
+	conn->fd = socket(AF_INET, SOCK_STREAM, 0);
+	conn->in.clear();
+	conn->received = 0;
+	if (conn->fd < 0)
+	{
+		return false;
+	}
+	struct timeval timeout = {.tv_sec = HTTP_CLIENT_TIMEOUT_S, .tv_usec = 0};
+	setsockopt(conn->fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	setsockopt(conn->fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+	int one = 1;
+	setsockopt(conn->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(port);
+	// The server may still be starting
+	for (int waited = 0; connect(conn->fd, (struct sockaddr *)&addr, sizeof(addr)) < 0; waited += 10)
+	{
+		if (waited >= timeout_ms)
+		{
+			http_close(conn);
+			return false;
+		}
+		close(conn->fd);
+		usleep(10000);
+		conn->fd = socket(AF_INET, SOCK_STREAM, 0);
+		setsockopt(conn->fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(conn->fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+		setsockopt(conn->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	}
+	return true;
+}
+
+void http_close(http_conn_t *conn)
+{
+	if (conn->fd >= 0)
+	{
+		close(conn->fd);
+	}
+	conn->fd = -1;
+	conn->in.clear();
+}
+
+static bool send_all(int fd, const void *buf, size_t len)
+{
+	const char *p = (const char *)buf;
+	while (len > 0)
+	{
+		ssize_t sent = send(fd, p, len, MSG_NOSIGNAL);
+		if (sent <= 0)
+		{
+			return false;
+		}
+		p += sent;
+		len -= sent;
+	}
+	return true;
+}
+
+// Function to receive until the buffer holds at least len bytes
+static bool fill(http_conn_t *conn, size_t len)
+{
+	char buf[16384];
+	while (conn->in.size() < len)
+	{
+		ssize_t n = recv(conn->fd, buf, sizeof(buf), 0);
+		if (n <= 0)
+		{
+			return false;
+		}
+		conn->in.append(buf, n);
+		conn->received += n;
+	}
+	return true;
+}
+
+// Function to take the bytes up to the delimiter out of the buffer (the delimiter is dropped)
+static bool read_until(http_conn_t *conn, const char *delim, std::string *out)
+{
+	size_t pos;
+	while ((pos = conn->in.find(delim)) == std::string::npos)
+	{
+		if (conn->in.size() > 65536 || !fill(conn, conn->in.size() + 1))
+		{
+			return false;
+		}
+	}
+	out->assign(conn->in, 0, pos);
+	conn->in.erase(0, pos + strlen(delim));
+	return true;
+}
+
+static bool read_exact(http_conn_t *conn, size_t len, std::string *out)
+{
+	if (!fill(conn, len))
+	{
+		return false;
+	}
+	out->append(conn->in, 0, len);
+	conn->in.erase(0, len);
+	return true;
+}
+
+// Function to find a header in a block of "Field: value" lines
+static std::string find_header(const std::string &headers, const char *field)
+{
+	size_t len = strlen(field);
+	size_t pos = 0;
+	while (pos < headers.size())
+	{
+		size_t end = headers.find("\r\n", pos);
+		if (end == std::string::npos)
+		{
+			end = headers.size();
+		}
+		if (end - pos > len && headers[pos + len] == ':' && !strncasecmp(&headers[pos], field, len))
+		{
+			size_t value = headers.find_first_not_of(" \t", pos + len + 1);
+			return value < end ? headers.substr(value, end - value) : "";
+		}
+		pos = end + 2;
+	}
+	return "";
+}
+
+std::string http_header(const http_response_t *resp, const char *field)
+{
+	return find_header(resp->headers, field);
+}
+
+bool http_read_head(http_conn_t *conn, http_response_t *resp)
+{
+	std::string head;
+	if (!read_until(conn, "\r\n\r\n", &head))
+	{
+		return false;
+	}
+	size_t line_end = head.find("\r\n");
+	resp->status = 0;
+	if (sscanf(head.c_str(), "HTTP/1.%*d %d", &resp->status) != 1)
+	{
+		return false;
+	}
+	resp->headers = line_end == std::string::npos ? "" : head.substr(line_end + 2);
+	resp->body.clear();
+	return true;
+}
+
+bool http_send(http_conn_t *conn, const char *method, const char *path, const char *extra)
+{
+	char req[1024];
+	int len = snprintf(req, sizeof(req), "%s %s HTTP/1.1\r\nHost: 127.0.0.1\r\n%s\r\n", method, path, extra);
+	return len < (int)sizeof(req) && send_all(conn->fd, req, len);
+}
+
+bool http_request(http_conn_t *conn, const char *method, const char *path, http_response_t *resp, const char *extra)
+{
+	if (!http_send(conn, method, path, extra) || !http_read_head(conn, resp))
+	{
+		return false;
+	}
+	std::string length = http_header(resp, "Content-Length");
+	if (!length.empty())
+	{
+		return read_exact(conn, strtoul(length.c_str(), NULL, 10), &resp->body);
+	}
+	if (strcasecmp(http_header(resp, "Transfer-Encoding").c_str(), "chunked"))
+	{
+		return false; // Every response of the server has a length
+	}
+	while (true)
+	{
+		std::string size_line, crlf;
+		if (!read_until(conn, "\r\n", &size_line))
+		{
+			return false;
+		}
+		size_t size = strtoul(size_line.c_str(), NULL, 16);
+		if (size == 0)
+		{
+			return read_until(conn, "\r\n", &crlf);
+		}
+		if (!read_exact(conn, size, &resp->body) || !read_exact(conn, 2, &crlf))
+		{
+			return false;
+		}
+	}
+}
+
+bool http_get(http_conn_t *conn, const char *path, http_response_t *resp, const char *extra)
+{
+	return http_request(conn, "GET", path, resp, extra);
+}
+
+bool http_read_part(http_conn_t *conn, std::string *headers, std::string *jpeg)
+{
+	// Parts are separated by "\r\n--boundary\r\n", the first one follows the response headers directly
+	std::string block;
+	do
+	{
+		if (!read_until(conn, "\r\n\r\n", &block))
+		{
+			return false;
+		}
+	} while (find_header(block, "Content-Length").empty());
+	size_t start = block.find("Content-Type");
+	*headers = start == std::string::npos ? block : block.substr(start);
+	std::string length = find_header(*headers, "Content-Length");
+	jpeg->clear();
+	return !length.empty() && read_exact(conn, strtoul(length.c_str(), NULL, 10), jpeg);
+}
+
+bool http_read_event(http_conn_t *conn, std::string *event)
+{
+	return read_until(conn, "\n\n", event);
+}
+
+bool ws_open(http_conn_t *conn, const char *path)
+{
+	char req[512];
+	int len = snprintf(req, sizeof(req),
+					   "GET %s HTTP/1.1\r\nHost: 127.0.0.1\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+					   "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n",
+					   path);
+	http_response_t resp;
+	if (!send_all(conn->fd, req, len) || !http_read_head(conn, &resp))
+	{
+		return false;
+	}
+	// The accept value for the sample key of RFC 6455
+	return resp.status == 101 && http_header(&resp, "Sec-WebSocket-Accept") == "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=";
+}
+
+bool ws_send_binary(http_conn_t *conn, const uint8_t *data, size_t len)
+{
+	static const uint8_t mask[4] = {0x12, 0x34, 0x56, 0x78};
+	std::vector<uint8_t> frame = {0x82};
+	if (len < 126)
+	{
+		frame.push_back(0x80 | len);
+	}
+	else
+	{
+		frame.push_back(0x80 | 126);
+		frame.push_back(len >> 8);
+		frame.push_back(len);
+	}
+	frame.insert(frame.end(), mask, mask + 4);
+	for (size_t i = 0; i < len; i++)
+	{
+		frame.push_back(data[i] ^ mask[i % 4]);
+	}
+	return send_all(conn->fd, frame.data(), frame.size());
+}
+
+bool ws_recv(http_conn_t *conn, std::vector<uint8_t> *payload, int *type)
+{
+	std::string hdr;
+	if (!read_exact(conn, 2, &hdr))
+	{
+		return false;
+	}
+	*type = hdr[0] & 0x0F;
+	size_t len = hdr[1] & 0x7F;
+	if (len >= 126)
+	{
+		std::string ext;
+		size_t n = len == 126 ? 2 : 8;
+		if (!read_exact(conn, n, &ext))
+		{
+			return false;
+		}
+		len = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			len = len << 8 | (uint8_t)ext[i];
+		}
+	}
+	std::string data;
+	if (!read_exact(conn, len, &data))
+	{
+		return false;
+	}
+	payload->assign(data.begin(), data.end());
+	return true;
+}
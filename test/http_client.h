@@ -0,0 +1,59 @@
+/* Small blocking HTTP / WebSocket client for the host web server tests and
+ * the load generator. One http_conn_t is one keep-alive connection to
+ * 127.0.0.1, bytes read past a response stay in its buffer.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// Structure for one client connection
+typedef struct
+{
+	int fd;
+	std::string in;	 // Received bytes not consumed yet
+	size_t received; // Bytes received since connect
+} http_conn_t;
+
+// Structure for a received response, headers as they came
+typedef struct
+{
+	int status;
+	std::string headers;
+	std::string body;
+} http_response_t;
+
+// Function to connect to a local port, false if nobody accepts within timeout_ms
+bool http_connect(http_conn_t *conn, uint16_t port, int timeout_ms);
+void http_close(http_conn_t *conn);
+
+// Function to send a request without reading the response.
+// extra is added to the header block and must end with "\r\n" when not empty
+bool http_send(http_conn_t *conn, const char *method, const char *path, const char *extra = "");
+
+// Function to send a request and read the whole response (Content-Length or chunked)
+bool http_request(http_conn_t *conn, const char *method, const char *path, http_response_t *resp, const char *extra = "");
+bool http_get(http_conn_t *conn, const char *path, http_response_t *resp, const char *extra = "");
+
+// Function to get a header value of a response, empty if it is not there
+std::string http_header(const http_response_t *resp, const char *field);
+
+// Function to read the status line and headers of a response that has no length (MJPEG stream)
+bool http_read_head(http_conn_t *conn, http_response_t *resp);
+
+// Function to read the next part of a multipart/x-mixed-replace stream into jpeg, with its part headers
+bool http_read_part(http_conn_t *conn, std::string *headers, std::string *jpeg);
+
+// Function to read the next Server-Sent Event, its lines without the blank line that ends it
+bool http_read_event(http_conn_t *conn, std::string *event);
+
+// Function to upgrade the connection to a WebSocket on path
+bool ws_open(http_conn_t *conn, const char *path);
+
+// Function to send one masked binary frame
+bool ws_send_binary(http_conn_t *conn, const uint8_t *data, size_t len);
+
+// Function to read the next frame, its opcode goes to type
+bool ws_recv(http_conn_t *conn, std::vector<uint8_t> *payload, int *type);
@@ -0,0 +1,79 @@
+/* Load generator for the car web server
+ *
+ * Each endpoint in turn gets the given number of concurrent clients for
+ * the given time, then its request rate and latency percentiles are
+ * printed (see load.h for the endpoint kinds). Run it against host_httpd,
+ * or with -s against the firmware started in this process, to get a
+ * baseline of the handlers without flashing a board.
+ *
+ *   http_load [-s] [-p port] [-c clients] [-d seconds] [endpoint ...]
+ */
+#include "host.h"
+#include "load.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+void setup();
+
+static const char *default_endpoints[] = {"/", "/status", "/go", "/control?var=quality&val=10", "/metrics", "ws", "stream"};
+
+int main(int argc, char **argv)
+{
+	int port = 8080;
+	int clients = 4;
+	double seconds = 5;
+	bool serve = false;
+	int opt;
+	while ((opt = getopt(argc, argv, "sp:c:d:")) != -1)
+	{
+		switch (opt)
+		{
+		case 's':
+			serve = true;
+			break;
+		case 'p':
+			port = atoi(optarg);
+			break;
+		case 'c':
+			clients = atoi(optarg);
+			break;
+		case 'd':
+			seconds = atof(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-s] [-p port] [-c clients] [-d seconds] [/path | ws | stream ...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (port <= 80 || port > 65534 || clients < 1 || seconds <= 0)
+	{
+		fprintf(stderr, "%s: invalid port, client count or duration\n", argv[0]);
+		return 2;
+	}
+	// The firmware logs to stdout, the table goes to a copy of it taken before
+	FILE *out = fdopen(dup(1), "w");
+	if (serve)
+	{
+		host_httpd_set_port_offset(port - 80);
+		host_camera_set_moving(true); // Stream clients get every frame, not the repeats of a parked car
+		if (!out || !freopen("/dev/null", "w", stdout))
+		{
+			return 1;
+		}
+		setup();
+	}
+
+	const char **endpoints = optind < argc ? (const char **)&argv[optind] : default_endpoints;
+	int count = optind < argc ? argc - optind : sizeof(default_endpoints) / sizeof(default_endpoints[0]);
+	load_print_header(out);
+	uint32_t errors = 0;
+	for (int i = 0; i < count; i++)
+	{
+		load_result_t r = load_run(port, endpoints[i], clients, (int)(seconds * 1000));
+		load_print(out, &r);
+		fflush(out);
+		errors += r.errors;
+	}
+	return errors ? 1 : 0;
+}
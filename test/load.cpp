@@ -0,0 +1,185 @@
+#include "load.h"
+#include "http_client.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+
+#define LOAD_CONNECT_TIMEOUT_MS 2000
+#define LOAD_WS_DRIVE 0x10 // CONTROL_DRIVE of app_httpd.cpp: [0x10, throttle, steering, seq lo, seq hi]
+#define LOAD_WS_ACK 0xFF
+
+typedef std::chrono::steady_clock load_clock;
+
+// Structure for what one client measured
+typedef struct
+{
+	std::vector<uint32_t> samples_us;
+	uint32_t errors;
+} load_client_t;
+
+static uint32_t elapsed_us(load_clock::time_point since)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(load_clock::now() - since).count();
+}
+
+// Client doing GET requests on one keep-alive connection, reconnecting after a failure
+static void get_client(uint16_t port, const char *path, load_clock::time_point end, load_client_t *out)
+{
+	http_conn_t conn = {-1, ""};
+	while (load_clock::now() < end)
+	{
+		// A request on a new connection includes connecting: the server takes max_open_sockets
+		// clients, later ones wait in the listen backlog until a session is closed
+		load_clock::time_point start = load_clock::now();
+		if (conn.fd < 0 && !http_connect(&conn, port, LOAD_CONNECT_TIMEOUT_MS))
+		{
+			out->errors++;
+			continue;
+		}
+		http_response_t resp;
+		if (!http_get(&conn, path, &resp) || resp.status >= 400)
+		{
+			out->errors++;
+			http_close(&conn);
+			continue;
+		}
+		out->samples_us.push_back(elapsed_us(start));
+		// Handlers that answer from their own task (/capture) close the connection after the response
+		if (http_header(&resp, "Connection") == "close")
+		{
+			http_close(&conn);
+		}
+	}
+	http_close(&conn);
+}
+
+// Client sending joystick frames on the WebSocket, one at a time, each timed until its ack
+static void ws_client(uint16_t port, load_clock::time_point end, load_client_t *out)
+{
+	http_conn_t conn = {-1, ""};
+	uint16_t seq = 0;
+	while (load_clock::now() < end)
+	{
+		// Like for GET, the first frame includes connecting and the handshake
+		load_clock::time_point start = load_clock::now();
+		if (conn.fd < 0 && (!http_connect(&conn, port, LOAD_CONNECT_TIMEOUT_MS) || !ws_open(&conn, "/ws")))
+		{
+			out->errors++;
+			http_close(&conn);
+			continue;
+		}
+		seq++;
+		uint8_t frame[5] = {LOAD_WS_DRIVE, 0, 0, (uint8_t)seq, (uint8_t)(seq >> 8)};
+		std::vector<uint8_t> ack;
+		int type;
+		if (!ws_send_binary(&conn, frame, sizeof(frame)) || !ws_recv(&conn, &ack, &type) || ack.size() != 4 ||
+			ack[0] != LOAD_WS_ACK || ack[1] != 0 || (ack[2] | ack[3] << 8) != seq)
+		{
+			out->errors++;
+			http_close(&conn);
+			continue;
+		}
+		out->samples_us.push_back(elapsed_us(start));
+	}
+	http_close(&conn);
+}
+
+// Client watching the MJPEG stream, timing the gap between frames
+static void stream_client(uint16_t port, load_clock::time_point end, load_client_t *out)
+{
+	http_conn_t conn = {-1, ""};
+	while (load_clock::now() < end)
+	{
+		http_response_t resp;
+		if (!http_connect(&conn, port, LOAD_CONNECT_TIMEOUT_MS) || !http_send(&conn, "GET", "/stream") ||
+			!http_read_head(&conn, &resp) || resp.status != 200)
+		{
+			out->errors++;
+			http_close(&conn);
+			std::this_thread::sleep_for(std::chrono::milliseconds(100)); // All viewer slots taken
+			continue;
+		}
+		std::string headers, jpeg;
+		bool first = true;
+		load_clock::time_point last = load_clock::now();
+		while (load_clock::now() < end)
+		{
+			if (!http_read_part(&conn, &headers, &jpeg) || jpeg.size() < 2 || (uint8_t)jpeg[0] != 0xFF || (uint8_t)jpeg[1] != 0xD8)
+			{
+				out->errors++;
+				break;
+			}
+			// The first frame measures the stream start, not the frame rate
+			if (!first)
+			{
+				out->samples_us.push_back(elapsed_us(last));
+			}
+			first = false;
+			last = load_clock::now();
+		}
+		http_close(&conn);
+	}
+}
+
+load_result_t load_run(uint16_t port, const char *endpoint, int clients, int duration_ms)
+{
+	std::vector<load_client_t> results(clients);
+	std::vector<std::thread> threads;
+	load_clock::time_point start = load_clock::now();
+	load_clock::time_point end = start + std::chrono::milliseconds(duration_ms);
+	for (int i = 0; i < clients; i++)
+	{
+		load_client_t *out = &results[i];
+		out->errors = 0;
+		if (!strcmp(endpoint, "ws"))
+		{
+			threads.emplace_back(ws_client, port, end, out);
+		}
+		else if (!strcmp(endpoint, "stream"))
+		{
+			threads.emplace_back(stream_client, port + 1, end, out);
+		}
+		else
+		{
+			threads.emplace_back(get_client, port, endpoint, end, out);
+		}
+	}
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	load_result_t r;
+	r.endpoint = endpoint;
+	r.clients = clients;
+	r.errors = 0;
+	r.seconds = elapsed_us(start) / 1e6;
+	std::vector<uint32_t> samples;
+	for (const load_client_t &c : results)
+	{
+		samples.insert(samples.end(), c.samples_us.begin(), c.samples_us.end());
+		r.errors += c.errors;
+	}
+	std::sort(samples.begin(), samples.end());
+	r.requests = samples.size();
+	r.rate = r.requests / r.seconds;
+	// Nearest-rank percentiles
+	r.p50_us = samples.empty() ? 0 : samples[(samples.size() * 50 + 99) / 100 - 1];
+	r.p99_us = samples.empty() ? 0 : samples[(samples.size() * 99 + 99) / 100 - 1];
+	r.max_us = samples.empty() ? 0 : samples.back();
+	return r;
+}
+
+void load_print_header(FILE *out)
+{
+	fprintf(out, "%-32s %7s %9s %7s %9s %8s %8s %8s\n", "endpoint", "clients", "requests", "errors", "req/s", "p50 ms", "p99 ms", "max ms");
+}
+
+void load_print(FILE *out, const load_result_t *r)
+{
+	fprintf(out, "%-32s %7d %9u %7u %9.1f %8.2f %8.2f %8.2f\n", r->endpoint.c_str(), r->clients, (unsigned)r->requests, (unsigned)r->errors,
+			r->rate, r->p50_us / 1000.0, r->p99_us / 1000.0, r->max_us / 1000.0);
+}
@@ -0,0 +1,32 @@
+/* Concurrent load on one endpoint of the host web server
+ *
+ * An endpoint is "/path" (GET on the control server over keep-alive
+ * connections), "ws" (drive frames on /ws, each timed until its ack) or
+ * "stream" (/stream on port + 1, timed between consecutive frames).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+// Structure for the outcome of one run
+typedef struct
+{
+	std::string endpoint;
+	int clients;
+	uint32_t requests; // Responses, acks or frames
+	uint32_t errors;   // Failed connections, error statuses and broken responses
+	double seconds;
+	double rate; // Requests per second over all clients
+	uint32_t p50_us;
+	uint32_t p99_us;
+	uint32_t max_us;
+} load_result_t;
+
+// Function to run clients concurrent clients against endpoint for duration_ms
+load_result_t load_run(uint16_t port, const char *endpoint, int clients, int duration_ms);
+
+// Function to print the column titles and one result line
+void load_print_header(FILE *out);
+void load_print(FILE *out, const load_result_t *result);
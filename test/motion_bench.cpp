@@ -0,0 +1,310 @@
+/* Replay benchmark of the change detection
+ *
+ * Sequences of 1/8 scale grayscale thumbnails, what the capture task decodes
+ * from each frame, go through motion.cpp with the scene rule of the capture
+ * task and the keep-alive of the stream clients. For each sequence the
+ * frames and bytes a stream client is sent are printed against sending every
+ * frame, with the CPU time of the signature and comparison per frame. The
+ * 1/8 scale decode itself only runs on the board, /metrics times it there.
+ *
+ * Without arguments three 30 s sequences of a VGA stream are generated: a
+ * parked car (sensor noise, exposure slowly drifting), a parked car that
+ * someone walks past, and a driving car. Files given as arguments hold
+ * concatenated binary PGM frames, as made from a recording with
+ *   ffmpeg -i rec.avi -vf scale=iw/8:ih/8,format=gray -f image2pipe -c:v pgm seq.pgm
+ *
+ *   motion_bench [-f fps] [-q quality] [-t threshold] [sequence.pgm ...]
+ */
+#include "motion.h"
+#include "check.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#define STREAM_KEEPALIVE_MS 1000 // As in app_httpd.cpp
+#define MOTION_THRESHOLD 3		 // FRAME_RING_MOTION_THRESHOLD
+#define SEQUENCE_SECONDS 30
+#define THUMB_W 80 // VGA at 1/8 scale
+#define THUMB_H 60
+
+// Structure for one sequence of thumbnails to replay
+typedef struct
+{
+	std::string name;
+	size_t w;
+	size_t h;
+	std::vector<uint8_t> pixels;  // Frames one after the other
+	std::vector<bool> changed;	  // Frames where something really moved, empty for files
+} sequence_t;
+
+// Structure for what a stream client gets from one sequence
+typedef struct
+{
+	uint32_t frames;
+	uint32_t sent;
+	uint32_t scenes;
+	uint32_t moved;	 // Frames that really changed
+	uint32_t missed; // Of those, frames that neither started a scene nor came within 2 frames after one
+	double ns_per_frame;
+} replay_result_t;
+
+static uint32_t rand_state = 1;
+
+static uint32_t random_below(uint32_t n)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 8) % n;
+}
+
+static size_t frame_count(const sequence_t *seq)
+{
+	return seq->pixels.size() / (seq->w * seq->h);
+}
+
+// Function to get the brightness of a textured floor and wall at a point, x may run past the image
+static int texture(int x, int y)
+{
+	return 110 + 50 * sin(x * 0.21) * cos(y * 0.17) + 30 * sin((x + 2 * y) * 0.07);
+}
+
+// Function to generate a sequence of fps frames a second: parked, passerby or driving
+static sequence_t generate_sequence(const char *kind, int fps)
+{
+	sequence_t seq;
+	seq.name = kind;
+	seq.w = THUMB_W;
+	seq.h = THUMB_H;
+	rand_state = 1;
+	int frames = SEQUENCE_SECONDS * fps;
+	for (int f = 0; f < frames; f++)
+	{
+		double t = (double)f / fps;
+		double exposure = 4 * sin(t * 0.3); // Auto exposure hunting a little
+		int shift = 0;
+		bool changed = false;
+		int walker_x = -100;
+		if (!strcmp(kind, "driving"))
+		{
+			shift = (int)(t * 40); // 40 thumbnail pixels a second, about 1 m/s
+			changed = true;
+		}
+		else if (!strcmp(kind, "passerby") && t >= 10 && t < 14)
+		{
+			walker_x = (int)((t - 10) * (THUMB_W + 12) / 4) - 12; // Crosses the image in 4 s
+			changed = walker_x > -12 && walker_x < THUMB_W;
+		}
+		seq.changed.push_back(changed);
+		for (size_t y = 0; y < seq.h; y++)
+		{
+			for (size_t x = 0; x < seq.w; x++)
+			{
+				int v = texture(x + shift, y) + exposure + (int)random_below(9) - 4;
+				if ((int)x >= walker_x && (int)x < walker_x + 12 && y >= 15)
+				{
+					v = 35 + (int)random_below(9) - 4;
+				}
+				seq.pixels.push_back(v < 0 ? 0 : v > 255 ? 255 : v);
+			}
+		}
+	}
+	return seq;
+}
+
+// Function to read the next PGM header field, skipping comments
+static bool pgm_field(FILE *f, size_t *value)
+{
+	int c = fgetc(f);
+	while (c == '#' || isspace(c))
+	{
+		if (c == '#')
+		{
+			while (c != '\n' && c != EOF)
+			{
+				c = fgetc(f);
+			}
+		}
+		c = fgetc(f);
+	}
+	if (!isdigit(c))
+	{
+		return false;
+	}
+	*value = 0;
+	for (; isdigit(c); c = fgetc(f))
+	{
+		*value = *value * 10 + c - '0';
+	}
+	return true; // The single whitespace after the field is consumed
+}
+
+static bool read_sequence(const char *path, sequence_t *seq)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f)
+	{
+		return false;
+	}
+	seq->name = path;
+	seq->w = seq->h = 0;
+	char magic[2];
+	size_t w, h, maxval;
+	while (fread(magic, 1, 2, f) == 2)
+	{
+		if (memcmp(magic, "P5", 2) || !pgm_field(f, &w) || !pgm_field(f, &h) || !pgm_field(f, &maxval) || maxval > 255 ||
+			(seq->w && (w != seq->w || h != seq->h)))
+		{
+			break;
+		}
+		seq->w = w;
+		seq->h = h;
+		size_t at = seq->pixels.size();
+		seq->pixels.resize(at + w * h);
+		if (fread(&seq->pixels[at], 1, w * h, f) != w * h)
+		{
+			seq->pixels.resize(at);
+			break;
+		}
+		while (isspace(fgetc(f)))
+		{
+		}
+		fseek(f, -1, SEEK_CUR);
+	}
+	fclose(f);
+	return frame_count(seq) > 0;
+}
+
+// Function to replay a sequence at fps: scenes as the capture task starts them, frames as a stream client sends them
+static replay_result_t replay(const sequence_t *seq, int fps, int threshold)
+{
+	replay_result_t r;
+	memset(&r, 0, sizeof(r));
+	motion_signature_t scene_start, frame_sig;
+	scene_start.valid = false;
+	uint32_t scene = 0, last_scene = 0;
+	int64_t last_sent = 0;
+	int since_scene = 0;
+	std::chrono::nanoseconds cpu(0);
+	r.frames = frame_count(seq);
+	for (uint32_t f = 0; f < r.frames; f++)
+	{
+		int64_t now_ms = (int64_t)f * 1000 / fps + 1;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		motion_signature(&seq->pixels[f * seq->w * seq->h], seq->w, seq->h, &frame_sig);
+		int motion = motion_compare(&frame_sig, &scene_start);
+		cpu += std::chrono::steady_clock::now() - start;
+		if (motion >= threshold)
+		{
+			scene++;
+			scene_start = frame_sig;
+			since_scene = 0;
+		}
+		else
+		{
+			since_scene++;
+		}
+		if (scene != last_scene || now_ms - last_sent >= STREAM_KEEPALIVE_MS)
+		{
+			last_scene = scene;
+			last_sent = now_ms;
+			r.sent++;
+		}
+		if (!seq->changed.empty() && seq->changed[f])
+		{
+			r.moved++;
+			r.missed += since_scene > 2;
+		}
+	}
+	r.scenes = scene;
+	r.ns_per_frame = (double)cpu.count() / r.frames;
+	return r;
+}
+
+int main(int argc, char **argv)
+{
+	int fps = 25;
+	int quality = 10;
+	int threshold = MOTION_THRESHOLD;
+	int opt;
+	while ((opt = getopt(argc, argv, "f:q:t:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'f':
+			fps = atoi(optarg);
+			break;
+		case 'q':
+			quality = atoi(optarg);
+			break;
+		case 't':
+			threshold = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-f fps] [-q quality] [-t threshold] [sequence.pgm ...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (fps <= 0 || threshold <= 0)
+	{
+		fprintf(stderr, "fps and threshold must be positive\n");
+		return 2;
+	}
+
+	std::vector<sequence_t> sequences;
+	for (int i = optind; i < argc; i++)
+	{
+		sequence_t seq;
+		if (!read_sequence(argv[i], &seq))
+		{
+			fprintf(stderr, "cannot read %s\n", argv[i]);
+			return 1;
+		}
+		sequences.push_back(seq);
+	}
+	bool generated = sequences.empty();
+	if (generated)
+	{
+		for (const char *kind : {"parked", "passerby", "driving"})
+		{
+			sequences.push_back(generate_sequence(kind, fps));
+		}
+	}
+
+	printf("%-12s %7s %7s %7s %9s %9s %7s %8s %8s\n", "sequence", "frames", "scenes", "sent", "KB/s all", "KB/s sent", "saved",
+		   "missed", "ns/frame");
+	for (const sequence_t &seq : sequences)
+	{
+		replay_result_t r = replay(&seq, fps, threshold);
+		// JPEG size of the full frame at this quality, as the camera makes it (see the esp_camera shim)
+		double frame_kb = seq.w * 8 * seq.h * 8 * 12 / (10.0 * (quality + 2)) / 1024;
+		double seconds = (double)r.frames / fps;
+		printf("%-12s %7u %7u %7u %9.0f %9.0f %6.1f%% %8u %8.0f\n", seq.name.c_str(), r.frames, r.scenes, r.sent,
+			   r.frames * frame_kb / seconds, r.sent * frame_kb / seconds, 100.0 * (r.frames - r.sent) / r.frames, r.missed,
+			   r.ns_per_frame);
+		if (!generated)
+		{
+			continue;
+		}
+		CHECK_EQ(r.missed, 0);
+		if (seq.name == "parked")
+		{
+			// Only the keep-alive and the odd exposure step get through
+			CHECK(r.sent <= SEQUENCE_SECONDS * 3 / 2);
+		}
+		else if (seq.name == "passerby")
+		{
+			CHECK(r.moved > 0);
+			CHECK(r.sent < r.frames / 4);
+		}
+		else
+		{
+			// Frames that moved less than the threshold since the last one sent may go, but no more than 2 in a row
+			CHECK(r.sent >= r.frames / 3);
+		}
+	}
+	return generated ? check_result("motion_bench") : 0;
+}
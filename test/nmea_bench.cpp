@@ -0,0 +1,320 @@
+/* Replay benchmark of the NMEA parsers
+ *
+ * Each log is fed byte by byte through nmea.cpp and through the stand-in for
+ * TinyGPSPlus it replaced (tinygps.h), and for each the throughput, the fixes
+ * decoded and the sentences turned away are printed. Without arguments three
+ * logs of a 10 Hz module are generated: clean, noisy (flipped bits, bits
+ * flipped in pairs that the XOR checksum cannot see, bursts of line noise)
+ * and truncated (sentences cut short, as when the UART buffer overflows).
+ * Their true positions are known, so fixes that do not match them are
+ * counted as wrong. Log files given as arguments are replayed as they are.
+ *
+ *   nmea_bench [-m megabytes] [log ...]
+ */
+#include "nmea.h"
+#include "tinygps.h"
+#include "check.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#define EPOCH_CS 10 // 10 Hz updates, in hundredths of a second
+
+// Structure for the true position of one update
+typedef struct
+{
+	int32_t lat_e7;
+	int32_t lon_e7;
+} truth_t;
+
+// Structure for one log to replay
+typedef struct
+{
+	std::string name;
+	std::string bytes;
+	std::vector<truth_t> truth; // By update number, empty for log files
+	uint32_t updates;
+} nmea_log_t;
+
+// Structure for what one parser made of one log
+typedef struct
+{
+	double seconds;
+	uint32_t fixes;	   // Updates with a position, one per UTC time
+	uint32_t wrong;	   // Fixes that do not match the true position of their time
+	uint32_t passed;   // Sentences with a valid checksum
+	uint32_t rejected; // Checksum failures and malformed sentences
+} replay_result_t;
+
+static uint32_t rand_state = 1;
+
+static uint32_t random_below(uint32_t n)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 8) % n;
+}
+
+// Function to wrap a body in '$' and its checksum
+static std::string sentence(const char *body)
+{
+	uint8_t sum = 0;
+	for (const char *p = body; *p; p++)
+	{
+		sum ^= *p;
+	}
+	char line[128];
+	snprintf(line, sizeof(line), "$%s*%02X\r\n", body, sum);
+	return line;
+}
+
+// Function to write a coordinate as dddmm.mmmmm from 1e-5 minutes
+static void format_coordinate(char *out, size_t len, int degree_digits, uint32_t minutes_e5)
+{
+	snprintf(out, len, "%0*u%02u.%05u", degree_digits, minutes_e5 / 6000000, minutes_e5 / 100000 % 60, minutes_e5 % 100000);
+}
+
+static int32_t minutes_e5_to_e7(uint32_t minutes_e5)
+{
+	return (int32_t)lround(minutes_e5 / 6.0 * 1e2 / 10);
+}
+
+// Function to damage one sentence the way the kind of log asks for
+static void damage(std::string *line, const char *kind)
+{
+	if (!strcmp(kind, "noisy"))
+	{
+		uint32_t roll = random_below(1000);
+		if (roll < 20)
+		{
+			(*line)[random_below(line->size())] ^= 1 << random_below(7);
+		}
+		else if (roll < 22)
+		{
+			// The same bit flipped in two characters of the body leaves the checksum as it was
+			size_t star = line->find('*');
+			uint8_t bit = 1 << random_below(7);
+			(*line)[1 + random_below(star - 1)] ^= bit;
+			(*line)[1 + random_below(star - 1)] ^= bit;
+		}
+		else if (roll < 27)
+		{
+			for (uint32_t i = random_below(8) + 1; i > 0; i--)
+			{
+				*line += (char)random_below(256);
+			}
+		}
+	}
+	else if (!strcmp(kind, "truncated") && random_below(100) < 5)
+	{
+		line->resize(1 + random_below(line->size() - 1));
+	}
+}
+
+// Function to generate about megabytes of the output of a moving 10 Hz module
+static nmea_log_t generate_log(const char *kind, size_t megabytes)
+{
+	nmea_log_t log;
+	log.name = kind;
+	uint32_t lat = 10 * 6000000 + 47 * 100000 + 38600, lon = 106 * 6000000 + 37 * 100000 + 78600;
+	rand_state = 1;
+	for (uint32_t update = 0; log.bytes.size() < megabytes << 20; update++)
+	{
+		lat += random_below(41) - 20;
+		lon += random_below(41) - 20;
+		log.truth.push_back({minutes_e5_to_e7(lat), minutes_e5_to_e7(lon)});
+		uint32_t cs = update * EPOCH_CS;
+		char time[16], lat_text[16], lon_text[16], body[100];
+		snprintf(time, sizeof(time), "%02u%02u%02u.%02u", cs / 360000 % 24, cs / 6000 % 60, cs / 100 % 60, cs % 100);
+		format_coordinate(lat_text, sizeof(lat_text), 2, lat);
+		format_coordinate(lon_text, sizeof(lon_text), 3, lon);
+
+		std::vector<std::string> lines;
+		snprintf(body, sizeof(body), "GNGGA,%s,%s,N,%s,E,1,09,1.02,12.3,M,2.4,M,,", time, lat_text, lon_text);
+		lines.push_back(sentence(body));
+		lines.push_back(sentence("GNGSA,A,3,05,13,15,18,20,,,,,,,,1.80,1.02,1.48,1"));
+		lines.push_back(sentence("GPGSV,3,1,10,05,52,061,34,13,38,173,30,15,61,210,36,18,22,319,28,0"));
+		lines.push_back(sentence("GPGSV,3,2,10,20,45,118,33,23,08,041,,24,14,279,19,26,03,198,,0"));
+		lines.push_back(sentence("GPGSV,3,3,10,29,11,090,22,30,05,330,,0"));
+		snprintf(body, sizeof(body), "GNRMC,%s,A,%s,N,%s,E,0.52,84.31,171026,,,A,V", time, lat_text, lon_text);
+		lines.push_back(sentence(body));
+		lines.push_back(sentence("GNVTG,84.31,T,,M,0.52,N,0.96,K,A"));
+		for (std::string &line : lines)
+		{
+			damage(&line, kind);
+			log.bytes += line;
+		}
+	}
+	log.updates = log.truth.size();
+	return log;
+}
+
+static bool read_log(const char *path, nmea_log_t *log)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f)
+	{
+		return false;
+	}
+	log->name = path;
+	char buf[65536];
+	size_t n;
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+	{
+		log->bytes.append(buf, n);
+	}
+	fclose(f);
+	log->updates = 0;
+	return true;
+}
+
+// Function to check a fix against the true position of the update at its UTC time hhmmsscc
+static bool fix_wrong(const nmea_log_t *log, uint32_t time, int32_t lat_e7, int32_t lon_e7)
+{
+	if (log->truth.empty())
+	{
+		return false;
+	}
+	uint32_t cs = time / 1000000 * 360000 + time / 10000 % 100 * 6000 + time % 10000;
+	uint32_t update = cs / EPOCH_CS;
+	if (cs % EPOCH_CS || update >= log->truth.size())
+	{
+		return true;
+	}
+	const truth_t *t = &log->truth[update];
+	return abs(lat_e7 - t->lat_e7) > 1 || abs(lon_e7 - t->lon_e7) > 1;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static replay_result_t replay_nmea(const nmea_log_t *log)
+{
+	replay_result_t r = {0, 0, 0, 0, 0};
+	nmea_parser_t parser;
+	nmea_parser_init(&parser);
+	uint32_t fixes = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (char c : log->bytes)
+	{
+		nmea_parser_feed(&parser, c);
+		if (parser.fixes != fixes)
+		{
+			fixes = parser.fixes;
+			r.wrong += fix_wrong(log, parser.fix.time, parser.fix.lat_e7, parser.fix.lon_e7);
+		}
+	}
+	r.seconds = seconds_since(start);
+	r.fixes = parser.fixes;
+	r.passed = parser.passed;
+	r.rejected = parser.failed + parser.rejected;
+	return r;
+}
+
+static replay_result_t replay_tinygps(const nmea_log_t *log)
+{
+	replay_result_t r = {0, 0, 0, 0, 0};
+	TinyGPSPlus gps;
+	uint32_t last_time = UINT32_MAX;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (char c : log->bytes)
+	{
+		// GGA and RMC each update the location, an update counts once per UTC time as for nmea.cpp
+		if (gps.encode(c) && gps.location.isUpdated())
+		{
+			double lat = gps.location.lat(), lon = gps.location.lng();
+			uint32_t time = gps.time.value();
+			if (time != last_time)
+			{
+				last_time = time;
+				r.fixes++;
+				r.wrong += fix_wrong(log, time, (int32_t)lround(lat * 1e7), (int32_t)lround(lon * 1e7));
+			}
+		}
+	}
+	r.seconds = seconds_since(start);
+	r.passed = gps.passedChecksum();
+	r.rejected = gps.failedChecksum();
+	return r;
+}
+
+static void print_result(const nmea_log_t *log, const char *parser, const replay_result_t *r)
+{
+	printf("%-12s %-10s %8.1f %12.0f %9u %9u %9u %7u\n", log->name.c_str(), parser, log->bytes.size() / r->seconds / 1e6,
+		   r->fixes / r->seconds, r->fixes, r->passed, r->rejected, r->wrong);
+}
+
+int main(int argc, char **argv)
+{
+	size_t megabytes = 16;
+	int opt;
+	while ((opt = getopt(argc, argv, "m:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'm':
+			megabytes = atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-m megabytes] [log ...]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	std::vector<nmea_log_t> logs;
+	for (int i = optind; i < argc; i++)
+	{
+		nmea_log_t log;
+		if (!read_log(argv[i], &log))
+		{
+			fprintf(stderr, "cannot read %s\n", argv[i]);
+			return 1;
+		}
+		logs.push_back(log);
+	}
+	bool generated = logs.empty();
+	if (generated)
+	{
+		for (const char *kind : {"clean", "noisy", "truncated"})
+		{
+			logs.push_back(generate_log(kind, megabytes));
+		}
+	}
+
+	printf("%-12s %-10s %8s %12s %9s %9s %9s %7s\n", "log", "parser", "MB/s", "fixes/s", "fixes", "passed", "rejected", "wrong");
+	for (const nmea_log_t &log : logs)
+	{
+		replay_result_t ours = replay_nmea(&log);
+		replay_result_t theirs = replay_tinygps(&log);
+		print_result(&log, "nmea", &ours);
+		print_result(&log, "tinygps", &theirs);
+		if (!generated)
+		{
+			continue;
+		}
+		// A damaged sentence may cost its update but never gives a wrong position, unless its
+		// characters are still valid where they landed and the checksum could not see the damage
+		if (log.name == "clean")
+		{
+			CHECK_EQ(ours.fixes, log.updates);
+			CHECK_EQ(theirs.fixes, log.updates);
+			CHECK_EQ(ours.rejected, 0);
+		}
+		else
+		{
+			CHECK(ours.rejected > 0);
+		}
+		CHECK(ours.wrong <= theirs.wrong);
+		if (log.name != "noisy")
+		{
+			CHECK_EQ(ours.wrong, 0);
+		}
+	}
+	return generated ? check_result("nmea_bench") : 0;
+}
@@ -0,0 +1,267 @@
+/* Sustained-write benchmark of the recorder
+ *
+ * The grabber and writer tasks of recorder.cpp record a stand-in camera
+ * stream into real files below RECORD_ROOT for a while on each of a few
+ * simulated cards: the card takes the bytes at its write speed and now and
+ * then stops for a while, as cards do when they erase a block. For each
+ * card the bytes written per second, the frames recorded and dropped, the
+ * time to write one frame and the longest a ring slot was held by the
+ * grabber are printed, along with the frames the camera could not publish
+ * because every slot was held (what a stalled recording would cost the
+ * live stream). Each file is checked against the counters and deleted.
+ *
+ *   recorder_bench [-d seconds] [-f fps] [-k frame kilobytes]
+ */
+// The headers of recorder.cpp come first, <cstdio> would drop the fwrite macro again
+#include "recorder.h"
+#include "frame_ring.h"
+#include "gps.h"
+#include "exif.h"
+#include "esp_timer.h"
+#include "Arduino.h"
+#include "SD_MMC.h"
+#include <stdio.h>
+
+static size_t card_fwrite(const void *data, size_t size, size_t count, FILE *f);
+
+// Every write of the recorder goes through the simulated card
+#define fwrite card_fwrite
+#include "../recorder.cpp"
+#undef fwrite
+
+#include "check.h"
+#include "host.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Structure for a simulated card
+typedef struct
+{
+	const char *name;
+	uint32_t bytes_per_s; // Sustained write speed
+	uint32_t stall_every; // Bytes between two stalls, 0 for none
+	uint32_t stall_ms;	  // Length of a stall
+} card_model_t;
+
+static const card_model_t cards[] = {
+	{"fast", 1500 * 1024, 0, 0},
+	{"stalling", 1500 * 1024, 1024 * 1024, 400},
+	{"slow", 400 * 1024, 0, 0},
+};
+
+static const card_model_t *card = NULL;
+static std::chrono::steady_clock::time_point card_busy; // When the card is done with the bytes so far
+static uint32_t card_since_stall = 0;
+
+static size_t card_fwrite(const void *data, size_t size, size_t count, FILE *f)
+{
+	size_t written = fwrite(data, size, count, f);
+	size_t bytes = written * size;
+	card_busy = std::max(card_busy, std::chrono::steady_clock::now()) + std::chrono::microseconds(bytes * 1000000ULL / card->bytes_per_s);
+	card_since_stall += bytes;
+	if (card->stall_every && card_since_stall >= card->stall_every)
+	{
+		card_since_stall = 0;
+		card_busy += std::chrono::milliseconds(card->stall_ms);
+	}
+	std::this_thread::sleep_until(card_busy);
+	return written;
+}
+
+// A stand-in for the frame ring: the camera publishes into FRAME_RING_SLOTS slots, the grabber is the only client
+static shared_frame_t ring[FRAME_RING_SLOTS];
+static std::mutex ring_mutex;
+static std::condition_variable ring_cv;
+static shared_frame_t *ring_latest = NULL;
+static uint32_t ring_seq = 0;
+static uint32_t ring_blocked = 0; // Frames the camera could not publish, every slot was held
+static std::chrono::steady_clock::time_point held_since[FRAME_RING_SLOTS];
+static std::chrono::microseconds longest_hold(0);
+
+void frame_ring_subscribe() {}
+void frame_ring_unsubscribe() {}
+
+shared_frame_t *frame_ring_acquire(uint32_t last_seq, TickType_t wait)
+{
+	std::unique_lock<std::mutex> lock(ring_mutex);
+	if (!ring_cv.wait_for(lock, std::chrono::milliseconds(wait), [last_seq] { return ring_latest && ring_latest->seq > last_seq; }))
+	{
+		return NULL;
+	}
+	ring_latest->refs++;
+	held_since[ring_latest - ring] = std::chrono::steady_clock::now();
+	return ring_latest;
+}
+
+void frame_ring_release(shared_frame_t *frame)
+{
+	std::lock_guard<std::mutex> lock(ring_mutex);
+	frame->refs--;
+	std::chrono::microseconds held =
+		std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - held_since[frame - ring]);
+	longest_hold = std::max(longest_hold, held);
+}
+
+// A 10 Hz GPS, so every frame gets its EXIF segment
+uint32_t gps_get_fix(gps_fix_t *fix)
+{
+	memset(fix, 0, sizeof(*fix));
+	fix->version = millis() / 100 + 1;
+	fix->fix_ms = millis();
+	fix->date = 171026;
+	fix->time = 12000000 + fix->version % 6000;
+	fix->lat_e7 = GPS_DEFAULT_LAT_E7 + fix->version;
+	fix->lon_e7 = GPS_DEFAULT_LON_E7;
+	fix->speed_cms = 100;
+	fix->course_cdeg = 9000;
+	fix->hdop_c = 90;
+	fix->sats = 9;
+	return fix->version;
+}
+
+// Function to run the camera at fps for the given time, frames of about frame_len bytes
+static uint32_t run_camera(int fps, size_t frame_len, double seconds)
+{
+	uint32_t published = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point next = start;
+	while (next - start < std::chrono::duration<double>(seconds))
+	{
+		std::this_thread::sleep_until(next);
+		next += std::chrono::microseconds(1000000 / fps);
+		std::lock_guard<std::mutex> lock(ring_mutex);
+		shared_frame_t *slot = NULL;
+		for (int i = 0; i < FRAME_RING_SLOTS && !slot; i++)
+		{
+			if (&ring[i] != ring_latest && ring[i].refs == 0)
+			{
+				slot = &ring[i];
+			}
+		}
+		if (!slot)
+		{
+			ring_blocked++;
+			continue;
+		}
+		size_t len = frame_len - frame_len / 5 + published * 7919 % (frame_len * 2 / 5); // Busier and calmer scenes
+		if (slot->cap < len)
+		{
+			slot->buf = (uint8_t *)realloc(slot->buf, len);
+			slot->cap = len;
+		}
+		slot->len = host_fake_jpeg(slot->buf, len, 640, 480, 128);
+		slot->width = 640;
+		slot->height = 480;
+		gettimeofday(&slot->timestamp, NULL);
+		slot->seq = ++ring_seq;
+		ring_latest = slot;
+		published++;
+		ring_cv.notify_all();
+	}
+	return published;
+}
+
+static long file_size(const char *path)
+{
+	struct stat st;
+	return stat(path, &st) == 0 ? st.st_size : -1;
+}
+
+// Function to record for the given time on one card and check the file it left
+static void bench_card(const card_model_t *model, int fps, size_t frame_len, double seconds)
+{
+	card = model;
+	card_busy = std::chrono::steady_clock::now();
+	card_since_stall = 0;
+	ring_blocked = 0;
+	longest_hold = std::chrono::microseconds(0);
+	memset(&stats.write, 0, sizeof(stats.write));
+	uint32_t frames = stats.frames, dropped = stats.dropped, errors = stats.errors, files = stats.files;
+	uint64_t bytes = stats.bytes;
+
+	CHECK(recorder_record(true));
+	uint32_t published = run_camera(fps, frame_len, seconds);
+	CHECK(recorder_record(false));
+	// The writer finishes the queued frames, then closes the file
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	while ((uxQueueMessagesWaiting(full_q) > 0 || file.avi) && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+	{
+		vTaskDelay(pdMS_TO_TICKS(10));
+	}
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() + seconds;
+
+	frames = stats.frames - frames;
+	dropped = stats.dropped - dropped;
+	bytes = stats.bytes - bytes;
+	printf("%-10s %8.0f %9.0f %9u %8u %8u %7u %7u %9lld %8u\n", model->name, model->bytes_per_s / 1024.0, bytes / elapsed / 1024,
+		   published, frames, dropped, latency_hist_percentile(&stats.write, 50), latency_hist_percentile(&stats.write, 99),
+		   (long long)longest_hold.count(), ring_blocked);
+
+	CHECK_EQ(stats.errors, errors);
+	CHECK_EQ(stats.files, files + 1);
+	CHECK_EQ(frames + dropped, published);
+	CHECK_EQ(file_size(stats.path), (long)(AVI_HEADER_SIZE + bytes + 8 + frames * 16));
+	char idx_path[sizeof(stats.path)];
+	strcpy(idx_path, stats.path);
+	strcpy(&idx_path[strlen(idx_path) - 3], "idx");
+	CHECK_EQ(file_size(idx_path), (long)(8 + frames * sizeof(record_index_t)));
+	remove(stats.path);
+	remove(idx_path);
+
+	// However slow the card, the grabber lets go of each slot at once and the camera keeps publishing
+	CHECK_EQ(ring_blocked, 0);
+	CHECK(longest_hold < std::chrono::milliseconds(20));
+	if (model->bytes_per_s > fps * frame_len * 2 && !model->stall_every)
+	{
+		CHECK_EQ(dropped, 0);
+	}
+	if (model->bytes_per_s < fps * frame_len)
+	{
+		// A card slower than the stream records what it can write
+		CHECK(bytes / elapsed > model->bytes_per_s * 0.8);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	double seconds = 5;
+	int fps = 20;
+	size_t frame_len = 30 * 1024; // VGA at quality 10
+	int opt;
+	while ((opt = getopt(argc, argv, "d:f:k:")) != -1)
+	{
+		switch (opt)
+		{
+		case 'd':
+			seconds = atof(optarg);
+			break;
+		case 'f':
+			fps = atoi(optarg);
+			break;
+		case 'k':
+			frame_len = atoi(optarg) * 1024;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-d seconds] [-f fps] [-k frame kilobytes]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (seconds <= 0 || fps <= 0 || frame_len < 1024)
+	{
+		fprintf(stderr, "seconds and fps must be positive, frames at least 1 KB\n");
+		return 2;
+	}
+
+	mkdir(RECORD_ROOT, 0755);
+	CHECK(recorder_start());
+	printf("%d fps, %u KB frames, %.0f KB/s stream\n", fps, (unsigned)(frame_len / 1024), fps * frame_len / 1024.0);
+	printf("%-10s %8s %9s %9s %8s %8s %7s %7s %9s %8s\n", "card", "KB/s", "written", "captured", "frames", "dropped",
+		   "p50 ms", "p99 ms", "hold us", "blocked");
+	for (const card_model_t &model : cards)
+	{
+		bench_card(&model, fps, frame_len, seconds);
+	}
+	return check_result("recorder_bench");
+}
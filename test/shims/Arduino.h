@@ -0,0 +1,176 @@
+/* Host shim of the parts of Arduino-ESP32 the car firmware uses
+ *
+ * Serial prints to stdout, there is no PSRAM, and millis() follows the
+ * host clock of esp_timer.h (tests can move it forward with host.h).
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+using std::max;
+using std::min;
+
+#define PI 3.1415926535897932384626433832795
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define SERIAL_8N1 0x800001c
+
+typedef uint8_t byte;
+
+template <class T, class L, class H>
+static inline T constrain(T value, L low, H high)
+{
+	return value < low ? low : (value > high ? high : value);
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+bool psramFound();
+void *ps_malloc(size_t size);
+void *ps_calloc(size_t count, size_t size);
+void *ps_realloc(void *ptr, size_t size);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+// Minimal Arduino String on top of std::string
+class String
+{
+public:
+	String() {}
+	String(const char *text) : s(text ? text : "") {}
+	String(const std::string &text) : s(text) {}
+	String(int value) : s(std::to_string(value)) {}
+	String(unsigned value) : s(std::to_string(value)) {}
+	String(long value) : s(std::to_string(value)) {}
+	String(unsigned long value) : s(std::to_string(value)) {}
+	String(double value, unsigned digits = 2)
+	{
+		char buf[32];
+		snprintf(buf, sizeof(buf), "%.*f", digits, value);
+		s = buf;
+	}
+	String &operator+=(const String &other)
+	{
+		s += other.s;
+		return *this;
+	}
+	String &operator+=(const char *other)
+	{
+		s += other;
+		return *this;
+	}
+	String &operator+=(char c)
+	{
+		s += c;
+		return *this;
+	}
+	friend String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+	friend String operator+(const String &a, const char *b) { return String(a.s + b); }
+	friend String operator+(const char *a, const String &b) { return String(a + b.s); }
+	bool operator==(const char *other) const { return s == other; }
+	bool operator==(const String &other) const { return s == other.s; }
+	char operator[](size_t i) const { return s[i]; }
+	const char *c_str() const { return s.c_str(); }
+	size_t length() const { return s.size(); }
+	bool reserve(size_t len)
+	{
+		s.reserve(len);
+		return true;
+	}
+	void trim()
+	{
+		size_t start = s.find_first_not_of(" \t\r\n");
+		size_t end = s.find_last_not_of(" \t\r\n");
+		s = start == std::string::npos ? "" : s.substr(start, end - start + 1);
+	}
+	int toInt() const { return atoi(s.c_str()); }
+	float toFloat() const { return atof(s.c_str()); }
+
+private:
+	std::string s;
+};
+
+class Print;
+
+// Something that knows how to print itself (IPAddress)
+class Printable
+{
+public:
+	virtual ~Printable() {}
+	virtual size_t printTo(Print &p) const = 0;
+};
+
+// Output half of HardwareSerial, everything goes to stdout
+class Print
+{
+public:
+	size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+	size_t write(const uint8_t *buf, size_t len) { return fwrite(buf, 1, len, stdout); }
+	size_t print(const char *text) { return fputs(text, stdout) >= 0 ? strlen(text) : 0; }
+	size_t print(const String &text) { return print(text.c_str()); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(int value) { return printf("%d", value); }
+	size_t print(unsigned value) { return printf("%u", value); }
+	size_t print(long value) { return printf("%ld", value); }
+	size_t print(unsigned long value) { return printf("%lu", value); }
+	size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+	size_t print(const Printable &value) { return value.printTo(*this); }
+	size_t println() { return print("\n"); }
+	template <typename T>
+	size_t println(const T &value)
+	{
+		return print(value) + println();
+	}
+	size_t println(double value, int digits) { return print(value, digits) + println(); }
+	size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+	{
+		va_list args;
+		va_start(args, format);
+		int n = vprintf(format, args);
+		va_end(args);
+		return n > 0 ? n : 0;
+	}
+	void flush() { fflush(stdout); }
+};
+
+// Serial port: without a device attached to its UART (host_uart_attach) nothing is ever received,
+// and nothing written raw is shown
+class HardwareSerial : public Print
+{
+public:
+	HardwareSerial(int uart = 0) : uart(uart) {}
+	void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rx = -1, int8_t tx = -1) { set_baud(baud); }
+	void end() {}
+	void updateBaudRate(unsigned long baud) { set_baud(baud); }
+	void setDebugOutput(bool enable) {}
+	void setRxBufferSize(size_t size) {}
+	void onReceive(void (*callback)(void)) {}
+	int available();
+	int read();
+	// Raw bytes are the command frames for the Arduino (or the GPS), they would garble the console
+	size_t write(uint8_t c) { return write(&c, 1); }
+	size_t write(const uint8_t *buf, size_t len);
+
+private:
+	void set_baud(unsigned long baud);
+	int uart;
+};
+
+extern HardwareSerial Serial;
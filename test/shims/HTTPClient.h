@@ -0,0 +1,4 @@
+#pragma once
+
+// Included by the sketch, nothing of it is used
+#include "Arduino.h"
@@ -0,0 +1,4 @@
+#pragma once
+
+// The core declares HardwareSerial next to Serial, so does Arduino.h here
+#include "Arduino.h"
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Arduino.h"
+
+// IPv4 address, printed and parsed in dotted form
+class IPAddress : public Printable
+{
+public:
+	IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : bytes{a, b, c, d} {}
+	bool fromString(const char *text)
+	{
+		unsigned a, b, c, d;
+		if (sscanf(text, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255)
+		{
+			return false;
+		}
+		bytes[0] = a;
+		bytes[1] = b;
+		bytes[2] = c;
+		bytes[3] = d;
+		return true;
+	}
+	String toString() const
+	{
+		char buf[16];
+		snprintf(buf, sizeof(buf), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+		return String(buf);
+	}
+	size_t printTo(Print &p) const override { return p.print(toString()); }
+
+private:
+	uint8_t bytes[4];
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Arduino.h"
+#include <map>
+#include <vector>
+
+// NVS namespace kept in memory, nothing survives the program
+class Preferences
+{
+public:
+	bool begin(const char *name, bool readOnly = false) { return true; }
+	void end() {}
+	int32_t getInt(const char *key, int32_t defaultValue = 0)
+	{
+		std::vector<uint8_t> &v = values[key];
+		int32_t value = defaultValue;
+		if (v.size() == sizeof(value))
+		{
+			memcpy(&value, v.data(), sizeof(value));
+		}
+		return value;
+	}
+	size_t putInt(const char *key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+	size_t getBytes(const char *key, void *buf, size_t maxLen)
+	{
+		std::vector<uint8_t> &v = values[key];
+		if (v.empty() || v.size() > maxLen)
+		{
+			return 0;
+		}
+		memcpy(buf, v.data(), v.size());
+		return v.size();
+	}
+	size_t putBytes(const char *key, const void *value, size_t len)
+	{
+		values[key].assign((const uint8_t *)value, (const uint8_t *)value + len);
+		return len;
+	}
+
+private:
+	std::map<std::string, std::vector<uint8_t>> values;
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+// The host has no card to mount, files go to RECORD_ROOT directly
+class SDMMCFS
+{
+public:
+	bool begin(const char *mountpoint = "/sdcard", bool mode1bit = false) { return true; }
+	void end() {}
+};
+
+static SDMMCFS SD_MMC;
@@ -0,0 +1,47 @@
+/* Host shim of the WiFi station: it is connected as soon as it is started,
+ * on the loopback address the host web server listens on.
+ */
+#pragma once
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+#define WIFI_STA 1
+
+typedef enum
+{
+	WL_IDLE_STATUS = 0,
+	WL_CONNECTED = 3,
+	WL_DISCONNECTED = 6,
+} wl_status_t;
+
+class WiFiClass
+{
+public:
+	bool mode(int mode) { return true; }
+	void persistent(bool persistent) {}
+	bool setSleep(bool enable) { return true; }
+	bool config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns = IPAddress()) { return true; }
+	wl_status_t begin(const char *ssid, const char *pass, int32_t channel = 0, const uint8_t *bssid = NULL)
+	{
+		connected = true;
+		return WL_CONNECTED;
+	}
+	bool disconnect()
+	{
+		connected = false;
+		return true;
+	}
+	wl_status_t status() { return connected ? WL_CONNECTED : WL_DISCONNECTED; }
+	const uint8_t *BSSID() { return connected ? bssid : NULL; }
+	int32_t channel() { return 1; }
+	IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+	IPAddress gatewayIP() { return IPAddress(127, 0, 0, 1); }
+	IPAddress subnetMask() { return IPAddress(255, 0, 0, 0); }
+
+private:
+	bool connected = false;
+	uint8_t bssid[6] = {0x02, 0, 0, 0, 0, 1};
+};
+
+static WiFiClass WiFi;
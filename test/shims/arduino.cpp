@@ -0,0 +1,142 @@
+#include "Arduino.h"
+#include "esp_system.h"
+#include "host.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#define HOST_UARTS 3
+
+HardwareSerial Serial(0);
+static const host_uart_device_t *uart_devices[HOST_UARTS];
+
+static const auto start = std::chrono::steady_clock::now();
+static std::atomic<int64_t> offset_us(0);
+
+int64_t esp_timer_get_time()
+{
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + offset_us.load();
+}
+
+void host_clock_advance_ms(uint32_t ms)
+{
+	offset_us += (int64_t)ms * 1000;
+}
+
+void host_uart_attach(int uart, const host_uart_device_t *device)
+{
+	uart_devices[uart] = device;
+}
+
+void HardwareSerial::set_baud(unsigned long baud)
+{
+	if (uart_devices[uart])
+	{
+		uart_devices[uart]->baud(baud);
+	}
+}
+
+int HardwareSerial::available()
+{
+	return uart_devices[uart] ? uart_devices[uart]->available() : 0;
+}
+
+int HardwareSerial::read()
+{
+	return uart_devices[uart] ? uart_devices[uart]->read() : -1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t len)
+{
+	if (uart_devices[uart])
+	{
+		uart_devices[uart]->write(buf, len);
+	}
+	return len;
+}
+
+const char *esp_err_to_name(esp_err_t err)
+{
+	return err == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+unsigned long millis()
+{
+	return esp_timer_get_time() / 1000;
+}
+
+unsigned long micros()
+{
+	return esp_timer_get_time();
+}
+
+void delay(uint32_t ms)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+static bool psram = false;
+
+void host_psram_enable(bool enable)
+{
+	psram = enable;
+}
+
+bool psramFound()
+{
+	return psram;
+}
+
+void *ps_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void *ps_calloc(size_t count, size_t size)
+{
+	return calloc(count, size);
+}
+
+void *ps_realloc(void *ptr, size_t size)
+{
+	return realloc(ptr, size);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+	return malloc(size);
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+	return realloc(ptr, size);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+	return 4 * 1024 * 1024;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+	return 4 * 1024 * 1024;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+	return 4 * 1024 * 1024;
+}
+
+uint32_t esp_get_free_heap_size()
+{
+	return 4 * 1024 * 1024;
+}
@@ -0,0 +1,10 @@
+/* Stand-in for the secret file of the README: the host build has no access
+ * point to join and no map key. An esp32_secret.h next to the firmware
+ * sources takes precedence over this one.
+ */
+#pragma once
+
+#define SECRET_SSID "host"
+#define SECRET_PASS "host"
+
+#define AZURE_MAPS_API ""
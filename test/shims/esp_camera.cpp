@@ -0,0 +1,158 @@
+#include "esp_camera.h"
+#include "host.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define HOST_FRAME_MS 20 // Frame interval of the stand-in sensor
+
+const resolution_info_t resolution[] = {
+	{96, 96}, {160, 120}, {176, 144}, {240, 176}, {240, 240}, {320, 240}, {400, 296},
+	{480, 320}, {640, 480}, {800, 600}, {1024, 768}, {1280, 720}, {1280, 1024}, {1600, 1200},
+};
+
+static sensor_t sensor;
+static bool initialized = false;
+static std::atomic<int> scene_gray(128);
+static std::atomic<bool> scene_moving(false);
+static uint32_t frame_count = 0;
+
+#define SETTER(name, field)                  \
+	static int name(sensor_t *s, int value) \
+	{                                        \
+		s->status.field = value;             \
+		return 0;                            \
+	}
+
+SETTER(set_quality, quality)
+SETTER(set_contrast, contrast)
+SETTER(set_brightness, brightness)
+SETTER(set_saturation, saturation)
+SETTER(set_colorbar, colorbar)
+SETTER(set_whitebal, awb)
+SETTER(set_gain_ctrl, agc)
+SETTER(set_exposure_ctrl, aec)
+SETTER(set_hmirror, hmirror)
+SETTER(set_vflip, vflip)
+SETTER(set_aec2, aec2)
+SETTER(set_awb_gain, awb_gain)
+SETTER(set_agc_gain, agc_gain)
+SETTER(set_aec_value, aec_value)
+SETTER(set_special_effect, special_effect)
+SETTER(set_wb_mode, wb_mode)
+SETTER(set_ae_level, ae_level)
+SETTER(set_dcw, dcw)
+SETTER(set_bpc, bpc)
+SETTER(set_wpc, wpc)
+SETTER(set_raw_gma, raw_gma)
+SETTER(set_lenc, lenc)
+
+static int set_framesize(sensor_t *s, framesize_t framesize)
+{
+	s->status.framesize = framesize;
+	return 0;
+}
+
+static int set_gainceiling(sensor_t *s, gainceiling_t gainceiling)
+{
+	s->status.gainceiling = gainceiling;
+	return 0;
+}
+
+esp_err_t esp_camera_init(const camera_config_t *config)
+{
+	memset(&sensor, 0, sizeof(sensor));
+	sensor.pixformat = config->pixel_format;
+	sensor.status.framesize = config->frame_size;
+	sensor.status.quality = config->jpeg_quality;
+	sensor.set_framesize = set_framesize;
+	sensor.set_quality = set_quality;
+	sensor.set_contrast = set_contrast;
+	sensor.set_brightness = set_brightness;
+	sensor.set_saturation = set_saturation;
+	sensor.set_gainceiling = set_gainceiling;
+	sensor.set_colorbar = set_colorbar;
+	sensor.set_whitebal = set_whitebal;
+	sensor.set_gain_ctrl = set_gain_ctrl;
+	sensor.set_exposure_ctrl = set_exposure_ctrl;
+	sensor.set_hmirror = set_hmirror;
+	sensor.set_vflip = set_vflip;
+	sensor.set_aec2 = set_aec2;
+	sensor.set_awb_gain = set_awb_gain;
+	sensor.set_agc_gain = set_agc_gain;
+	sensor.set_aec_value = set_aec_value;
+	sensor.set_special_effect = set_special_effect;
+	sensor.set_wb_mode = set_wb_mode;
+	sensor.set_ae_level = set_ae_level;
+	sensor.set_dcw = set_dcw;
+	sensor.set_bpc = set_bpc;
+	sensor.set_wpc = set_wpc;
+	sensor.set_raw_gma = set_raw_gma;
+	sensor.set_lenc = set_lenc;
+	initialized = true;
+	return ESP_OK;
+}
+
+esp_err_t esp_camera_deinit()
+{
+	initialized = false;
+	return ESP_OK;
+}
+
+// Frames are stand-in JPEGs of the configured size (see host_fake_jpeg), about as large as real
+// ones: a tenth of the pixels in bytes at quality 10, less at higher quality values. They are
+// paced like a sensor running at 1000 / HOST_FRAME_MS fps
+camera_fb_t *esp_camera_fb_get()
+{
+	static std::chrono::steady_clock::time_point next;
+	if (!initialized)
+	{
+		return NULL;
+	}
+	std::this_thread::sleep_until(next);
+	next = std::max(next, std::chrono::steady_clock::now()) + std::chrono::milliseconds(HOST_FRAME_MS);
+
+	camera_fb_t *fb = (camera_fb_t *)calloc(1, sizeof(camera_fb_t));
+	fb->width = resolution[sensor.status.framesize].width;
+	fb->height = resolution[sensor.status.framesize].height;
+	fb->format = PIXFORMAT_JPEG;
+	fb->len = fb->width * fb->height * 12 / (10 * (sensor.status.quality + 2));
+	fb->buf = (uint8_t *)malloc(fb->len);
+	// A moving scene flips between two brightnesses, so every frame counts as motion
+	uint8_t gray = scene_gray;
+	if (scene_moving && frame_count++ % 2)
+	{
+		gray ^= 0x80;
+	}
+	host_fake_jpeg(fb->buf, fb->len, fb->width, fb->height, gray);
+	gettimeofday(&fb->timestamp, NULL);
+	return fb;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb)
+{
+	if (fb)
+	{
+		free(fb->buf);
+		free(fb);
+	}
+}
+
+void host_camera_set_gray(uint8_t gray)
+{
+	scene_gray = gray;
+}
+
+void host_camera_set_moving(bool moving)
+{
+	scene_moving = moving;
+}
+
+sensor_t *esp_camera_sensor_get()
+{
+	return initialized ? &sensor : NULL;
+}
@@ -0,0 +1,943 @@
+#include "esp_http_server.h"
+#include "host.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define HOST_RESP_HEAD_LEN 1024 // Room for the status line and every header of a response
+
+static std::atomic<int> port_offset(8000);
+
+// Structure for one client connection
+struct host_session
+{
+	int fd;
+	std::string in; // Received bytes not parsed yet
+	bool ws = false;
+	const httpd_uri_t *ws_uri = NULL;
+	// Header of the WebSocket frame being delivered to the handler
+	httpd_ws_type_t ws_type = HTTPD_WS_TYPE_CONTINUE;
+	bool ws_final = false;
+	bool ws_masked = false;
+	uint8_t ws_mask[4];
+	size_t ws_len = 0;
+	size_t ws_read = 0; // Payload bytes the handler has taken
+};
+
+// Structure for one registered handler, the URI is copied like the IDF server does
+struct host_handler
+{
+	std::string uri;
+	httpd_uri_t def;
+};
+
+struct host_server
+{
+	httpd_config_t config;
+	int listen_fd = -1;
+	int wake[2] = {-1, -1};
+	std::vector<host_handler *> handlers;
+	std::vector<host_session *> sessions;
+	std::mutex close_mutex;
+	std::vector<int> close_requests; // From httpd_sess_trigger_close, served by the server task
+	std::atomic<bool> stop{false};
+	std::thread thread;
+};
+
+// Structure behind httpd_req_t.aux: the parsed request and the response being built
+struct host_request
+{
+	host_server *server;
+	host_session *sess;
+	std::vector<std::pair<std::string, std::string>> headers;
+	const char *status = "200 OK";
+	const char *type = "text/html";
+	std::vector<std::pair<const char *, const char *>> resp_headers; // Pointers, valid until the response is sent
+	bool headers_sent = false;
+};
+
+void host_httpd_set_port_offset(int offset)
+{
+	port_offset = offset;
+}
+
+// Function to send a whole buffer, false if the peer is gone or stalled past the send timeout
+static bool send_all(int fd, const char *buf, size_t len)
+{
+	while (len > 0)
+	{
+		ssize_t sent = send(fd, buf, len, MSG_NOSIGNAL);
+		if (sent <= 0)
+		{
+			return false;
+		}
+		buf += sent;
+		len -= sent;
+	}
+	return true;
+}
+
+// Function to receive more bytes into the session buffer, false on close, error or receive timeout
+static bool session_fill(host_session *s)
+{
+	char buf[4096];
+	ssize_t n = recv(s->fd, buf, sizeof(buf), 0);
+	if (n <= 0)
+	{
+		return false;
+	}
+	s->in.append(buf, n);
+	return true;
+}
+
+// Function to read exactly len bytes of the session, buffered ones first
+static bool session_read(host_session *s, void *out, size_t len)
+{
+	while (s->in.size() < len)
+	{
+		if (!session_fill(s))
+		{
+			return false;
+		}
+	}
+	memcpy(out, s->in.data(), len);
+	s->in.erase(0, len);
+	return true;
+}
+
+static void session_close(host_server *hd, host_session *s)
+{
+	for (size_t i = 0; i < hd->sessions.size(); i++)
+	{
+		if (hd->sessions[i] == s)
+		{
+			hd->sessions.erase(hd->sessions.begin() + i);
+			break;
+		}
+	}
+	// With a close callback the application owns the descriptor
+	if (hd->config.close_fn)
+	{
+		hd->config.close_fn(hd, s->fd);
+	}
+	else
+	{
+		close(s->fd);
+	}
+	delete s;
+}
+
+// Function to send a complete response without a handler (errors of the server itself)
+static void send_plain(int fd, const char *status, const char *body)
+{
+	char buf[256];
+	int len = snprintf(buf, sizeof(buf), "HTTP/1.1 %s\r\nContent-Type: text/html\r\nContent-Length: %u\r\n\r\n%s", status,
+					   (unsigned)strlen(body), body);
+	send_all(fd, buf, len);
+}
+
+// SHA-1 of data, for the WebSocket handshake
+static void sha1(const uint8_t *data, size_t len, uint8_t out[20])
+{
+	uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+	std::vector<uint8_t> msg(data, data + len);
+	msg.push_back(0x80);
+	while (msg.size() % 64 != 56)
+	{
+		msg.push_back(0);
+	}
+	uint64_t bits = (uint64_t)len * 8;
+	for (int i = 7; i >= 0; i--)
+	{
+		msg.push_back(bits >> (i * 8));
+	}
+	for (size_t block = 0; block < msg.size(); block += 64)
+	{
+		uint32_t w[80];
+		for (int i = 0; i < 16; i++)
+		{
+			const uint8_t *p = &msg[block + i * 4];
+			w[i] = (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+		}
+		for (int i = 16; i < 80; i++)
+		{
+			uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+			w[i] = x << 1 | x >> 31;
+		}
+		uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+		for (int i = 0; i < 80; i++)
+		{
+			uint32_t f, k;
+			if (i < 20)
+			{
+				f = (b & c) | (~b & d);
+				k = 0x5A827999;
+			}
+			else if (i < 40)
+			{
+				f = b ^ c ^ d;
+				k = 0x6ED9EBA1;
+			}
+			else if (i < 60)
+			{
+				f = (b & c) | (b & d) | (c & d);
+				k = 0x8F1BBCDC;
+			}
+			else
+			{
+				f = b ^ c ^ d;
+				k = 0xCA62C1D6;
+			}
+			uint32_t t = (a << 5 | a >> 27) + f + e + k + w[i];
+			e = d;
+			d = c;
+			c = b << 30 | b >> 2;
+			b = a;
+			a = t;
+		}
+		h[0] += a;
+		h[1] += b;
+		h[2] += c;
+		h[3] += d;
+		h[4] += e;
+	}
+	for (int i = 0; i < 20; i++)
+	{
+		out[i] = h[i / 4] >> (24 - (i % 4) * 8);
+	}
+}
+
+static std::string base64(const uint8_t *data, size_t len)
+{
+	static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	std::string out;
+	for (size_t i = 0; i < len; i += 3)
+	{
+		uint32_t v = data[i] << 16 | (i + 1 < len ? data[i + 1] << 8 : 0) | (i + 2 < len ? data[i + 2] : 0);
+		out += table[v >> 18 & 63];
+		out += table[v >> 12 & 63];
+		out += i + 1 < len ? table[v >> 6 & 63] : '=';
+		out += i + 2 < len ? table[v & 63] : '=';
+	}
+	return out;
+}
+
+static const char *find_header(const host_request *r, const char *field)
+{
+	for (const auto &h : r->headers)
+	{
+		if (!strcasecmp(h.first.c_str(), field))
+		{
+			return h.second.c_str();
+		}
+	}
+	return NULL;
+}
+
+// Function to send one WebSocket frame from the server (never masked)
+static bool ws_send(int fd, httpd_ws_type_t type, bool final, const uint8_t *payload, size_t len)
+{
+	std::string frame;
+	frame += (char)((final ? 0x80 : 0) | type);
+	if (len < 126)
+	{
+		frame += (char)len;
+	}
+	else if (len < 65536)
+	{
+		frame += (char)126;
+		frame += (char)(len >> 8);
+		frame += (char)len;
+	}
+	else
+	{
+		frame += (char)127;
+		for (int i = 7; i >= 0; i--)
+		{
+			frame += (char)((uint64_t)len >> (i * 8));
+		}
+	}
+	frame.append((const char *)payload, len);
+	return send_all(fd, frame.data(), frame.size());
+}
+
+// Function to read the header of the next WebSocket frame into the session
+static bool ws_read_header(host_session *s)
+{
+	uint8_t hdr[2];
+	if (!session_read(s, hdr, 2))
+	{
+		return false;
+	}
+	s->ws_final = hdr[0] & 0x80;
+	s->ws_type = (httpd_ws_type_t)(hdr[0] & 0x0F);
+	s->ws_masked = hdr[1] & 0x80;
+	uint64_t len = hdr[1] & 0x7F;
+	if (len >= 126)
+	{
+		uint8_t ext[8];
+		int n = len == 126 ? 2 : 8;
+		if (!session_read(s, ext, n))
+		{
+			return false;
+		}
+		len = 0;
+		for (int i = 0; i < n; i++)
+		{
+			len = len << 8 | ext[i];
+		}
+	}
+	if (s->ws_masked && !session_read(s, s->ws_mask, 4))
+	{
+		return false;
+	}
+	s->ws_len = len;
+	s->ws_read = 0;
+	return true;
+}
+
+// Function to read payload bytes of the current frame and unmask them
+static bool ws_read_payload(host_session *s, uint8_t *out, size_t len)
+{
+	if (!session_read(s, out, len))
+	{
+		return false;
+	}
+	for (size_t i = 0; s->ws_masked && i < len; i++)
+	{
+		out[i] ^= s->ws_mask[(s->ws_read + i) % 4];
+	}
+	s->ws_read += len;
+	return true;
+}
+
+// Function to handle one frame of a WebSocket session, false if the session ends
+static bool ws_process(host_server *hd, host_session *s)
+{
+	if (!ws_read_header(s))
+	{
+		return false;
+	}
+	if (s->ws_type >= HTTPD_WS_TYPE_CLOSE)
+	{
+		// Control frames are answered by the server, like the IDF does without handle_ws_control_frames
+		std::vector<uint8_t> payload(s->ws_len);
+		if (!ws_read_payload(s, payload.data(), payload.size()))
+		{
+			return false;
+		}
+		if (s->ws_type == HTTPD_WS_TYPE_CLOSE)
+		{
+			ws_send(s->fd, HTTPD_WS_TYPE_CLOSE, true, payload.data(), std::min<size_t>(payload.size(), 2));
+			return false;
+		}
+		return s->ws_type != HTTPD_WS_TYPE_PING || ws_send(s->fd, HTTPD_WS_TYPE_PONG, true, payload.data(), payload.size());
+	}
+
+	host_request r;
+	r.server = hd;
+	r.sess = s;
+	r.resp_headers.reserve(hd->config.max_resp_headers);
+	httpd_req_t req;
+	memset(&req, 0, sizeof(req));
+	req.handle = hd;
+	req.method = 0; // Data frames, the handshake was the HTTP_GET call
+	snprintf(req.uri, sizeof(req.uri), "%s", s->ws_uri->uri);
+	req.user_ctx = s->ws_uri->user_ctx;
+	req.aux = &r;
+	if (s->ws_uri->handler(&req) != ESP_OK)
+	{
+		return false;
+	}
+	// Whatever the handler did not read is dropped
+	std::vector<uint8_t> rest(s->ws_len - s->ws_read);
+	return ws_read_payload(s, rest.data(), rest.size());
+}
+
+// Function to switch a session to WebSocket, false if the request is not a valid upgrade
+static bool ws_handshake(host_session *s, host_request *r)
+{
+	const char *upgrade = find_header(r, "Upgrade");
+	const char *key = find_header(r, "Sec-WebSocket-Key");
+	if (!upgrade || strcasecmp(upgrade, "websocket") || !key)
+	{
+		send_plain(s->fd, "400 Bad Request", "Not a WebSocket upgrade");
+		return false;
+	}
+	std::string accept = std::string(key) + WS_GUID;
+	uint8_t digest[20];
+	sha1((const uint8_t *)accept.data(), accept.size(), digest);
+	std::string resp = "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " +
+					   base64(digest, sizeof(digest)) + "\r\n\r\n";
+	s->ws = true;
+	return send_all(s->fd, resp.data(), resp.size());
+}
+
+static int parse_method(const std::string &method)
+{
+	static const struct
+	{
+		const char *name;
+		httpd_method_t method;
+	} methods[] = {{"GET", HTTP_GET}, {"POST", HTTP_POST}, {"PUT", HTTP_PUT}, {"DELETE", HTTP_DELETE}, {"HEAD", HTTP_HEAD}, {"OPTIONS", HTTP_OPTIONS}};
+	for (const auto &m : methods)
+	{
+		if (method == m.name)
+		{
+			return m.method;
+		}
+	}
+	return -1;
+}
+
+// Function to parse and serve one request whose header ends at header_len, false if the session ends
+static bool http_process(host_server *hd, host_session *s, size_t header_len)
+{
+	std::string head = s->in.substr(0, header_len);
+	s->in.erase(0, header_len + 4);
+
+	host_request r;
+	r.server = hd;
+	r.sess = s;
+	r.resp_headers.reserve(hd->config.max_resp_headers);
+	size_t line_end = head.find("\r\n");
+	std::string line = head.substr(0, line_end);
+	size_t sp1 = line.find(' ');
+	size_t sp2 = line.rfind(' ');
+	int method = sp1 == std::string::npos ? -1 : parse_method(line.substr(0, sp1));
+	if (method < 0 || sp2 <= sp1)
+	{
+		send_plain(s->fd, "400 Bad Request", "Server unable to understand request due to invalid syntax");
+		return false;
+	}
+	std::string uri = line.substr(sp1 + 1, sp2 - sp1 - 1);
+	if (uri.size() > HTTPD_MAX_URI_LEN)
+	{
+		send_plain(s->fd, "414 URI Too Long", "URI is too long");
+		return false;
+	}
+	size_t pos = line_end;
+	while (pos != std::string::npos && pos + 2 < head.size())
+	{
+		size_t next = head.find("\r\n", pos + 2);
+		std::string field = head.substr(pos + 2, next == std::string::npos ? std::string::npos : next - pos - 2);
+		size_t colon = field.find(':');
+		if (colon != std::string::npos)
+		{
+			size_t value = field.find_first_not_of(" \t", colon + 1);
+			r.headers.emplace_back(field.substr(0, colon), value == std::string::npos ? "" : field.substr(value));
+		}
+		pos = next;
+	}
+
+	httpd_req_t req;
+	memset(&req, 0, sizeof(req));
+	req.handle = hd;
+	req.method = method;
+	snprintf(req.uri, sizeof(req.uri), "%s", uri.c_str());
+	req.aux = &r;
+	const char *content_len = find_header(&r, "Content-Length");
+	req.content_len = content_len ? strtoul(content_len, NULL, 10) : 0;
+	// No handler reads a body, it is dropped so the next request parses
+	std::vector<uint8_t> body(req.content_len);
+	if (!session_read(s, body.data(), body.size()))
+	{
+		return false;
+	}
+
+	size_t match_len = strcspn(req.uri, "?");
+	bool uri_found = false;
+	for (host_handler *h : hd->handlers)
+	{
+		bool match = hd->config.uri_match_fn ? hd->config.uri_match_fn(h->def.uri, req.uri, match_len)
+											 : h->uri.size() == match_len && !strncmp(h->def.uri, req.uri, match_len);
+		if (!match)
+		{
+			continue;
+		}
+		uri_found = true;
+		if (h->def.method != method)
+		{
+			continue;
+		}
+		req.user_ctx = h->def.user_ctx;
+		if (h->def.is_websocket)
+		{
+			s->ws_uri = &h->def;
+			if (!ws_handshake(s, &r))
+			{
+				return false;
+			}
+		}
+		return h->def.handler(&req) == ESP_OK;
+	}
+	if (uri_found)
+	{
+		send_plain(s->fd, "405 Method Not Allowed", "Request method for this URI is not handled by server");
+	}
+	else
+	{
+		send_plain(s->fd, "404 Not Found", "This URI does not exist");
+	}
+	return true;
+}
+
+// Function to serve what arrived on a session, false if the session ends
+static bool session_process(host_server *hd, host_session *s)
+{
+	if (s->ws)
+	{
+		if (!ws_process(hd, s))
+		{
+			return false;
+		}
+	}
+	else if (!session_fill(s))
+	{
+		return false;
+	}
+	// Serve every complete request, pipelined ones included
+	while (!s->ws)
+	{
+		size_t end = s->in.find("\r\n\r\n");
+		if (end == std::string::npos)
+		{
+			if (s->in.size() > HTTPD_MAX_REQ_HDR_LEN)
+			{
+				send_plain(s->fd, "431 Request Header Fields Too Large", "Header fields are too long");
+				return false;
+			}
+			return true;
+		}
+		if (end > HTTPD_MAX_REQ_HDR_LEN)
+		{
+			send_plain(s->fd, "431 Request Header Fields Too Large", "Header fields are too long");
+			return false;
+		}
+		if (!http_process(hd, s, end))
+		{
+			return false;
+		}
+	}
+	// Frames that came in with the handshake or the last frame
+	while (!s->in.empty())
+	{
+		if (!ws_process(hd, s))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static void session_accept(host_server *hd)
+{
+	int fd = accept(hd->listen_fd, NULL, NULL);
+	if (fd < 0)
+	{
+		return;
+	}
+	struct timeval recv_timeout = {.tv_sec = hd->config.recv_wait_timeout, .tv_usec = 0};
+	struct timeval send_timeout = {.tv_sec = hd->config.send_wait_timeout, .tv_usec = 0};
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &recv_timeout, sizeof(recv_timeout));
+	setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &send_timeout, sizeof(send_timeout));
+	// lwip sends small writes right away, Nagle on the host loopback would add delayed-ACK stalls instead
+	int one = 1;
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	host_session *s = new host_session;
+	s->fd = fd;
+	hd->sessions.push_back(s);
+}
+
+// The server task: one request at a time over all sessions, like the IDF httpd task
+static void server_task(host_server *hd)
+{
+	while (!hd->stop)
+	{
+		fd_set read_set;
+		FD_ZERO(&read_set);
+		FD_SET(hd->wake[0], &read_set);
+		int max_fd = hd->wake[0];
+		// Once every session is taken, new clients wait in the listen backlog
+		if (hd->sessions.size() < hd->config.max_open_sockets)
+		{
+			FD_SET(hd->listen_fd, &read_set);
+			max_fd = std::max(max_fd, hd->listen_fd);
+		}
+		for (host_session *s : hd->sessions)
+		{
+			FD_SET(s->fd, &read_set);
+			max_fd = std::max(max_fd, s->fd);
+		}
+		if (select(max_fd + 1, &read_set, NULL, NULL, NULL) < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			break;
+		}
+
+		if (FD_ISSET(hd->wake[0], &read_set))
+		{
+			char buf[64];
+			if (read(hd->wake[0], buf, sizeof(buf)) < 0)
+			{
+				continue;
+			}
+			std::vector<int> requests;
+			{
+				std::lock_guard<std::mutex> lock(hd->close_mutex);
+				requests.swap(hd->close_requests);
+			}
+			for (int fd : requests)
+			{
+				for (host_session *s : hd->sessions)
+				{
+					if (s->fd == fd)
+					{
+						session_close(hd, s);
+						break;
+					}
+				}
+			}
+		}
+		// Sessions closed above are no longer in the list, their descriptors are not looked at
+		std::vector<host_session *> ready;
+		for (host_session *s : hd->sessions)
+		{
+			if (FD_ISSET(s->fd, &read_set))
+			{
+				ready.push_back(s);
+			}
+		}
+		for (host_session *s : ready)
+		{
+			if (!session_process(hd, s))
+			{
+				session_close(hd, s);
+			}
+		}
+		if (FD_ISSET(hd->listen_fd, &read_set))
+		{
+			session_accept(hd);
+		}
+	}
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
+{
+	// lwip has no SIGPIPE, a client going away must not end the program
+	signal(SIGPIPE, SIG_IGN);
+	int fd = socket(AF_INET, SOCK_STREAM, 0);
+	int one = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(config->server_port + port_offset);
+	if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, config->backlog_conn) < 0)
+	{
+		fprintf(stderr, "httpd: cannot listen on port %d: %s\n", config->server_port + port_offset.load(), strerror(errno));
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+		return ESP_ERR_HTTPD_TASK;
+	}
+	host_server *hd = new host_server;
+	hd->config = *config;
+	hd->listen_fd = fd;
+	if (pipe(hd->wake) < 0)
+	{
+		close(fd);
+		delete hd;
+		return ESP_ERR_HTTPD_TASK;
+	}
+	hd->thread = std::thread(server_task, hd);
+	*handle = hd;
+	return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle)
+{
+	host_server *hd = (host_server *)handle;
+	if (!hd)
+	{
+		return ESP_ERR_INVALID_ARG;
+	}
+	hd->stop = true;
+	if (write(hd->wake[1], "", 1) < 0)
+	{
+		return ESP_FAIL;
+	}
+	hd->thread.join();
+	while (!hd->sessions.empty())
+	{
+		session_close(hd, hd->sessions.back());
+	}
+	close(hd->listen_fd);
+	close(hd->wake[0]);
+	close(hd->wake[1]);
+	for (host_handler *h : hd->handlers)
+	{
+		delete h;
+	}
+	delete hd;
+	return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler)
+{
+	host_server *hd = (host_server *)handle;
+	if (!hd || !uri_handler || !uri_handler->uri || !uri_handler->handler)
+	{
+		return ESP_ERR_INVALID_ARG;
+	}
+	for (host_handler *h : hd->handlers)
+	{
+		if (h->uri == uri_handler->uri && h->def.method == uri_handler->method)
+		{
+			return ESP_ERR_HTTPD_HANDLER_EXISTS;
+		}
+	}
+	if (hd->handlers.size() >= hd->config.max_uri_handlers)
+	{
+		return ESP_ERR_HTTPD_HANDLERS_FULL;
+	}
+	host_handler *h = new host_handler;
+	h->uri = uri_handler->uri;
+	h->def = *uri_handler;
+	h->def.uri = h->uri.c_str();
+	hd->handlers.push_back(h);
+	return ESP_OK;
+}
+
+// Template ending in '*' matches any rest, ending in '?' makes the character before it optional
+bool httpd_uri_match_wildcard(const char *uri_template, const char *uri_to_match, size_t match_upto)
+{
+	size_t len = strlen(uri_template);
+	char last = len > 0 ? uri_template[len - 1] : 0;
+	char prev = len > 1 ? uri_template[len - 2] : 0;
+	bool asterisk = last == '*' || (prev == '*' && last == '?');
+	bool quest = last == '?' || (prev == '?' && last == '*');
+	size_t exact = len - asterisk - quest;
+	if (quest && match_upto + 1 == exact && !strncmp(uri_template, uri_to_match, match_upto))
+	{
+		return true;
+	}
+	if (asterisk)
+	{
+		return match_upto >= exact && !strncmp(uri_template, uri_to_match, exact);
+	}
+	return match_upto == exact && !strncmp(uri_template, uri_to_match, exact);
+}
+
+size_t httpd_req_get_url_query_len(httpd_req_t *r)
+{
+	const char *query = strchr(r->uri, '?');
+	return query ? strlen(query + 1) : 0;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len)
+{
+	const char *query = strchr(r->uri, '?');
+	if (!query)
+	{
+		return ESP_ERR_NOT_FOUND;
+	}
+	if (!buf || buf_len == 0)
+	{
+		return ESP_ERR_INVALID_ARG;
+	}
+	snprintf(buf, buf_len, "%s", query + 1);
+	return strlen(query + 1) < buf_len ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size)
+{
+	size_t key_len = strlen(key);
+	while (qry && *qry)
+	{
+		const char *end = strchr(qry, '&');
+		size_t pair_len = end ? (size_t)(end - qry) : strlen(qry);
+		if (pair_len > key_len && qry[key_len] == '=' && !strncmp(qry, key, key_len))
+		{
+			size_t value_len = pair_len - key_len - 1;
+			size_t copy = std::min(value_len, val_size - 1);
+			memcpy(val, qry + key_len + 1, copy);
+			val[copy] = '\0';
+			return copy == value_len ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+		}
+		qry = end ? end + 1 : NULL;
+	}
+	return ESP_ERR_NOT_FOUND;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field)
+{
+	const char *value = find_header((host_request *)r->aux, field);
+	return value ? strlen(value) : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size)
+{
+	const char *value = find_header((host_request *)r->aux, field);
+	if (!value)
+	{
+		return ESP_ERR_NOT_FOUND;
+	}
+	snprintf(val, val_size, "%s", value);
+	return strlen(value) < val_size ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r)
+{
+	return ((host_request *)r->aux)->sess->fd;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+	((host_request *)r->aux)->status = status;
+	return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+	((host_request *)r->aux)->type = type;
+	return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+	host_request *req = (host_request *)r->aux;
+	if (req->resp_headers.size() >= req->server->config.max_resp_headers)
+	{
+		return ESP_ERR_HTTPD_RESP_HDR;
+	}
+	req->resp_headers.emplace_back(field, value);
+	return ESP_OK;
+}
+
+// Function to build the status line and headers, framing is either Content-Length or chunked
+static std::string response_head(host_request *req, ssize_t content_len)
+{
+	// Built in one buffer so a response costs the same whatever its headers, like the pointers IDF keeps
+	std::string head;
+	head.reserve(HOST_RESP_HEAD_LEN);
+	head.append("HTTP/1.1 ").append(req->status).append("\r\nContent-Type: ").append(req->type).append("\r\n");
+	char framing[48] = "Transfer-Encoding: chunked\r\n";
+	if (content_len >= 0)
+	{
+		snprintf(framing, sizeof(framing), "Content-Length: %zd\r\n", content_len);
+	}
+	head.append(framing);
+	for (const auto &h : req->resp_headers)
+	{
+		head.append(h.first).append(": ").append(h.second).append("\r\n");
+	}
+	head += "\r\n";
+	req->headers_sent = true;
+	return head;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+	host_request *req = (host_request *)r->aux;
+	if (buf_len == HTTPD_RESP_USE_STRLEN)
+	{
+		buf_len = buf ? strlen(buf) : 0;
+	}
+	std::string head = response_head(req, buf_len);
+	if (!send_all(req->sess->fd, head.data(), head.size()) || (buf_len > 0 && !send_all(req->sess->fd, buf, buf_len)))
+	{
+		return ESP_ERR_HTTPD_RESP_SEND;
+	}
+	return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+	host_request *req = (host_request *)r->aux;
+	if (buf_len == HTTPD_RESP_USE_STRLEN)
+	{
+		buf_len = buf ? strlen(buf) : 0;
+	}
+	std::string out = req->headers_sent ? "" : response_head(req, -1);
+	char size[24];
+	snprintf(size, sizeof(size), "%zx\r\n", buf ? (size_t)buf_len : 0);
+	out += size;
+	if (buf && buf_len > 0)
+	{
+		out.append(buf, buf_len);
+	}
+	out += "\r\n";
+	return send_all(req->sess->fd, out.data(), out.size()) ? ESP_OK : ESP_ERR_HTTPD_RESP_SEND;
+}
+
+esp_err_t httpd_resp_send_404(httpd_req_t *r)
+{
+	httpd_resp_set_status(r, "404 Not Found");
+	httpd_resp_set_type(r, "text/html");
+	return httpd_resp_send(r, "This URI does not exist", HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t httpd_resp_send_500(httpd_req_t *r)
+{
+	httpd_resp_set_status(r, "500 Internal Server Error");
+	httpd_resp_set_type(r, "text/html");
+	return httpd_resp_send(r, "Server has encountered an unexpected error", HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd)
+{
+	host_server *hd = (host_server *)handle;
+	{
+		std::lock_guard<std::mutex> lock(hd->close_mutex);
+		hd->close_requests.push_back(sockfd);
+	}
+	return write(hd->wake[1], "", 1) == 1 ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *pkt, size_t max_len)
+{
+	host_session *s = ((host_request *)req->aux)->sess;
+	pkt->final = s->ws_final;
+	pkt->fragmented = !s->ws_final || s->ws_type == HTTPD_WS_TYPE_CONTINUE;
+	pkt->type = s->ws_type;
+	pkt->len = s->ws_len;
+	if (max_len == 0)
+	{
+		return ESP_OK; // Only the length
+	}
+	if (!pkt->payload)
+	{
+		return ESP_ERR_INVALID_ARG;
+	}
+	if (max_len < s->ws_len - s->ws_read)
+	{
+		return ESP_ERR_INVALID_SIZE;
+	}
+	return ws_read_payload(s, pkt->payload, s->ws_len - s->ws_read) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *pkt)
+{
+	host_session *s = ((host_request *)req->aux)->sess;
+	return ws_send(s->fd, pkt->type, pkt->final, pkt->payload, pkt->len) ? ESP_OK : ESP_FAIL;
+}
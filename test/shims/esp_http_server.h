@@ -0,0 +1,146 @@
+/* Host shim of the ESP-IDF HTTP server on POSIX sockets
+ *
+ * Like the IDF server, each httpd_start() runs one task that accepts at most
+ * max_open_sockets sessions and calls the URI handlers one request at a
+ * time. Sessions are HTTP/1.1 keep-alive, a handler returning an error closes
+ * its session, and close_fn (if set) owns closing the descriptor. WebSocket
+ * handlers get the handshake with HTTP_GET and then one call per data frame.
+ * The listening port is server_port plus the offset set with
+ * host_httpd_set_port_offset() (see host.h), so no privileges are needed.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/types.h>
+#include "esp_err.h"
+
+#define ESP_ERR_HTTPD_BASE 0xb000
+#define ESP_ERR_HTTPD_HANDLERS_FULL (ESP_ERR_HTTPD_BASE + 1)
+#define ESP_ERR_HTTPD_HANDLER_EXISTS (ESP_ERR_HTTPD_BASE + 2)
+#define ESP_ERR_HTTPD_INVALID_REQ (ESP_ERR_HTTPD_BASE + 3)
+#define ESP_ERR_HTTPD_RESULT_TRUNC (ESP_ERR_HTTPD_BASE + 4)
+#define ESP_ERR_HTTPD_RESP_HDR (ESP_ERR_HTTPD_BASE + 5)
+#define ESP_ERR_HTTPD_RESP_SEND (ESP_ERR_HTTPD_BASE + 6)
+#define ESP_ERR_HTTPD_TASK (ESP_ERR_HTTPD_BASE + 8)
+
+#define HTTPD_RESP_USE_STRLEN -1
+#define HTTPD_MAX_REQ_HDR_LEN 1024 // CONFIG_HTTPD_MAX_REQ_HDR_LEN of Arduino-ESP32
+#define HTTPD_MAX_URI_LEN 512
+
+// Request methods, numbered like http_parser
+typedef enum
+{
+	HTTP_DELETE = 0,
+	HTTP_GET = 1,
+	HTTP_HEAD = 2,
+	HTTP_POST = 3,
+	HTTP_PUT = 4,
+	HTTP_OPTIONS = 6,
+} httpd_method_t;
+
+typedef void *httpd_handle_t;
+typedef void (*httpd_close_func_t)(httpd_handle_t hd, int sockfd);
+typedef bool (*httpd_uri_match_func_t)(const char *reference_uri, const char *uri_to_match, size_t match_upto);
+
+typedef struct
+{
+	unsigned task_priority;
+	size_t stack_size;
+	int core_id;
+	uint16_t server_port;
+	uint16_t ctrl_port;
+	uint16_t max_open_sockets;
+	uint16_t max_uri_handlers;
+	uint16_t max_resp_headers;
+	uint16_t backlog_conn;
+	bool lru_purge_enable;
+	uint16_t recv_wait_timeout; // Seconds
+	uint16_t send_wait_timeout; // Seconds
+	httpd_close_func_t close_fn;
+	httpd_uri_match_func_t uri_match_fn;
+} httpd_config_t;
+
+#define HTTPD_DEFAULT_CONFIG()           \
+	{                                    \
+		.task_priority = 5,              \
+		.stack_size = 4096,              \
+		.core_id = 0x7FFFFFFF,           \
+		.server_port = 80,               \
+		.ctrl_port = 32768,              \
+		.max_open_sockets = 7,           \
+		.max_uri_handlers = 8,           \
+		.max_resp_headers = 8,           \
+		.backlog_conn = 5,               \
+		.lru_purge_enable = false,       \
+		.recv_wait_timeout = 5,          \
+		.send_wait_timeout = 5,          \
+		.close_fn = NULL,                \
+		.uri_match_fn = NULL,            \
+	}
+
+typedef struct httpd_req
+{
+	httpd_handle_t handle;
+	int method;
+	char uri[HTTPD_MAX_URI_LEN + 1];
+	size_t content_len;
+	void *user_ctx;
+	void *aux; // Session and response state of the shim
+} httpd_req_t;
+
+typedef struct
+{
+	const char *uri;
+	httpd_method_t method;
+	esp_err_t (*handler)(httpd_req_t *r);
+	void *user_ctx;
+	bool is_websocket;
+	bool handle_ws_control_frames;
+	const char *supported_subprotocol;
+} httpd_uri_t;
+
+typedef enum
+{
+	HTTPD_WS_TYPE_CONTINUE = 0x0,
+	HTTPD_WS_TYPE_TEXT = 0x1,
+	HTTPD_WS_TYPE_BINARY = 0x2,
+	HTTPD_WS_TYPE_CLOSE = 0x8,
+	HTTPD_WS_TYPE_PING = 0x9,
+	HTTPD_WS_TYPE_PONG = 0xA,
+} httpd_ws_type_t;
+
+typedef struct
+{
+	bool final;
+	bool fragmented;
+	httpd_ws_type_t type;
+	uint8_t *payload;
+	size_t len;
+} httpd_ws_frame_t;
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config);
+esp_err_t httpd_stop(httpd_handle_t handle);
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler);
+bool httpd_uri_match_wildcard(const char *uri_template, const char *uri_to_match, size_t match_upto);
+
+size_t httpd_req_get_url_query_len(httpd_req_t *r);
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len);
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size);
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field);
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size);
+int httpd_req_to_sockfd(httpd_req_t *r);
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status);
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type);
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value);
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_404(httpd_req_t *r);
+esp_err_t httpd_resp_send_500(httpd_req_t *r);
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd);
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *pkt, size_t max_len);
+esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *pkt);
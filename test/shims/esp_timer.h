@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+// Microseconds since the program started, plus whatever the tests added with host_clock_advance_ms
+int64_t esp_timer_get_time();
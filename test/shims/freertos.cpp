@@ -0,0 +1,226 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string.h>
+
+// Structure for a task: a thread and its notification value
+struct host_task
+{
+	std::mutex mutex;
+	std::condition_variable cv;
+	uint32_t notify = 0;
+};
+
+struct host_semaphore
+{
+	std::mutex mutex;
+	std::condition_variable cv;
+	UBaseType_t count;
+	UBaseType_t max;
+};
+
+struct host_queue
+{
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque<std::vector<uint8_t>> items;
+	UBaseType_t length;
+	UBaseType_t item_size;
+};
+
+static thread_local host_task *current_task = NULL;
+
+// Function to wait on cv until ready() holds or the ticks run out
+template <typename Ready>
+static bool wait_ticks(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, TickType_t ticks, Ready ready)
+{
+	if (ticks == portMAX_DELAY)
+	{
+		cv.wait(lock, ready);
+		return true;
+	}
+	return cv.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t priority,
+								   TaskHandle_t *handle, BaseType_t core)
+{
+	host_task *task = new host_task;
+	if (handle)
+	{
+		*handle = task;
+	}
+	std::thread([fn, arg, task]() {
+		current_task = task;
+		fn(arg);
+	}).detach();
+	return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t priority, TaskHandle_t *handle)
+{
+	return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+	if (!task || task == current_task)
+	{
+		// The thread ends here, its handle stays valid for late notifications
+		pthread_exit(NULL);
+	}
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+	if (!current_task)
+	{
+		current_task = new host_task; // Main thread or a thread the shim did not start
+	}
+	return current_task;
+}
+
+TickType_t xTaskGetTickCount()
+{
+	return esp_timer_get_time() / 1000;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+void vTaskDelayUntil(TickType_t *previous, TickType_t increment)
+{
+	*previous += increment;
+	int32_t left = (int32_t)(*previous - xTaskGetTickCount());
+	if (left > 0)
+	{
+		vTaskDelay(left);
+	}
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+	host_task *task = xTaskGetCurrentTaskHandle();
+	std::unique_lock<std::mutex> lock(task->mutex);
+	wait_ticks(task->cv, lock, ticks, [task] { return task->notify > 0; });
+	uint32_t value = task->notify;
+	if (value)
+	{
+		task->notify = clear ? 0 : value - 1;
+	}
+	return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+	std::lock_guard<std::mutex> lock(task->mutex);
+	task->notify++;
+	task->cv.notify_all();
+	return pdPASS;
+}
+
+static SemaphoreHandle_t semaphore_create(UBaseType_t max, UBaseType_t initial)
+{
+	host_semaphore *sem = new host_semaphore;
+	sem->count = initial;
+	sem->max = max;
+	return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+	return semaphore_create(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+	return semaphore_create(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial)
+{
+	return semaphore_create(max, initial);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+	delete sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+	std::unique_lock<std::mutex> lock(sem->mutex);
+	if (!wait_ticks(sem->cv, lock, ticks, [sem] { return sem->count > 0; }))
+	{
+		return pdFALSE;
+	}
+	sem->count--;
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+	std::lock_guard<std::mutex> lock(sem->mutex);
+	if (sem->count >= sem->max)
+	{
+		return pdFALSE;
+	}
+	sem->count++;
+	sem->cv.notify_all();
+	return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+	host_queue *queue = new host_queue;
+	queue->length = length;
+	queue->item_size = item_size;
+	return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+	delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+	std::unique_lock<std::mutex> lock(queue->mutex);
+	if (!wait_ticks(queue->cv, lock, ticks, [queue] { return queue->items.size() < queue->length; }))
+	{
+		return pdFALSE;
+	}
+	const uint8_t *bytes = (const uint8_t *)item;
+	queue->items.emplace_back(bytes, bytes + queue->item_size);
+	queue->cv.notify_all();
+	return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+	std::unique_lock<std::mutex> lock(queue->mutex);
+	if (!wait_ticks(queue->cv, lock, ticks, [queue] { return !queue->items.empty(); }))
+	{
+		return pdFALSE;
+	}
+	memcpy(item, queue->items.front().data(), queue->item_size);
+	queue->items.pop_front();
+	queue->cv.notify_all();
+	return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+	std::lock_guard<std::mutex> lock(queue->mutex);
+	return queue->items.size();
+}
@@ -0,0 +1,45 @@
+/* Host shim of the FreeRTOS API used by the car firmware
+ *
+ * Tasks are threads, one tick is one millisecond of the host clock. Critical
+ * sections are recursive mutexes, so they keep other tasks out but do not
+ * stop the world like on the ESP32.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xffffffffUL
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7fffffff
+
+typedef struct
+{
+	pthread_mutex_t mutex;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP}
+
+static inline void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+	pthread_mutex_lock(&mux->mutex);
+}
+
+static inline void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+	pthread_mutex_unlock(&mux->mutex);
+}
+
+#define portENTER_CRITICAL_ISR portENTER_CRITICAL
+#define portEXIT_CRITICAL_ISR portEXIT_CRITICAL
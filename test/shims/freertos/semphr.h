@@ -0,0 +1,12 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct host_semaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
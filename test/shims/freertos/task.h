@@ -0,0 +1,19 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t priority,
+								   TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t priority, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t *previous, TickType_t increment);
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
@@ -0,0 +1,44 @@
+/* Hooks for tests running the firmware modules on the host */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Move esp_timer_get_time(), millis() and the tick count forward without sleeping
+void host_clock_advance_ms(uint32_t ms);
+
+// Write a stand-in JPEG of len bytes: a SOF0 header with the size, then gray filler that the
+// host jpg2rgb565 decodes as a uniform image of that brightness. Returns len, 0 if too short
+size_t host_fake_jpeg(uint8_t *out, size_t len, uint16_t width, uint16_t height, uint8_t gray);
+
+// Set the brightness of the frames the stand-in camera produces
+void host_camera_set_gray(uint8_t gray);
+
+// Make the scene change on every frame, as in front of a driving car
+void host_camera_set_moving(bool moving);
+
+// Calls of jpg2rgb565 since start, and calls that started while another one was running
+uint32_t host_jpeg_decodes();
+uint32_t host_jpeg_overlaps();
+
+// Make psramFound() report PSRAM (off by default, as on a board without it)
+void host_psram_enable(bool enable);
+
+// Ports of httpd_start() are server_port plus this offset (default 8000, so port 80 is served on 8080)
+void host_httpd_set_port_offset(int offset);
+
+// Limit the bytes per second the firmware can send() over all its sockets together, 0 for no limit
+void host_link_set_rate(uint32_t bytes_per_s);
+
+// Structure for a stand-in device wired to a UART, such as the GPS module on UART 1. It is called
+// from whichever task uses the port
+typedef struct
+{
+	void (*baud)(uint32_t baud);					// The port was opened or switched to this baud rate
+	void (*write)(const uint8_t *data, size_t len); // Bytes the firmware sent
+	int (*available)();								// Bytes received and not read yet
+	int (*read)();									// Next byte received, -1 if none
+} host_uart_device_t;
+
+// Wire a device to a UART, NULL to unplug it. The HardwareSerial of that UART then talks to it
+void host_uart_attach(int uart, const host_uart_device_t *device);
@@ -0,0 +1,75 @@
+#include "img_converters.h"
+#include "host.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdlib.h>
+#include <string.h>
+
+static std::atomic<int> decoding(0);
+static std::atomic<uint32_t> decodes(0);
+static std::atomic<uint32_t> overlaps(0);
+
+size_t host_fake_jpeg(uint8_t *out, size_t len, uint16_t width, uint16_t height, uint8_t gray)
+{
+	static const size_t header = 2 + 10; // SOI and a baseline SOF0 with one component
+	if (len < header + 3)
+	{
+		return 0;
+	}
+	const uint8_t sof[] = {0xFF, 0xD8, 0xFF, 0xC0, 0, 8, 8, (uint8_t)(height >> 8), (uint8_t)height, (uint8_t)(width >> 8), (uint8_t)width, 1};
+	memcpy(out, sof, sizeof(sof));
+	memset(&out[header], gray, len - header - 2);
+	out[len - 2] = 0xFF;
+	out[len - 1] = 0xD9;
+	return len;
+}
+
+bool frame2jpg(camera_fb_t *fb, uint8_t quality, uint8_t **out, size_t *out_len)
+{
+	size_t len = 64 + fb->len / 16;
+	*out = (uint8_t *)malloc(len);
+	if (!*out)
+	{
+		return false;
+	}
+	*out_len = host_fake_jpeg(*out, len, fb->width, fb->height, fb->len ? fb->buf[0] : 0);
+	return true;
+}
+
+bool jpg2rgb565(const uint8_t *src, size_t src_len, uint8_t *out, jpg_scale_t scale)
+{
+	if (src_len < 15 || src[0] != 0xFF || src[1] != 0xD8 || src[2] != 0xFF || src[3] != 0xC0)
+	{
+		return false;
+	}
+	size_t round = (1 << scale) - 1; // Partial blocks at the edge still give a pixel
+	size_t height = ((src[7] << 8 | src[8]) + round) >> scale;
+	size_t width = ((src[9] << 8 | src[10]) + round) >> scale;
+	// The real decoder keeps its state in globals, count calls that would have trampled each other
+	if (decoding++ > 0)
+	{
+		overlaps++;
+	}
+	decodes++;
+	std::this_thread::sleep_for(std::chrono::microseconds(200)); // About what 1/8 scale costs on the ESP32
+	decoding--;
+	uint8_t gray = src[12];
+	uint16_t pixel = (gray >> 3) << 11 | (gray >> 2) << 5 | gray >> 3;
+	for (size_t i = 0; i < width * height; i++)
+	{
+		out[i * 2] = pixel >> 8; // Big endian like the esp32-camera decoder output
+		out[i * 2 + 1] = pixel & 0xFF;
+	}
+	return true;
+}
+
+uint32_t host_jpeg_decodes()
+{
+	return decodes;
+}
+
+uint32_t host_jpeg_overlaps()
+{
+	return overlaps;
+}
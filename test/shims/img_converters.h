@@ -0,0 +1,16 @@
+#pragma once
+
+// Only the converters the firmware uses. The host decoder reads the JPEGs made by host_fake_jpeg()
+#include "esp_camera.h"
+
+typedef enum
+{
+	JPG_SCALE_NONE,
+	JPG_SCALE_2X,
+	JPG_SCALE_4X,
+	JPG_SCALE_8X,
+	JPG_SCALE_MAX = JPG_SCALE_8X
+} jpg_scale_t;
+
+bool frame2jpg(camera_fb_t *fb, uint8_t quality, uint8_t **out, size_t *out_len);
+bool jpg2rgb565(const uint8_t *src, size_t src_len, uint8_t *out, jpg_scale_t scale);
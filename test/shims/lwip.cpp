@@ -0,0 +1,40 @@
+#include "lwip/sockets.h"
+#include "host.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#undef send
+
+#define HOST_LINK_SLICE 1460 // Bytes per send() on a slow link, one TCP segment
+
+static std::atomic<uint32_t> link_rate(0);
+static std::mutex link_mutex;
+static std::chrono::steady_clock::time_point link_free; // When the link has carried what it was given
+
+void host_link_set_rate(uint32_t bytes_per_s)
+{
+	link_rate = bytes_per_s;
+}
+
+// A slow link takes one segment at a time and returns once it is on the air, the way a full
+// send buffer blocks on the board. All sockets share the link
+ssize_t host_link_send(int fd, const void *buf, size_t len, int flags)
+{
+	uint32_t rate = link_rate;
+	if (!rate)
+	{
+		return send(fd, buf, len, flags);
+	}
+	len = std::min<size_t>(len, HOST_LINK_SLICE);
+	std::chrono::steady_clock::time_point done;
+	{
+		std::lock_guard<std::mutex> lock(link_mutex);
+		link_free = std::max(link_free, std::chrono::steady_clock::now()) + std::chrono::microseconds(len * 1000000ULL / rate);
+		done = link_free;
+	}
+	std::this_thread::sleep_until(done);
+	return send(fd, buf, len, flags);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// lwip offers the BSD socket API, on the host it is the system one
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+// send() of the firmware goes over the simulated WiFi link, which tests can slow down (host.h)
+ssize_t host_link_send(int fd, const void *buf, size_t len, int flags);
+#define send host_link_send
@@ -0,0 +1,67 @@
+/* Host shim of the parts of the UNO R4 core the AutoCar_Arduino sketch uses
+ *
+ * The board runs on a simulated clock (uno.h): millis() and micros() only
+ * move when the sketch delays or a test advances them, and timer interrupts
+ * run on the way. Pins keep the last value written, echo pins follow the
+ * simulated sonars, and Serial1 receives the bytes a test schedules.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void noInterrupts();
+void interrupts();
+
+// USB serial: prints are counted, not shown, and lost while begin() was not called
+class SerialUSB
+{
+public:
+	void begin(unsigned long baud) { started = true; }
+	size_t print(const char *text) { return count(strlen(text)); }
+	size_t print(char c) { return count(1); }
+	size_t print(int value) { return count(1); }
+	size_t println(const char *text) { return count(strlen(text) + 1); }
+	size_t println(char c) { return count(2); }
+	size_t println() { return count(1); }
+
+	bool started = false;
+	uint32_t lines = 0; // print calls while started
+	uint32_t lost = 0;	// print calls before begin()
+
+private:
+	size_t count(size_t len)
+	{
+		(started ? lines : lost)++;
+		return started ? len : 0;
+	}
+};
+
+// UART: receives the bytes scheduled with uno_serial1_receive() once the clock reaches them
+class UART
+{
+public:
+	void begin(unsigned long baud) {}
+	int available();
+	int read();
+	size_t write(uint8_t c) { return 1; }
+};
+
+extern SerialUSB Serial;
+extern UART Serial1;
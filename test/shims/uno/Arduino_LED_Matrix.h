@@ -0,0 +1,14 @@
+/* Host shim of the UNO R4 WiFi LED matrix: shows nothing */
+#pragma once
+
+#include <stdint.h>
+
+#define LEDMATRIX_ANIMATION_OPENSOURCE 0
+
+class ArduinoLEDMatrix
+{
+public:
+	void loadSequence(int sequence) {}
+	void begin() {}
+	void play(bool loop) {}
+};
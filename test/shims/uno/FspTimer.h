@@ -0,0 +1,34 @@
+/* Host shim of the UNO R4 FspTimer: a periodic timer whose overflow
+ * interrupt runs on the simulated clock of uno.h
+ */
+#pragma once
+
+#include <stdint.h>
+
+#define TIMER_MODE_PERIODIC 1
+
+typedef struct
+{
+	uint32_t event;
+	void const *p_context;
+} timer_callback_args_t;
+
+typedef void (*GPTimerCbk_f)(timer_callback_args_t *args);
+
+class FspTimer
+{
+public:
+	// Function to get a free timer channel, -1 when uno_timers_available() ran out
+	static int8_t get_available_timer(uint8_t &type, bool force = false);
+	bool begin(uint8_t mode, uint8_t type, uint8_t channel, float freq_hz, float duty_perc, GPTimerCbk_f cbk = nullptr,
+			   void *ctx = nullptr);
+	bool setup_overflow_irq(uint8_t priority = 12) { return callback != nullptr; }
+	bool open() { return true; }
+	bool start();
+	bool stop();
+
+	GPTimerCbk_f callback = nullptr;
+	uint32_t period_us = 0;
+	bool running = false;
+	uint64_t next_us = 0; // Clock time of the next interrupt while running
+};
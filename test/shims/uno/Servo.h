@@ -0,0 +1,12 @@
+/* Host shim of the Servo library: remembers the last angle */
+#pragma once
+
+class Servo
+{
+public:
+	void attach(int pin) {}
+	void write(int value) { angle = value; }
+	int read() { return angle; }
+
+	int angle = 90;
+};
@@ -0,0 +1,267 @@
+#include "Arduino.h"
+#include "FspTimer.h"
+#include "uno.h"
+#include <deque>
+
+#define UNO_PINS 32
+#define UNO_SONARS 4
+#define UNO_TIMERS 4
+
+// Structure for a simulated ultrasonic sensor
+typedef struct
+{
+	uint8_t trig;
+	uint8_t echo;
+	int cm;
+	uint64_t echo_start_us; // Echo pulse of the last ping
+	uint32_t echo_len_us;
+	uint32_t pings;
+} uno_sonar_t;
+
+// Structure for a byte Serial1 receives at a given time
+typedef struct
+{
+	uint64_t at_us;
+	uint8_t byte;
+} uno_rx_t;
+
+SerialUSB Serial;
+UART Serial1;
+
+static uint64_t now_us = 0;
+static int pins[UNO_PINS];
+static uno_sonar_t sonars[UNO_SONARS];
+static int sonar_count = 0;
+static FspTimer *timers[UNO_TIMERS];
+static int timer_count = 0;
+static int timers_free = 1;
+static bool in_isr = false;
+static uno_isr_stats_t isr_stats;
+static std::deque<uno_rx_t> rx;
+static uint64_t last_read_us = 0;
+
+uint64_t uno_now_us()
+{
+	return now_us;
+}
+
+void uno_advance_us(uint64_t us)
+{
+	uint64_t end = now_us + us;
+	while (true)
+	{
+		// Run the interrupt that falls due first, the clock stands still while it runs
+		FspTimer *due = nullptr;
+		for (int i = 0; i < timer_count; i++)
+		{
+			if (timers[i]->running && timers[i]->next_us <= end && (!due || timers[i]->next_us < due->next_us))
+			{
+				due = timers[i];
+			}
+		}
+		if (!due)
+		{
+			break;
+		}
+		now_us = due->next_us;
+		due->next_us += due->period_us;
+		timer_callback_args_t args = {0, nullptr};
+		in_isr = true;
+		isr_stats.calls++;
+		due->callback(&args);
+		in_isr = false;
+	}
+	now_us = end;
+}
+
+void uno_timers_available(int count)
+{
+	timers_free = count;
+}
+
+void uno_sonar_attach(uint8_t trig, uint8_t echo, int cm)
+{
+	if (sonar_count < UNO_SONARS)
+	{
+		sonars[sonar_count++] = {trig, echo, cm, 0, 0, 0};
+	}
+}
+
+static uno_sonar_t *sonar_on(uint8_t pin, bool trig)
+{
+	for (int i = 0; i < sonar_count; i++)
+	{
+		if ((trig ? sonars[i].trig : sonars[i].echo) == pin)
+		{
+			return &sonars[i];
+		}
+	}
+	return nullptr;
+}
+
+void uno_sonar_set(uint8_t trig, int cm)
+{
+	uno_sonar_t *sonar = sonar_on(trig, true);
+	if (sonar)
+	{
+		sonar->cm = cm;
+	}
+}
+
+uint32_t uno_sonar_pings(uint8_t trig)
+{
+	uno_sonar_t *sonar = sonar_on(trig, true);
+	return sonar ? sonar->pings : 0;
+}
+
+void uno_serial1_receive(uint64_t at_us, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+	{
+		rx.push_back({at_us, data[i]});
+	}
+}
+
+uint64_t uno_serial1_last_read_us()
+{
+	return last_read_us;
+}
+
+uno_isr_stats_t uno_isr_stats()
+{
+	return isr_stats;
+}
+
+int uno_pin(uint8_t pin)
+{
+	return pin < UNO_PINS ? pins[pin] : 0;
+}
+
+unsigned long millis()
+{
+	return now_us / 1000;
+}
+
+unsigned long micros()
+{
+	return now_us;
+}
+
+void delay(unsigned long ms)
+{
+	delayMicroseconds(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	if (in_isr)
+	{
+		isr_stats.blocking++;
+		return;
+	}
+	uno_advance_us(us);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+	if (pin >= UNO_PINS)
+	{
+		return;
+	}
+	// The falling edge of a trigger pulse sends the burst, the echo pulse follows
+	uno_sonar_t *sonar = sonar_on(pin, true);
+	if (sonar && pins[pin] == HIGH && value == LOW)
+	{
+		sonar->echo_start_us = now_us + UNO_ECHO_DELAY_US;
+		sonar->echo_len_us = sonar->cm ? sonar->cm * UNO_US_PER_CM : UNO_NO_ECHO_US;
+		sonar->pings++;
+	}
+	pins[pin] = value;
+}
+
+int digitalRead(uint8_t pin)
+{
+	uno_sonar_t *sonar = sonar_on(pin, false);
+	if (sonar)
+	{
+		return now_us >= sonar->echo_start_us && now_us < sonar->echo_start_us + sonar->echo_len_us ? HIGH : LOW;
+	}
+	return pin < UNO_PINS ? pins[pin] : LOW;
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+	if (pin < UNO_PINS)
+	{
+		pins[pin] = value;
+	}
+}
+
+void noInterrupts()
+{
+}
+
+void interrupts()
+{
+}
+
+int UART::available()
+{
+	int count = 0;
+	for (const uno_rx_t &byte : rx)
+	{
+		if (byte.at_us > now_us)
+		{
+			break;
+		}
+		count++;
+	}
+	return count;
+}
+
+int UART::read()
+{
+	if (rx.empty() || rx.front().at_us > now_us)
+	{
+		return -1;
+	}
+	uint8_t byte = rx.front().byte;
+	rx.pop_front();
+	last_read_us = now_us;
+	return byte;
+}
+
+int8_t FspTimer::get_available_timer(uint8_t &type, bool force)
+{
+	type = 0;
+	return timers_free > 0 ? --timers_free : -1;
+}
+
+bool FspTimer::begin(uint8_t mode, uint8_t type, uint8_t channel, float freq_hz, float duty_perc, GPTimerCbk_f cbk, void *ctx)
+{
+	if (timer_count >= UNO_TIMERS || freq_hz <= 0)
+	{
+		return false;
+	}
+	callback = cbk;
+	period_us = (uint32_t)(1000000.0f / freq_hz + 0.5f);
+	timers[timer_count++] = this;
+	return true;
+}
+
+bool FspTimer::start()
+{
+	running = true;
+	next_us = now_us + period_us;
+	return true;
+}
+
+bool FspTimer::stop()
+{
+	running = false;
+	return true;
+}
@@ -0,0 +1,45 @@
+/* Hooks for tests running the AutoCar_Arduino sketch on the simulated UNO R4 */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define UNO_ECHO_DELAY_US 450 // From the end of the trigger pulse to the start of the echo
+#define UNO_NO_ECHO_US 38000  // Echo pulse of an HC-SR04 that heard nothing
+#define UNO_US_PER_CM 57      // Echo pulse length per cm of distance (as NewPing counts it)
+
+// Structure for what the timer interrupts did since start
+typedef struct
+{
+	uint32_t calls;
+	uint32_t blocking; // delay() or delayMicroseconds() called from an interrupt
+} uno_isr_stats_t;
+
+// Function to get the simulated time in microseconds
+uint64_t uno_now_us();
+
+// Function to move the clock forward, running the timer interrupts that fall due on the way
+void uno_advance_us(uint64_t us);
+
+// Function to set the number of timer channels FspTimer::get_available_timer() hands out (default 1)
+void uno_timers_available(int count);
+
+// Function to put an ultrasonic sensor on trig and echo with an obstacle at cm (0 = nothing in range)
+void uno_sonar_attach(uint8_t trig, uint8_t echo, int cm);
+
+// Function to move the obstacle in front of the sensor on trig
+void uno_sonar_set(uint8_t trig, int cm);
+
+// Function to count the trigger pulses of the sensor on trig
+uint32_t uno_sonar_pings(uint8_t trig);
+
+// Function to have Serial1 receive bytes once the clock reaches at_us
+void uno_serial1_receive(uint64_t at_us, const uint8_t *data, size_t len);
+
+// Function to get the time of the last Serial1.read()
+uint64_t uno_serial1_last_read_us();
+
+uno_isr_stats_t uno_isr_stats();
+
+// Function to get the last value written to a pin with digitalWrite() or analogWrite()
+int uno_pin(uint8_t pin);
@@ -0,0 +1,212 @@
+// Host tests of the automatic mode: the state machine of auto_drive.h on its own, then the whole
+// sketch on the simulated UNO R4, measuring how long a command waits before it is read
+#include "uno.h"
+#include "check.h"
+#include "../AutoCar_Arduino/AutoCar_Arduino.ino"
+#include <algorithm>
+#include <vector>
+
+#define LOOP_US 10	// Cost of one pass of loop() besides the delays it makes itself
+#define PROBES 200 // Commands sent in each simulation
+
+static auto_inputs_t clear_inputs(uint32_t sampled_ms)
+{
+	auto_inputs_t in = {100, 100, 100, sampled_ms, sampled_ms, sampled_ms, 0, 0, 255, 0};
+	return in;
+}
+
+static void test_sequence()
+{
+	auto_drive_t a;
+	auto_enter(&a, AUTO_START, 1000);
+	auto_inputs_t in = clear_inputs(1000);
+	CHECK_EQ(auto_step(&a, &in, 1499).motor, AUTO_MOTOR_KEEP);
+	CHECK_EQ(a.state, AUTO_START);
+	auto_step(&a, &in, 1500);
+	CHECK_EQ(a.state, AUTO_RESAMPLE);
+
+	// Only readings taken after entering AUTO_RESAMPLE count
+	CHECK_EQ(auto_step(&a, &in, 1510).motor, AUTO_MOTOR_STOP);
+	CHECK_EQ(a.state, AUTO_RESAMPLE);
+	in = clear_inputs(1520);
+	auto_step(&a, &in, 1530);
+	CHECK_EQ(a.state, AUTO_DRIVE);
+	CHECK_EQ(auto_step(&a, &in, 1540).motor, AUTO_MOTOR_FORWARD);
+
+	// Obstacle on the left: stop, back away, stop, then look right
+	in.left = stop_car_distance_side;
+	CHECK_EQ(auto_step(&a, &in, 1550).motor, AUTO_MOTOR_STOP);
+	CHECK_EQ(a.state, AUTO_STOP);
+	CHECK_EQ(auto_step(&a, &in, 1550 + AUTO_PAUSE_MS).motor, AUTO_MOTOR_BACK);
+	CHECK_EQ(auto_step(&a, &in, 1550 + 2 * AUTO_PAUSE_MS).motor, AUTO_MOTOR_STOP);
+	auto_action_t action = auto_step(&a, &in, 1550 + 3 * AUTO_PAUSE_MS);
+	CHECK_EQ(action.look, 10);
+	CHECK_EQ(a.state, AUTO_LOOK_RIGHT);
+
+	// Each side is measured once the front sensor was read after the servo moved
+	in.servo_moved_ms = 2500;
+	in.front_ms = 2500;
+	auto_step(&a, &in, 2600);
+	CHECK_EQ(a.state, AUTO_LOOK_RIGHT);
+	in.front = 80;
+	in.front_ms = 2810;
+	CHECK_EQ(auto_step(&a, &in, 2820).look, 170);
+	CHECK_EQ(a.state, AUTO_LOOK_LEFT);
+	in.servo_moved_ms = 2820;
+	in.front = 40;
+	in.front_ms = 3130;
+	action = auto_step(&a, &in, 3140);
+	CHECK_EQ(action.look, 90);
+	CHECK_EQ(action.motor, AUTO_MOTOR_SPIN_RIGHT);
+	CHECK_EQ(a.distance_right, 80);
+	CHECK_EQ(a.distance_left, 40);
+	CHECK_EQ(auto_step(&a, &in, 3140 + AUTO_TURN_MS).motor, AUTO_MOTOR_STOP);
+	CHECK_EQ(a.state, AUTO_RESAMPLE);
+}
+
+static void test_vision()
+{
+	auto_drive_t a;
+	auto_enter(&a, AUTO_DRIVE, 0);
+	auto_inputs_t in = clear_inputs(0);
+
+	// A cue that says there is little room ahead stops the car even though the sonar sees nothing
+	in.vision_clear = VISION_STOP_CLEAR;
+	in.vision_ms = 100;
+	auto_action_t action = auto_step(&a, &in, 100 + VISION_MAX_AGE_MS - 1);
+	CHECK_EQ(action.motor, AUTO_MOTOR_STOP);
+	CHECK(action.camera_obstacle);
+
+	// An old cue is ignored
+	auto_enter(&a, AUTO_DRIVE, 0);
+	CHECK_EQ(auto_step(&a, &in, 100 + VISION_MAX_AGE_MS).motor, AUTO_MOTOR_FORWARD);
+
+	// A clear steering hint turns without sweeping the servo
+	auto_enter(&a, AUTO_STOP_AFTER_BACK, 1000);
+	in.vision_steer = -VISION_STEER_MIN;
+	in.vision_ms = 1200;
+	action = auto_step(&a, &in, 1000 + AUTO_PAUSE_MS);
+	CHECK_EQ(action.motor, AUTO_MOTOR_SPIN_LEFT);
+	CHECK_EQ(action.look, AUTO_LOOK_KEEP);
+	CHECK_EQ(a.state, AUTO_TURN);
+}
+
+// The automatic mode branch of loop() before the state machine: five delay(300), the servo sweeps
+// and the turn block everything, and commands are only read at three points of the sequence
+static int legacy_front = 20, legacy_right = 100, legacy_left = 100; // Same obstacle as for the sketch
+
+static void legacy_poll()
+{
+	while (Serial1.available() > 0)
+	{
+		Serial1.read();
+	}
+}
+
+// Function to model a blocking ping: delay(30), then NewPing's ping_cm() waits for the echo
+static int legacy_ping(int cm)
+{
+	delay(30);
+	delayMicroseconds(10 + UNO_ECHO_DELAY_US + cm * UNO_US_PER_CM);
+	return cm;
+}
+
+static void legacy_loop()
+{
+	legacy_poll(); // Top of loop()
+	delay(50);
+	legacy_poll();
+	if (legacy_front <= stop_car_distance || legacy_right <= stop_car_distance_side || legacy_left <= stop_car_distance_side)
+	{
+		delay(300); // Stop
+		delay(300); // Back
+		delay(300); // Stop
+		delay(300); // lookRight()
+		int right = legacy_ping(legacy_front);
+		delay(300);
+		delay(300); // lookLeft()
+		int left = legacy_ping(legacy_front);
+		delay(300);
+		legacy_poll();
+		if (right != left)
+		{
+			delay(250); // AutoTurnRight() or AutoTurnLeft()
+		}
+	}
+	legacy_front = legacy_ping(legacy_front);
+	legacy_left = legacy_ping(legacy_left);
+	legacy_right = legacy_ping(legacy_right);
+}
+
+static void send_frame(uint64_t at_us, uint8_t cmd, uint8_t arg0, uint8_t arg1)
+{
+	static uint8_t seq = 0;
+	uint8_t frame[CAR_FRAME_LEN];
+	car_frame_encode(frame, seq++, cmd, arg0, arg1);
+	uno_serial1_receive(at_us, frame, sizeof(frame));
+}
+
+// Function to send PROBES camera cues at varying times while run() loops, and return how long
+// each one waited in the UART buffer, in microseconds
+static std::vector<uint32_t> probe_latency(void (*run)())
+{
+	std::vector<uint32_t> waits;
+	uint32_t rand_state = 1;
+	uint64_t arrival = uno_now_us();
+	for (int i = 0; i < PROBES; i++)
+	{
+		rand_state = rand_state * 1103515245 + 12345;
+		arrival = std::max(arrival, uno_serial1_last_read_us()) + 1000 + (rand_state >> 8) % 40000;
+		send_frame(arrival, CAR_CMD_VISION, 0, 255);
+		while (uno_now_us() < arrival || Serial1.available() > 0)
+		{
+			run();
+		}
+		waits.push_back(uno_serial1_last_read_us() - arrival);
+	}
+	std::sort(waits.begin(), waits.end());
+	return waits;
+}
+
+static bool visited[AUTO_RESAMPLE + 1];
+
+static void sketch_pass()
+{
+	loop();
+	uno_advance_us(LOOP_US);
+	visited[autoDrive.state] = true;
+}
+
+// An obstacle stays in front of the car, so the avoidance sequence repeats the whole time:
+// the worst case for the blocking loop
+static void test_command_latency()
+{
+	std::vector<uint32_t> before = probe_latency(legacy_loop);
+
+	uno_sonar_attach(trig_pin_1, echo_pin_1, 20);
+	uno_sonar_attach(trig_pin_2, echo_pin_2, 100);
+	uno_sonar_attach(trig_pin_3, echo_pin_3, 100);
+	setup();
+	send_frame(uno_now_us(), CAR_CMD_AUTO, 0, 0);
+	for (int i = 0; i < 1000; i++)
+	{
+		sketch_pass();
+	}
+	CHECK(isAutoMode);
+	std::vector<uint32_t> after = probe_latency(sketch_pass);
+
+	printf("command wait in auto mode: before p50 %.1f ms, max %.1f ms; after p50 %.3f ms, max %.3f ms\n",
+		   before[PROBES / 2] / 1000.0, before.back() / 1000.0, after[PROBES / 2] / 1000.0, after.back() / 1000.0);
+	CHECK(before.back() > 1000000);
+	CHECK(after.back() < 1000);
+	// The sequence itself still ran through while commands were read
+	CHECK(visited[AUTO_STOP] && visited[AUTO_BACK] && visited[AUTO_LOOK_LEFT] && visited[AUTO_RESAMPLE]);
+}
+
+int main()
+{
+	test_sequence();
+	test_vision();
+	test_command_latency();
+	return check_result("auto_drive");
+}
@@ -0,0 +1,182 @@
+// Host tests of the UART frame parser shared with the Arduino
+#include "car_protocol.h"
+#include "check.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#define UART_BAUD 115200
+#define UART_BYTE_US (10 * 1000000.0 / UART_BAUD) // Start bit, 8 data bits, stop bit
+#define POLL_US 50								  // Time between two reads of Serial1 by the sketch
+
+// Function to feed bytes and count the frames that come out
+static int feed(car_parser_t *p, const uint8_t *data, size_t len, car_frame_t *last)
+{
+	int frames = 0;
+	for (size_t i = 0; i < len; i++)
+	{
+		if (car_parser_feed(p, data[i], last))
+		{
+			frames++;
+		}
+	}
+	return frames;
+}
+
+static void test_crc()
+{
+	// CRC-8/SMBUS (poly 0x07, init 0) check value
+	CHECK_EQ(car_crc8((const uint8_t *)"123456789", 9), 0xF4);
+	uint8_t frame[CAR_FRAME_LEN];
+	car_frame_encode(frame, 7, CAR_CMD_FORWARD, 200, 0);
+	CHECK_EQ(frame[0], CAR_FRAME_SYNC);
+	CHECK_EQ(frame[5], car_crc8(&frame[1], 4));
+}
+
+static void test_round_trip()
+{
+	car_parser_t p;
+	car_parser_init(&p);
+	car_frame_t out;
+	for (int seq = 0; seq < 300; seq++)
+	{
+		uint8_t frame[CAR_FRAME_LEN];
+		car_frame_encode(frame, seq, CAR_CMD_DRIVE, seq * 3, -seq);
+		CHECK_EQ(feed(&p, frame, sizeof(frame), &out), 1);
+		CHECK_EQ(out.seq, (uint8_t)seq);
+		CHECK_EQ(out.cmd, CAR_CMD_DRIVE);
+		CHECK_EQ(out.arg0, (uint8_t)(seq * 3));
+		CHECK_EQ(out.arg1, (uint8_t)-seq);
+	}
+	CHECK_EQ(p.frames, 300);
+	CHECK_EQ(p.crc_errors, 0);
+	CHECK_EQ(p.lost_frames, 0);
+}
+
+static void test_noise_and_resync()
+{
+	car_parser_t p;
+	car_parser_init(&p);
+	car_frame_t out;
+
+	// Debug text before the first frame is skipped
+	const char *text = "Booting...\r\n";
+	CHECK_EQ(feed(&p, (const uint8_t *)text, strlen(text), &out), 0);
+
+	uint8_t good[CAR_FRAME_LEN];
+	car_frame_encode(good, 1, CAR_CMD_LEFT, 0, 0);
+	CHECK_EQ(feed(&p, good, sizeof(good), &out), 1);
+
+	// A corrupted frame is dropped and counted
+	uint8_t bad[CAR_FRAME_LEN];
+	car_frame_encode(bad, 2, CAR_CMD_RIGHT, 10, 0);
+	bad[3] ^= 0x40;
+	CHECK_EQ(feed(&p, bad, sizeof(bad), &out), 0);
+	CHECK_EQ(p.crc_errors, 1);
+
+	// A truncated frame followed by a complete one: the parser finds the sync byte inside the bad buffer
+	uint8_t stream[3 + CAR_FRAME_LEN];
+	car_frame_encode(good, 3, CAR_CMD_STOP, 0, 0);
+	stream[0] = CAR_FRAME_SYNC;
+	stream[1] = 9;
+	stream[2] = CAR_CMD_BACK;
+	memcpy(&stream[3], good, CAR_FRAME_LEN);
+	CHECK_EQ(feed(&p, stream, sizeof(stream), &out), 1);
+	CHECK_EQ(out.seq, 3);
+	CHECK_EQ(out.cmd, CAR_CMD_STOP);
+	CHECK_EQ(p.lost_frames, 1); // Sequence 2 never arrived
+
+	// A sync byte as an argument value does not break the next frame
+	car_frame_encode(good, 4, CAR_CMD_DRIVE, CAR_FRAME_SYNC, CAR_FRAME_SYNC);
+	CHECK_EQ(feed(&p, good, sizeof(good), &out), 1);
+	CHECK_EQ(out.arg0, CAR_FRAME_SYNC);
+	CHECK_EQ(p.frames, 3);
+}
+
+// Function to build command frames back to back, as the ESP32 sends them when it has a backlog.
+// Every corrupt_every-th byte is flipped, 0 = a clean line
+static std::vector<uint8_t> make_wire(int commands, int corrupt_every)
+{
+	std::vector<uint8_t> wire(commands * CAR_FRAME_LEN);
+	for (int i = 0; i < commands; i++)
+	{
+		car_frame_encode(&wire[i * CAR_FRAME_LEN], i, CAR_CMD_DRIVE, i, -i);
+	}
+	for (size_t i = corrupt_every; corrupt_every && i < wire.size(); i += corrupt_every)
+	{
+		wire[i] ^= 0x5A;
+	}
+	return wire;
+}
+
+// Function to replay the wire at UART_BAUD into a parser read every POLL_US, and report the
+// commands per second and the time from the first bit of a frame to its decoding
+static void bench_uart(const char *name, int corrupt_every)
+{
+	const int commands = 20000;
+	std::vector<uint8_t> wire = make_wire(commands, corrupt_every);
+	car_parser_t p;
+	car_parser_init(&p);
+	car_frame_t out;
+	std::vector<double> latency_us;
+	size_t next = 0;
+	double now = 0;
+	while (next < wire.size())
+	{
+		now += POLL_US;
+		// Feed every byte that has fully arrived by now
+		while (next < wire.size() && (next + 1) * UART_BYTE_US <= now)
+		{
+			if (car_parser_feed(&p, wire[next], &out))
+			{
+				latency_us.push_back(now - (next + 1 - CAR_FRAME_LEN) * UART_BYTE_US);
+			}
+			next++;
+		}
+	}
+	std::sort(latency_us.begin(), latency_us.end());
+
+	// The parser alone on this computer
+	auto start = std::chrono::steady_clock::now();
+	const int rounds = 50;
+	uint32_t parsed = 0;
+	for (int r = 0; r < rounds; r++)
+	{
+		car_parser_t q;
+		car_parser_init(&q);
+		for (uint8_t byte : wire)
+		{
+			parsed += car_parser_feed(&q, byte, &out);
+		}
+	}
+	double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+	double rate = p.frames / (now / 1e6);
+	printf("%-6s at %d baud: %.0f commands/s (line limit %.0f), latency p50 %.0f us max %.0f us, %u CRC errors, "
+		   "%u lost, parser %.1f ns/byte\n",
+		   name, UART_BAUD, rate, 1e6 / (CAR_FRAME_LEN * UART_BYTE_US), latency_us[latency_us.size() / 2], latency_us.back(),
+		   (unsigned)p.crc_errors, (unsigned)p.lost_frames, ns / (rounds * wire.size()));
+	CHECK(parsed > 0);
+	CHECK(rate > 0.95 * 1e6 / (CAR_FRAME_LEN * UART_BYTE_US) * p.frames / commands);
+	// A frame is decoded within one poll of its last byte
+	CHECK(latency_us.back() <= CAR_FRAME_LEN * UART_BYTE_US + POLL_US);
+	if (!corrupt_every)
+	{
+		CHECK_EQ(p.frames, commands);
+	}
+	else
+	{
+		// A flipped byte costs its own frame and at most the next one, never the rest of the stream
+		CHECK(p.frames >= commands - 2 * (wire.size() / corrupt_every));
+	}
+}
+
+int main()
+{
+	test_crc();
+	test_round_trip();
+	test_noise_and_resync();
+	bench_uart("clean", 0);
+	bench_uart("noisy", 997);
+	return check_result("car_protocol");
+}
@@ -0,0 +1,252 @@
+// Host tests of the joystick mixing used by the Arduino sketch, then the sketch on the simulated UNO R4
+// turning joystick frames into motor PWM
+#include "uno.h"
+#include "check.h"
+#include "../AutoCar_Arduino/AutoCar_Arduino.ino"
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+#define LOOP_US 10		   // Cost of one pass of loop() besides the delays it makes itself
+#define DRIVE_FRAMES 400   // Joystick frames sent in the simulation
+#define DRIVE_PERIOD_MS 50 // The page sends the joystick this often
+#define DRIVE_JITTER_MS 30 // WiFi delays each frame by up to this much
+
+static void test_mix()
+{
+	int target[2];
+	drive_mix(100, 0, target); // Straight ahead
+	CHECK_EQ(target[DRIVE_LEFT], 100);
+	CHECK_EQ(target[DRIVE_RIGHT], 100);
+
+	drive_mix(0, 60, target); // Spin right on the spot
+	CHECK_EQ(target[DRIVE_LEFT], 60);
+	CHECK_EQ(target[DRIVE_RIGHT], -60);
+
+	// Full throttle and full right: scaled together, the inner side stops
+	drive_mix(127, 127, target);
+	CHECK_EQ(target[DRIVE_LEFT], 127);
+	CHECK_EQ(target[DRIVE_RIGHT], 0);
+
+	// Full throttle with some steering keeps the difference between the sides
+	drive_mix(127, 40, target);
+	CHECK_EQ(target[DRIVE_LEFT], 127);
+	CHECK_EQ(target[DRIVE_RIGHT], 87 * 127 / 167);
+
+	// Backwards to the left
+	drive_mix(-80, -30, target);
+	CHECK_EQ(target[DRIVE_LEFT], -110);
+	CHECK_EQ(target[DRIVE_RIGHT], -50);
+
+	// Deadband and clamping of the axes
+	drive_mix(DRIVE_DEADBAND - 1, -(DRIVE_DEADBAND - 1), target);
+	CHECK_EQ(target[DRIVE_LEFT], 0);
+	CHECK_EQ(target[DRIVE_RIGHT], 0);
+	CHECK_EQ(drive_axis(-128), -127);
+	CHECK_EQ(drive_axis(DRIVE_DEADBAND), DRIVE_DEADBAND);
+}
+
+static void test_ramp_and_pwm()
+{
+	int speed = 0;
+	int steps = 0;
+	while (speed != 127 && steps < 100)
+	{
+		int next = drive_ramp(speed, 127);
+		CHECK(next - speed <= DRIVE_ACCEL);
+		speed = next;
+		steps++;
+	}
+	CHECK_EQ(steps, (127 + DRIVE_ACCEL - 1) / DRIVE_ACCEL);
+	CHECK_EQ(drive_ramp(10, -10), 10 - DRIVE_ACCEL);
+	CHECK_EQ(drive_ramp(3, 5), 5);
+
+	CHECK_EQ(drive_speed_to_pwm(0), 0);
+	CHECK_EQ(drive_speed_to_pwm(1), DRIVE_MIN_PWM);
+	CHECK_EQ(drive_speed_to_pwm(127), DRIVE_MAX_PWM);
+	CHECK_EQ(drive_speed_to_pwm(-127), -DRIVE_MAX_PWM);
+	for (int s = 1; s < 127; s++)
+	{
+		CHECK(drive_speed_to_pwm(s + 1) >= drive_speed_to_pwm(s));
+	}
+}
+
+static void test_slow_slots()
+{
+	int pwm[2] = {200, 100};
+	int slow, fast;
+	CHECK_EQ(drive_slow_slots(pwm, &slow, &fast), DRIVE_SLOTS / 2);
+	CHECK_EQ(slow, DRIVE_RIGHT);
+	CHECK_EQ(fast, 200);
+
+	pwm[DRIVE_LEFT] = -90;
+	pwm[DRIVE_RIGHT] = 180;
+	CHECK_EQ(drive_slow_slots(pwm, &slow, &fast), DRIVE_SLOTS / 2);
+	CHECK_EQ(slow, DRIVE_LEFT);
+
+	pwm[DRIVE_LEFT] = 0;
+	pwm[DRIVE_RIGHT] = 0;
+	CHECK_EQ(drive_slow_slots(pwm, &slow, &fast), 0);
+	CHECK_EQ(fast, 0);
+
+	pwm[DRIVE_LEFT] = 150;
+	pwm[DRIVE_RIGHT] = 150;
+	CHECK_EQ(drive_slow_slots(pwm, &slow, &fast), DRIVE_SLOTS);
+}
+
+static void test_lease()
+{
+	CHECK(!drive_lease_expired(1000, 1000));
+	CHECK(!drive_lease_expired(1000 + CAR_DRIVE_LEASE_MS - 1, 1000));
+	CHECK(drive_lease_expired(1000 + CAR_DRIVE_LEASE_MS, 1000));
+	// millis() wraps after 49 days
+	CHECK(!drive_lease_expired(32, 0xFFFFFF00u));
+	CHECK(drive_lease_expired(CAR_DRIVE_LEASE_MS, 0xFFFFFF00u));
+}
+
+static void send_frame(uint64_t at_us, uint8_t cmd, uint8_t arg0, uint8_t arg1)
+{
+	static uint8_t seq = 0;
+	uint8_t frame[CAR_FRAME_LEN];
+	car_frame_encode(frame, seq++, cmd, arg0, arg1);
+	uno_serial1_receive(at_us, frame, sizeof(frame));
+}
+
+// Intervals between two runs of the ramp job (driveStep) and of the slot job (driveSlotStep), in microseconds
+static std::vector<uint32_t> step_intervals, slot_intervals;
+
+static void drive_pass()
+{
+	static unsigned long step_run = 0, slot_run = 0;
+	static uint64_t step_us = 0, slot_us = 0;
+	uint64_t now = uno_now_us();
+	loop();
+	if (tasks[3].lastRun != step_run)
+	{
+		if (step_us)
+		{
+			step_intervals.push_back(now - step_us);
+		}
+		step_run = tasks[3].lastRun;
+		step_us = now;
+	}
+	if (tasks[4].lastRun != slot_run)
+	{
+		if (slot_us)
+		{
+			slot_intervals.push_back(now - slot_us);
+		}
+		slot_run = tasks[4].lastRun;
+		slot_us = now;
+	}
+	uno_advance_us(LOOP_US);
+}
+
+static uint32_t percentile(std::vector<uint32_t> v, int percent)
+{
+	std::sort(v.begin(), v.end());
+	return v[(v.size() - 1) * percent / 100];
+}
+
+// Function to run the sketch until driveStep has used the frame that arrived at arrival, returns that time
+static uint64_t until_applied(uint64_t arrival)
+{
+	while (uno_now_us() < arrival || Serial1.available() > 0)
+	{
+		drive_pass();
+	}
+	unsigned long step_run = tasks[3].lastRun;
+	uint64_t applied = uno_now_us();
+	while (tasks[3].lastRun == step_run)
+	{
+		applied = uno_now_us();
+		drive_pass();
+	}
+	return applied;
+}
+
+// Joystick frames arrive every DRIVE_PERIOD_MS, late by up to DRIVE_JITTER_MS, while the sonar runs in
+// the background. For each the time from arrival to the first PWM computed from it, then the time
+// from standstill to full speed and from the last frame to the motors stopping
+static void test_command_to_pwm()
+{
+	uno_sonar_attach(trig_pin_1, echo_pin_1, 100);
+	uno_sonar_attach(trig_pin_2, echo_pin_2, 100);
+	uno_sonar_attach(trig_pin_3, echo_pin_3, 100);
+	setup();
+	for (int i = 0; i < 1000; i++)
+	{
+		drive_pass();
+	}
+
+	std::vector<uint32_t> latency;
+	uint32_t rand_state = 1;
+	uint64_t start = uno_now_us() + 1000;
+	uint64_t arrival = 0;
+	for (int i = 0; i < DRIVE_FRAMES; i++)
+	{
+		rand_state = rand_state * 1103515245 + 12345;
+		arrival = std::max<uint64_t>(arrival + 1000, start + i * DRIVE_PERIOD_MS * 1000ULL + (rand_state >> 8) % (DRIVE_JITTER_MS * 1000));
+		int throttle = 70 + (int)(50 * sin(i * 0.2));
+		int steer = (i % 9 - 4) * 15;
+		send_frame(arrival, CAR_CMD_DRIVE, (uint8_t)throttle, (uint8_t)steer);
+		uint64_t applied = until_applied(arrival);
+		latency.push_back(applied - arrival);
+		int target[2];
+		drive_mix(throttle, steer, target);
+		CHECK(driveActive && driveTarget[DRIVE_LEFT] == target[DRIVE_LEFT] && driveTarget[DRIVE_RIGHT] == target[DRIVE_RIGHT]);
+		CHECK_EQ(uno_pin(EN), std::max(drive_abs(drivePwm[DRIVE_LEFT]), drive_abs(drivePwm[DRIVE_RIGHT])));
+	}
+
+	// Standstill to full speed straight ahead
+	driveActive = false;
+	Stop();
+	uint64_t full_start = 0, full_at = 0;
+	for (int i = 0; !full_at && i < 20; i++)
+	{
+		arrival = uno_now_us() + DRIVE_PERIOD_MS * 1000;
+		send_frame(arrival, CAR_CMD_DRIVE, 127, 0);
+		until_applied(arrival);
+		full_start = full_start ? full_start : arrival;
+		while (!full_at && uno_now_us() < arrival + DRIVE_PERIOD_MS * 1000)
+		{
+			drive_pass();
+			full_at = drivePwm[DRIVE_LEFT] == DRIVE_MAX_PWM && drivePwm[DRIVE_RIGHT] == DRIVE_MAX_PWM ? uno_now_us() : 0;
+		}
+	}
+	CHECK(full_at != 0);
+
+	// The page is closed: the motors stop once the lease runs out
+	while (driveActive && uno_now_us() < arrival + 2000000)
+	{
+		drive_pass();
+	}
+	uint64_t stopped = uno_now_us() - arrival;
+	CHECK(!driveActive);
+	CHECK(uno_pin(IN1) == LOW && uno_pin(IN2) == LOW && uno_pin(IN3) == LOW && uno_pin(IN4) == LOW);
+
+	uint32_t p50 = percentile(latency, 50), p99 = percentile(latency, 99), low = percentile(latency, 0), high = percentile(latency, 100);
+	printf("command to PWM: p50 %.2f ms, p99 %.2f ms, max %.2f ms, jitter %.2f ms\n", p50 / 1000.0, p99 / 1000.0, high / 1000.0,
+		   (high - low) / 1000.0);
+	printf("ramp job every %.2f..%.2f ms, slot job every %.3f..%.3f ms\n", percentile(step_intervals, 0) / 1000.0,
+		   percentile(step_intervals, 100) / 1000.0, percentile(slot_intervals, 0) / 1000.0, percentile(slot_intervals, 100) / 1000.0);
+	printf("standstill to full speed %.0f ms, stopped %.0f ms after the last frame\n", (full_at - full_start) / 1000.0,
+		   stopped / 1000.0);
+
+	// A frame waits at most for the next run of the ramp job
+	CHECK(high <= (DRIVE_STEP_MS + 1) * 1000);
+	CHECK(percentile(step_intervals, 100) <= (DRIVE_STEP_MS + 1) * 1000);
+	CHECK(percentile(slot_intervals, 100) <= (DRIVE_SLOT_MS + 1) * 1000);
+	CHECK(full_at - full_start <= ((127 + DRIVE_ACCEL - 1) / DRIVE_ACCEL + 2) * DRIVE_STEP_MS * 1000ULL);
+	CHECK(stopped <= (CAR_DRIVE_LEASE_MS + DRIVE_STEP_MS + 1) * 1000ULL);
+}
+
+int main()
+{
+	test_mix();
+	test_ramp_and_pwm();
+	test_slow_slots();
+	test_lease();
+	test_command_to_pwm();
+	return check_result("drive_mix");
+}
@@ -0,0 +1,210 @@
+// Host tests of the EXIF GPS segment, decoded the way a photo viewer reads it
+#include "exif.h"
+#include "check.h"
+#include <chrono>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+static uint16_t get_u16(const uint8_t *p)
+{
+	return p[0] | p[1] << 8;
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Structure for a decoded GPS IFD entry
+typedef struct
+{
+	uint16_t type;
+	uint32_t count;
+	const uint8_t *value; // Inside the entry for up to 4 bytes, else at its offset
+} entry_t;
+
+// Function to find a tag in the IFD at offset ifd of the TIFF data
+static bool find_tag(const uint8_t *tiff, size_t tiff_len, uint32_t ifd, uint16_t tag, entry_t *out)
+{
+	uint16_t count = get_u16(&tiff[ifd]);
+	for (int i = 0; i < count; i++)
+	{
+		const uint8_t *e = &tiff[ifd + 2 + i * 12];
+		if (get_u16(e) != tag)
+		{
+			continue;
+		}
+		static const int sizes[] = {0, 1, 1, 2, 4, 8};
+		out->type = get_u16(&e[2]);
+		out->count = get_u32(&e[4]);
+		uint32_t len = out->count * sizes[out->type];
+		out->value = len <= 4 ? &e[8] : &tiff[get_u32(&e[8])];
+		CHECK(len <= 4 || get_u32(&e[8]) + len <= tiff_len);
+		return true;
+	}
+	return false;
+}
+
+static double rational(const uint8_t *p)
+{
+	return (double)get_u32(p) / get_u32(&p[4]);
+}
+
+// Function to decode a coordinate from its reference and degrees / minutes / seconds
+static int32_t coordinate_e7(const uint8_t *tiff, size_t tiff_len, uint32_t ifd, uint16_t ref_tag)
+{
+	entry_t ref, dms;
+	CHECK(find_tag(tiff, tiff_len, ifd, ref_tag, &ref));
+	CHECK(find_tag(tiff, tiff_len, ifd, ref_tag + 1, &dms));
+	CHECK_EQ(dms.count, 3);
+	double degrees = rational(dms.value) + rational(&dms.value[8]) / 60 + rational(&dms.value[16]) / 3600;
+	bool negative = ref.value[0] == 'S' || ref.value[0] == 'W';
+	return (int32_t)((negative ? -degrees : degrees) * 1e7 + (negative ? -0.5 : 0.5));
+}
+
+static void test_segment()
+{
+	gps_fix_t fix;
+	memset(&fix, 0, sizeof(fix));
+	uint8_t out[EXIF_GPS_MAX_LEN];
+	CHECK_EQ(exif_gps_segment(&fix, out), 0); // No fix yet
+
+	fix.version = 3;
+	fix.lat_e7 = -337654321;
+	fix.lon_e7 = 1512345678;
+	fix.time = 23595950;
+	fix.date = 170524;
+	fix.speed_cms = 1250;
+	fix.course_cdeg = 27050;
+	fix.hdop_c = 87;
+	size_t len = exif_gps_segment(&fix, out);
+	CHECK(len > 0 && len <= EXIF_GPS_MAX_LEN);
+	CHECK_EQ(out[0], 0xFF);
+	CHECK_EQ(out[1], 0xE1);
+	CHECK_EQ(out[2] << 8 | out[3], len - 2);
+	CHECK(!memcmp(&out[4], "Exif\0\0", 6));
+
+	const uint8_t *tiff = &out[10];
+	size_t tiff_len = len - 10;
+	CHECK(!memcmp(tiff, "II\x2A\0", 4));
+	uint32_t ifd0 = get_u32(&tiff[4]);
+	entry_t pointer;
+	CHECK(find_tag(tiff, tiff_len, ifd0, 0x8825, &pointer));
+	uint32_t gps = get_u32(pointer.value);
+	CHECK(gps < tiff_len);
+
+	CHECK(abs(coordinate_e7(tiff, tiff_len, gps, 0x0001) - fix.lat_e7) <= 3);
+	CHECK(abs(coordinate_e7(tiff, tiff_len, gps, 0x0003) - fix.lon_e7) <= 3);
+
+	entry_t e;
+	CHECK(find_tag(tiff, tiff_len, gps, 0x0007, &e));
+	CHECK_EQ(rational(e.value), 23);
+	CHECK_EQ(rational(&e.value[8]), 59);
+	CHECK_EQ(lround(rational(&e.value[16]) * 100), 5950);
+	CHECK(find_tag(tiff, tiff_len, gps, 0x001D, &e));
+	CHECK(!strcmp((const char *)e.value, "2024:05:17"));
+	CHECK(find_tag(tiff, tiff_len, gps, 0x000C, &e));
+	CHECK_EQ(e.value[0], 'K');
+	CHECK(find_tag(tiff, tiff_len, gps, 0x000D, &e));
+	CHECK_EQ(lround(rational(e.value) * 1000), 45000); // 12.5 m/s = 45 km/h
+	CHECK(find_tag(tiff, tiff_len, gps, 0x000F, &e));
+	CHECK_EQ(lround(rational(e.value) * 100), 27050);
+	CHECK(find_tag(tiff, tiff_len, gps, 0x000B, &e));
+	CHECK_EQ(lround(rational(e.value) * 100), 87);
+	CHECK(find_tag(tiff, tiff_len, gps, 0x0012, &e));
+	CHECK(!strcmp((const char *)e.value, "WGS-84"));
+
+	// Unknown values leave their tags out
+	fix.speed_cms = -1;
+	fix.course_cdeg = -1;
+	fix.hdop_c = -1;
+	fix.time = 0;
+	fix.date = 0;
+	size_t short_len = exif_gps_segment(&fix, out);
+	CHECK(short_len < len);
+	CHECK(!find_tag(tiff, short_len - 10, gps, 0x000D, &e));
+	CHECK(!find_tag(tiff, short_len - 10, gps, 0x0007, &e));
+	CHECK(find_tag(tiff, short_len - 10, gps, 0x0012, &e));
+}
+
+static void test_can_splice()
+{
+	static const uint8_t jpeg[] = {0xFF, 0xD8, 0xFF, 0xDB};
+	static const uint8_t other[] = {0x89, 'P', 'N', 'G'};
+	CHECK(exif_can_splice(jpeg, sizeof(jpeg)));
+	CHECK(!exif_can_splice(jpeg, 2));
+	CHECK(!exif_can_splice(other, sizeof(other)));
+}
+
+// Function to time fn over runs calls, in nanoseconds per call
+template <typename Fn>
+static double ns_per_call(int runs, Fn fn)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < runs; i++)
+	{
+		fn(i);
+	}
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+}
+
+// What tagging costs per frame: the segment bytes added to each frame size, the time to build the segment
+// for a new fix, and the copy of the frame that splicing into a buffer instead of sending it in pieces would take
+static void test_overhead()
+{
+	static const struct
+	{
+		const char *name;
+		size_t width;
+		size_t height;
+	} sizes[] = {{"QVGA", 320, 240}, {"CIF", 400, 296}, {"VGA", 640, 480}, {"SVGA", 800, 600}, {"UXGA", 1600, 1200}};
+	const int runs = 20000;
+	gps_fix_t fix;
+	memset(&fix, 0, sizeof(fix));
+	fix.lat_e7 = 108231000;
+	fix.lon_e7 = 1066297000;
+	fix.date = 171026;
+	fix.speed_cms = 150;
+	fix.course_cdeg = 9000;
+	fix.hdop_c = 90;
+	uint8_t app1[EXIF_GPS_MAX_LEN];
+	size_t len = 0;
+	double build_ns = ns_per_call(runs, [&](int i) {
+		fix.version = i + 1; // A new fix every time, nothing can be reused
+		fix.time = 12000000 + i % 6000;
+		fix.lat_e7 += 17;
+		len = exif_gps_segment(&fix, app1);
+	});
+	CHECK(len > 0 && len <= EXIF_GPS_MAX_LEN);
+
+	printf("frame  frame KB  APP1 bytes  added  build ns  copy ns\n");
+	for (const auto &size : sizes)
+	{
+		size_t frame_len = size.width * size.height / 10; // JPEG at quality 10 (see the esp_camera shim)
+		std::vector<uint8_t> frame(frame_len, 0x55), copy(frame_len + EXIF_GPS_MAX_LEN);
+		frame[0] = 0xFF;
+		frame[1] = 0xD8;
+		double copy_ns = ns_per_call(runs / 10, [&](int i) {
+			memcpy(copy.data(), frame.data(), EXIF_SPLICE_AT);
+			memcpy(&copy[EXIF_SPLICE_AT], app1, len);
+			memcpy(&copy[EXIF_SPLICE_AT + len], &frame[EXIF_SPLICE_AT], frame_len - EXIF_SPLICE_AT);
+			frame[i % frame_len] ^= copy[i % copy.size()]; // Keep the copies from being optimized away
+		});
+		printf("%-5s  %8.1f  %10zu  %4.2f%%  %8.0f  %7.0f\n", size.name, frame_len / 1024.0, len, 100.0 * len / frame_len,
+			   build_ns, copy_ns);
+		if (size.width >= 640)
+		{
+			CHECK(len * 200 < frame_len * 3); // Under 1.5% more bytes from VGA up
+		}
+	}
+	CHECK(build_ns < 20000); // Far below the 40-100 ms between two frames
+}
+
+int main()
+{
+	test_segment();
+	test_can_splice();
+	test_overhead();
+	return check_result("exif");
+}
@@ -0,0 +1,232 @@
+// Host tests of the frame ring, built together with frame_ring.cpp to publish without the capture task
+#include "../frame_ring.cpp"
+#include "check.h"
+#include "host.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// Function to publish a frame the way the capture task does
+static uint32_t publish()
+{
+	xSemaphoreTake(ring_lock, portMAX_DELAY);
+	shared_frame_t *slot = claim_slot();
+	xSemaphoreGive(ring_lock);
+	CHECK(slot != NULL);
+	publish_slot(slot);
+	return slot->seq;
+}
+
+static int64_t elapsed_ms(int64_t start_us)
+{
+	return (esp_timer_get_time() - start_us) / 1000;
+}
+
+// A waiter is woken by the next publish
+static void test_wakeup()
+{
+	uint32_t seq = publish();
+	std::thread publisher([] {
+		vTaskDelay(pdMS_TO_TICKS(20));
+		publish();
+	});
+	shared_frame_t *frame = frame_ring_acquire(seq, pdMS_TO_TICKS(2000));
+	CHECK(frame != NULL);
+	CHECK(frame && frame->seq == seq + 1);
+	frame_ring_release(frame);
+	publisher.join();
+}
+
+// A publish that comes after a timeout must not cut the next wait short
+static void test_timeout_leaves_no_wakeup()
+{
+	uint32_t seq = publish();
+	CHECK(frame_ring_acquire(seq, pdMS_TO_TICKS(20)) == NULL);
+	seq = publish(); // Nobody waits any more
+	int64_t start = esp_timer_get_time();
+	CHECK(frame_ring_acquire(seq, pdMS_TO_TICKS(50)) == NULL);
+	CHECK(elapsed_ms(start) >= 45);
+	for (int i = 0; i < FRAME_RING_MAX_WAITERS; i++)
+	{
+		CHECK(!waiters[i].waiting);
+	}
+
+	// Same with the wakeup racing the timeout: the publish lands while the waiter is listed
+	for (int i = 0; i < 20; i++)
+	{
+		seq = publish();
+		std::thread publisher([] {
+			vTaskDelay(pdMS_TO_TICKS(5));
+			publish();
+		});
+		shared_frame_t *frame = frame_ring_acquire(seq, pdMS_TO_TICKS(5));
+		frame_ring_release(frame);
+		publisher.join();
+	}
+	seq = publish();
+	start = esp_timer_get_time();
+	CHECK(frame_ring_acquire(seq, pdMS_TO_TICKS(30)) == NULL);
+	CHECK(elapsed_ms(start) >= 25);
+}
+
+// More clients than waiter entries still see every frame
+static void test_many_waiters()
+{
+	uint32_t seq = publish();
+	const int clients = FRAME_RING_MAX_WAITERS + 4;
+	int got[clients] = {0};
+	std::vector<std::thread> threads;
+	for (int i = 0; i < clients; i++)
+	{
+		threads.emplace_back([i, seq, &got] {
+			shared_frame_t *frame = frame_ring_acquire(seq, pdMS_TO_TICKS(2000));
+			got[i] = frame != NULL;
+			frame_ring_release(frame);
+		});
+	}
+	vTaskDelay(pdMS_TO_TICKS(30));
+	publish();
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+	for (int i = 0; i < clients; i++)
+	{
+		CHECK(got[i]);
+	}
+}
+
+// Function to get the next frame the capture task publishes after seq, NULL if none came
+static shared_frame_t *next_frame(uint32_t *seq)
+{
+	shared_frame_t *frame = frame_ring_acquire(*seq, pdMS_TO_TICKS(1000));
+	CHECK(frame != NULL);
+	if (frame)
+	{
+		*seq = frame->seq;
+	}
+	return frame;
+}
+
+// The capture task decodes each frame once, the thumbnail comes with the frame and feeds the change detection
+static void test_thumbnails()
+{
+	camera_config_t config;
+	memset(&config, 0, sizeof(config));
+	config.pixel_format = PIXFORMAT_JPEG;
+	config.frame_size = FRAMESIZE_CIF;
+	CHECK_EQ(esp_camera_init(&config), ESP_OK);
+	frame_ring_set_motion_threshold(0);
+	host_camera_set_gray(128);
+	frame_ring_subscribe();
+
+	// Nobody asked for thumbnails and change detection is off: nothing is decoded
+	uint32_t seq = 0;
+	uint32_t decodes = host_jpeg_decodes();
+	for (int i = 0; i < 3; i++)
+	{
+		shared_frame_t *frame = next_frame(&seq);
+		CHECK(frame && frame->gray_w == 0);
+		frame_ring_release(frame);
+	}
+	CHECK_EQ(host_jpeg_decodes(), decodes);
+
+	frame_ring_want_thumbnails(true);
+	frame_ring_release(next_frame(&seq)); // May have been captured before the request
+	for (int i = 0; i < 3; i++)
+	{
+		shared_frame_t *frame = next_frame(&seq);
+		CHECK(frame && frame->gray_w == 50 && frame->gray_h == 37); // 400 x 296 at 1/8 scale
+		CHECK(frame && frame->gray_w && abs(frame->gray[frame->gray_w * frame->gray_h - 1] - 128) <= 4);
+		frame_ring_release(frame);
+	}
+
+	// A new scene only when the picture changes
+	frame_ring_set_motion_threshold(FRAME_RING_MOTION_THRESHOLD);
+	shared_frame_t *frame = next_frame(&seq);
+	frame_ring_release(next_frame(&seq));
+	uint32_t scene = frame ? frame->scene : 0;
+	for (int i = 0; i < 3; i++)
+	{
+		frame = next_frame(&seq);
+		CHECK(frame && frame->scene == scene && frame->motion == 0);
+		frame_ring_release(frame);
+	}
+	host_camera_set_gray(40);
+	frame = next_frame(&seq);
+	frame_ring_release(frame);
+	frame = next_frame(&seq);
+	CHECK(frame && frame->scene != scene);
+	frame_ring_release(frame);
+	frame_ring_want_thumbnails(false);
+	frame_ring_unsubscribe();
+	vTaskDelay(pdMS_TO_TICKS(50)); // Let the capture task finish its frame and go to sleep
+	CHECK_EQ(host_jpeg_decodes() - decodes, stats.decode.count);
+	CHECK(stats.decode.count <= stats.captured);
+	CHECK_EQ(host_jpeg_overlaps(), 0);
+}
+
+// Stream clients share the capture: each one gets every frame the camera makes, however many there are.
+// Clients hold each frame for a while, as if sending it over WiFi
+static void test_per_client_fps()
+{
+	const int counts[] = {1, 2, 4, 8};
+	const int run_ms = 1000;
+	frame_ring_set_motion_threshold(0);
+	frame_ring_subscribe();
+	vTaskDelay(pdMS_TO_TICKS(100)); // Let the capture task get going
+	double single_fps = 0;
+	printf("clients  per-client fps  captures/s\n");
+	for (int clients : counts)
+	{
+		int frames[8] = {0};
+		uint32_t captured = stats.captured;
+		int64_t start = esp_timer_get_time();
+		std::vector<std::thread> threads;
+		for (int i = 0; i < clients; i++)
+		{
+			threads.emplace_back([i, start, &frames] {
+				uint32_t seq = 0;
+				while (elapsed_ms(start) < run_ms)
+				{
+					shared_frame_t *frame = frame_ring_acquire(seq, pdMS_TO_TICKS(100));
+					if (frame)
+					{
+						seq = frame->seq;
+						frames[i]++;
+						vTaskDelay(pdMS_TO_TICKS(5));
+						frame_ring_release(frame);
+					}
+				}
+			});
+		}
+		for (std::thread &t : threads)
+		{
+			t.join();
+		}
+		double seconds = elapsed_ms(start) / 1000.0;
+		int slowest = *std::min_element(frames, frames + clients);
+		double fps = slowest / seconds;
+		double captures = (stats.captured - captured) / seconds;
+		printf("%7d  %14.1f  %10.1f\n", clients, fps, captures);
+		if (clients == 1)
+		{
+			single_fps = fps;
+		}
+		CHECK(fps > single_fps * 0.9);
+		CHECK(captures < single_fps * 1.1); // One capture per frame, not one per client
+	}
+	frame_ring_unsubscribe();
+	vTaskDelay(pdMS_TO_TICKS(50));
+}
+
+int main()
+{
+	CHECK(frame_ring_start()); // No subscribers, the capture task sleeps
+	test_wakeup();
+	test_timeout_leaves_no_wakeup();
+	test_many_waiters();
+	test_thumbnails();
+	test_per_client_fps();
+	return check_result("frame_ring");
+}
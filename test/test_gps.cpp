@@ -0,0 +1,513 @@
+// Host tests of the fix publishing, built together with gps.cpp to reach the GPS task steps
+#include "../gps.cpp"
+#include "check.h"
+#include "host.h"
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define HAMMER_READERS 3
+#define HAMMER_MS 300
+
+static int tracked = 0;
+static int events = 0;
+
+void track_add(const gps_fix_t *fix)
+{
+	tracked++;
+}
+
+void events_publish_gps(float lat, float lon, uint32_t seq)
+{
+	events++;
+}
+
+static void feed_body(const char *body)
+{
+	uint8_t sum = 0;
+	for (const char *p = body; *p; p++)
+	{
+		sum ^= *p;
+	}
+	char line[128];
+	snprintf(line, sizeof(line), "$%s*%02X\r\n", body, sum);
+	for (const char *p = line; *p; p++)
+	{
+		nmea_parser_feed(&nmea, *p);
+	}
+}
+
+// One update, however many times the task looks at it, is one version, one track point and one event
+static void test_one_generation_per_fix()
+{
+	nmea_parser_init(&nmea);
+	gps_fix_t fix;
+	memset(&fix, 0, sizeof(fix));
+	gps_fix_t read;
+	CHECK_EQ(gps_get_fix(&read), 0);
+
+	feed_body("GPGGA,100000.00,4807.03800,N,01131.00000,E,1,08,0.94,545.4,M,46.9,M,,");
+	feed_body("GPRMC,100000.00,A,4807.03800,N,01131.00000,E,001.0,090.0,230394,,");
+	CHECK(publish_update(&fix));
+	CHECK(!publish_update(&fix));
+	CHECK_EQ(gps_fix_version(), 1);
+	CHECK_EQ(gps_get_fix(&read), 1);
+	CHECK_EQ(read.lat_e7, 481173000);
+	CHECK_EQ(read.time, 10000000);
+
+	// A repeat of the same UTC time does not move the generation
+	feed_body("GPGGA,100000.00,4807.03800,N,01131.00000,E,1,08,0.94,545.4,M,46.9,M,,");
+	CHECK(!publish_update(&fix));
+
+	feed_body("GPGGA,100000.10,4807.03900,N,01131.00000,E,1,08,0.94,545.4,M,46.9,M,,");
+	feed_body("GPRMC,100000.10,A,4807.03900,N,01131.00000,E,001.0,090.0,230394,,");
+	CHECK(publish_update(&fix));
+	CHECK_EQ(gps_get_fix(&read), 2);
+	CHECK_EQ(read.time, 10000010);
+	CHECK_EQ(tracked, 2);
+	CHECK_EQ(events, 2);
+}
+
+// Function to build a fix whose every field follows from its version, so a torn copy shows
+static void make_fix(gps_fix_t *fix, uint32_t version)
+{
+	fix->version = version;
+	fix->fix_ms = version * 100;
+	fix->date = version % 1000000;
+	fix->time = version * 10;
+	fix->lat_e7 = (int32_t)(version * 7);
+	fix->lon_e7 = -(int32_t)(version * 7);
+	fix->speed_cms = version % 5000;
+	fix->course_cdeg = version % 36000;
+	fix->hdop_c = version % 10000;
+	fix->sats = version % 40;
+}
+
+static bool fix_consistent(const gps_fix_t *fix)
+{
+	gps_fix_t expected;
+	make_fix(&expected, fix->version);
+	return !memcmp(&expected, fix, sizeof(expected));
+}
+
+// Structure for what one reader thread saw
+typedef struct
+{
+	uint64_t reads;
+	uint64_t torn;
+	uint64_t backwards; // Versions lower than the previous read
+} hammer_reader_t;
+
+// Function to read fixes until stop, copying them with read(), and check every copy
+static void hammer_read(hammer_reader_t *r, const std::atomic<bool> *stop, uint32_t (*read)(gps_fix_t *))
+{
+	uint32_t last = 0;
+	while (!*stop)
+	{
+		gps_fix_t fix;
+		uint32_t version = read(&fix);
+		r->reads++;
+		r->torn += version != fix.version || !fix_consistent(&fix);
+		r->backwards += version < last;
+		last = version;
+	}
+}
+
+// The fix as it was shared before: globals written one after the other, read with no synchronization
+static volatile gps_fix_t shared_fix;
+
+static uint32_t read_shared(gps_fix_t *fix)
+{
+	fix->version = shared_fix.version;
+	fix->fix_ms = shared_fix.fix_ms;
+	fix->date = shared_fix.date;
+	fix->time = shared_fix.time;
+	fix->lat_e7 = shared_fix.lat_e7;
+	fix->lon_e7 = shared_fix.lon_e7;
+	fix->speed_cms = shared_fix.speed_cms;
+	fix->course_cdeg = shared_fix.course_cdeg;
+	fix->hdop_c = shared_fix.hdop_c;
+	fix->sats = shared_fix.sats;
+	return fix->version;
+}
+
+static void write_shared(const gps_fix_t *fix)
+{
+	shared_fix.version = fix->version;
+	shared_fix.fix_ms = fix->fix_ms;
+	shared_fix.date = fix->date;
+	shared_fix.time = fix->time;
+	shared_fix.lat_e7 = fix->lat_e7;
+	shared_fix.lon_e7 = fix->lon_e7;
+	shared_fix.speed_cms = fix->speed_cms;
+	shared_fix.course_cdeg = fix->course_cdeg;
+	shared_fix.hdop_c = fix->hdop_c;
+	shared_fix.sats = fix->sats;
+}
+
+// Function to publish new fixes as fast as write() allows for HAMMER_MS while HAMMER_READERS threads
+// copy them, and return the total over the readers
+static hammer_reader_t hammer(void (*write)(const gps_fix_t *), uint32_t (*read)(gps_fix_t *), uint32_t *published)
+{
+	std::atomic<bool> stop(false);
+	std::vector<hammer_reader_t> readers(HAMMER_READERS, hammer_reader_t{0, 0, 0});
+	std::vector<std::thread> threads;
+	for (hammer_reader_t &r : readers)
+	{
+		threads.emplace_back(hammer_read, &r, &stop, read);
+	}
+	gps_fix_t fix;
+	gps_get_fix(&fix);
+	uint32_t version = fix.version;
+	*published = 0;
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now() + std::chrono::milliseconds(HAMMER_MS);
+	while (std::chrono::steady_clock::now() < end)
+	{
+		for (int i = 0; i < 64; i++)
+		{
+			make_fix(&fix, ++version);
+			write(&fix);
+			(*published)++;
+		}
+	}
+	stop = true;
+	hammer_reader_t total = {0, 0, 0};
+	for (size_t i = 0; i < threads.size(); i++)
+	{
+		threads[i].join();
+		total.reads += readers[i].reads;
+		total.torn += readers[i].torn;
+		total.backwards += readers[i].backwards;
+	}
+	return total;
+}
+
+// The GPS task publishing back to back while other tasks read: no copy may mix two fixes and
+// no reader may see the version go back
+static void test_concurrent_readers()
+{
+	uint32_t published;
+	hammer_reader_t before = hammer(write_shared, read_shared, &published);
+	printf("unsynchronized record: %u fixes written, %llu reads, %llu torn\n", (unsigned)published,
+		   (unsigned long long)before.reads, (unsigned long long)before.torn);
+	hammer_reader_t after = hammer(publish_fix, gps_get_fix, &published);
+	printf("fix slots: %u fixes published, %llu reads, %llu torn, %llu went back\n", (unsigned)published,
+		   (unsigned long long)after.reads, (unsigned long long)after.torn, (unsigned long long)after.backwards);
+	CHECK(published > 1000);
+	CHECK(after.reads > 1000);
+	CHECK_EQ(after.torn, 0);
+	CHECK_EQ(after.backwards, 0);
+}
+
+// One update of the module's factory output (all sentences, 1 Hz), as it comes off the UART.
+// Each sentence is tagged with its field in PCAS03; %s is the UTC time, and the date for RMC
+typedef struct
+{
+	int field;
+	const char *body;
+} module_sentence_t;
+
+#define PCAS03_GGA 0
+#define PCAS03_RMC 4
+
+static const module_sentence_t factory_update[] = {
+	{0, "GNGGA,%s,1047.38600,N,10637.78600,E,1,09,1.02,12.3,M,2.4,M,,"},
+	{1, "GNGLL,1047.38600,N,10637.78600,E,%s,A,A"},
+	{2, "GNGSA,A,3,05,13,15,18,20,,,,,,,,1.80,1.02,1.48,1"},
+	{2, "GNGSA,A,3,06,09,16,,,,,,,,,,1.80,1.02,1.48,4"},
+	{3, "GPGSV,3,1,10,05,52,061,34,13,38,173,30,15,61,210,36,18,22,319,28,0"},
+	{3, "GPGSV,3,2,10,20,45,118,33,23,08,041,,24,14,279,19,26,03,198,,0"},
+	{3, "GPGSV,3,3,10,29,11,090,22,30,05,330,,0"},
+	{3, "BDGSV,2,1,06,06,48,012,31,09,55,230,35,16,60,170,38,19,12,301,,0"},
+	{3, "BDGSV,2,2,06,20,20,075,24,22,07,141,,0"},
+	{PCAS03_RMC, "GNRMC,%s,A,1047.38600,N,10637.78600,E,0.52,84.31,%s,,,A,V"},
+	{5, "GNVTG,84.31,T,,M,0.52,N,0.96,K,A"},
+	{6, "GNZDA,%s,17,10,2026,00,00"},
+	{7, "GPTXT,01,01,01,ANTENNA OK"},
+};
+#define FACTORY_SENTENCES (int)(sizeof(factory_update) / sizeof(factory_update[0]))
+#define MODULE_FIELDS 8
+#define MODULE_BACKLOG_US 1000000 // An update that would leave later than this is dropped
+
+static const uint32_t pcas01_bauds[] = {4800, 9600, 19200, 38400, 57600, 115200};
+
+// Structure for a byte on the wire and the baud rate it was sent at
+typedef struct
+{
+	int64_t at_us; // When it has been received completely
+	uint32_t baud;
+	uint8_t byte;
+} module_byte_t;
+
+// Stand-in ATGM336H on UART 1: replays factory_update at its update rate and baud rate, and obeys
+// the PCAS commands it understands. Bytes sent at another baud rate than the UART's arrive garbled
+static struct
+{
+	bool pcas01;		// Firmware that changes baud rate on PCAS01
+	uint32_t baud;
+	uint32_t update_ms;
+	bool enabled[MODULE_FIELDS];
+	uint32_t uart_baud; // Of the ESP32 side
+	int64_t next_update_us;
+	int64_t tx_free_us; // When the module's UART has sent everything queued
+	uint32_t updates;
+	uint32_t dropped;	// Updates that did not fit in the baud rate
+	uint32_t commands; // PCAS commands understood
+	std::deque<module_byte_t> wire;
+	std::string command;
+} module;
+
+// Function to queue one update of the enabled sentences at the module's baud rate
+static void module_send_update(int64_t at_us)
+{
+	uint32_t cs = module.updates * module.update_ms / 10;
+	char time[16], date[8] = "171026", line[128];
+	snprintf(time, sizeof(time), "10%02u%02u.%02u", cs / 6000 % 60, cs / 100 % 60, cs % 100);
+	std::string out;
+	for (int i = 0; i < FACTORY_SENTENCES; i++)
+	{
+		if (!module.enabled[factory_update[i].field])
+		{
+			continue;
+		}
+		char body[96];
+		snprintf(body, sizeof(body), factory_update[i].body, time, date);
+		uint8_t sum = 0;
+		for (const char *p = body; *p; p++)
+		{
+			sum ^= *p;
+		}
+		snprintf(line, sizeof(line), "$%s*%02X\r\n", body, sum);
+		out += line;
+	}
+	module.updates++;
+	int64_t byte_us = 10000000 / module.baud; // 8N1: ten bits per byte
+	int64_t start = std::max(at_us, module.tx_free_us);
+	if (start - at_us > MODULE_BACKLOG_US)
+	{
+		module.dropped++;
+		return;
+	}
+	for (char c : out)
+	{
+		start += byte_us;
+		module.wire.push_back({start, module.baud, (uint8_t)c});
+	}
+	module.tx_free_us = start;
+}
+
+// Function to bring the module's output up to now
+static void module_run()
+{
+	int64_t now = esp_timer_get_time();
+	while (module.next_update_us <= now)
+	{
+		module_send_update(module.next_update_us);
+		module.next_update_us += module.update_ms * 1000LL;
+	}
+}
+
+// Function to apply one command line the module received
+static void module_command(const std::string &line)
+{
+	size_t star = line.find('*');
+	if (line[0] != '$' || star == std::string::npos)
+	{
+		return;
+	}
+	uint8_t sum = 0;
+	for (size_t i = 1; i < star; i++)
+	{
+		sum ^= line[i];
+	}
+	if (strtoul(line.c_str() + star + 1, NULL, 16) != sum)
+	{
+		return;
+	}
+	std::string body = line.substr(1, star - 1);
+	std::vector<std::string> fields(1);
+	for (char c : body)
+	{
+		if (c == ',')
+		{
+			fields.emplace_back();
+		}
+		else
+		{
+			fields.back() += c;
+		}
+	}
+	if (fields[0] == "PCAS01" && module.pcas01 && fields.size() > 1)
+	{
+		unsigned code = atoi(fields[1].c_str());
+		if (code < sizeof(pcas01_bauds) / sizeof(pcas01_bauds[0]))
+		{
+			module.baud = pcas01_bauds[code];
+			module.commands++;
+		}
+	}
+	else if (fields[0] == "PCAS02" && fields.size() > 1)
+	{
+		uint32_t ms = atoi(fields[1].c_str());
+		if (ms == 1000 || ms == 500 || ms == 200 || ms == 100)
+		{
+			module.update_ms = ms;
+			module.commands++;
+		}
+	}
+	else if (fields[0] == "PCAS03")
+	{
+		// Empty fields keep their setting
+		for (size_t i = 1; i < fields.size() && i <= MODULE_FIELDS; i++)
+		{
+			if (!fields[i].empty())
+			{
+				module.enabled[i - 1] = atoi(fields[i].c_str()) > 0;
+			}
+		}
+		module.commands++;
+	}
+}
+
+static void module_baud(uint32_t baud)
+{
+	module.uart_baud = baud;
+}
+
+static void module_write(const uint8_t *data, size_t len)
+{
+	// Sent at the wrong baud rate, the module hears noise
+	if (module.uart_baud != module.baud)
+	{
+		return;
+	}
+	for (size_t i = 0; i < len; i++)
+	{
+		module.command += (char)data[i];
+		if (data[i] == '\n')
+		{
+			module_command(module.command);
+			module.command.clear();
+		}
+	}
+}
+
+static int module_available()
+{
+	module_run();
+	int64_t now = esp_timer_get_time();
+	int count = 0;
+	for (const module_byte_t &b : module.wire)
+	{
+		if (b.at_us > now)
+		{
+			break;
+		}
+		count++;
+	}
+	return count;
+}
+
+static int module_read()
+{
+	if (!module_available())
+	{
+		return -1;
+	}
+	module_byte_t b = module.wire.front();
+	module.wire.pop_front();
+	// A byte sampled at the wrong baud rate comes out as some other byte, mostly not ASCII
+	return b.baud == module.uart_baud ? b.byte : (b.byte ^ 0x5A) | 0x80;
+}
+
+static const host_uart_device_t module_device = {module_baud, module_write, module_available, module_read};
+
+// Function to power the module up with its factory settings, and the ESP32 side from reset
+static void module_power_on(bool pcas01)
+{
+	module.pcas01 = pcas01;
+	module.baud = GPS_BAUD;
+	module.update_ms = 1000;
+	for (int i = 0; i < MODULE_FIELDS; i++)
+	{
+		module.enabled[i] = true;
+	}
+	module.next_update_us = esp_timer_get_time();
+	module.tx_free_us = 0;
+	module.updates = 0;
+	module.dropped = 0;
+	module.commands = 0;
+	module.wire.clear();
+	module.command.clear();
+	host_uart_attach(1, &module_device);
+	nmea_parser_init(&nmea);
+	update_ms = 1000;
+	gpsSerial.begin(GPS_BAUD, SERIAL_8N1, GPS_RX_PIN, GPS_TX_PIN);
+}
+
+// Function to run the GPS task loop for ms and return the fixes published per second
+static double fix_rate(uint32_t ms)
+{
+	gps_fix_t fix;
+	gps_get_fix(&fix);
+	uint32_t fixes = nmea.fixes, published = 0;
+	uint32_t start = millis();
+	while (millis() - start < ms)
+	{
+		while (gpsSerial.available() > 0)
+		{
+			nmea_parser_feed(&nmea, gpsSerial.read());
+		}
+		if (nmea.fixes != fixes)
+		{
+			fixes = nmea.fixes;
+			published += publish_update(&fix);
+		}
+		delay(5);
+	}
+	return published * 1000.0 / ms;
+}
+
+// Function to configure a freshly powered module and check what it ended up with
+static void check_negotiation(const char *name, bool pcas01, uint32_t baud, uint32_t ms)
+{
+	module_power_on(pcas01);
+	uint32_t start = millis();
+	gps_configure();
+	uint32_t took = millis() - start;
+	double rate = fix_rate(1000);
+	printf("%s: %u baud, update every %u ms, %u commands taken, configured in %.1f s, %.1f fixes/s, %u updates dropped\n",
+		   name, module.baud, module.update_ms, module.commands, took / 1000.0, rate, module.dropped);
+	CHECK_EQ(module.baud, baud);
+	CHECK_EQ(module.update_ms, ms);
+	CHECK_EQ(update_ms, ms);
+	for (int i = 0; i < MODULE_FIELDS; i++)
+	{
+		CHECK_EQ(module.enabled[i], i == PCAS03_GGA || i == PCAS03_RMC);
+	}
+	CHECK(rate >= 1000.0 / ms * 0.8);
+	CHECK_EQ(module.dropped, 0);
+}
+
+// The module as it powers up, then the startup configuration against a module that takes every
+// command and one whose firmware ignores PCAS01 (the rate falls back to what 9600 baud carries)
+static void test_negotiation()
+{
+	module_power_on(true);
+	double factory = fix_rate(2000);
+	printf("factory settings: %u baud, %.1f fixes/s\n", module.baud, factory);
+	CHECK(factory < 1.6);
+	check_negotiation("PCAS01 taken", true, GPS_FAST_BAUD, GPS_FAST_UPDATE_MS);
+	check_negotiation("PCAS01 ignored", false, GPS_BAUD, GPS_SLOW_UPDATE_MS);
+	host_uart_attach(1, NULL);
+}
+
+int main()
+{
+	test_one_generation_per_fix();
+	test_concurrent_readers();
+	test_negotiation();
+	return check_result("gps");
+}
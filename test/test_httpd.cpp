@@ -0,0 +1,485 @@
+// Host tests of the web server: setup() of the sketch starts the real handlers on local sockets,
+// then they are talked to over HTTP, WebSocket and the MJPEG stream
+#include "Arduino.h"
+#include "check.h"
+#include "host.h"
+#include "http_client.h"
+#include "load.h"
+#include "esp_camera.h"
+#include "stream_control.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <unistd.h>
+
+void setup();
+void events_publish_gps(float lat, float lon, uint32_t seq);
+void events_publish_pose(float lat, float lon, float heading, uint32_t seq);
+extern volatile uint32_t car_uart_bytes_sent;
+
+static uint16_t port;
+
+// Allocations of the whole program and of the calling thread, to tell the server's from the client's
+static std::atomic<uint64_t> allocations(0);
+static thread_local uint64_t own_allocations = 0;
+
+void *operator new(size_t size)
+{
+	allocations++;
+	own_allocations++;
+	void *ptr = malloc(size ? size : 1);
+	if (!ptr)
+	{
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t size) noexcept
+{
+	free(ptr);
+}
+
+static http_response_t get(const char *path, const char *extra = "")
+{
+	http_conn_t conn;
+	http_response_t resp = {0, "", ""};
+	CHECK(http_connect(&conn, port, 2000));
+	CHECK(http_get(&conn, path, &resp, extra));
+	http_close(&conn);
+	return resp;
+}
+
+static void test_pages()
+{
+	http_response_t index = get("/");
+	CHECK_EQ(index.status, 200);
+	CHECK(http_header(&index, "Content-Encoding") == "gzip");
+	CHECK(index.body.size() > 2 && (uint8_t)index.body[0] == 0x1F && (uint8_t)index.body[1] == 0x8B);
+	std::string etag = "If-None-Match: " + http_header(&index, "ETag") + "\r\n";
+	http_response_t cached = get("/", etag.c_str());
+	CHECK_EQ(cached.status, 304);
+	CHECK(cached.body.empty());
+
+	http_response_t status = get("/status");
+	CHECK_EQ(status.status, 200);
+	CHECK(http_header(&status, "Content-Type") == "application/json");
+	CHECK(status.body.size() > 2 && status.body.front() == '{' && status.body.back() == '}');
+	CHECK(status.body.find("\"framesize\"") != std::string::npos);
+	http_response_t fields = get("/status?fields=quality");
+	CHECK(fields.body.find("\"quality\":") != std::string::npos);
+	CHECK(fields.body.find("\"framesize\"") == std::string::npos);
+
+	CHECK_EQ(get("/metrics").status, 200);
+	CHECK_EQ(get("/latency").status, 200);
+	CHECK_EQ(get("/track").status, 200);
+	// OPTIONS /* matches every path, so the IDF server answers other paths with 405, not 404
+	CHECK_EQ(get("/missing").status, 405);
+
+	http_response_t capture = get("/capture");
+	CHECK_EQ(capture.status, 200);
+	CHECK(capture.body.size() > 2 && (uint8_t)capture.body[0] == 0xFF && (uint8_t)capture.body[1] == 0xD8);
+}
+
+static void test_commands()
+{
+	uint32_t sent = car_uart_bytes_sent;
+	http_response_t go = get("/go");
+	CHECK_EQ(go.status, 200);
+	CHECK(go.body == "OK");
+	CHECK(http_header(&go, "Access-Control-Allow-Origin") == "*");
+	CHECK(car_uart_bytes_sent > sent);
+	CHECK_EQ(get("/stop").status, 200);
+
+	CHECK_EQ(get("/control?var=quality&val=14").status, 200);
+	CHECK_EQ(esp_camera_sensor_get()->status.quality, 14);
+	CHECK_EQ(get("/control").status, 404);
+
+	// Preflight for every path, other methods are refused
+	http_conn_t conn;
+	http_response_t resp;
+	CHECK(http_connect(&conn, port, 2000));
+	CHECK(http_request(&conn, "OPTIONS", "/go", &resp));
+	CHECK_EQ(resp.status, 200);
+	CHECK(http_header(&resp, "Access-Control-Allow-Methods") == "GET, POST, OPTIONS");
+	CHECK(http_request(&conn, "POST", "/go", &resp));
+	CHECK_EQ(resp.status, 405);
+	// The connection is kept for the next request
+	CHECK(http_get(&conn, "/stop", &resp));
+	CHECK_EQ(resp.status, 200);
+	http_close(&conn);
+}
+
+static void test_ws()
+{
+	http_conn_t conn;
+	CHECK(http_connect(&conn, port, 2000));
+	CHECK(ws_open(&conn, "/ws"));
+	std::vector<uint8_t> ack;
+	int type = 0;
+	const uint8_t forward[4] = {1, 200, 0x34, 0x12}; // DRIVE_FORWARD at speed 200, seq 0x1234
+	CHECK(ws_send_binary(&conn, forward, sizeof(forward)));
+	CHECK(ws_recv(&conn, &ack, &type));
+	CHECK_EQ(type, 2);
+	CHECK(ack == std::vector<uint8_t>({0xFF, 0, 0x34, 0x12}));
+	const uint8_t unknown[4] = {0x20, 0, 7, 0};
+	CHECK(ws_send_binary(&conn, unknown, sizeof(unknown)));
+	CHECK(ws_recv(&conn, &ack, &type));
+	CHECK(ack == std::vector<uint8_t>({0xFF, 1, 7, 0}));
+	http_close(&conn);
+}
+
+static void test_stream()
+{
+	http_conn_t conn;
+	http_response_t resp;
+	CHECK(http_connect(&conn, port + 1, 2000));
+	CHECK(http_send(&conn, "GET", "/stream"));
+	CHECK(http_read_head(&conn, &resp));
+	CHECK_EQ(resp.status, 200);
+	CHECK(http_header(&resp, "Content-Type").find("multipart/x-mixed-replace") == 0);
+	// Keep-alive repeats of an unchanged scene come once a second, so change it for every frame
+	uint32_t last_seq = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		host_camera_set_gray(i % 2 ? 40 : 200);
+		std::string headers, jpeg;
+		CHECK(http_read_part(&conn, &headers, &jpeg));
+		CHECK(jpeg.size() > 2 && (uint8_t)jpeg[0] == 0xFF && (uint8_t)jpeg[1] == 0xD8);
+		size_t at = headers.find("X-Frame-Seq: ");
+		CHECK(at != std::string::npos);
+		uint32_t seq = at == std::string::npos ? 0 : strtoul(&headers[at + 13], NULL, 10);
+		CHECK(seq > last_seq);
+		last_seq = seq;
+	}
+	http_close(&conn);
+
+	CHECK(http_connect(&conn, port + 1, 2000));
+	CHECK(http_get(&conn, "/missing", &resp));
+	CHECK_EQ(resp.status, 404);
+	http_close(&conn);
+}
+
+#define LINK_SLOW_RATE 80000 // Bytes/s of a weak WiFi link: about 7 fps of the boot picture
+#define LINK_SLOW_WINDOWS 7	 // Controller windows on the slow link
+#define LINK_FAST_WINDOWS 20 // Deadline for climbing back, in controller windows
+
+// Structure for what the stream client saw during one controller window
+typedef struct
+{
+	double fps;
+	double kbytes_per_s;
+	int level; // Of the controller at the end of the window
+} link_window_t;
+
+// Function to read the stream for one controller window
+static link_window_t read_window(http_conn_t *conn)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	double ms = 0;
+	uint32_t frames = 0;
+	size_t bytes = 0;
+	while (ms < STREAM_CONTROL_WINDOW_MS)
+	{
+		std::string headers, jpeg;
+		if (!http_read_part(conn, &headers, &jpeg))
+		{
+			CHECK(false);
+			break;
+		}
+		frames++;
+		bytes += jpeg.size();
+		ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+	link_window_t w = {frames * 1000.0 / ms, bytes / ms, stream_control_level()};
+	return w;
+}
+
+static void print_window(const char *link, int i, const link_window_t *w)
+{
+	printf("  %-5s %2d: level %d, %5.1f fps, %6.1f kB/s\n", link, i, w->level, w->fps, w->kbytes_per_s);
+}
+
+// The stream over a link too slow for the boot picture: the controller steps down until the link
+// keeps up with the frame rate, holds there, and climbs back once the link is fast again
+static void test_stream_link()
+{
+	// test_commands picked the quality by hand, which turned the controller off
+	CHECK_EQ(get("/control?var=adaptive&val=1").status, 200);
+	CHECK(stream_control_enabled());
+	CHECK_EQ(stream_control_level(), 0);
+	host_camera_set_moving(true);
+	host_link_set_rate(LINK_SLOW_RATE);
+	http_conn_t conn;
+	http_response_t resp;
+	CHECK(http_connect(&conn, port + 1, 2000));
+	CHECK(http_send(&conn, "GET", "/stream"));
+	CHECK(http_read_head(&conn, &resp));
+
+	printf("stream on a %d kB/s link, then unlimited:\n", LINK_SLOW_RATE / 1000);
+	link_window_t slow[LINK_SLOW_WINDOWS];
+	for (int i = 0; i < LINK_SLOW_WINDOWS; i++)
+	{
+		slow[i] = read_window(&conn);
+		print_window("slow", i, &slow[i]);
+	}
+	// Stepped down, and settled: the last windows keep the level and the frame rate the controller accepts
+	const link_window_t *last = &slow[LINK_SLOW_WINDOWS - 1];
+	CHECK(last->level > 0);
+	CHECK_EQ(slow[LINK_SLOW_WINDOWS - 2].level, last->level);
+	CHECK_EQ(slow[LINK_SLOW_WINDOWS - 3].level, last->level);
+	CHECK(slow[0].fps * 5 / 4 < last->fps);
+	CHECK(last->fps > STREAM_TARGET_FPS * 4 / 5.0);
+	CHECK(last->kbytes_per_s * 1000 < LINK_SLOW_RATE);
+
+	host_link_set_rate(0);
+	link_window_t fast = *last;
+	for (int i = 0; i < LINK_FAST_WINDOWS && fast.level > 0; i++)
+	{
+		fast = read_window(&conn);
+		print_window("fast", i, &fast);
+	}
+	CHECK_EQ(fast.level, 0);
+	http_close(&conn);
+	host_camera_set_moving(false);
+}
+
+// Concurrent clients on the handlers the page uses most, nothing may fail
+static void test_load()
+{
+	static const char *endpoints[] = {"/status", "/go", "ws"};
+	load_print_header(stdout);
+	for (const char *endpoint : endpoints)
+	{
+		load_result_t r = load_run(port, endpoint, 4, 300);
+		load_print(stdout, &r);
+		CHECK_EQ(r.errors, 0);
+		CHECK(r.requests > 0);
+	}
+}
+
+// Structure for what loading one path cost, averaged over the loads
+typedef struct
+{
+	double bytes;		// Received by the browser, headers included
+	double allocations; // Made by the server
+} page_cost_t;
+
+// Function to load a path on kept connections and average the bytes received and the server allocations
+static page_cost_t page_cost(const char *path, const char *extra, int loads)
+{
+	http_conn_t conn;
+	http_response_t resp;
+	CHECK(http_connect(&conn, port, 2000));
+	uint64_t all = allocations, own = own_allocations;
+	for (int i = 0; i < loads; i++)
+	{
+		CHECK(http_get(&conn, path, &resp, extra));
+	}
+	page_cost_t cost = {(double)conn.received / loads, (double)(allocations - all - (own_allocations - own)) / loads};
+	http_close(&conn);
+	return cost;
+}
+
+// The control page is served from flash as it was compressed at build time. Before, the handler
+// built it with 71 String += on every load and sent it uncompressed. Arduino's String grows to the
+// exact length on each concat, so that is replayed here as one realloc per piece
+static void test_page_load()
+{
+	const int loads = 200, pieces = 71;
+	std::ifstream file(PAGE_SOURCE, std::ios::binary);
+	std::stringstream html;
+	html << file.rdbuf();
+	std::string page = html.str();
+	CHECK(page.size() > 1000);
+	size_t built_allocations = 0, built_copied = 0, len = 0;
+	char *built = NULL;
+	for (int p = 0; p < pieces; p++)
+	{
+		size_t piece = (p + 1) * page.size() / pieces - p * page.size() / pieces;
+		char *grown = (char *)realloc(built, len + piece + 1);
+		built_copied += grown != built ? len : 0;
+		built_allocations++;
+		built = grown;
+		memcpy(built + len, page.data() + len, piece);
+		len += piece;
+	}
+	CHECK_EQ(len, page.size());
+	CHECK(!memcmp(built, page.data(), len));
+	free(built);
+
+	// /go sets the same CORS headers and sends a short body: what the host server costs per request
+	http_response_t first = get("/");
+	std::string etag = "If-None-Match: " + http_header(&first, "ETag") + "\r\n";
+	page_cost_t baseline = page_cost("/go", "", loads);
+	page_cost_t baseline_etag = page_cost("/go", etag.c_str(), loads);
+	page_cost_t fresh = page_cost("/", "", loads);
+	page_cost_t cached = page_cost("/", etag.c_str(), loads);
+
+	printf("page load: before %zu bytes sent, %zu allocations and %zu bytes moved building it;\n"
+		   "  now %.0f bytes first load, %.0f bytes revalidated, %+.1f / %+.1f allocations against a short reply\n",
+		   page.size(), built_allocations, built_copied, fresh.bytes, cached.bytes, fresh.allocations - baseline.allocations,
+		   cached.allocations - baseline_etag.allocations);
+	CHECK(fresh.bytes < page.size());
+	CHECK(cached.bytes < 512);
+	// The handler itself allocates nothing
+	CHECK(fresh.allocations <= baseline.allocations);
+	CHECK(cached.allocations <= baseline_etag.allocations);
+}
+
+// One driver, one command at a time: the WebSocket round trip against a GET per press, on a new
+// connection each time or on a kept one
+static void test_drive_latency()
+{
+	const int presses = 300;
+	std::vector<uint32_t> fresh_us;
+	for (int i = 0; i < presses; i++)
+	{
+		int64_t start = esp_timer_get_time();
+		http_response_t resp = get(i % 2 ? "/stop" : "/go");
+		fresh_us.push_back(esp_timer_get_time() - start);
+		CHECK_EQ(resp.status, 200);
+	}
+	std::sort(fresh_us.begin(), fresh_us.end());
+	load_result_t kept = load_run(port, "/go", 1, 300);
+	load_result_t ws = load_run(port, "ws", 1, 300);
+
+	printf("drive command round trip: GET on a new connection p50 %.3f ms p99 %.3f ms\n", fresh_us[presses / 2] / 1000.0,
+		   fresh_us[presses * 99 / 100] / 1000.0);
+	load_print_header(stdout);
+	load_print(stdout, &kept);
+	load_print(stdout, &ws);
+	CHECK_EQ(kept.errors + ws.errors, 0);
+	CHECK(ws.p50_us < fresh_us[presses / 2]);
+}
+
+// Snapshots come from the frame ring in their own tasks: two /capture clients back to back, each
+// waiting for a new frame, neither slow the stream nor hold up the control routes
+static void test_capture_load()
+{
+	host_camera_set_moving(true);
+	load_result_t alone = load_run(port, "stream", 1, 1000);
+	load_result_t stream, capture, status;
+	std::thread snapshots([&]() { capture = load_run(port, "/capture?wait_new=1", 2, 1000); });
+	std::thread control([&]() { status = load_run(port, "/status", 1, 1000); });
+	stream = load_run(port, "stream", 1, 1000);
+	snapshots.join();
+	control.join();
+	host_camera_set_moving(false);
+
+	load_print_header(stdout);
+	load_print(stdout, &alone);
+	load_print(stdout, &stream);
+	load_print(stdout, &capture);
+	load_print(stdout, &status);
+	CHECK_EQ(stream.errors + capture.errors + status.errors, 0);
+	CHECK(capture.requests > 0);
+	CHECK(stream.rate > alone.rate * 0.9);
+	// Waiting in the server task, every snapshot held up the control routes for up to a frame interval
+	CHECK(status.p50_us < 5000);
+}
+
+// Function to get a number that follows key in an event, 0 if it is not there
+static uint32_t event_number(const std::string &event, const char *key)
+{
+	size_t at = event.find(key);
+	return at == std::string::npos ? 0 : strtoul(&event[at + strlen(key)], NULL, 10);
+}
+
+// Function to open an /events subscription and wait until the events task serves it
+static void events_open(http_conn_t *conn)
+{
+	http_response_t resp;
+	std::string event;
+	CHECK(http_connect(conn, port, 2000));
+	CHECK(http_send(conn, "GET", "/events"));
+	CHECK(http_read_head(conn, &resp));
+	CHECK_EQ(resp.status, 200);
+	CHECK(http_header(&resp, "Content-Type") == "text/event-stream");
+	CHECK(http_read_event(conn, &event));
+	CHECK(event == "retry: 2000");
+	for (int i = 0; i < 100 && get("/metrics").body.find("car_events_subscribers 1") == std::string::npos; i++)
+	{
+		usleep(10000);
+	}
+}
+
+// GPS fixes reach the /events subscribers in order and within a few milliseconds, between the
+// stats events and a flood of pose estimates that share the stream
+static void test_events()
+{
+	const uint32_t fixes = 50;
+	http_conn_t conn;
+	events_open(&conn);
+	std::thread gps([]()
+					{
+		for (uint32_t seq = 1; seq <= fixes; seq++)
+		{
+			// A burst of poses right before the fix, faster than the events task can send them
+			for (uint32_t i = 1; i <= 16; i++)
+			{
+				events_publish_pose(47.6f, -122.3f, 90.0f, seq * 16 + i);
+			}
+			events_publish_gps(47.6f, -122.3f + seq * 1e-5f, seq);
+			usleep(10000);
+		} });
+
+	std::vector<uint32_t> latency_ms;
+	uint32_t last_id = 0, last_seq = 0;
+	std::string event;
+	unsigned long deadline = millis() + 5000; // Stats events keep coming, so a lost last fix cannot hang the test
+	while (last_seq < fixes && millis() < deadline && http_read_event(&conn, &event))
+	{
+		uint32_t id = event_number(event, "id: ");
+		CHECK(id > last_id);
+		last_id = id;
+		if (event.find("event: gps\n") == std::string::npos)
+		{
+			continue;
+		}
+		uint32_t seq = event_number(event, "\"seq\":");
+		CHECK_EQ(seq, last_seq + 1);
+		last_seq = seq;
+		latency_ms.push_back(millis() - event_number(event, "\"t\":"));
+	}
+	gps.join();
+	http_close(&conn);
+
+	CHECK_EQ(last_seq, fixes);
+	std::sort(latency_ms.begin(), latency_ms.end());
+	uint32_t p50 = latency_ms.empty() ? 0 : latency_ms[latency_ms.size() / 2];
+	uint32_t worst = latency_ms.empty() ? 0 : latency_ms.back();
+	printf("events: %u gps fixes, delivery p50 %u ms, max %u ms\n", (unsigned)latency_ms.size(), (unsigned)p50, (unsigned)worst);
+	CHECK(worst < 50);
+}
+
+int main()
+{
+	// A port pair of our own, so parallel runs do not collide. It stays below the ephemeral
+	// range (32768 and up on Linux), where the load clients of an earlier run may still hold it
+	port = 20000 + getpid() % 6000 * 2;
+	host_httpd_set_port_offset(port - 80);
+	setup();
+	test_pages();
+	test_commands();
+	test_ws();
+	test_stream();
+	test_stream_link();
+	test_load();
+	test_page_load();
+	test_drive_latency();
+	test_capture_load();
+	test_events();
+	return check_result("httpd");
+}
@@ -0,0 +1,73 @@
+// Host tests of the latency histograms
+#include "latency_hist.h"
+#include "check.h"
+#include <string.h>
+
+static void test_buckets()
+{
+	latency_hist_t h;
+	memset(&h, 0, sizeof(h));
+	latency_hist_add(&h, 0);	   // < 1 ms
+	latency_hist_add(&h, 999);	   // < 1 ms
+	latency_hist_add(&h, 1000);	   // < 2 ms
+	latency_hist_add(&h, 3999);	   // < 4 ms
+	latency_hist_add(&h, 4000);	   // < 8 ms
+	latency_hist_add(&h, 1023999); // < 1024 ms
+	latency_hist_add(&h, 5000000); // Slower than everything
+	CHECK_EQ(h.buckets[0], 2);
+	CHECK_EQ(h.buckets[1], 1);
+	CHECK_EQ(h.buckets[2], 1);
+	CHECK_EQ(h.buckets[3], 1);
+	CHECK_EQ(h.buckets[10], 1);
+	CHECK_EQ(h.buckets[LATENCY_HIST_BUCKETS - 1], 1);
+	CHECK_EQ(h.count, 7);
+	CHECK_EQ(h.max_us, 5000000);
+	CHECK_EQ(h.sum_us, 0 + 999 + 1000 + 3999 + 4000 + 1023999 + 5000000);
+
+	CHECK_EQ(latency_hist_bucket_ms(&h, 0), 1);
+	CHECK_EQ(latency_hist_bucket_ms(&h, 3), 8);
+	CHECK_EQ(latency_hist_bucket_ms(&h, LATENCY_HIST_BUCKETS - 1), 5000);
+}
+
+static void test_percentiles()
+{
+	latency_hist_t h;
+	memset(&h, 0, sizeof(h));
+	CHECK_EQ(latency_hist_percentile(&h, 50), 0);
+
+	// 98 fast samples and 2 slow ones: p50 is fast, p99 lands in the slow bucket
+	for (int i = 0; i < 98; i++)
+	{
+		latency_hist_add(&h, 1500);
+	}
+	latency_hist_add(&h, 40000);
+	latency_hist_add(&h, 40000);
+	CHECK_EQ(latency_hist_percentile(&h, 50), 2);
+	CHECK_EQ(latency_hist_percentile(&h, 98), 2);
+	CHECK_EQ(latency_hist_percentile(&h, 99), 64);
+	CHECK_EQ(latency_hist_percentile(&h, 100), 64);
+}
+
+static void test_json()
+{
+	latency_hist_t h;
+	memset(&h, 0, sizeof(h));
+	latency_hist_add(&h, 2500);
+	char buf[256];
+	int n = latency_hist_json(&h, buf, sizeof(buf));
+	CHECK_EQ(n, (int)strlen(buf));
+	CHECK(!strcmp(buf, "{\"n\":1,\"avg_us\":2500,\"max_us\":2500,\"p50_ms\":4,\"p99_ms\":4,\"buckets\":[0,0,1,0,0,0,0,0,0,0,0,0]}"));
+
+	// Too small a buffer: the result is cut but terminated, and the length shows it was cut
+	char small[20];
+	CHECK(latency_hist_json(&h, small, sizeof(small)) >= (int)sizeof(small));
+	CHECK_EQ(strlen(small), sizeof(small) - 1);
+}
+
+int main()
+{
+	test_buckets();
+	test_percentiles();
+	test_json();
+	return check_result("latency_hist");
+}
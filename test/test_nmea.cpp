@@ -0,0 +1,178 @@
+// Host tests of the streaming NMEA parser
+#include "nmea.h"
+#include "check.h"
+#include <string.h>
+
+// Function to wrap a sentence body in '$' and its checksum
+static void sentence(char *out, size_t len, const char *body)
+{
+	uint8_t sum = 0;
+	for (const char *p = body; *p; p++)
+	{
+		sum ^= *p;
+	}
+	snprintf(out, len, "$%s*%02X\r\n", body, sum);
+}
+
+// Function to feed a string, returns the type of the last completed sentence
+static nmea_type_t feed(nmea_parser_t *parser, const char *text)
+{
+	nmea_type_t last = NMEA_NONE;
+	for (; *text; text++)
+	{
+		nmea_type_t type = nmea_parser_feed(parser, *text);
+		if (type != NMEA_NONE)
+		{
+			last = type;
+		}
+	}
+	return last;
+}
+
+static nmea_type_t feed_body(nmea_parser_t *parser, const char *body)
+{
+	char line[128];
+	sentence(line, sizeof(line), body);
+	return feed(parser, line);
+}
+
+static void test_gga_rmc()
+{
+	nmea_parser_t p;
+	nmea_parser_init(&p);
+	CHECK_EQ(p.data.speed_cms, -1);
+	CHECK_EQ(p.data.hdop_c, -1);
+
+	CHECK_EQ(feed_body(&p, "GNGGA,123519.00,4807.03800,N,01131.00000,E,1,08,0.94,545.4,M,46.9,M,,"), NMEA_GGA);
+	CHECK_EQ(p.data.time, 12351900);
+	CHECK_EQ(p.data.lat_e7, 481173000); // 48 deg 7.038 min
+	CHECK_EQ(p.data.lon_e7, 115166667); // 11 deg 31 min
+	CHECK_EQ(p.data.sats, 8);
+	CHECK_EQ(p.data.hdop_c, 94);
+	CHECK_EQ(p.data.quality, 1);
+	CHECK_EQ(p.data.location_updates, 1);
+
+	CHECK_EQ(feed_body(&p, "GPRMC,123519.10,A,4807.03900,S,01131.00100,W,022.4,084.4,230394,003.1,W"), NMEA_RMC);
+	CHECK_EQ(p.data.time, 12351910);
+	CHECK_EQ(p.data.date, 230394);
+	CHECK_EQ(p.data.lat_e7, -481173167);
+	CHECK_EQ(p.data.lon_e7, -115166833);
+	CHECK_EQ(p.data.speed_cms, 1152); // 22.4 knots
+	CHECK_EQ(p.data.course_cdeg, 8440);
+	CHECK_EQ(p.passed, 2);
+}
+
+static void test_no_fix()
+{
+	nmea_parser_t p;
+	nmea_parser_init(&p);
+	// Quality 0 and status V carry no position
+	feed_body(&p, "GPGGA,000001.00,,,,,0,00,99.99,,,,,,");
+	feed_body(&p, "GPRMC,000001.00,V,,,,,,,010100,,,N");
+	CHECK_EQ(p.data.location_updates, 0);
+	CHECK_EQ(p.data.lat_e7, 0);
+	CHECK_EQ(p.data.speed_cms, -1);
+	CHECK_EQ(p.passed, 2);
+	CHECK_EQ(p.rejected, 0);
+}
+
+static void test_vtg()
+{
+	nmea_parser_t p;
+	nmea_parser_init(&p);
+	CHECK_EQ(feed_body(&p, "GPVTG,054.7,T,034.4,M,005.5,N,010.2,K"), NMEA_VTG);
+	CHECK_EQ(p.data.course_cdeg, 5470);
+	CHECK_EQ(p.data.speed_cms, 282); // 5.5 knots
+	CHECK_EQ(p.data.location_updates, 0);
+}
+
+static void test_corrupted()
+{
+	nmea_parser_t p;
+	nmea_parser_init(&p);
+	feed_body(&p, "GPGGA,120000.00,1049.38600,N,10637.78200,E,1,07,1.10,10.0,M,0.0,M,,");
+	nmea_data_t before = p.data;
+
+	// Checksum mismatch: one digit changed after the checksum was computed
+	char line[128];
+	sentence(line, sizeof(line), "GPGGA,120001.00,1049.38600,N,10637.78200,E,1,07,1.10,10.0,M,0.0,M,,");
+	line[18] = '9';
+	CHECK_EQ(feed(&p, line), NMEA_NONE);
+	CHECK_EQ(p.failed, 1);
+	CHECK(!memcmp(&before, &p.data, sizeof(before)));
+
+	// Truncated by the start of the next sentence, which still parses
+	sentence(line, sizeof(line), "GPRMC,120002.00,A,1049.38700,N,10637.78300,E,0.5,90.0,170524,,,A");
+	CHECK_EQ(feed(&p, "$GPGGA,120002.00,1049.3"), NMEA_NONE);
+	CHECK_EQ(feed(&p, line), NMEA_RMC);
+	CHECK_EQ(p.rejected, 1);
+	CHECK_EQ(p.data.time, 12000200);
+
+	// Line noise, a missing checksum and an overlong field are rejected
+	CHECK_EQ(feed(&p, "$GPGGA,1\x01\r\n"), NMEA_NONE);
+	CHECK_EQ(feed(&p, "$GPGGA,120003.00,1049.38600\r\n"), NMEA_NONE);
+	CHECK_EQ(feed_body(&p, "GPGGA,1200030000000000000.00,1049.38600,N,10637.78200,E,1,07,1.10,10.0,M,0.0,M,,"), NMEA_NONE);
+	CHECK_EQ(p.rejected, 4);
+	CHECK_EQ(p.data.time, 12000200);
+
+	// Malformed values reject the whole sentence
+	CHECK_EQ(feed_body(&p, "GPGGA,120004.00,1049.3x600,N,10637.78200,E,1,07,1.10,10.0,M,0.0,M,,"), NMEA_NONE);
+	CHECK_EQ(feed_body(&p, "GPGGA,120004.00,1061.00000,N,10637.78200,E,1,07,1.10,10.0,M,0.0,M,,"), NMEA_NONE);
+	CHECK_EQ(p.rejected, 6);
+
+	// Sentences that are not decoded still pass the checksum
+	CHECK_EQ(feed_body(&p, "GPGSV,3,1,11,03,03,111,00,04,15,270,00,06,01,010,00,13,06,292,00"), NMEA_OTHER);
+}
+
+// GGA and RMC of one update give a single fix, whatever order they come in
+static void test_epochs()
+{
+	nmea_parser_t p;
+	nmea_parser_init(&p);
+	feed_body(&p, "GPGGA,100000.00,4807.03800,N,01131.00000,E,1,08,0.94,545.4,M,46.9,M,,");
+	CHECK_EQ(p.fixes, 0);
+	CHECK_EQ(p.fix.lat_e7, 0);
+	feed_body(&p, "GPRMC,100000.00,A,4807.03800,N,01131.00000,E,001.0,090.0,230394,,");
+	CHECK_EQ(p.fixes, 1);
+	CHECK_EQ(p.fix.lat_e7, 481173000);
+	CHECK_EQ(p.fix.speed_cms, 51);
+	CHECK_EQ(p.fix.sats, 8);
+
+	// A repeated sentence of the closed update does not open another one
+	feed_body(&p, "GPGGA,100000.00,4807.03800,N,01131.00000,E,1,08,0.94,545.4,M,46.9,M,,");
+	feed_body(&p, "GPGSV,1,1,00");
+	CHECK_EQ(p.fixes, 1);
+
+	feed_body(&p, "GPRMC,100001.00,A,4807.03900,N,01131.00000,E,001.0,090.0,230394,,");
+	CHECK_EQ(p.fixes, 1);
+	feed_body(&p, "GPGGA,100001.00,4807.03900,N,01131.00000,E,1,09,0.90,545.4,M,46.9,M,,");
+	CHECK_EQ(p.fixes, 2);
+	CHECK_EQ(p.fix.sats, 9);
+	CHECK_EQ(p.fix.time, 10000100);
+
+	// With only GGA sent the update closes when the next one starts, with the data it had
+	feed_body(&p, "GPGGA,100002.00,4807.04000,N,01131.00000,E,1,09,0.90,545.4,M,46.9,M,,");
+	CHECK_EQ(p.fixes, 2);
+	feed_body(&p, "GPGGA,100003.00,4807.04100,N,01131.00000,E,1,09,0.90,545.4,M,46.9,M,,");
+	CHECK_EQ(p.fixes, 3);
+	CHECK_EQ(p.fix.time, 10000200);
+	CHECK_EQ(p.fix.lat_e7, 481173333);
+
+	// A sentence without a valid position neither opens nor completes an update
+	feed_body(&p, "GPRMC,100003.00,V,,,,,,,230394,,");
+	CHECK_EQ(p.fixes, 3);
+	feed_body(&p, "GPGGA,100004.00,,,,,0,00,,,M,,M,,");
+	CHECK_EQ(p.fixes, 4);
+	CHECK_EQ(p.fix.time, 10000300);
+	CHECK_EQ(p.data.location_updates, 7); // Every position sentence still counts here
+}
+
+int main()
+{
+	test_gga_rmc();
+	test_no_fix();
+	test_vtg();
+	test_corrupted();
+	test_epochs();
+	return check_result("nmea");
+}
@@ -0,0 +1,366 @@
+// Host tests of the fixed-point pose estimator, built together with pose.cpp to reach the filter steps
+#include "../pose.cpp"
+#include "check.h"
+#include "host.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static gps_fix_t current_fix;
+static int published_count = 0;
+
+uint32_t gps_get_fix(gps_fix_t *fix)
+{
+	*fix = current_fix;
+	return fix->version;
+}
+
+uint32_t gps_fix_version()
+{
+	return current_fix.version;
+}
+
+void events_publish_pose(float lat, float lon, float heading, uint32_t seq)
+{
+	published_count++;
+}
+
+static gps_fix_t make_fix(int32_t lat_e7, int32_t lon_e7)
+{
+	gps_fix_t fix;
+	memset(&fix, 0, sizeof(fix));
+	fix.version = current_fix.version + 1;
+	fix.lat_e7 = lat_e7;
+	fix.lon_e7 = lon_e7;
+	fix.speed_cms = -1;
+	fix.course_cdeg = -1;
+	fix.hdop_c = 100;
+	return fix;
+}
+
+static void test_sin_table()
+{
+	CHECK_EQ(sin_q14(0), 0);
+	CHECK_EQ(sin_q14(16384), 16384); // 90 degrees
+	CHECK_EQ(cos_q14(0), 16384);
+	CHECK_EQ(cos_q14(32768), -16384);
+	CHECK_EQ(sin_q14(49152), -16384);
+}
+
+// A fix is converted to mm around the origin and back without losing more than the last digit
+static void test_round_trip()
+{
+	pose_command(CAR_CMD_AUTO, 0, 0); // No motion model, fixes are taken as they are
+	current_fix = make_fix(108231000, 1066297000);
+	correct(&current_fix);
+	publish();
+	pose_t pose;
+	pose_get(&pose);
+	CHECK_EQ(pose.lat_e7, 108231000);
+	CHECK_EQ(pose.lon_e7, 1066297000);
+	CHECK_EQ(pose.version, 1);
+
+	static const int32_t offsets[][2] = {{898, 0}, {0, 915}, {-12345, 6789}, {150000, -150000}};
+	for (const int32_t *d : offsets)
+	{
+		current_fix = make_fix(108231000 + d[0], 1066297000 + d[1]);
+		correct(&current_fix);
+		publish();
+		pose_get(&pose);
+		CHECK(abs(pose.lat_e7 - current_fix.lat_e7) <= 1);
+		CHECK(abs(pose.lon_e7 - current_fix.lon_e7) <= 1);
+	}
+	CHECK_EQ(published_count, 5);
+
+	// 898e-7 degrees of latitude is 10 m north
+	current_fix = make_fix(108231000 + 898, 1066297000);
+	correct(&current_fix);
+	CHECK_EQ(y_mm, 9996);
+	CHECK(abs(x_mm) <= 1);
+}
+
+// Dead reckoning moves by the commanded speed and turn rate, and stops when the joystick lease runs out
+static void test_predict()
+{
+	pose_command(CAR_CMD_MANUAL, 0, 0);
+	heading = 0;
+	int32_t y = y_mm;
+	pose_command(CAR_CMD_FORWARD, 255, 0);
+	CHECK(predict(1000));
+	CHECK_EQ(y_mm - y, POSE_MAX_SPEED_MMS);
+
+	pose_command(CAR_CMD_RIGHT, 255, 0);
+	CHECK(predict(1000));
+	CHECK_EQ(heading, (uint16_t)TURN_BAM_PER_S);
+
+	// Facing west now, half throttle backwards moves east
+	int32_t x = x_mm;
+	pose_command(CAR_CMD_DRIVE, (uint8_t)-64, 0);
+	CHECK(predict(500));
+	CHECK(abs((x_mm - x) - 64 * POSE_MAX_SPEED_MMS / 127 / 2) <= 1);
+	host_clock_advance_ms(CAR_DRIVE_LEASE_MS);
+	CHECK(!predict(50));
+
+	pose_command(CAR_CMD_STOP, 0, 0);
+	CHECK(!predict(1000));
+}
+
+// With a motion model a fix only pulls the estimate part of the way, more so with a good HDOP
+static void test_correct_gain()
+{
+	pose_command(CAR_CMD_STOP, 0, 0);
+	heading = 0;
+	current_fix = make_fix(origin_lat_e7, origin_lon_e7);
+	x_mm = 0;
+	y_mm = -1000;
+	correct(&current_fix);
+	CHECK_EQ(y_mm, -1000 + 1000 * POSE_GPS_GAIN_Q8 / 256);
+
+	y_mm = -1000;
+	current_fix.hdop_c = 500;
+	correct(&current_fix);
+	CHECK_EQ(y_mm, -1000 + 1000 * (POSE_GPS_GAIN_Q8 / 2) / 256);
+
+	// Far away fixes are taken as they are
+	y_mm = -POSE_SNAP_MM - 1;
+	correct(&current_fix);
+	CHECK_EQ(y_mm, 0);
+
+	// The GPS course turns the heading towards it while moving
+	current_fix.speed_cms = POSE_COURSE_MIN_CMS;
+	current_fix.course_cdeg = 9000;
+	correct(&current_fix);
+	CHECK_EQ(heading, 16384 * POSE_HEADING_GAIN_Q8 / 256);
+}
+
+// Replay of drive sessions: the commands the page sent, played into a model of the real car that
+// differs from the filter's (motor lag, a slower car, faster spins) and into the filter, with noisy
+// GPS fixes from the true path. The estimate is scored against the true path at every update
+#define REPLAY_STEP_MS (1000 / POSE_RATE_HZ)
+#define REPLAY_FIX_MS 100	   // 10 Hz GPS
+#define REPLAY_NOISE_MM 800	   // GPS error per axis (standard deviation)
+#define REPLAY_SPEED_FACTOR 0.9 // True speed over the speed the filter assumes
+#define REPLAY_TURN_FACTOR 1.1
+#define REPLAY_LAG_S 0.2 // Time constant of the motors
+#define ORIGIN_LAT_E7 108231000
+#define ORIGIN_LON_E7 1066297000
+
+// Structure for one command of a session
+typedef struct
+{
+	uint32_t at_ms;
+	uint8_t cmd;
+	uint8_t arg0;
+	uint8_t arg1;
+} replay_command_t;
+
+// Structure for the score of one estimator over a session, errors in mm
+typedef struct
+{
+	double rms;
+	double p95;
+	double max;
+} replay_score_t;
+
+static uint32_t noise_state = 1;
+
+// Function to get a normally distributed number (Box-Muller) with the given deviation
+static double gaussian(double sigma)
+{
+	double u[2];
+	for (double &v : u)
+	{
+		noise_state = noise_state * 1103515245 + 12345;
+		v = ((noise_state >> 8) + 1) / (double)(1 << 24);
+	}
+	return sigma * sqrt(-2 * log(u[0])) * cos(2 * M_PI * u[1]);
+}
+
+// Buttons on the page: runs, spins and reversing, each button press a command with the default speed
+static std::vector<replay_command_t> buttons_session()
+{
+	std::vector<replay_command_t> s;
+	uint32_t t = 0;
+	for (int lap = 0; lap < 6; lap++)
+	{
+		s.push_back({t, CAR_CMD_FORWARD, 0, 0});
+		s.push_back({t += 4000, CAR_CMD_RIGHT, 0, 0});
+		s.push_back({t += 500, CAR_CMD_FORWARD, 0, 0});
+		s.push_back({t += 3000, CAR_CMD_LEFT, 0, 0});
+		s.push_back({t += 300, CAR_CMD_BACK, 0, 0});
+		s.push_back({t += 1500, CAR_CMD_STOP, 0, 0});
+		t += 1000;
+	}
+	s.push_back({t, CAR_CMD_STOP, 0, 0});
+	return s;
+}
+
+// The joystick: a slalom at varying throttle, positions sent every 100 ms like the page does
+static std::vector<replay_command_t> joystick_session()
+{
+	std::vector<replay_command_t> s;
+	for (uint32_t t = 0; t < 60000; t += 100)
+	{
+		int throttle = 60 + 50 * sin(t / 7000.0);
+		int steering = 80 * sin(t / 1500.0);
+		s.push_back({t, CAR_CMD_DRIVE, (uint8_t)throttle, (uint8_t)steering});
+	}
+	s.push_back({60000, CAR_CMD_STOP, 0, 0});
+	return s;
+}
+
+// Parked: the car does not move, only the GPS noise does
+static std::vector<replay_command_t> parked_session()
+{
+	return {{0, CAR_CMD_STOP, 0, 0}, {30000, CAR_CMD_STOP, 0, 0}};
+}
+
+// Function to score errors in mm
+static replay_score_t score(std::vector<double> errors)
+{
+	replay_score_t r = {0, 0, 0};
+	for (double e : errors)
+	{
+		r.rms += e * e;
+	}
+	r.rms = sqrt(r.rms / errors.size());
+	std::sort(errors.begin(), errors.end());
+	r.p95 = errors[errors.size() * 95 / 100];
+	r.max = errors.back();
+	return r;
+}
+
+// Function to replay a session, scoring the filter and the last fix held until the next one
+static void replay(const char *name, const std::vector<replay_command_t> &session, replay_score_t *filter, replay_score_t *held)
+{
+	// Start over: no origin, no fix yet, stopped
+	has_origin = false;
+	heading = 0;
+	memset(&current_fix, 0, sizeof(current_fix));
+	pose_command(CAR_CMD_MANUAL, 0, 0);
+
+	double k = cos(ORIGIN_LAT_E7 * 1e-7 * M_PI / 180);
+	double x = 0, y = 0, h = 0, v = 0, w = 0; // True position (mm), heading (rad, clockwise from north), speeds
+	double target_v = 0, target_w = 0;
+	uint32_t lease_ms = 0;
+	double fix_x = 0, fix_y = 0;
+	std::vector<double> filter_errors, held_errors;
+	size_t next = 0;
+	uint32_t end = session.back().at_ms;
+	for (uint32_t t = 0; t <= end; t += REPLAY_STEP_MS)
+	{
+		while (next < session.size() && session[next].at_ms <= t)
+		{
+			const replay_command_t *c = &session[next++];
+			pose_command(c->cmd, c->arg0, c->arg1);
+			double straight = (c->arg0 ? c->arg0 : POSE_DEFAULT_STRAIGHT_PWM) * POSE_MAX_SPEED_MMS / 255.0;
+			double spin = (c->arg0 ? c->arg0 : POSE_DEFAULT_TURN_PWM) * POSE_MAX_TURN_DPS / 255.0 * M_PI / 180;
+			target_v = c->cmd == CAR_CMD_FORWARD ? straight : c->cmd == CAR_CMD_BACK ? -straight : 0;
+			target_w = c->cmd == CAR_CMD_RIGHT ? spin : c->cmd == CAR_CMD_LEFT ? -spin : 0;
+			if (c->cmd == CAR_CMD_DRIVE)
+			{
+				target_v = (int8_t)c->arg0 * POSE_MAX_SPEED_MMS / 127.0;
+				target_w = (int8_t)c->arg1 * POSE_MAX_TURN_DPS / 127.0 * M_PI / 180;
+				lease_ms = t + CAR_DRIVE_LEASE_MS;
+			}
+			else
+			{
+				lease_ms = 0;
+			}
+			target_v *= REPLAY_SPEED_FACTOR;
+			target_w *= REPLAY_TURN_FACTOR;
+		}
+		// The true car, integrated in 1 ms steps
+		for (int i = 0; i < REPLAY_STEP_MS; i++)
+		{
+			bool leased = !lease_ms || t + i < lease_ms;
+			v += ((leased ? target_v : 0) - v) * 0.001 / REPLAY_LAG_S;
+			w += ((leased ? target_w : 0) - w) * 0.001 / REPLAY_LAG_S;
+			h += w * 0.001;
+			x += v * sin(h) * 0.001;
+			y += v * cos(h) * 0.001;
+		}
+		host_clock_advance_ms(REPLAY_STEP_MS);
+
+		// The pose task: predict, take a new fix, publish
+		predict(REPLAY_STEP_MS);
+		if (t % REPLAY_FIX_MS == 0)
+		{
+			fix_x = x + gaussian(REPLAY_NOISE_MM);
+			fix_y = y + gaussian(REPLAY_NOISE_MM);
+			current_fix = make_fix(ORIGIN_LAT_E7 + lround(fix_y / 11.132), ORIGIN_LON_E7 + lround(fix_x / (11.132 * k)));
+			current_fix.hdop_c = 90;
+			current_fix.speed_cms = fabs(v) / 10;
+			double course = fmod((v < 0 ? h + M_PI : h) * 180 / M_PI + gaussian(5) + 720, 360);
+			current_fix.course_cdeg = lround(course * 100) % 36000;
+			correct(&current_fix);
+		}
+		publish();
+		pose_t pose;
+		pose_get(&pose);
+		double px = (pose.lon_e7 - ORIGIN_LON_E7) * 11.132 * k;
+		double py = (pose.lat_e7 - ORIGIN_LAT_E7) * 11.132;
+		filter_errors.push_back(hypot(px - x, py - y));
+		held_errors.push_back(hypot(fix_x - x, fix_y - y));
+	}
+	*filter = score(filter_errors);
+	*held = score(held_errors);
+	printf("  %-9s filter rms %5.0f mm, p95 %5.0f mm, max %5.0f mm; last fix rms %5.0f mm, p95 %5.0f mm, max %5.0f mm\n", name,
+		   filter->rms, filter->p95, filter->max, held->rms, held->p95, held->max);
+}
+
+static void test_replay()
+{
+	printf("replay at %d Hz, GPS at %d Hz with %d mm noise:\n", POSE_RATE_HZ, 1000 / REPLAY_FIX_MS, REPLAY_NOISE_MM);
+	replay_score_t filter, held;
+	replay("buttons", buttons_session(), &filter, &held);
+	CHECK(filter.rms < held.rms);
+	replay("joystick", joystick_session(), &filter, &held);
+	CHECK(filter.rms < held.rms);
+	replay("parked", parked_session(), &filter, &held);
+	CHECK(filter.rms < held.rms);
+}
+
+// CPU cost of the pose task per update: a prediction alone, and a prediction with a fix to take in
+static void test_update_cost()
+{
+	const int updates = 1000000;
+	pose_command(CAR_CMD_MANUAL, 0, 0);
+	pose_command(CAR_CMD_FORWARD, 200, 0);
+	current_fix = make_fix(ORIGIN_LAT_E7, ORIGIN_LON_E7);
+	current_fix.speed_cms = 100;
+	current_fix.course_cdeg = 4500;
+	correct(&current_fix);
+	volatile int32_t sink = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < updates; i++)
+	{
+		predict(REPLAY_STEP_MS);
+		sink = sink + x_mm;
+	}
+	double predict_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / updates;
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < updates; i++)
+	{
+		predict(REPLAY_STEP_MS);
+		current_fix.lat_e7 = ORIGIN_LAT_E7 + (i & 1023);
+		correct(&current_fix);
+		publish();
+		sink = sink + x_mm;
+	}
+	double fix_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / updates;
+	printf("update cost on this host: %.1f ns predicting, %.1f ns with a fix and publishing\n", predict_ns, fix_ns);
+	CHECK(predict_ns < fix_ns);
+}
+
+int main()
+{
+	sin_table_init();
+	test_sin_table();
+	test_round_trip();
+	test_predict();
+	test_correct_gain();
+	test_replay();
+	test_update_cost();
+	return check_result("pose");
+}
@@ -0,0 +1,168 @@
+// Host tests of the AVI writer, built together with recorder.cpp to reach the file functions.
+// RECORD_ROOT is a directory below the working directory
+#include "../recorder.cpp"
+#include "check.h"
+#include <sys/stat.h>
+#include <vector>
+
+// The recorder tasks are not started, the ring and the GPS are never asked
+void frame_ring_subscribe() {}
+void frame_ring_unsubscribe() {}
+shared_frame_t *frame_ring_acquire(uint32_t last_seq, TickType_t wait) { return NULL; }
+void frame_ring_release(shared_frame_t *frame) {}
+uint32_t gps_get_fix(gps_fix_t *fix) { return 0; }
+
+static uint32_t get_u32(const uint8_t *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static std::vector<uint8_t> read_file(const char *path)
+{
+	std::vector<uint8_t> data;
+	FILE *f = fopen(path, "rb");
+	CHECK(f != NULL);
+	if (f)
+	{
+		uint8_t buf[4096];
+		size_t n;
+		while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+		{
+			data.insert(data.end(), buf, buf + n);
+		}
+		fclose(f);
+	}
+	return data;
+}
+
+// Function to make a fake JPEG of len bytes (SOI, filler, EOI)
+static void fake_jpeg(record_buffer_t *b, size_t len, int64_t captured_us, uint32_t gps_version)
+{
+	b->buf = (uint8_t *)realloc(b->buf, len);
+	b->cap = b->len = len;
+	memset(b->buf, 0x55, len);
+	b->buf[0] = 0xFF;
+	b->buf[1] = 0xD8;
+	b->buf[len - 2] = 0xFF;
+	b->buf[len - 1] = 0xD9;
+	b->width = 320;
+	b->height = 240;
+	b->captured_us = captured_us;
+	memset(&b->fix, 0, sizeof(b->fix));
+	b->fix.version = gps_version;
+	b->fix.lat_e7 = 108231000 + gps_version;
+	b->fix.lon_e7 = 1066297000 - gps_version;
+	b->fix.speed_cms = -1;
+	b->fix.course_cdeg = -1;
+	b->fix.hdop_c = -1;
+}
+
+static void test_avi()
+{
+	mkdir(RECORD_ROOT, 0755);
+	static const size_t sizes[] = {1000, 1501, 2048, 777, 3000};
+	const int frames = sizeof(sizes) / sizeof(sizes[0]);
+	record_buffer_t b;
+	memset(&b, 0, sizeof(b));
+	fake_jpeg(&b, sizes[0], 5000000, 0);
+	CHECK(record_open(&b));
+	for (int i = 0; i < frames; i++)
+	{
+		fake_jpeg(&b, sizes[i], 5000000 + i * 100000, i); // 10 fps, the first frame has no fix yet
+		CHECK(record_write(&b));
+	}
+	record_close();
+	free(b.buf);
+	CHECK_EQ(stats.errors, 0);
+
+	std::vector<uint8_t> avi = read_file(stats.path);
+	CHECK(avi.size() > AVI_HEADER_SIZE);
+	if (avi.size() <= AVI_HEADER_SIZE)
+	{
+		return;
+	}
+	const uint8_t *h = avi.data();
+	CHECK(!memcmp(h, "RIFF", 4));
+	CHECK_EQ(get_u32(&h[4]), avi.size() - 8);
+	CHECK(!memcmp(&h[8], "AVI LIST", 8));
+	CHECK(!memcmp(&h[20], "hdrlavih", 8));
+	CHECK_EQ(get_u32(&h[32]), 100000); // us per frame
+	CHECK_EQ(get_u32(&h[48]), frames);
+	CHECK_EQ(get_u32(&h[64]), 320);
+	CHECK_EQ(get_u32(&h[68]), 240);
+	CHECK(!memcmp(&h[108], "vidsMJPG", 8));
+	CHECK(!memcmp(&h[212], "LIST", 4));
+	CHECK(!memcmp(&h[220], "movi", 4));
+	uint32_t movi_end = 220 + get_u32(&h[216]);
+	CHECK(movi_end + 8 + frames * 16 == avi.size());
+
+	// Walk the chunks, then check that idx1 points at each of them
+	std::vector<uint32_t> offsets, lengths;
+	uint32_t pos = 224;
+	while (pos + 8 <= movi_end)
+	{
+		CHECK(!memcmp(&h[pos], "00dc", 4));
+		uint32_t len = get_u32(&h[pos + 4]);
+		offsets.push_back(pos - 220);
+		lengths.push_back(len);
+		pos += 8 + len + (len & 1);
+	}
+	CHECK_EQ(pos, movi_end);
+	CHECK_EQ(offsets.size(), frames);
+	for (size_t i = 0; i < offsets.size() && (int)i < frames; i++)
+	{
+		const uint8_t *jpg = &h[220 + offsets[i] + 8];
+		CHECK(jpg[0] == 0xFF && jpg[1] == 0xD8);
+		CHECK(jpg[lengths[i] - 2] == 0xFF && jpg[lengths[i] - 1] == 0xD9);
+		if (i == 0)
+		{
+			CHECK_EQ(lengths[i], sizes[i]); // No fix, the frame is stored as it came
+		}
+		else
+		{
+			CHECK(jpg[2] == 0xFF && jpg[3] == 0xE1); // EXIF GPS segment right after SOI
+			CHECK_EQ(lengths[i], sizes[i] + 2 + (jpg[4] << 8 | jpg[5]));
+		}
+	}
+	const uint8_t *idx1 = &h[movi_end];
+	CHECK(!memcmp(idx1, "idx1", 4));
+	CHECK_EQ(get_u32(&idx1[4]), frames * 16);
+	for (int i = 0; i < frames && i < (int)offsets.size(); i++)
+	{
+		const uint8_t *e = &idx1[8 + i * 16];
+		CHECK(!memcmp(e, "00dc", 4));
+		CHECK_EQ(get_u32(&e[4]), 0x10);
+		CHECK_EQ(get_u32(&e[8]), offsets[i]);
+		CHECK_EQ(get_u32(&e[12]), lengths[i]);
+	}
+
+	// The sidecar holds the same offsets with the GPS data
+	char idx_path[sizeof(stats.path)];
+	strcpy(idx_path, stats.path);
+	strcpy(&idx_path[strlen(idx_path) - 3], "idx");
+	std::vector<uint8_t> idx = read_file(idx_path);
+	CHECK_EQ(idx.size(), 8 + frames * sizeof(record_index_t));
+	if (idx.size() != 8 + frames * sizeof(record_index_t))
+	{
+		return;
+	}
+	CHECK(!memcmp(idx.data(), "CARIDX", 6));
+	CHECK_EQ(idx[6] | idx[7] << 8, RECORD_INDEX_VERSION);
+	for (int i = 0; i < frames; i++)
+	{
+		record_index_t entry;
+		memcpy(&entry, &idx[8 + i * sizeof(entry)], sizeof(entry));
+		CHECK_EQ(entry.offset, offsets[i]);
+		CHECK_EQ(entry.size, lengths[i]);
+		CHECK_EQ(entry.time_ms, i * 100);
+		CHECK_EQ(entry.gps_version, i);
+		CHECK_EQ(entry.lat_e7, 108231000 + i);
+		CHECK_EQ(entry.lon_e7, 1066297000 - i);
+	}
+}
+
+int main()
+{
+	test_avi();
+	return check_result("recorder");
+}
@@ -0,0 +1,131 @@
+// Host simulation of the background sonar sampling of the sketch (sampleSonar and sonarTimerISR)
+// on the simulated UNO R4: how often each distance is refreshed, and what the interrupt costs
+#include "uno.h"
+#include "check.h"
+#include "../AutoCar_Arduino/AutoCar_Arduino.ino"
+#include <algorithm>
+
+#define LOOP_US 10		// Cost of one pass of loop() besides the delays it makes itself
+#define RUN_MS 10000	// Simulated time per measurement
+#define WARMUP_MS 1000 // The front sensor is skipped while the servo settles after setup()
+
+// Structure for what one measurement saw
+typedef struct
+{
+	uint32_t readings[SONAR_COUNT]; // New readings stored by sampleSonar
+	int last[SONAR_COUNT];			// Last distance of each sensor
+	uint32_t isr_calls;
+} sonar_run_t;
+
+static unsigned long *const reading_times[SONAR_COUNT] = {&F_time, &R_time, &L_time};
+static int *const distances[SONAR_COUNT] = {&F_distance, &R_distance, &L_distance};
+
+// Function to run the sketch for ms of simulated time and count the new readings of each sensor
+static sonar_run_t run(uint32_t ms)
+{
+	sonar_run_t r = {};
+	unsigned long last_time[SONAR_COUNT];
+	for (int i = 0; i < SONAR_COUNT; i++)
+	{
+		last_time[i] = *reading_times[i];
+	}
+	uint32_t isr_start = uno_isr_stats().calls;
+	uint64_t end = uno_now_us() + (uint64_t)ms * 1000;
+	while (uno_now_us() < end)
+	{
+		loop();
+		uno_advance_us(LOOP_US);
+		for (int i = 0; i < SONAR_COUNT; i++)
+		{
+			if (*reading_times[i] != last_time[i])
+			{
+				last_time[i] = *reading_times[i];
+				r.readings[i]++;
+			}
+		}
+	}
+	for (int i = 0; i < SONAR_COUNT; i++)
+	{
+		r.last[i] = *distances[i];
+	}
+	r.isr_calls = uno_isr_stats().calls - isr_start;
+	return r;
+}
+
+// Function to model the refresh of all three distances before: frontReadPing(), leftReadPing() and
+// rightReadPing() each did delay(30) and then waited for the echo (NewPing gives up at maximum_distance)
+static double legacy_refresh_ms(const int cm[SONAR_COUNT])
+{
+	double us = 0;
+	for (int i = 0; i < SONAR_COUNT; i++)
+	{
+		int echo_us = cm[i] && cm[i] <= maximum_distance ? cm[i] * UNO_US_PER_CM : maximum_distance * US_ROUNDTRIP_CM;
+		us += 30000 + 10 + UNO_ECHO_DELAY_US + echo_us;
+	}
+	return us / 1000;
+}
+
+static void print_run(const char *name, const int cm[SONAR_COUNT], const sonar_run_t *r)
+{
+	printf("%-14s front %5.1f Hz, right %5.1f Hz, left %5.1f Hz, all three every %5.1f ms (before %5.1f ms), %u interrupts/s\n",
+		   name, r->readings[SONAR_FRONT] * 1000.0 / RUN_MS, r->readings[SONAR_RIGHT] * 1000.0 / RUN_MS,
+		   r->readings[SONAR_LEFT] * 1000.0 / RUN_MS, RUN_MS / (double)std::min({r->readings[0], r->readings[1], r->readings[2]}),
+		   legacy_refresh_ms(cm), (unsigned)(r->isr_calls * 1000ULL / RUN_MS));
+}
+
+// Without a free timer the sketch says so, which only reaches the computer if Serial was started first
+static void test_no_timer()
+{
+	uno_timers_available(0);
+	setup();
+	CHECK_EQ(Serial.lost, 0);
+	CHECK(Serial.lines > 0);
+	uno_timers_available(1);
+}
+
+static void test_refresh()
+{
+	const int near[SONAR_COUNT] = {50, 100, 150};
+	uno_sonar_attach(trig_pin_1, echo_pin_1, near[SONAR_FRONT]);
+	uno_sonar_attach(trig_pin_2, echo_pin_2, near[SONAR_RIGHT]);
+	uno_sonar_attach(trig_pin_3, echo_pin_3, near[SONAR_LEFT]);
+	setup();
+	run(WARMUP_MS);
+
+	// Every echo ends well within the ping spacing, so the sensors take turns every SONAR_PING_SPACING_MS
+	sonar_run_t r = run(RUN_MS);
+	print_run("in range", near, &r);
+	for (int i = 0; i < SONAR_COUNT; i++)
+	{
+		CHECK(r.readings[i] * 1000.0 / RUN_MS > 1000.0 / (SONAR_COUNT * (SONAR_PING_SPACING_MS + 1)));
+		CHECK(r.last[i] >= near[i] - 1 && r.last[i] <= near[i] + 1);
+	}
+	// The interrupt only runs while an echo is timed: about one call per SONAR_TIMER_US of echo
+	uint32_t pings = r.readings[0] + r.readings[1] + r.readings[2];
+	uint32_t echo_us = (UNO_ECHO_DELAY_US + (near[0] + near[1] + near[2]) * UNO_US_PER_CM / SONAR_COUNT);
+	CHECK(r.isr_calls < pings * (echo_us / SONAR_TIMER_US + 3));
+
+	// Nothing in range: each ping waits for its timeout, and the reading is the default distance
+	const int far[SONAR_COUNT] = {0, 0, 0};
+	for (int i = 0; i < SONAR_COUNT; i++)
+	{
+		uno_sonar_set(sonarTrigPins[i], 0);
+	}
+	r = run(RUN_MS);
+	print_run("nothing ahead", far, &r);
+	for (int i = 0; i < SONAR_COUNT; i++)
+	{
+		CHECK(r.readings[i] > 0);
+		CHECK_EQ(r.last[i], 250);
+	}
+
+	// The interrupt never waits: no delay() or delayMicroseconds() from it
+	CHECK_EQ(uno_isr_stats().blocking, 0);
+}
+
+int main()
+{
+	test_no_timer();
+	test_refresh();
+	return check_result("sonar");
+}
@@ -0,0 +1,84 @@
+// Host tests of the adaptive stream quality controller
+#include "stream_control.h"
+#include "esp_camera.h"
+#include "check.h"
+#include "host.h"
+#include <string.h>
+
+// Function to report one full measurement window of frames with the given timing
+static void run_window(uint32_t frame_ms, uint32_t send_ms)
+{
+	for (uint32_t i = 0; i <= STREAM_CONTROL_WINDOW_MS / frame_ms; i++)
+	{
+		host_clock_advance_ms(frame_ms);
+		stream_control_report(frame_ms, send_ms, 10000);
+	}
+}
+
+static void check_sensor(framesize_t framesize, int quality)
+{
+	sensor_t *s = esp_camera_sensor_get();
+	CHECK_EQ(s->status.framesize, framesize);
+	CHECK_EQ(s->status.quality, quality);
+}
+
+int main()
+{
+	camera_config_t config;
+	memset(&config, 0, sizeof(config));
+	config.pixel_format = PIXFORMAT_JPEG;
+	config.frame_size = FRAMESIZE_CIF;
+	config.jpeg_quality = 10;
+	CHECK_EQ(esp_camera_init(&config), ESP_OK);
+	CHECK_EQ(stream_control_level(), 0);
+
+	// One slow window steps down, the window right after the change is not judged
+	run_window(200, 150);
+	CHECK_EQ(stream_control_level(), 1);
+	check_sensor(FRAMESIZE_CIF, 15);
+	run_window(200, 150);
+	CHECK_EQ(stream_control_level(), 1);
+	run_window(200, 150);
+	CHECK_EQ(stream_control_level(), 2);
+
+	// A single late frame is enough to step down
+	run_window(50, 5);
+	run_window(50, 5);
+	CHECK_EQ(stream_control_level(), 2);
+	host_clock_advance_ms(50);
+	stream_control_report(50, STREAM_LATENCY_BUDGET_MS + 1, 10000);
+	run_window(50, 5);
+	CHECK_EQ(stream_control_level(), 3);
+	check_sensor(FRAMESIZE_QVGA, 12);
+
+	// Stepping back up needs STREAM_CONTROL_UPGRADE_WINDOWS good windows in a row (after the settling one)
+	run_window(50, 5);
+	for (int i = 0; i < STREAM_CONTROL_UPGRADE_WINDOWS - 1; i++)
+	{
+		run_window(50, 5);
+		CHECK_EQ(stream_control_level(), 3);
+	}
+	run_window(50, 5);
+	CHECK_EQ(stream_control_level(), 2);
+	check_sensor(FRAMESIZE_CIF, 22);
+
+	// Windows that are fine but without headroom reset the count
+	run_window(50, 5);
+	run_window(50, 5);
+	run_window(50, 5);
+	run_window(50, 30);
+	run_window(50, 5);
+	run_window(50, 5);
+	CHECK_EQ(stream_control_level(), 2);
+	run_window(50, 5);
+	CHECK_EQ(stream_control_level(), 1);
+
+	// Disabled, the controller leaves the sensor alone
+	stream_control_enable(false);
+	CHECK(!stream_control_enabled());
+	run_window(200, 150);
+	run_window(200, 150);
+	CHECK_EQ(stream_control_level(), 1);
+	check_sensor(FRAMESIZE_CIF, 15);
+	return check_result("stream_control");
+}
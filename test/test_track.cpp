@@ -0,0 +1,360 @@
+// Host tests of the in-RAM track recorder
+#include "track.h"
+#include "check.h"
+#include "host.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#define ORIGIN_LAT_E7 108231000
+#define ORIGIN_LON_E7 1066297000
+
+static uint32_t now_ms = 1000;
+
+// Function to make a fix x_cm east and y_cm north of the origin, dt_ms after the previous one
+static gps_fix_t fix_at(double x_cm, double y_cm, uint32_t dt_ms)
+{
+	gps_fix_t fix;
+	memset(&fix, 0, sizeof(fix));
+	now_ms += dt_ms;
+	fix.version = 1;
+	fix.fix_ms = now_ms;
+	fix.lat_e7 = ORIGIN_LAT_E7 + lround(y_cm / 1.1132);
+	fix.lon_e7 = ORIGIN_LON_E7 + lround(x_cm / (1.1132 * cos(ORIGIN_LAT_E7 * 1e-7 * M_PI / 180)));
+	return fix;
+}
+
+// Function to decode every stored block, oldest first
+static std::vector<track_reader_t> read_all()
+{
+	std::vector<track_reader_t> points;
+	uint8_t block[TRACK_BLOCK_SIZE];
+	uint32_t seq = 0;
+	size_t len;
+	while ((len = track_copy_block(&seq, block)) > 0)
+	{
+		track_reader_t reader;
+		track_reader_init(&reader, block, len);
+		while (track_reader_next(&reader))
+		{
+			points.push_back(reader);
+		}
+		seq++;
+	}
+	return points;
+}
+
+// Standing still costs one point per TRACK_MAX_GAP_MS
+static void test_standing_still()
+{
+	uint32_t before = track_points();
+	for (int i = 0; i < 60; i++)
+	{
+		gps_fix_t fix = fix_at(0, 0, 1000);
+		track_add(&fix);
+	}
+	uint32_t stored = track_points() - before;
+	CHECK(stored >= 5 && stored <= 7);
+	std::vector<track_reader_t> points = read_all();
+	for (size_t i = 1; i < points.size(); i++)
+	{
+		CHECK(points[i].time_ms - points[i - 1].time_ms <= TRACK_MAX_GAP_MS);
+	}
+}
+
+// Every corner of a zigzag is kept, and the varint deltas decode to the exact input
+static void test_round_trip()
+{
+	std::vector<gps_fix_t> fixes;
+	for (int i = 0; i < 50; i++)
+	{
+		fixes.push_back(fix_at(i * 1000.0, i % 2 ? 500 : -500, 1000));
+	}
+	// Large and negative jumps need the long varint forms
+	fixes.push_back(fix_at(-4e7, 3e7, 300000));
+	fixes.push_back(fix_at(2e6, -1e6, 1));
+	fixes.push_back(fix_at(0, 0, 1000));
+	fixes.push_back(fix_at(1000, 0, 1000));
+
+	for (const gps_fix_t &fix : fixes)
+	{
+		track_add(&fix);
+	}
+	// All but the newest point are stored, the newest waits for the next fix
+	std::vector<track_reader_t> points = read_all();
+	size_t stored = fixes.size() - 1;
+	CHECK(points.size() >= stored);
+	for (size_t i = 0; i < stored && stored <= points.size(); i++)
+	{
+		const track_reader_t *point = &points[points.size() - stored + i];
+		CHECK_EQ(point->time_ms, fixes[i].fix_ms);
+		CHECK_EQ(point->lat_e7, fixes[i].lat_e7);
+		CHECK_EQ(point->lon_e7, fixes[i].lon_e7);
+	}
+}
+
+// When every block is used the oldest one is dropped, readers continue with the oldest left
+static void test_rollover()
+{
+	for (int i = 0; i < 3000; i++)
+	{
+		gps_fix_t fix = fix_at(i * 1000.0, i % 2 ? 500 : -500, 1000);
+		track_add(&fix);
+	}
+	CHECK(track_bytes() > (TRACK_BLOCKS_HEAP - 1) * (TRACK_BLOCK_SIZE - 16));
+	CHECK(track_bytes() <= TRACK_BLOCKS_HEAP * TRACK_BLOCK_SIZE);
+
+	uint8_t block[TRACK_BLOCK_SIZE];
+	uint32_t seq = 0;
+	CHECK(track_copy_block(&seq, block) > 0);
+	CHECK(seq > 0);
+	std::vector<track_reader_t> points = read_all();
+	CHECK_EQ(points.size(), track_points());
+	CHECK_EQ(points.back().time_ms, now_ms - 1000);
+	for (size_t i = 1; i < points.size(); i++)
+	{
+		CHECK(points[i].time_ms > points[i - 1].time_ms);
+	}
+}
+
+// Function to get the distance of (x, y) from the segment a-b, all in cm
+static double segment_distance(double x, double y, double ax, double ay, double bx, double by)
+{
+	double dx = bx - ax, dy = by - ay;
+	double len2 = dx * dx + dy * dy;
+	double t = len2 > 0 ? ((x - ax) * dx + (y - ay) * dy) / len2 : 0;
+	t = t < 0 ? 0 : t > 1 ? 1 : t;
+	return hypot(x - ax - t * dx, y - ay - t * dy);
+}
+
+// A corner sampled densely moves each point only a little off the line, the stored path must still follow it
+static void test_corner()
+{
+	std::vector<gps_fix_t> fixes;
+	fixes.push_back(fix_at(0, 0, TRACK_MAX_GAP_MS + 1)); // After a gap, so the start is stored
+	for (int i = 1; i <= 80; i++)
+	{
+		fixes.push_back(fix_at(i * 10.0, 0, 100)); // 8 m east every 10 cm at 1 m/s
+	}
+	for (int i = 1; i <= 80; i++)
+	{
+		fixes.push_back(fix_at(800, i * 10.0, 100)); // Then 8 m north
+	}
+	for (const gps_fix_t &fix : fixes)
+	{
+		track_add(&fix);
+	}
+	gps_fix_t end = fix_at(800, 810, TRACK_MAX_GAP_MS + 1); // After a gap, so the last point is stored
+	track_add(&end);
+
+	std::vector<track_reader_t> points;
+	for (const track_reader_t &p : read_all())
+	{
+		if (p.time_ms >= fixes[0].fix_ms)
+		{
+			points.push_back(p);
+		}
+	}
+	CHECK(points.size() >= 3 && points.size() <= 12);
+	double k = 1.1132 * cos(ORIGIN_LAT_E7 * 1e-7 * M_PI / 180);
+	std::vector<double> xs, ys;
+	for (const track_reader_t &p : points)
+	{
+		xs.push_back((p.lon_e7 - ORIGIN_LON_E7) * k);
+		ys.push_back((p.lat_e7 - ORIGIN_LAT_E7) * 1.1132);
+	}
+	for (size_t i = 0; i < fixes.size(); i++)
+	{
+		double x = (fixes[i].lon_e7 - ORIGIN_LON_E7) * k;
+		double y = (fixes[i].lat_e7 - ORIGIN_LAT_E7) * 1.1132;
+		double nearest = 1e9;
+		for (size_t j = 1; j < xs.size(); j++)
+		{
+			nearest = fmin(nearest, segment_distance(x, y, xs[j - 1], ys[j - 1], xs[j], ys[j]));
+		}
+		CHECK(nearest <= TRACK_TOLERANCE_CM + 1);
+	}
+}
+
+#define DAY_FIX_MS 100				   // 10 Hz, the fast GPS mode
+#define DAY_FIXES (24 * 3600 * 1000 / DAY_FIX_MS) // One day of driving
+#define DAY_NOISE_CM 30				   // GPS jitter around the true path
+#define GEOJSON_CHUNK 1024			   // TRACK_CHUNK_SIZE of the /track handler
+
+static uint32_t rand_state = 1;
+
+// Function to get a pseudo random number in [0, 1)
+static double random01()
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return (rand_state >> 8) / (double)(1 << 24);
+}
+
+// Function to drive a day around town: straight runs at 3 to 10 m/s, turns, and stops of up to two
+// minutes, sampled every DAY_FIX_MS with GPS jitter. Returns the fixes, one per sample
+static std::vector<gps_fix_t> drive_day()
+{
+	std::vector<gps_fix_t> fixes;
+	fixes.reserve(DAY_FIXES);
+	double x = 0, y = 0, heading = 0;
+	while (fixes.size() < DAY_FIXES)
+	{
+		double choice = random01();
+		int samples = 0;
+		double speed = 0, turn = 0; // cm and radians per sample
+		if (choice < 0.7)
+		{
+			samples = (5 + random01() * 55) * 1000 / DAY_FIX_MS;
+			speed = (300 + random01() * 700) * DAY_FIX_MS / 1000;
+		}
+		else if (choice < 0.85)
+		{
+			samples = (2 + random01() * 2) * 1000 / DAY_FIX_MS;
+			speed = 300.0 * DAY_FIX_MS / 1000;
+			turn = (random01() < 0.5 ? -1 : 1) * M_PI / 2 / samples;
+		}
+		else
+		{
+			samples = (5 + random01() * 115) * 1000 / DAY_FIX_MS;
+		}
+		for (int i = 0; i < samples && fixes.size() < DAY_FIXES; i++)
+		{
+			heading += turn;
+			x += speed * cos(heading);
+			y += speed * sin(heading);
+			fixes.push_back(fix_at(x + (random01() - 0.5) * 2 * DAY_NOISE_CM, y + (random01() - 0.5) * 2 * DAY_NOISE_CM, DAY_FIX_MS));
+		}
+	}
+	return fixes;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Function to export the track the way the /track handler does, counting the bytes instead of sending them.
+// points counts the GeoJSON coordinates, the binary form is not decoded
+static size_t export_track(bool binary, uint32_t *points)
+{
+	uint8_t block[TRACK_BLOCK_SIZE];
+	char chunk[GEOJSON_CHUNK];
+	size_t sent = 0, chunk_len = 0;
+	*points = 0;
+	uint32_t seq = 0;
+	size_t len;
+	while ((len = track_copy_block(&seq, block)) > 0)
+	{
+		seq++;
+		if (binary)
+		{
+			sent += 2 + len;
+			continue;
+		}
+		track_reader_t reader;
+		track_reader_init(&reader, block, len);
+		while (track_reader_next(&reader))
+		{
+			if (GEOJSON_CHUNK - chunk_len < 32)
+			{
+				sent += chunk_len;
+				chunk_len = 0;
+			}
+			chunk_len += snprintf(&chunk[chunk_len], GEOJSON_CHUNK - chunk_len, "%s[%.7f,%.7f]", *points ? "," : "",
+								  reader.lon_e7 / 1e7, reader.lat_e7 / 1e7);
+			(*points)++;
+		}
+	}
+	return sent + chunk_len;
+}
+
+// A day of driving at 10 Hz in the PSRAM recorder: memory per fix, whether the day fits, how close the
+// stored path stays to every fix, and how fast the whole track is exported in either format
+static void test_day()
+{
+	std::vector<gps_fix_t> fixes = drive_day();
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (const gps_fix_t &fix : fixes)
+	{
+		track_add(&fix);
+	}
+	double add_s = seconds_since(start);
+	std::vector<track_reader_t> points = read_all();
+	CHECK_EQ(points.size(), track_points());
+	uint32_t bytes = track_bytes();
+	double held_h = (points.back().time_ms - points.front().time_ms) / 3600000.0;
+	printf("24 h at %d Hz: %u fixes, %zu points stored in %u bytes (%.2f bytes per point, %.3f per fix, %.1f KB per hour),\n"
+		   "  %.1f h held in %d KB, %.0f ns per fix added\n",
+		   1000 / DAY_FIX_MS, (unsigned)fixes.size(), points.size(), bytes, (double)bytes / points.size(),
+		   (double)bytes / fixes.size(), bytes / 1024.0 / 24, held_h, TRACK_BLOCKS_PSRAM * TRACK_BLOCK_SIZE / 1024,
+		   add_s * 1e9 / fixes.size());
+	CHECK((double)bytes / points.size() < 8);
+	CHECK(held_h > 23.9);
+
+	// Every fix lies close to the stored segment around it. The newest fix is still pending
+	size_t segment = 0;
+	double k = 1.1132 * cos(ORIGIN_LAT_E7 * 1e-7 * M_PI / 180);
+	double worst = 0;
+	for (size_t i = 0; i + 1 < fixes.size(); i++)
+	{
+		const gps_fix_t *f = &fixes[i];
+		if (f->fix_ms < points.front().time_ms)
+		{
+			continue;
+		}
+		while (segment + 2 < points.size() && points[segment + 1].time_ms <= f->fix_ms)
+		{
+			segment++;
+		}
+		const track_reader_t *a = &points[segment], *b = &points[segment + 1];
+		worst = fmax(worst, segment_distance((f->lon_e7 - a->lon_e7) * k, (f->lat_e7 - a->lat_e7) * 1.1132, 0, 0,
+											 (b->lon_e7 - a->lon_e7) * k, (b->lat_e7 - a->lat_e7) * 1.1132));
+	}
+	CHECK(worst <= TRACK_TOLERANCE_CM + 1);
+
+	for (bool binary : {true, false})
+	{
+		uint32_t exported;
+		start = std::chrono::steady_clock::now();
+		size_t sent = export_track(binary, &exported);
+		double s = seconds_since(start);
+		printf("  export %-7s %8zu bytes in %6.2f ms: %7.1f MB/s, %6.2f M points/s\n", binary ? "binary" : "geojson", sent,
+			   s * 1000, sent / s / 1e6, points.size() / s / 1e6);
+		if (!binary)
+		{
+			CHECK_EQ(exported, points.size());
+		}
+		else
+		{
+			uint32_t blocks = 0, seq = 0;
+			uint8_t block[TRACK_BLOCK_SIZE];
+			while (track_copy_block(&seq, block) > 0)
+			{
+				seq++;
+				blocks++;
+			}
+			CHECK_EQ(sent, bytes + 2 * blocks);
+		}
+	}
+	printf("  worst distance of a fix from the stored path %.0f cm\n", worst);
+}
+
+int main(int argc, char **argv)
+{
+	// A day of driving needs the PSRAM sized recorder, it runs on its own (ctest track_day)
+	if (argc > 1 && !strcmp(argv[1], "day"))
+	{
+		host_psram_enable(true);
+		CHECK(track_init());
+		test_day();
+		return check_result("track day");
+	}
+	CHECK(track_init());
+	test_standing_still();
+	test_round_trip();
+	test_corner();
+	test_rollover();
+	return check_result("track");
+}
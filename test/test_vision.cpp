@@ -0,0 +1,222 @@
+// Host tests of the obstacle cue running next to the capture task, built together with vision.cpp
+#include "../vision.cpp"
+#include "check.h"
+#include "host.h"
+#include "esp_camera.h"
+#include "auto_drive.h"
+#include <chrono>
+#include <string.h>
+
+static volatile int cues = 0;
+static volatile uint8_t last_clear = 0;
+
+void car_uart_send(uint8_t cmd, uint8_t arg0, uint8_t arg1)
+{
+	if (cmd == CAR_CMD_VISION)
+	{
+		last_clear = arg1;
+		cues++;
+	}
+}
+
+// Vision and change detection share the one decode the capture task makes per frame
+static void test_shared_decode()
+{
+	camera_config_t config;
+	memset(&config, 0, sizeof(config));
+	config.pixel_format = PIXFORMAT_JPEG;
+	config.frame_size = FRAMESIZE_CIF;
+	CHECK_EQ(esp_camera_init(&config), ESP_OK);
+	CHECK(frame_ring_start());
+	CHECK(vision_start());
+	host_camera_set_gray(100);
+
+	vision_enable(true);
+	for (int i = 0; i < 50 && stats.frames < 5; i++)
+	{
+		vTaskDelay(pdMS_TO_TICKS(20));
+	}
+	vision_enable(false);
+	vTaskDelay(pdMS_TO_TICKS(200)); // Vision unsubscribes, the capture task goes to sleep
+
+	CHECK(stats.frames >= 5);
+	CHECK(cues >= 5);
+	CHECK_EQ(last_clear, 255); // An even floor is free up to the horizon
+	CHECK_EQ(stats.steer, 0);
+	CHECK_EQ(host_jpeg_decodes(), frame_ring_stats()->decode.count);
+	CHECK_EQ(host_jpeg_overlaps(), 0);
+}
+
+#define FIXTURE_W 80 // VGA at 1/8 scale
+#define FIXTURE_H 60
+#define FIXTURE_VARIANTS 20 // Renderings of each fixture with other noise, exposure and obstacle position
+
+// What the automatic mode does with a cue (auto_drive.h), the answer a fixture expects
+typedef enum
+{
+	CUE_STRAIGHT,
+	CUE_STOP,
+	CUE_LEFT,
+	CUE_RIGHT,
+} cue_decision_t;
+
+static const char *decision_names[] = {"straight", "stop", "left", "right"};
+
+// Structure for an object standing on the floor, columns x0..x1 - 1 and rows top..bottom of the thumbnail
+typedef struct
+{
+	int x0;
+	int x1;
+	int top;
+	int bottom;  // Row where it meets the floor
+	int luma;
+	bool soft;	 // Fades into the floor over its lowest rows, like a cushion or a shadow
+	bool offset; // luma is added to the floor instead of replacing it
+} fixture_object_t;
+
+// Structure for one scene in front of the car and what the car should do there
+typedef struct
+{
+	const char *name;
+	cue_decision_t expect;
+	int objects;
+	fixture_object_t object[2];
+} vision_fixture_t;
+
+static const vision_fixture_t fixtures[] = {
+	{"clear", CUE_STRAIGHT, 0, {}},
+	{"far box", CUE_STRAIGHT, 1, {{32, 48, 18, 30, 50, false, false}}},
+	{"glare", CUE_STRAIGHT, 1, {{38, 41, 45, 46, 250, false, false}}},
+	{"shadow", CUE_STRAIGHT, 1, {{0, 80, 40, 59, -25, true, true}}},
+	{"near box", CUE_STOP, 1, {{28, 52, 30, 55, 50, false, false}}},
+	{"low block", CUE_STOP, 1, {{30, 50, 50, 56, 60, false, false}}},
+	{"cushion", CUE_STOP, 1, {{28, 52, 40, 57, 170, true, false}}},
+	{"near wall", CUE_STOP, 1, {{0, 80, 0, 55, 170, false, false}}},
+	{"box left", CUE_RIGHT, 1, {{0, 30, 28, 50, 50, false, false}}},
+	{"box right", CUE_LEFT, 1, {{50, 80, 28, 50, 50, false, false}}},
+	{"two boxes", CUE_RIGHT, 2, {{0, 20, 30, 52, 45, false, false}, {58, 80, 26, 34, 55, false, false}}},
+};
+
+static uint32_t rand_state = 1;
+
+static int random_between(int low, int high)
+{
+	rand_state = rand_state * 1103515245 + 12345;
+	return low + (int)((rand_state >> 8) % (uint32_t)(high - low + 1));
+}
+
+// Function to render a fixture as the capture task would hand it over: a wall above the horizon,
+// a tiled floor getting lighter into the distance, the objects, sensor noise on everything
+static void render_fixture(const vision_fixture_t *fixture, int shift, int exposure, uint8_t *gray)
+{
+	for (int y = 0; y < FIXTURE_H; y++)
+	{
+		for (int x = 0; x < FIXTURE_W; x++)
+		{
+			int floor = y < FIXTURE_H * VISION_HORIZON_PCT / 100 ? 175 : 115 + (FIXTURE_H - 1 - y) * 2 / 5 - (y % 7 == 0) * 12;
+			int v = floor;
+			for (int i = 0; i < fixture->objects; i++)
+			{
+				const fixture_object_t *o = &fixture->object[i];
+				if (x < o->x0 + shift || x >= o->x1 + shift || y < o->top || y > o->bottom)
+				{
+					continue;
+				}
+				int target = o->offset ? floor + o->luma : o->luma;
+				int fade = o->soft && o->bottom - y < 4 ? o->bottom - y + 1 : 5; // Fifths of the way from the floor
+				v = floor + (target - floor) * fade / 5;
+			}
+			v += exposure + random_between(-5, 5);
+			gray[y * FIXTURE_W + x] = v < 0 ? 0 : v > 255 ? 255 : v;
+		}
+	}
+}
+
+// Function to work out the free space of each band from the geometry: up to the lowest object covering most of it
+static void fixture_free(const vision_fixture_t *fixture, int shift, uint8_t *free)
+{
+	int horizon = FIXTURE_H * VISION_HORIZON_PCT / 100;
+	for (int band = 0; band < VISION_COLUMNS; band++)
+	{
+		int x0 = FIXTURE_W * band / VISION_COLUMNS;
+		int x1 = FIXTURE_W * (band + 1) / VISION_COLUMNS;
+		int blocked = horizon - 1;
+		for (int i = 0; i < fixture->objects; i++)
+		{
+			const fixture_object_t *o = &fixture->object[i];
+			int covered = min(x1, o->x1 + shift) - max(x0, o->x0 + shift);
+			if (!o->offset && covered * 2 >= x1 - x0 && o->bottom >= horizon)
+			{
+				blocked = max(blocked, o->bottom);
+			}
+		}
+		free[band] = (FIXTURE_H - 1 - blocked) * 255 / (FIXTURE_H - horizon);
+	}
+}
+
+static cue_decision_t decide(int8_t steer, uint8_t clear)
+{
+	if (clear <= VISION_STOP_CLEAR)
+	{
+		return CUE_STOP;
+	}
+	return steer >= VISION_STEER_MIN ? CUE_RIGHT : steer <= -VISION_STEER_MIN ? CUE_LEFT : CUE_STRAIGHT;
+}
+
+// Every fixture in several renderings through vision_process: how often the cue leads the car to do the
+// right thing, how far the free space of the bands is off, and the time of one frame
+static void test_fixtures()
+{
+	static uint8_t gray[FIXTURE_W * FIXTURE_H];
+	shared_frame_t frame;
+	memset(&frame, 0, sizeof(frame));
+	frame.gray = gray;
+	frame.gray_w = FIXTURE_W;
+	frame.gray_h = FIXTURE_H;
+	int right = 0, total = 0;
+	std::chrono::nanoseconds slowest(0), all(0);
+	printf("fixture     expect    correct  band error  ns/frame\n");
+	for (const vision_fixture_t &fixture : fixtures)
+	{
+		int correct = 0;
+		int error = 0;
+		std::chrono::nanoseconds spent(0);
+		for (int v = 0; v < FIXTURE_VARIANTS; v++)
+		{
+			int shift = random_between(-2, 2);
+			render_fixture(&fixture, shift, random_between(-15, 15), gray);
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			CHECK(vision_process(&frame));
+			std::chrono::nanoseconds took = std::chrono::steady_clock::now() - start;
+			spent += took;
+			slowest = max(slowest, took);
+			correct += decide(stats.steer, stats.clear) == fixture.expect;
+			uint8_t free[VISION_COLUMNS];
+			fixture_free(&fixture, shift, free);
+			for (int band = 0; band < VISION_COLUMNS; band++)
+			{
+				error += abs(stats.free[band] - free[band]);
+			}
+		}
+		printf("%-11s %-8s %5d/%-3d %10.1f  %8lld\n", fixture.name, decision_names[fixture.expect], correct, FIXTURE_VARIANTS,
+			   (double)error / (FIXTURE_VARIANTS * VISION_COLUMNS), (long long)(spent.count() / FIXTURE_VARIANTS));
+		// An obstacle in front is never missed
+		if (fixture.expect == CUE_STOP)
+		{
+			CHECK_EQ(correct, FIXTURE_VARIANTS);
+		}
+		right += correct;
+		total += FIXTURE_VARIANTS;
+		all += spent;
+	}
+	printf("%d/%d cues right, %lld ns per frame, slowest %lld ns\n", right, total, (long long)(all.count() / total),
+		   (long long)slowest.count());
+	CHECK(right * 10 >= total * 9);
+}
+
+int main()
+{
+	test_shared_decode();
+	test_fixtures();
+	return check_result("vision");
+}
@@ -0,0 +1,244 @@
+#include "tinygps.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int from_hex(char c)
+{
+	if (c >= 'A' && c <= 'F')
+	{
+		return c - 'A' + 10;
+	}
+	if (c >= 'a' && c <= 'f')
+	{
+		return c - 'a' + 10;
+	}
+	return c - '0';
+}
+
+// Function to parse a decimal into hundredths, as the library does for time, speed, course and hdop
+static int32_t parse_decimal(const char *term)
+{
+	bool negative = *term == '-';
+	if (negative)
+	{
+		term++;
+	}
+	int32_t ret = 100 * (int32_t)atol(term);
+	while (isdigit((unsigned char)*term))
+	{
+		term++;
+	}
+	if (*term == '.' && isdigit((unsigned char)term[1]))
+	{
+		ret += 10 * (term[1] - '0');
+		if (isdigit((unsigned char)term[2]))
+		{
+			ret += term[2] - '0';
+		}
+	}
+	return negative ? -ret : ret;
+}
+
+// Function to parse ddmm.mmmm into whole degrees and billionths
+static void parse_degrees(const char *term, tinygps_degrees_t *deg)
+{
+	uint32_t left = atol(term);
+	uint32_t minutes = left % 100;
+	uint32_t multiplier = 10000000;
+	uint32_t ten_millionths = minutes * multiplier;
+	deg->deg = (uint16_t)(left / 100);
+	while (isdigit((unsigned char)*term))
+	{
+		term++;
+	}
+	if (*term == '.')
+	{
+		while (isdigit((unsigned char)*++term))
+		{
+			multiplier /= 10;
+			ten_millionths += (*term - '0') * multiplier;
+		}
+	}
+	deg->billionths = (5 * ten_millionths + 1) / 3;
+	deg->negative = false;
+}
+
+void TinyGPSLocation::commit()
+{
+	raw_lat = new_lat;
+	raw_lng = new_lng;
+	valid = updated = true;
+}
+
+double TinyGPSLocation::lat()
+{
+	updated = false;
+	double ret = raw_lat.deg + raw_lat.billionths / 1000000000.0;
+	return raw_lat.negative ? -ret : ret;
+}
+
+double TinyGPSLocation::lng()
+{
+	updated = false;
+	double ret = raw_lng.deg + raw_lng.billionths / 1000000000.0;
+	return raw_lng.negative ? -ret : ret;
+}
+
+bool TinyGPSPlus::encode(char c)
+{
+	encoded_chars++;
+	switch (c)
+	{
+	case ',':
+		parity ^= (uint8_t)c;
+		// fall through
+	case '\r':
+	case '\n':
+	case '*':
+	{
+		bool valid_sentence = false;
+		if (term_offset < sizeof(term))
+		{
+			term[term_offset] = 0;
+			valid_sentence = end_of_term();
+		}
+		term_number++;
+		term_offset = 0;
+		checksum_term = c == '*';
+		return valid_sentence;
+	}
+	case '$':
+		term_number = term_offset = 0;
+		parity = 0;
+		sentence_type = SENTENCE_OTHER;
+		checksum_term = false;
+		sentence_has_fix = false;
+		return false;
+	default:
+		if (term_offset < sizeof(term) - 1)
+		{
+			term[term_offset++] = c;
+		}
+		if (!checksum_term)
+		{
+			parity ^= (uint8_t)c;
+		}
+		return false;
+	}
+}
+
+// Function to handle the term that just ended, returns true for a sentence with a valid checksum
+bool TinyGPSPlus::end_of_term()
+{
+	if (checksum_term)
+	{
+		uint8_t checksum = 16 * from_hex(term[0]) + from_hex(term[1]);
+		if (checksum != parity)
+		{
+			failed_checksums++;
+			return false;
+		}
+		passed_checksums++;
+		if (sentence_has_fix)
+		{
+			sentences_with_fix++;
+		}
+		if (sentence_type == SENTENCE_RMC)
+		{
+			date.commit();
+			time.commit();
+			if (sentence_has_fix)
+			{
+				location.commit();
+				speed.commit();
+				course.commit();
+			}
+		}
+		else if (sentence_type == SENTENCE_GGA)
+		{
+			time.commit();
+			if (sentence_has_fix)
+			{
+				location.commit();
+			}
+			satellites.commit();
+			hdop.commit();
+		}
+		return true;
+	}
+
+	if (term_number == 0)
+	{
+		if (!strcmp(term, "GPRMC") || !strcmp(term, "GNRMC"))
+		{
+			sentence_type = SENTENCE_RMC;
+		}
+		else if (!strcmp(term, "GPGGA") || !strcmp(term, "GNGGA"))
+		{
+			sentence_type = SENTENCE_GGA;
+		}
+		else
+		{
+			sentence_type = SENTENCE_OTHER;
+		}
+		return false;
+	}
+	if (sentence_type == SENTENCE_OTHER || !term[0])
+	{
+		return false;
+	}
+
+	// Field numbers of RMC, then of GGA where they differ
+	bool rmc = sentence_type == SENTENCE_RMC;
+	int field = term_number;
+	if (field == 1)
+	{
+		time.new_val = parse_decimal(term);
+	}
+	else if (rmc && field == 2)
+	{
+		sentence_has_fix = term[0] == 'A';
+	}
+	else if (field == (rmc ? 3 : 2))
+	{
+		parse_degrees(term, &location.new_lat);
+	}
+	else if (field == (rmc ? 4 : 3))
+	{
+		location.new_lat.negative = term[0] == 'S';
+	}
+	else if (field == (rmc ? 5 : 4))
+	{
+		parse_degrees(term, &location.new_lng);
+	}
+	else if (field == (rmc ? 6 : 5))
+	{
+		location.new_lng.negative = term[0] == 'W';
+	}
+	else if (rmc && field == 7)
+	{
+		speed.new_val = parse_decimal(term);
+	}
+	else if (rmc && field == 8)
+	{
+		course.new_val = parse_decimal(term);
+	}
+	else if (rmc && field == 9)
+	{
+		date.new_val = atol(term);
+	}
+	else if (!rmc && field == 6)
+	{
+		sentence_has_fix = term[0] > '0';
+	}
+	else if (!rmc && field == 7)
+	{
+		satellites.new_val = atol(term);
+	}
+	else if (!rmc && field == 8)
+	{
+		hdop.new_val = parse_decimal(term);
+	}
+	return false;
+}
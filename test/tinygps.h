@@ -0,0 +1,103 @@
+/* Stand-in for TinyGPSPlus, the parser the GPS task used before nmea.cpp
+ *
+ * The library is not vendored here, so nmea_bench compares against this
+ * re-implementation of its encode() path (as in TinyGPSPlus 1.0.x): terms of
+ * at most 14 characters collected one byte at a time, an XOR parity, fields
+ * converted with atol() as they end, and the sentence's values committed
+ * when the checksum term matches. Only GGA and RMC from GP and GN talkers
+ * are decoded, and the fields are not checked beyond what atol() accepts.
+ * The API is the subset the firmware used.
+ */
+#pragma once
+
+#include <stdint.h>
+
+// Structure for a coordinate as the library keeps it
+typedef struct
+{
+	uint16_t deg;
+	uint32_t billionths;
+	bool negative;
+} tinygps_degrees_t;
+
+class TinyGPSLocation
+{
+public:
+	bool isValid() const { return valid; }
+	bool isUpdated() const { return updated; }
+	double lat();
+	double lng();
+
+private:
+	friend class TinyGPSPlus;
+	void commit();
+	bool valid = false;
+	bool updated = false;
+	tinygps_degrees_t raw_lat = {0, 0, false}, raw_lng = {0, 0, false};
+	tinygps_degrees_t new_lat = {0, 0, false}, new_lng = {0, 0, false};
+};
+
+// A value committed with its sentence: time (hhmmsscc), date, speed, course, satellites, hdop
+class TinyGPSValue
+{
+public:
+	bool isValid() const { return valid; }
+	bool isUpdated() const { return updated; }
+	uint32_t value()
+	{
+		updated = false;
+		return val;
+	}
+
+private:
+	friend class TinyGPSPlus;
+	void commit()
+	{
+		val = new_val;
+		valid = updated = true;
+	}
+	bool valid = false;
+	bool updated = false;
+	uint32_t val = 0, new_val = 0;
+};
+
+class TinyGPSPlus
+{
+public:
+	// Feed one byte, returns true when it completed a sentence with a valid checksum
+	bool encode(char c);
+
+	TinyGPSLocation location;
+	TinyGPSValue time;
+	TinyGPSValue date;
+	TinyGPSValue speed;
+	TinyGPSValue course;
+	TinyGPSValue satellites;
+	TinyGPSValue hdop;
+
+	uint32_t charsProcessed() const { return encoded_chars; }
+	uint32_t sentencesWithFix() const { return sentences_with_fix; }
+	uint32_t failedChecksum() const { return failed_checksums; }
+	uint32_t passedChecksum() const { return passed_checksums; }
+
+private:
+	enum
+	{
+		SENTENCE_GGA,
+		SENTENCE_RMC,
+		SENTENCE_OTHER
+	};
+	bool end_of_term();
+
+	uint8_t parity = 0;
+	bool checksum_term = false;
+	char term[15];
+	uint8_t sentence_type = SENTENCE_OTHER;
+	uint8_t term_number = 0;
+	uint8_t term_offset = 0;
+	bool sentence_has_fix = false;
+	uint32_t encoded_chars = 0;
+	uint32_t sentences_with_fix = 0;
+	uint32_t failed_checksums = 0;
+	uint32_t passed_checksums = 0;
+};
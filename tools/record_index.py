@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Look up frames of a recording from the car's microSD card.
+
+    python3 tools/record_index.py rec_0001.avi                  list every frame as CSV
+    python3 tools/record_index.py rec_0001.avi at 12.5 [out.jpg]    save the frame 12.5 s in
+    python3 tools/record_index.py rec_0001.avi near LAT LON [out.jpg]  save the frame closest to a position
+
+Reads the sidecar index (rec_0001.idx, see recorder.h) that the car writes
+next to each AVI file. It also works on a recording cut short by a power loss,
+whose AVI header and idx1 index were never written.
+"""
+import math
+import struct
+import sys
+
+MOVI_FOURCC_POS = 220  # Position of the 'movi' fourcc, the index offsets count from there
+RECORD = struct.Struct("<IIIIiiII")
+
+
+def read_index(avi_path):
+    with open(avi_path[:-4] + ".idx", "rb") as f:
+        header = f.read(8)
+        if header[:6] != b"CARIDX":
+            raise ValueError("not a car recording index")
+        frames = []
+        while True:
+            data = f.read(RECORD.size)
+            if len(data) < RECORD.size:
+                return frames
+            offset, size, time_ms, gps_version, lat_e7, lon_e7, gps_date, gps_time = RECORD.unpack(data)
+            frames.append({"offset": offset, "size": size, "time": time_ms / 1000.0, "gps": gps_version,
+                           "lat": lat_e7 / 1e7, "lon": lon_e7 / 1e7, "date": gps_date, "utc": gps_time})
+
+
+def save_frame(avi_path, frame, out_path):
+    with open(avi_path, "rb") as f:
+        f.seek(MOVI_FOURCC_POS + frame["offset"] + 8)  # Skip the '00dc' chunk header
+        jpeg = f.read(frame["size"])
+    with open(out_path, "wb") as f:
+        f.write(jpeg)
+    print("frame at %.3f s (%.7f, %.7f) saved to %s" % (frame["time"], frame["lat"], frame["lon"], out_path))
+
+
+def distance_m(lat1, lon1, lat2, lon2):
+    # Equirectangular approximation, plenty for picking the nearest frame
+    x = math.radians(lon2 - lon1) * math.cos(math.radians((lat1 + lat2) / 2))
+    y = math.radians(lat2 - lat1)
+    return math.hypot(x, y) * 6371000.0
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    avi_path = sys.argv[1]
+    frames = read_index(avi_path)
+    if not frames:
+        print("No frames recorded")
+        return
+
+    if len(sys.argv) == 2:
+        print("frame,time_s,offset,size,gps_version,lat,lon,date,utc")
+        for i, fr in enumerate(frames):
+            print("%d,%.3f,%d,%d,%d,%.7f,%.7f,%06d,%08d" % (i, fr["time"], fr["offset"], fr["size"], fr["gps"],
+                                                              fr["lat"], fr["lon"], fr["date"], fr["utc"]))
+    elif sys.argv[2] == "at":
+        t = float(sys.argv[3])
+        frame = min(frames, key=lambda fr: abs(fr["time"] - t))
+        save_frame(avi_path, frame, sys.argv[4] if len(sys.argv) > 4 else "frame.jpg")
+    elif sys.argv[2] == "near":
+        lat, lon = float(sys.argv[3]), float(sys.argv[4])
+        located = [fr for fr in frames if fr["gps"]]
+        if not located:
+            print("The recording has no GPS fix")
+            return
+        frame = min(located, key=lambda fr: distance_m(lat, lon, fr["lat"], fr["lon"]))
+        print("%.1f m from the requested position" % distance_m(lat, lon, frame["lat"], frame["lon"]))
+        save_frame(avi_path, frame, sys.argv[5] if len(sys.argv) > 5 else "frame.jpg")
+    else:
+        print(__doc__)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
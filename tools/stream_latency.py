@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Measure the latency of the car's MJPEG stream from a computer on the same network.
+
+    python3 tools/stream_latency.py 192.168.1.50 [seconds]
+
+Every part of the stream carries X-Timestamp (capture time on the car's clock),
+X-Frame-Seq and X-Frame-Age (time the frame waited on the car before it was
+sent). The car and this computer do not share a clock, so the receive latency
+is reported above the fastest frame seen: the minimum of (receive time -
+capture time) is taken as the fixed offset between the clocks plus the best
+case network delay. Sequence numbers the car captured but never sent are
+counted as dropped; this includes frames the car left out because the
+scene did not change (see X-Motion).
+"""
+import socket
+import sys
+import time
+
+
+def read_line(sock_file):
+    line = sock_file.readline()
+    if not line:
+        raise EOFError("stream closed")
+    return line.decode("latin-1").strip()
+
+
+def percentile(values, percent):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) * percent / 100))]
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    host = sys.argv[1]
+    duration = float(sys.argv[2]) if len(sys.argv) > 2 else 10.0
+
+    sock = socket.create_connection((host, 81), timeout=5)
+    sock.sendall(b"GET /stream HTTP/1.1\r\nHost: %s\r\n\r\n" % host.encode())
+    stream = sock.makefile("rb")
+    while read_line(stream):
+        pass  # HTTP response headers
+
+    offsets, ages = [], []
+    frames = dropped = 0
+    last_seq = None
+    start = time.monotonic()
+    while time.monotonic() - start < duration:
+        headers = {}
+        line = read_line(stream)
+        while line.startswith("--") or not line:
+            line = read_line(stream)  # Boundary and the blank lines around it
+        while line:
+            key, _, value = line.partition(":")
+            headers[key.strip().lower()] = value.strip()
+            line = read_line(stream)
+        stream.read(int(headers["content-length"]))
+        received = time.monotonic()
+
+        seq = int(headers.get("x-frame-seq", 0))
+        if last_seq is not None and seq > last_seq + 1:
+            dropped += seq - last_seq - 1
+        last_seq = seq
+        frames += 1
+        offsets.append(received - float(headers.get("x-timestamp", 0)))
+        ages.append(int(headers.get("x-frame-age", 0)) / 1000.0)
+    sock.close()
+
+    if not frames:
+        print("No frames received")
+        return
+    base = min(offsets)
+    latency = [(o - base) * 1000.0 for o in offsets]
+    elapsed = time.monotonic() - start
+    print("frames %d in %.1f s (%.1f fps), dropped sequence numbers %d" % (frames, elapsed, frames / elapsed, dropped))
+    print("queued on the car     p50 %6.1f ms  p99 %6.1f ms  max %6.1f ms" % (percentile(ages, 50), percentile(ages, 99), max(ages)))
+    print("receive above minimum p50 %6.1f ms  p99 %6.1f ms  max %6.1f ms" % (percentile(latency, 50), percentile(latency, 99), max(latency)))
+
+
+if __name__ == "__main__":
+    main()
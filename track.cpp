@@ -0,0 +1,270 @@
+#include "track.h"
+#include "Arduino.h"
+#include "freertos/semphr.h"
+
+#define CM_PER_E7 1.1132f // Length of 1e-7 degree of latitude in cm
+
+// Structure for one recorded point
+typedef struct
+{
+	uint32_t time_ms;
+	int32_t lat_e7;
+	int32_t lon_e7;
+} track_point_t;
+
+static SemaphoreHandle_t track_lock = NULL; // Guards the blocks against the /track export
+static uint8_t *blocks = NULL;
+static uint16_t *block_len = NULL;
+static uint16_t *block_points = NULL;
+static uint32_t block_count = 0;
+static uint32_t block_total = 0; // Blocks started since boot, the newest has sequence number block_total - 1
+
+// Simplification state, only used by the GPS task
+static track_point_t last;	  // Last stored point
+static track_point_t pending; // Newest point, stored only if the next one does not continue the line
+static track_point_t skipped[TRACK_MAX_SKIPPED]; // Points dropped since last, all must stay near the line
+static uint32_t skipped_count = 0;
+static bool has_last = false;
+static bool has_pending = false;
+
+// Function to append an unsigned varint, returns the number of bytes written
+static size_t put_varint(uint8_t *out, uint32_t value)
+{
+	size_t n = 0;
+	while (value >= 0x80)
+	{
+		out[n++] = (value & 0x7F) | 0x80;
+		value >>= 7;
+	}
+	out[n++] = value;
+	return n;
+}
+
+// Function to read an unsigned varint, returns false if the block ends in the middle of it
+static bool get_varint(track_reader_t *reader, uint32_t *value)
+{
+	uint32_t result = 0;
+	for (int shift = 0; shift < 35 && reader->p < reader->end; shift += 7)
+	{
+		uint8_t b = *reader->p++;
+		result |= (uint32_t)(b & 0x7F) << shift;
+		if (!(b & 0x80))
+		{
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+
+static uint32_t zigzag(int32_t value)
+{
+	return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value)
+{
+	return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// Function to get the distance of p from the segment a-c in cm (flat earth, fine over a few hundred meters)
+static float off_line_cm(const track_point_t *a, const track_point_t *p, const track_point_t *c)
+{
+	float k = cosf(a->lat_e7 * 1e-7f * (float)PI / 180) * CM_PER_E7;
+	float px = (p->lon_e7 - a->lon_e7) * k;
+	float py = (p->lat_e7 - a->lat_e7) * CM_PER_E7;
+	float cx = (c->lon_e7 - a->lon_e7) * k;
+	float cy = (c->lat_e7 - a->lat_e7) * CM_PER_E7;
+	float len2 = cx * cx + cy * cy;
+	float t = len2 > 0 ? (px * cx + py * cy) / len2 : 0;
+	t = constrain(t, 0.0f, 1.0f);
+	float dx = px - t * cx;
+	float dy = py - t * cy;
+	return sqrtf(dx * dx + dy * dy);
+}
+
+// Function to get the largest distance of the pending and skipped points from the segment last-c in cm
+static float max_off_line_cm(const track_point_t *c)
+{
+	float max_cm = off_line_cm(&last, &pending, c);
+	for (uint32_t i = 0; i < skipped_count; i++)
+	{
+		max_cm = max(max_cm, off_line_cm(&last, &skipped[i], c));
+	}
+	return max_cm;
+}
+
+// Function to write a point into the newest block, starting a new block (and dropping the oldest) when it is full
+static void store_point(const track_point_t *point)
+{
+	uint8_t delta[15];
+	size_t n = 0;
+	if (has_last)
+	{
+		n += put_varint(&delta[n], zigzag(point->lat_e7 - last.lat_e7));
+		n += put_varint(&delta[n], zigzag(point->lon_e7 - last.lon_e7));
+		n += put_varint(&delta[n], point->time_ms - last.time_ms);
+	}
+
+	xSemaphoreTake(track_lock, portMAX_DELAY);
+	uint32_t slot = (block_total - 1) % block_count;
+	if (!block_total || block_len[slot] + n > TRACK_BLOCK_SIZE)
+	{
+		slot = block_total++ % block_count;
+		uint8_t *header = &blocks[slot * TRACK_BLOCK_SIZE];
+		memcpy(header, &point->time_ms, 4);
+		memcpy(header + 4, &point->lat_e7, 4);
+		memcpy(header + 8, &point->lon_e7, 4);
+		block_len[slot] = TRACK_BLOCK_HEADER;
+		block_points[slot] = 1;
+	}
+	else
+	{
+		memcpy(&blocks[slot * TRACK_BLOCK_SIZE + block_len[slot]], delta, n);
+		block_len[slot] += n;
+		block_points[slot]++;
+	}
+	xSemaphoreGive(track_lock);
+
+	last = *point;
+	has_last = true;
+}
+
+bool track_init()
+{
+	block_count = psramFound() ? TRACK_BLOCKS_PSRAM : TRACK_BLOCKS_HEAP;
+	size_t size = block_count * TRACK_BLOCK_SIZE;
+	blocks = (uint8_t *)(psramFound() ? ps_malloc(size) : malloc(size));
+	block_len = (uint16_t *)calloc(block_count, sizeof(uint16_t));
+	block_points = (uint16_t *)calloc(block_count, sizeof(uint16_t));
+	track_lock = xSemaphoreCreateMutex();
+	if (!blocks || !block_len || !block_points || !track_lock)
+	{
+		Serial.println("Track memory allocation failed");
+		free(blocks);
+		blocks = NULL;
+		return false;
+	}
+	return true;
+}
+
+void track_add(const gps_fix_t *fix)
+{
+	if (!blocks)
+	{
+		return;
+	}
+	track_point_t point = {fix->fix_ms, fix->lat_e7, fix->lon_e7};
+	if (!has_last)
+	{
+		store_point(&point);
+		return;
+	}
+	// The pending point is kept if skipping it would move the line too far from it or from any point
+	// skipped before: a slow turn moves each point only a little off the line, but the corner a lot
+	if (has_pending)
+	{
+		if (point.time_ms - last.time_ms > TRACK_MAX_GAP_MS || skipped_count == TRACK_MAX_SKIPPED || max_off_line_cm(&point) > TRACK_TOLERANCE_CM)
+		{
+			store_point(&pending);
+			skipped_count = 0;
+		}
+		else
+		{
+			skipped[skipped_count++] = pending;
+		}
+	}
+	pending = point;
+	has_pending = true;
+}
+
+size_t track_copy_block(uint32_t *seq, uint8_t *buf)
+{
+	size_t len = 0;
+	if (!blocks)
+	{
+		return 0;
+	}
+	xSemaphoreTake(track_lock, portMAX_DELAY);
+	uint32_t oldest = block_total > block_count ? block_total - block_count : 0;
+	if (*seq < oldest)
+	{
+		*seq = oldest; // Dropped while the caller was busy, continue with the oldest one left
+	}
+	if (*seq < block_total)
+	{
+		uint32_t slot = *seq % block_count;
+		len = block_len[slot];
+		memcpy(buf, &blocks[slot * TRACK_BLOCK_SIZE], len);
+	}
+	xSemaphoreGive(track_lock);
+	return len;
+}
+
+uint32_t track_points()
+{
+	uint32_t points = 0;
+	if (!blocks)
+	{
+		return 0;
+	}
+	xSemaphoreTake(track_lock, portMAX_DELAY);
+	for (uint32_t i = 0; i < block_count; i++)
+	{
+		points += block_points[i];
+	}
+	xSemaphoreGive(track_lock);
+	return points;
+}
+
+uint32_t track_bytes()
+{
+	uint32_t bytes = 0;
+	if (!blocks)
+	{
+		return 0;
+	}
+	xSemaphoreTake(track_lock, portMAX_DELAY);
+	for (uint32_t i = 0; i < block_count; i++)
+	{
+		bytes += block_len[i];
+	}
+	xSemaphoreGive(track_lock);
+	return bytes;
+}
+
+void track_reader_init(track_reader_t *reader, const uint8_t *block, size_t len)
+{
+	reader->p = block;
+	reader->end = block + len;
+	reader->first = len >= TRACK_BLOCK_HEADER;
+	if (reader->first)
+	{
+		memcpy(&reader->time_ms, block, 4);
+		memcpy(&reader->lat_e7, block + 4, 4);
+		memcpy(&reader->lon_e7, block + 8, 4);
+		reader->p += TRACK_BLOCK_HEADER;
+	}
+	else
+	{
+		reader->p = reader->end;
+	}
+}
+
+bool track_reader_next(track_reader_t *reader)
+{
+	if (reader->first)
+	{
+		reader->first = false;
+		return true;
+	}
+	uint32_t dlat, dlon, dtime;
+	if (!get_varint(reader, &dlat) || !get_varint(reader, &dlon) || !get_varint(reader, &dtime))
+	{
+		return false;
+	}
+	reader->lat_e7 += unzigzag(dlat);
+	reader->lon_e7 += unzigzag(dlon);
+	reader->time_ms += dtime;
+	return true;
+}
@@ -0,0 +1,55 @@
+/* In-RAM recorder of the path driven by the car
+ *
+ * Fixes are stored in a fixed amount of memory, split into blocks. Each block
+ * starts with one absolute point (time ms since boot, lat/lon in 1e-7
+ * degrees, little endian) followed by points stored as varint deltas:
+ * zigzag dlat, zigzag dlon, dtime. When all blocks are used the oldest one is
+ * dropped. Points on a straight line are skipped as long as every one of them
+ * stays within TRACK_TOLERANCE_CM of the stored line, so driving straight or
+ * standing still costs almost nothing and corners are kept.
+ *
+ * The binary /track export is the list of blocks, each prefixed by its
+ * length as a little endian uint16.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gps.h"
+
+#define TRACK_BLOCK_SIZE 1024		  // Bytes per block
+#define TRACK_BLOCKS_PSRAM 256		  // 256 KB with PSRAM
+#define TRACK_BLOCKS_HEAP 8			  // 8 KB without
+#define TRACK_BLOCK_HEADER 12		  // Absolute time, latitude and longitude
+#define TRACK_TOLERANCE_CM 150		  // Largest distance of a skipped point from the stored line
+#define TRACK_MAX_GAP_MS 10000		  // Keep at least one point per interval, even when not moving
+#define TRACK_MAX_SKIPPED 64		  // Skipped points checked against the line, one is kept after that many
+
+// Structure to walk through the points of one block
+typedef struct
+{
+	const uint8_t *p;
+	const uint8_t *end;
+	uint32_t time_ms;
+	int32_t lat_e7;
+	int32_t lon_e7;
+	bool first; // Header point not returned yet
+} track_reader_t;
+
+// Function to allocate the track memory
+bool track_init();
+
+// Function to offer a new fix to the recorder (GPS task only)
+void track_add(const gps_fix_t *fix);
+
+// Copy the first block with a sequence number >= *seq into buf (TRACK_BLOCK_SIZE bytes).
+// *seq is set to the copied block, returns its length or 0 when there is no such block
+size_t track_copy_block(uint32_t *seq, uint8_t *buf);
+
+// Number of stored points and bytes used
+uint32_t track_points();
+uint32_t track_bytes();
+
+// Functions to decode a block copied by track_copy_block
+void track_reader_init(track_reader_t *reader, const uint8_t *block, size_t len);
+bool track_reader_next(track_reader_t *reader);
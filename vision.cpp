@@ -0,0 +1,144 @@
+#include "vision.h"
+#include "frame_ring.h"
+#include "car_protocol.h"
+#include "esp_timer.h"
+#include "Arduino.h"
+#include "freertos/task.h"
+
+void car_uart_send(uint8_t cmd, uint8_t arg0, uint8_t arg1);
+
+static TaskHandle_t vision_task = NULL;
+static volatile bool enabled = false;
+static vision_stats_t stats;
+
+// Function to measure the free space of one band, 0 (blocked right in front) .. 255 (clear to the horizon)
+static uint8_t band_free(const uint8_t *gray, size_t w, size_t h, size_t x0, size_t x1)
+{
+	size_t horizon = h * VISION_HORIZON_PCT / 100;
+	size_t bw = x1 - x0;
+	int floor = -1;
+	int prev = 0;
+	size_t y = h;
+	while (y-- > horizon)
+	{
+		const uint8_t *row = &gray[y * w];
+		int sum = 0;
+		for (size_t x = x0; x < x1; x++)
+		{
+			sum += row[x];
+		}
+		int mean = sum / (int)bw;
+		if (floor < 0)
+		{
+			floor = mean; // The bottom row is the floor under the bumper
+		}
+		else if (abs(mean - prev) > VISION_EDGE_DELTA || abs(mean - floor) > VISION_FLOOR_DELTA)
+		{
+			break;
+		}
+		prev = mean;
+	}
+	size_t scanned = h - 1 - y;
+	return scanned * 255 / (h - horizon);
+}
+
+// Function to analyze one frame and send the cue to the Arduino
+static bool vision_process(shared_frame_t *frame)
+{
+	// The capture task decoded the frame already, the JPEG decoder must not run here as well
+	size_t w = frame->gray_w;
+	size_t h = frame->gray_h;
+	if (w < VISION_COLUMNS * 2 || h < 8)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < VISION_COLUMNS; i++)
+	{
+		stats.free[i] = band_free(frame->gray, w, h, w * i / VISION_COLUMNS, w * (i + 1) / VISION_COLUMNS);
+	}
+
+	// Straight ahead is as clear as the worse of the two middle bands
+	int half = VISION_COLUMNS / 2;
+	uint8_t clear = min(stats.free[half - 1], stats.free[half]);
+	int left = 0;
+	int right = 0;
+	for (int i = 0; i < half - 1; i++)
+	{
+		left += stats.free[i];
+		right += stats.free[VISION_COLUMNS - 1 - i];
+	}
+	int steer = (right - left) * 100 / ((half - 1) * 255);
+	stats.steer = steer;
+	stats.clear = clear;
+	car_uart_send(CAR_CMD_VISION, (uint8_t)stats.steer, clear);
+	return true;
+}
+
+// Task that sends the obstacle cue while automatic mode is on
+static void vision_task_fn(void *arg)
+{
+	bool subscribed = false;
+	uint32_t last_seq = 0;
+	TickType_t last_wake = xTaskGetTickCount();
+	while (true)
+	{
+		if (!enabled)
+		{
+			if (subscribed)
+			{
+				frame_ring_want_thumbnails(false);
+				frame_ring_unsubscribe();
+				subscribed = false;
+			}
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			last_wake = xTaskGetTickCount();
+			continue;
+		}
+		if (!subscribed)
+		{
+			frame_ring_want_thumbnails(true);
+			frame_ring_subscribe(); // Keeps the camera capturing when nobody watches the stream
+			subscribed = true;
+		}
+
+		shared_frame_t *frame = frame_ring_acquire(last_seq, pdMS_TO_TICKS(1000 / VISION_RATE_HZ));
+		if (frame)
+		{
+			last_seq = frame->seq;
+			int64_t start = esp_timer_get_time();
+			bool ok = vision_process(frame);
+			frame_ring_release(frame);
+			if (ok)
+			{
+				latency_hist_add(&stats.process, esp_timer_get_time() - start);
+				stats.seq = last_seq;
+				stats.frames++;
+			}
+		}
+		vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(1000 / VISION_RATE_HZ));
+	}
+}
+
+bool vision_start()
+{
+	if (vision_task)
+	{
+		return true;
+	}
+	return xTaskCreatePinnedToCore(vision_task_fn, "vision", 4096, NULL, 3, &vision_task, tskNO_AFFINITY) == pdPASS;
+}
+
+void vision_enable(bool enable)
+{
+	enabled = enable;
+	if (enable && vision_task)
+	{
+		xTaskNotifyGive(vision_task);
+	}
+}
+
+const vision_stats_t *vision_stats()
+{
+	return &stats;
+}
@@ -0,0 +1,48 @@
+/* Camera obstacle cue for automatic mode
+ *
+ * While the Arduino drives by itself, a task takes the newest frame of the
+ * shared ring about VISION_RATE_HZ times per second. It works on the 1/8
+ * scale grayscale thumbnail the capture task decoded with the frame (see
+ * frame_ring.h). The image is split into VISION_COLUMNS vertical bands.
+ * Each band is scanned from the bottom row (the floor just in front of the
+ * car) up to the horizon. The scan
+ * stops at the first row with a strong edge, or at a row whose brightness
+ * differs too much from the floor. The rows passed are that band's free
+ * space. Low or soft obstacles the sonar does not see still interrupt the
+ * floor.
+ *
+ * The result is sent to the Arduino as a CAR_CMD_VISION frame:
+ *   arg0 = steering hint, int8 -100 (turn left) .. 100 (turn right)
+ *   arg1 = free space straight ahead, 0 (blocked) .. 255 (clear to the horizon)
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "latency_hist.h"
+
+#define VISION_RATE_HZ 10
+#define VISION_COLUMNS 8		// Vertical bands the free space is measured in
+#define VISION_HORIZON_PCT 40	// Rows above this share of the image height are never scanned
+#define VISION_EDGE_DELTA 18	// Mean luma step between two rows of a band that counts as an edge
+#define VISION_FLOOR_DELTA 40	// Luma difference from the floor under the car that is no longer floor
+
+// Structure for the result of the last processed frame and the cost of processing
+typedef struct
+{
+	uint32_t frames;		   // Frames processed
+	uint32_t seq;			   // Ring sequence number of the last processed frame
+	int8_t steer;			   // Last steering hint
+	uint8_t clear;			   // Last free space ahead
+	uint8_t free[VISION_COLUMNS]; // Free space of each band, left to right
+	latency_hist_t process;	   // Analysis of one frame, the decode is timed by the capture task
+} vision_stats_t;
+
+// Function to start the vision task, it sleeps until vision_enable(true)
+bool vision_start();
+
+// Function to turn the cue on in automatic mode and off in manual mode
+void vision_enable(bool enable);
+
+// Result and timing of the last processed frame, written by the vision task only
+const vision_stats_t *vision_stats();
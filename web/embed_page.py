@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Compress web/index.html into car_index.h for the ESP32 CAM web server.
+
+Run this after every change to index.html:
+    python3 web/embed_page.py
+The header keeps the same layout as camera_index.h and adds an ETag derived
+from the compressed bytes, so browsers only download the page again after it
+has actually changed.
+"""
+import gzip
+import os
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "index.html")
+TARGET = os.path.join(HERE, "..", "car_index.h")
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        html = f.read()
+    # mtime=0 keeps the output (and the ETag) stable between runs
+    data = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = "%08x" % zlib.crc32(data)
+
+    lines = [
+        "//File: index.html.gz, Size: %d " % len(data),
+        "// Generated by web/embed_page.py from web/index.html, do not edit",
+        "#define car_index_html_gz_len %d" % len(data),
+        '#define car_index_html_gz_etag "\\"%s\\""' % etag,
+        "const uint8_t car_index_html_gz[] = {",
+    ]
+    for i in range(0, len(data), 16):
+        lines.append(" " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    with open(TARGET, "w") as f:
+        f.write("\n".join(lines))
+    print("%s: %d -> %d bytes, ETag %s" % (os.path.basename(TARGET), len(html), len(data), etag))
+
+
+if __name__ == "__main__":
+    main()